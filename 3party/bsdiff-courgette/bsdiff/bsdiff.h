@@ -441,6 +441,9 @@ BSDiffStatus ApplyBinaryPatch(OldReader & old_reader,
 
   auto pending_diff_zeros = ReadVarUint<uint32_t>(diff_skips);
 
+  // Reused between blocks; one sink write per block instead of one per byte.
+  std::vector<uint8_t> copy_buf;
+
   while (control_stream_copy_counts.Size() > 0) {
     auto copy_count = ReadVarUint<uint32_t>(control_stream_copy_counts);
     auto extra_count = ReadVarUint<uint32_t>(control_stream_extra_counts);
@@ -456,6 +459,7 @@ BSDiffStatus ApplyBinaryPatch(OldReader & old_reader,
       return UNEXPECTED_ERROR;
 
     // Add together bytes from the 'old' file and the 'diff' stream.
+    copy_buf.resize(copy_count);
     for (size_t i = 0; i < copy_count; ++i) {
       uint8_t diff_byte = 0;
       if (pending_diff_zeros) {
@@ -464,9 +468,9 @@ BSDiffStatus ApplyBinaryPatch(OldReader & old_reader,
         pending_diff_zeros = ReadVarUint<uint32_t>(diff_skips);
         diff_byte = ReadPrimitiveFromSource<uint8_t>(diff_bytes);
       }
-      uint8_t byte = old_position[i] + diff_byte;
-      WriteToSink(new_sink, byte);
+      copy_buf[i] = old_position[i] + diff_byte;
     }
+    new_sink.Write(copy_buf.data(), copy_count);
     old_position += copy_count;
 
     // Copy bytes from the extra block.
@@ -0,0 +1,156 @@
+#include "base/alloc_tracker.hpp"
+
+#include <cstdlib>
+#include <new>
+#include <sstream>
+
+namespace
+{
+size_t constexpr kMaxScopeDepth = 16;
+
+struct ThreadState
+{
+  char const * m_tags[kMaxScopeDepth];
+  size_t m_depth = 0;
+  // Counters of the innermost scope. They are flushed to the global map only
+  // on scope switches to keep the per-allocation work to two additions.
+  uint64_t m_count = 0;
+  uint64_t m_bytes = 0;
+  // Protects the tracker from accounting its own allocations.
+  bool m_insideTracker = false;
+};
+
+thread_local ThreadState t_state;
+}  // namespace
+
+namespace base
+{
+// static
+AllocTracker & AllocTracker::Instance()
+{
+  static AllocTracker instance;
+  return instance;
+}
+
+void AllocTracker::EnterScope(char const * tag)
+{
+  auto & state = t_state;
+  FlushCurrentThread();
+  if (state.m_depth < kMaxScopeDepth)
+    state.m_tags[state.m_depth] = tag;
+  // Scopes deeper than kMaxScopeDepth are not tracked but are still counted
+  // to keep EnterScope/LeaveScope calls balanced.
+  ++state.m_depth;
+}
+
+void AllocTracker::LeaveScope()
+{
+  auto & state = t_state;
+  FlushCurrentThread();
+  if (state.m_depth != 0)
+    --state.m_depth;
+}
+
+void AllocTracker::OnAllocation(size_t bytes)
+{
+  auto & state = t_state;
+  if (state.m_insideTracker || state.m_depth == 0 || state.m_depth > kMaxScopeDepth)
+    return;
+
+  ++state.m_count;
+  state.m_bytes += bytes;
+}
+
+std::map<std::string, AllocTracker::TagStatistic> AllocTracker::GetStatistics() const
+{
+  auto & state = t_state;
+  state.m_insideTracker = true;
+  std::map<std::string, TagStatistic> result;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    result = m_stats;
+  }
+  state.m_insideTracker = false;
+  return result;
+}
+
+std::string AllocTracker::ToString() const
+{
+  std::ostringstream ss;
+  ss << "Allocations by tag:\n";
+  for (auto const & stat : GetStatistics())
+  {
+    ss << "  " << stat.first << ": count = " << stat.second.m_count
+       << ", bytes = " << stat.second.m_bytes << "\n";
+  }
+  return ss.str();
+}
+
+void AllocTracker::Reset()
+{
+  auto & state = t_state;
+  state.m_count = 0;
+  state.m_bytes = 0;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stats.clear();
+}
+
+void AllocTracker::FlushCurrentThread()
+{
+  auto & state = t_state;
+  if (state.m_count == 0 && state.m_bytes == 0)
+    return;
+
+  state.m_insideTracker = true;
+  if (state.m_depth != 0 && state.m_depth <= kMaxScopeDepth)
+    Add(state.m_tags[state.m_depth - 1], state.m_count, state.m_bytes);
+  state.m_count = 0;
+  state.m_bytes = 0;
+  state.m_insideTracker = false;
+}
+
+void AllocTracker::Add(char const * tag, uint64_t count, uint64_t bytes)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto & stat = m_stats[tag];
+  stat.m_count += count;
+  stat.m_bytes += bytes;
+}
+}  // namespace base
+
+#if defined(TRACK_ALLOCATIONS)
+// Replacement allocation functions reporting to the tracker. They are
+// defined only when allocation tracking is compiled in, so regular builds
+// keep the standard library implementation.
+void * operator new(std::size_t size)
+{
+  void * p = std::malloc(size == 0 ? 1 : size);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  base::AllocTracker::Instance().OnAllocation(size);
+  return p;
+}
+
+void * operator new[](std::size_t size) { return ::operator new(size); }
+
+void * operator new(std::size_t size, std::nothrow_t const &) noexcept
+{
+  void * p = std::malloc(size == 0 ? 1 : size);
+  if (p != nullptr)
+    base::AllocTracker::Instance().OnAllocation(size);
+  return p;
+}
+
+void * operator new[](std::size_t size, std::nothrow_t const & tag) noexcept
+{
+  return ::operator new(size, tag);
+}
+
+void operator delete(void * p) noexcept { std::free(p); }
+void operator delete[](void * p) noexcept { std::free(p); }
+void operator delete(void * p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void * p, std::size_t) noexcept { std::free(p); }
+void operator delete(void * p, std::nothrow_t const &) noexcept { std::free(p); }
+void operator delete[](void * p, std::nothrow_t const &) noexcept { std::free(p); }
+#endif
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace base
+{
+// Lightweight attribution of heap allocation traffic to tagged scopes.
+//
+// When the build defines TRACK_ALLOCATIONS, the replacement operator new in
+// alloc_tracker.cpp reports every allocation to the tracker, and
+// SCOPED_ALLOC_TAG("drape:tile") attributes allocations made by the current
+// thread inside the scope to the given tag. Without the define the macro
+// expands to nothing and the allocation operators are not replaced; the
+// class itself stays available for manual accounting in tests.
+//
+// Deallocations are deliberately not tracked: the goal is to attribute
+// allocation traffic between subsystems, not to find leaks.
+class AllocTracker
+{
+public:
+  struct TagStatistic
+  {
+    uint64_t m_count = 0;
+    uint64_t m_bytes = 0;
+  };
+
+  static AllocTracker & Instance();
+
+  // Attributes subsequent allocations of the current thread to |tag| until
+  // the matching LeaveScope call. Scopes nest and the innermost tag wins.
+  // |tag| must outlive the scope, string literals are expected.
+  void EnterScope(char const * tag);
+  void LeaveScope();
+
+  // Records a single allocation of |bytes| made by the current thread.
+  // Allocations outside of any tagged scope are not accounted.
+  void OnAllocation(size_t bytes);
+
+  // Returns the accumulated per-tag statistic. Counters of a scope become
+  // visible after the scope has been entered again or left.
+  std::map<std::string, TagStatistic> GetStatistics() const;
+
+  std::string ToString() const;
+  void Reset();
+
+private:
+  AllocTracker() = default;
+
+  // Moves the counters of the current thread's innermost scope to m_stats.
+  void FlushCurrentThread();
+  void Add(char const * tag, uint64_t count, uint64_t bytes);
+
+  mutable std::mutex m_mutex;
+  std::map<std::string, TagStatistic> m_stats;
+};
+
+class ScopedAllocTag
+{
+public:
+  explicit ScopedAllocTag(char const * tag) { AllocTracker::Instance().EnterScope(tag); }
+  ~ScopedAllocTag() { AllocTracker::Instance().LeaveScope(); }
+
+  ScopedAllocTag(ScopedAllocTag const &) = delete;
+  ScopedAllocTag & operator=(ScopedAllocTag const &) = delete;
+};
+}  // namespace base
+
+#define ALLOC_TAG_CONCAT_IMPL(x, y) x##y
+#define ALLOC_TAG_CONCAT(x, y) ALLOC_TAG_CONCAT_IMPL(x, y)
+
+#if defined(TRACK_ALLOCATIONS)
+#define SCOPED_ALLOC_TAG(tag) ::base::ScopedAllocTag ALLOC_TAG_CONCAT(allocTag, __LINE__)(tag)
+#else
+#define SCOPED_ALLOC_TAG(tag)
+#endif
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace base
+{
+// Bump-pointer arena for node based containers whose nodes all die together.
+// Individual deallocation is a no-op; the memory is returned at once when the
+// arena is destroyed or Reset() is called. It must outlive every container
+// which allocates from it.
+class MemoryArena
+{
+public:
+  explicit MemoryArena(size_t blockSize = kDefaultBlockSize) : m_blockSize(blockSize) {}
+
+  void * Allocate(size_t size, size_t alignment)
+  {
+    size_t offset = (m_offset + alignment - 1) / alignment * alignment;
+    if (m_blocks.empty() || offset + size > m_blocks.back().m_size)
+    {
+      size_t const blockSize = std::max(m_blockSize, size + alignment);
+      m_blocks.emplace_back(blockSize);
+      offset = 0;
+    }
+
+    void * p = m_blocks.back().m_data.get() + offset;
+    m_offset = offset + size;
+    return p;
+  }
+
+  // All containers allocating from the arena must be empty when Reset() is called.
+  void Reset()
+  {
+    m_blocks.clear();
+    m_offset = 0;
+  }
+
+private:
+  static size_t constexpr kDefaultBlockSize = 1 << 16;
+
+  struct Block
+  {
+    explicit Block(size_t size) : m_data(std::make_unique<uint8_t[]>(size)), m_size(size) {}
+
+    std::unique_ptr<uint8_t[]> m_data;
+    size_t m_size;
+  };
+
+  std::vector<Block> m_blocks;
+  size_t m_blockSize;
+  size_t m_offset = 0;
+};
+
+// Minimal STL allocator on top of MemoryArena.
+template <typename T>
+class ArenaAllocator
+{
+public:
+  using value_type = T;
+
+  explicit ArenaAllocator(MemoryArena & arena) : m_arena(&arena) {}
+
+  template <typename U>
+  ArenaAllocator(ArenaAllocator<U> const & rhs) : m_arena(rhs.m_arena)
+  {
+  }
+
+  T * allocate(size_t n)
+  {
+    return static_cast<T *>(m_arena->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T * /* p */, size_t /* n */) {}
+
+  bool operator==(ArenaAllocator const & rhs) const { return m_arena == rhs.m_arena; }
+  bool operator!=(ArenaAllocator const & rhs) const { return !(*this == rhs); }
+
+  template <typename U>
+  friend class ArenaAllocator;
+
+private:
+  MemoryArena * m_arena;
+};
+}  // namespace base
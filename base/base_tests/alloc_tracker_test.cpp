@@ -0,0 +1,67 @@
+#include "testing/testing.hpp"
+
+#include "base/alloc_tracker.hpp"
+
+namespace
+{
+// The tests exercise the manual accounting API: the replacement allocation
+// operators are compiled in only with TRACK_ALLOCATIONS.
+UNIT_TEST(AllocTracker_Smoke)
+{
+  auto & tracker = base::AllocTracker::Instance();
+  tracker.Reset();
+
+  tracker.EnterScope("test:outer");
+  tracker.OnAllocation(100);
+  tracker.OnAllocation(28);
+  tracker.LeaveScope();
+
+  auto const stats = tracker.GetStatistics();
+  TEST_EQUAL(stats.size(), 1, ());
+  auto const & stat = stats.at("test:outer");
+  TEST_EQUAL(stat.m_count, 2, ());
+  TEST_EQUAL(stat.m_bytes, 128, ());
+
+  tracker.Reset();
+  TEST(tracker.GetStatistics().empty(), ());
+}
+
+UNIT_TEST(AllocTracker_NestedScopes)
+{
+  auto & tracker = base::AllocTracker::Instance();
+  tracker.Reset();
+
+  tracker.EnterScope("test:outer");
+  tracker.OnAllocation(10);
+  {
+    tracker.EnterScope("test:inner");
+    tracker.OnAllocation(1);
+    tracker.OnAllocation(2);
+    tracker.LeaveScope();
+  }
+  tracker.OnAllocation(20);
+  tracker.LeaveScope();
+
+  auto const stats = tracker.GetStatistics();
+  TEST_EQUAL(stats.size(), 2, ());
+  TEST_EQUAL(stats.at("test:outer").m_count, 2, ());
+  TEST_EQUAL(stats.at("test:outer").m_bytes, 30, ());
+  TEST_EQUAL(stats.at("test:inner").m_count, 2, ());
+  TEST_EQUAL(stats.at("test:inner").m_bytes, 3, ());
+
+  tracker.Reset();
+}
+
+UNIT_TEST(AllocTracker_OutsideScope)
+{
+  auto & tracker = base::AllocTracker::Instance();
+  tracker.Reset();
+
+  // Allocations outside of any tagged scope are not accounted.
+  tracker.OnAllocation(1000);
+  tracker.EnterScope("test:scope");
+  tracker.LeaveScope();
+
+  TEST(tracker.GetStatistics().empty(), ());
+}
+}  // namespace
@@ -0,0 +1,43 @@
+#include "testing/testing.hpp"
+
+#include "base/arena_allocator.hpp"
+
+#include <cstdint>
+#include <map>
+#include <utility>
+
+namespace
+{
+UNIT_TEST(MemoryArena_Alignment)
+{
+  base::MemoryArena arena(64 /* blockSize */);
+
+  auto const * p1 = arena.Allocate(1 /* size */, 1 /* alignment */);
+  auto const * p2 = arena.Allocate(8 /* size */, 8 /* alignment */);
+  TEST_NOT_EQUAL(p1, p2, ());
+  TEST_EQUAL(reinterpret_cast<uintptr_t>(p2) % 8, 0, ());
+
+  // An allocation larger than the block size gets a dedicated block.
+  auto const * p3 = arena.Allocate(128 /* size */, 8 /* alignment */);
+  TEST_EQUAL(reinterpret_cast<uintptr_t>(p3) % 8, 0, ());
+}
+
+UNIT_TEST(ArenaAllocator_Map)
+{
+  base::MemoryArena arena;
+  using Allocator = base::ArenaAllocator<std::pair<int const, int>>;
+  Allocator alloc(arena);
+  std::map<int, int, std::less<int>, Allocator> m(alloc);
+
+  int constexpr kNumValues = 1000;
+  for (int i = 0; i < kNumValues; ++i)
+    m.emplace(i, i * i);
+
+  TEST_EQUAL(m.size(), static_cast<size_t>(kNumValues), ());
+  for (int i = 0; i < kNumValues; ++i)
+    TEST_EQUAL(m.at(i), i * i, ());
+
+  m.clear();
+  TEST(m.empty(), ());
+}
+}  // namespace
@@ -163,6 +163,24 @@ UNIT_TEST(CacheSmoke_6)
   TEST_EQUAL(v, std::vector<char>(8, 0), ());
 }
 
+UNIT_TEST(ConcurrentCacheSmoke)
+{
+  base::ConcurrentCache<uint32_t, char> cache(4 /* logCacheSize */, 1 /* logShardsCount */);
+
+  auto const doInit = [](uint32_t key, char & value) { value = 'a' + key % 26; };
+
+  TEST_EQUAL(cache.GetValue(0, doInit), 'a', ());
+  TEST_EQUAL(cache.GetValue(1, doInit), 'b', ());
+  TEST_EQUAL(cache.GetValue(0, doInit), 'a', ());
+
+  auto const stat = cache.GetStat();
+  TEST_EQUAL(stat.m_accesses, 3, ());
+  TEST_EQUAL(stat.m_misses, 2, ());
+
+  cache.Reset();
+  TEST_EQUAL(cache.GetStat().m_accesses, 0, ());
+}
+
 UNIT_TEST(Cache_Init)
 {
   base::Cache<uint32_t, char> cache;
@@ -19,6 +19,13 @@ public:
   {
   }
 
+  FifoCacheTest(size_t capacity, size_t memoryBudget,
+                typename FifoCache<Key, Value>::SizeFn const & sizeFn,
+                typename FifoCache<Key, Value>::Loader const & loader)
+      : m_cache(capacity, memoryBudget, sizeFn, loader)
+  {
+  }
+
   Value const & GetValue(Key const & key) { return m_cache.GetValue(key); }
   unordered_map<Key, Value> const & GetMap() const { return m_cache.m_map; }
   boost::circular_buffer<Key> const & GetFifo() const { return m_cache.m_fifo; }
@@ -81,6 +88,26 @@ UNIT_TEST(FifoCache)
   }
 }
 
+UNIT_TEST(FifoCache_MemoryBudget)
+{
+  using Key = int;
+  using Value = int;
+  // Every value weighs 10 bytes, the budget admits two values in addition to the current one.
+  FifoCacheTest<Key, Value> cache(100 /* capacity */, 20 /* memoryBudget */,
+                                  [](Value const &) { return size_t(10); } /* sizeFn */,
+                                  [](Key k, Value & v) { v = k; } /* loader */);
+
+  TEST_EQUAL(cache.GetValue(1), 1, ());
+  TEST_EQUAL(cache.GetValue(2), 2, ());
+  TEST_EQUAL(cache.GetValue(3), 3, ());
+  TEST(cache.IsValid(), ());
+  {
+    // The oldest value (1) is evicted: the budget fits two values when a third one is added.
+    unordered_map<Key, Value> expectedMap({{2 /* key */, 2 /* value */}, {3, 3}});
+    TEST_EQUAL(cache.GetMap(), expectedMap, ());
+  }
+}
+
 UNIT_TEST(FifoCache_LoaderCalls)
 {
   using Key = int;
@@ -5,6 +5,7 @@
 #include "base/macros.hpp"
 
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -78,12 +79,6 @@ namespace base
       }
     }
 
-  private:
-    inline size_t Index(KeyT const & key) const
-    {
-      return static_cast<size_t>(Hash(key) & m_hashMask);
-    }
-
     inline static uint32_t Hash(uint32_t x)
     {
       x = (x ^ 61) ^ (x >> 16);
@@ -98,6 +93,12 @@ namespace base
       return Hash(uint32_t(x) ^ uint32_t(x >> 32));
     }
 
+  private:
+    inline size_t Index(KeyT const & key) const
+    {
+      return static_cast<size_t>(Hash(key) & m_hashMask);
+    }
+
     // TODO: Consider using separate arrays for keys and values, to save on padding.
     struct Data
     {
@@ -137,6 +138,9 @@ namespace base
       return static_cast<double>(m_miss) / static_cast<double>(m_access);
     }
 
+    uint64_t GetAccessesCount() const { return m_access; }
+    uint64_t GetMissesCount() const { return m_miss; }
+
     uint32_t GetCacheSize() const { return m_cache.GetCacheSize(); }
 
     TValue & Find(TKey const & key, bool & found)
@@ -166,4 +170,100 @@ namespace base
     uint64_t m_miss;
     uint64_t m_access;
   };
+
+  // Sharded thread-safe cache. The key space is split between
+  // 2 ^ logShardsCount shards, each with its own lock and statistics, so
+  // accesses to different shards do not contend on a single mutex.
+  // Values are returned by copy because a reference into a shard is only
+  // valid under its lock.
+  template <typename TKey, typename TValue>
+  class ConcurrentCache
+  {
+    DISALLOW_COPY(ConcurrentCache);
+
+  public:
+    struct Stat
+    {
+      uint64_t m_accesses = 0;
+      uint64_t m_misses = 0;
+
+      double GetCacheMiss() const
+      {
+        if (m_accesses == 0)
+          return 0.0;
+        return static_cast<double>(m_misses) / static_cast<double>(m_accesses);
+      }
+    };
+
+    ConcurrentCache() = default;
+
+    /// @param[in] logCacheSize is pow of two for the total number of
+    /// elements in all shards; must be greater than |logShardsCount|.
+    ConcurrentCache(uint32_t logCacheSize, uint32_t logShardsCount)
+    {
+      Init(logCacheSize, logShardsCount);
+    }
+
+    void Init(uint32_t logCacheSize, uint32_t logShardsCount)
+    {
+      ASSERT_LESS(logShardsCount, logCacheSize, ());
+
+      m_shards.reset(new Shard[1 << logShardsCount]);
+      m_shardsMask = (1 << logShardsCount) - 1;
+      for (uint32_t i = 0; i <= m_shardsMask; ++i)
+        m_shards[i].m_cache.Init(logCacheSize - logShardsCount);
+    }
+
+    // Returns a copy of the value for |key|; on a miss |doInit| is called
+    // with (key, value &) under the shard lock to construct the value.
+    template <typename TDoInit>
+    TValue GetValue(TKey const & key, TDoInit && doInit)
+    {
+      auto & shard = GetShard(key);
+      std::lock_guard<std::mutex> lock(shard.m_mutex);
+      bool found;
+      TValue & value = shard.m_cache.Find(key, found);
+      if (!found)
+        doInit(key, value);
+      return value;
+    }
+
+    Stat GetStat() const
+    {
+      Stat stat;
+      for (uint32_t i = 0; i <= m_shardsMask; ++i)
+      {
+        auto & shard = m_shards[i];
+        std::lock_guard<std::mutex> lock(shard.m_mutex);
+        stat.m_accesses += shard.m_cache.GetAccessesCount();
+        stat.m_misses += shard.m_cache.GetMissesCount();
+      }
+      return stat;
+    }
+
+    void Reset()
+    {
+      for (uint32_t i = 0; i <= m_shardsMask; ++i)
+      {
+        auto & shard = m_shards[i];
+        std::lock_guard<std::mutex> lock(shard.m_mutex);
+        shard.m_cache.Reset();
+      }
+    }
+
+  private:
+    struct Shard
+    {
+      mutable std::mutex m_mutex;
+      CacheWithStat<TKey, TValue> m_cache;
+    };
+
+    Shard & GetShard(TKey const & key) const
+    {
+      return m_shards[Cache<TKey, TValue>::Hash(key) & m_shardsMask];
+    }
+
+    std::unique_ptr<Shard[]> m_shards;
+    uint32_t m_shardsMask = 0;
+  };
 }  // namespace base
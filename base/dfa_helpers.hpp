@@ -48,7 +48,9 @@ private:
 template <typename DFAIt, typename It>
 void DFAMove(DFAIt & it, It begin, It end)
 {
-  for (; begin != end; ++begin)
+  // The rejecting state is absorbing in all our DFAs, so the rest of
+  // the string can't change the outcome and is skipped.
+  for (; begin != end && !it.Rejects(); ++begin)
     it.Move(*begin);
 }
 
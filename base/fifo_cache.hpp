@@ -15,6 +15,7 @@ class FifoCache
 
 public:
   using Loader = std::function<void(Key const & key, Value & value)>;
+  using SizeFn = std::function<size_t(Value const & value)>;
 
   /// \param capacity maximum size of the cache in number of items.
   /// \param loader Function which is called if it's necessary to load a new item for the cache.
@@ -23,6 +24,20 @@ public:
   {
   }
 
+  /// \param capacity maximum size of the cache in number of items.
+  /// \param memoryBudget maximum approximate size of the cached values in bytes.
+  /// \param sizeFn Function which returns an approximate size of a value in bytes.
+  /// \param loader Function which is called if it's necessary to load a new item for the cache.
+  FifoCache(size_t capacity, size_t memoryBudget, SizeFn const & sizeFn, Loader const & loader)
+    : m_fifo(capacity)
+    , m_capacity(capacity)
+    , m_memoryBudget(memoryBudget)
+    , m_sizeFn(sizeFn)
+    , m_loader(loader)
+  {
+    CHECK(m_sizeFn, ());
+  }
+
   /// \brief Loads value, if it's necessary, by |key| with |m_loader|, puts it to cache and
   /// returns the reference to the value to |m_map|.
   Value const & GetValue(const Key & key)
@@ -32,23 +47,43 @@ public:
       return it->second;
 
     if (Size() >= m_capacity)
-    {
-      CHECK(!m_fifo.empty(), ());
-      m_map.erase(m_fifo.back());
-    }
+      EvictOldest();
 
     m_fifo.push_front(key);
 
     auto & v = m_map[key];
     m_loader(key, v);
+    if (m_sizeFn)
+    {
+      m_memory += m_sizeFn(v);
+      // The newest value is never evicted, so a single value bigger than the whole
+      // budget is still cached.
+      while (m_memory > m_memoryBudget && Size() > 1)
+        EvictOldest();
+    }
     return v;
   }
 
 private:
   size_t Size() const { return m_map.size(); }
 
+  void EvictOldest()
+  {
+    auto const it = m_map.find(m_fifo.back());
+    CHECK(it != m_map.end(), ());
+    if (m_sizeFn)
+      m_memory -= m_sizeFn(it->second);
+    m_map.erase(it);
+    m_fifo.pop_back();
+  }
+
   std::unordered_map<Key, Value> m_map;
   boost::circular_buffer<Key> m_fifo;
   size_t m_capacity;
+  // Zero means the cache is bounded by |m_capacity| only.
+  size_t m_memoryBudget = 0;
+  // Approximate size of the cached values in bytes.
+  size_t m_memory = 0;
+  SizeFn m_sizeFn;
   Loader m_loader;
 };
@@ -353,6 +353,10 @@ size_t LevenshteinDFA::ErrorsMade(State const & s) const
 
 size_t LevenshteinDFA::Move(size_t s, UniChar c) const
 {
+  // The rejecting state is absorbing, no need to search the alphabet.
+  if (IsRejecting(s))
+    return s;
+
   ASSERT_GREATER(m_alphabet.size(), 0, ());
   ASSERT(is_sorted(m_alphabet.begin(), m_alphabet.end() - 1), ());
 
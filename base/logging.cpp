@@ -8,13 +8,16 @@
 #include "std/target_os.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
 #include <map>
 #include <mutex>
+#include <queue>
 #include <sstream>
 
 using namespace std;
@@ -22,6 +25,94 @@ using namespace std;
 namespace
 {
 mutex g_logMutex;
+
+// Bounded queue of formatted log lines drained by a background writer
+// thread. The queue mutex is held only to move a string in or out, so
+// logging threads never wait on the output stream.
+class AsyncLogSink
+{
+public:
+  static size_t constexpr kMaxQueueSize = 2048;
+
+  static AsyncLogSink & Instance()
+  {
+    // Deliberately leaked: the writer thread runs until the process exits
+    // and must not outlive the queue it drains.
+    static AsyncLogSink * instance = new AsyncLogSink();
+    return *instance;
+  }
+
+  void Enable()
+  {
+    if (m_enabled.exchange(true))
+      return;
+    m_thread = threads::SimpleThread(&AsyncLogSink::ProcessMessages, this);
+    m_thread.detach();
+  }
+
+  // Returns false when asynchronous logging is not enabled; drops the
+  // message (and accounts it) when the queue is full.
+  bool Push(string && line)
+  {
+    if (!m_enabled.load(memory_order_acquire))
+      return false;
+
+    lock_guard<mutex> lock(m_mutex);
+    if (m_messages.size() >= kMaxQueueSize)
+      ++m_dropped;
+    else
+      m_messages.push(move(line));
+    m_condition.notify_one();
+    return true;
+  }
+
+  void Flush()
+  {
+    if (!m_enabled.load(memory_order_acquire))
+      return;
+
+    unique_lock<mutex> lock(m_mutex);
+    m_drained.wait(lock, [this]() { return m_messages.empty() && !m_writing; });
+  }
+
+private:
+  AsyncLogSink() = default;
+
+  void ProcessMessages()
+  {
+    threads::SetCurrentThreadPriority(threads::ThreadPriority::Background);
+    while (true)
+    {
+      string line;
+      size_t dropped = 0;
+      {
+        unique_lock<mutex> lock(m_mutex);
+        m_writing = false;
+        m_drained.notify_all();
+        m_condition.wait(lock, [this]() { return !m_messages.empty(); });
+        line = move(m_messages.front());
+        m_messages.pop();
+        dropped = m_dropped;
+        m_dropped = 0;
+        m_writing = true;
+      }
+
+      lock_guard<mutex> lock(g_logMutex);
+      if (dropped != 0)
+        cerr << "LOG: " << dropped << " message(s) were dropped on queue overflow." << endl;
+      cerr << line;
+    }
+  }
+
+  atomic<bool> m_enabled{false};
+  mutex m_mutex;
+  condition_variable m_condition;
+  condition_variable m_drained;
+  queue<string> m_messages;
+  size_t m_dropped = 0;
+  bool m_writing = false;
+  threads::SimpleThread m_thread;
+};
 }  // namespace
 
 namespace base
@@ -95,15 +186,30 @@ public:
 
 void LogMessageDefault(LogLevel level, SrcPoint const & srcPoint, string const & msg)
 {
-  lock_guard<mutex> lock(g_logMutex);
+  string line;
+  {
+    lock_guard<mutex> lock(g_logMutex);
 
-  static LogHelper logger;
+    static LogHelper logger;
 
-  ostringstream out;
-  logger.WriteProlog(out, level);
+    ostringstream out;
+    logger.WriteProlog(out, level);
 
-  out << DebugPrint(srcPoint) << msg << endl;
-  cerr << out.str();
+    out << DebugPrint(srcPoint) << msg << endl;
+    line = out.str();
+  }
+
+  auto & sink = AsyncLogSink::Instance();
+  if (level < g_LogAbortLevel && sink.Push(move(line)))
+    return;
+
+  // Messages which are about to abort the process are written in order
+  // and synchronously.
+  sink.Flush();
+  {
+    lock_guard<mutex> lock(g_logMutex);
+    cerr << line;
+  }
 
   CHECK_LESS(level, g_LogAbortLevel, ("Abort. Log level is too serious", level));
 }
@@ -119,6 +225,10 @@ void LogMessageTests(LogLevel level, SrcPoint const &, string const & msg)
   CHECK_LESS(level, g_LogAbortLevel, ("Abort. Log level is too serious", level));
 }
 
+void EnableAsyncLogging() { AsyncLogSink::Instance().Enable(); }
+
+void FlushLogs() { AsyncLogSink::Instance().Flush(); }
+
 LogMessageFn LogMessage = &LogMessageDefault;
 
 LogMessageFn SetLogMessageFn(LogMessageFn fn)
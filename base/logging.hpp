@@ -41,6 +41,18 @@ LogMessageFn SetLogMessageFn(LogMessageFn fn);
 void LogMessageDefault(LogLevel level, SrcPoint const & srcPoint, std::string const & msg);
 void LogMessageTests(LogLevel level, SrcPoint const & srcPoint, std::string const & msg);
 
+/// Makes LogMessageDefault enqueue formatted messages into a bounded buffer
+/// drained by a background writer thread instead of writing them to the
+/// output stream synchronously, so logging threads only pay for message
+/// formatting. When the buffer overflows, new messages are dropped and the
+/// writer reports how many were lost. Messages at or above g_LogAbortLevel
+/// are always flushed and written synchronously before abort. Once enabled,
+/// asynchronous logging stays on until the process exits.
+void EnableAsyncLogging();
+/// Blocks until all messages enqueued so far are written. No-op when
+/// asynchronous logging is not enabled.
+void FlushLogs();
+
 /// Scope Guard to temporarily suppress specific log level, for example, in unit tests:
 /// ...
 /// {
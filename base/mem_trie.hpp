@@ -6,13 +6,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
-#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
 
 namespace base
 {
+// Keeps subtrees ordered by their first characters, as a sorted vector.
+// Compared to a std::map this saves one heap allocation per child and
+// keeps the children of a node contiguous in memory, which matters for
+// the large tries built by search and the categories index.
 template <typename Char, typename Subtree>
 class MapMoves
 {
@@ -33,34 +36,37 @@ public:
 
   Subtree * GetSubtree(Char const & c) const
   {
-    auto const it = m_subtrees.find(c);
-    if (it == m_subtrees.end())
+    auto const it = Find(c);
+    if (it == m_subtrees.end() || it->first != c)
       return nullptr;
     return it->second.get();
   }
 
   Subtree & GetOrCreateSubtree(Char const & c, bool & created)
   {
-    auto & node = m_subtrees[c];
-    if (!node)
-    {
-      node = std::make_unique<Subtree>();
-      created = true;
-    }
-    else
+    auto const it = Find(c);
+    if (it != m_subtrees.end() && it->first == c)
     {
       created = false;
+      return *it->second;
     }
-    return *node;
+
+    created = true;
+    return *m_subtrees.emplace(it, c, std::make_unique<Subtree>())->second;
   }
 
   void AddSubtree(Char const & c, std::unique_ptr<Subtree> subtree)
   {
     ASSERT(!GetSubtree(c), ());
-    m_subtrees.emplace(c, move(subtree));
+    m_subtrees.emplace(Find(c), c, std::move(subtree));
   }
 
-  void EraseSubtree(Char const & c) { m_subtrees.erase(c); }
+  void EraseSubtree(Char const & c)
+  {
+    auto const it = Find(c);
+    if (it != m_subtrees.end() && it->first == c)
+      m_subtrees.erase(it);
+  }
 
   size_t Size() const { return m_subtrees.size(); }
   bool Empty() const { return Size() == 0; }
@@ -70,7 +76,24 @@ public:
   void Swap(MapMoves & rhs) { m_subtrees.swap(rhs.m_subtrees); }
 
 private:
-  std::map<Char, std::unique_ptr<Subtree>> m_subtrees;
+  using Entry = std::pair<Char, std::unique_ptr<Subtree>>;
+  using Entries = std::vector<Entry>;
+
+  typename Entries::iterator Find(Char const & c)
+  {
+    return std::lower_bound(
+        m_subtrees.begin(), m_subtrees.end(), c,
+        [](Entry const & entry, Char const & c) { return entry.first < c; });
+  }
+
+  typename Entries::const_iterator Find(Char const & c) const
+  {
+    return std::lower_bound(
+        m_subtrees.cbegin(), m_subtrees.cend(), c,
+        [](Entry const & entry, Char const & c) { return entry.first < c; });
+  }
+
+  Entries m_subtrees;
 };
 
 template <typename Char, typename Subtree>
@@ -22,6 +22,16 @@ void NormalizeInplace(strings::UniString & s)
 {
   size_t const size = s.size();
 
+  // Fast path: characters below U+00A0 are not changed by the
+  // decomposition below, so such strings need not be rebuilt at all.
+  {
+    size_t i = 0;
+    while (i < size && s[i] < 0xa0)
+      ++i;
+    if (i == size)
+      return;
+  }
+
   strings::UniString r;
   r.reserve(size);
   for (size_t i = 0; i < size; ++i)
@@ -5,6 +5,13 @@
 #include <chrono>
 #include <exception>
 
+#if defined(OMIM_OS_WINDOWS_NATIVE) || defined(OMIM_OS_WINDOWS_MINGW)
+#include "std/windows.hpp"
+#else
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
 #if defined(OMIM_OS_ANDROID)
 void AndroidThreadAttachToJVM();
 void AndroidThreadDetachFromJVM();
@@ -106,6 +113,21 @@ void Sleep(size_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms
 
 ThreadID GetCurrentThreadID() { return std::this_thread::get_id(); }
 
+void SetCurrentThreadPriority(ThreadPriority priority)
+{
+  bool const background = (priority == ThreadPriority::Background);
+#if defined(OMIM_OS_WINDOWS_NATIVE) || defined(OMIM_OS_WINDOWS_MINGW)
+  ::SetThreadPriority(::GetCurrentThread(),
+                      background ? THREAD_PRIORITY_BELOW_NORMAL : THREAD_PRIORITY_NORMAL);
+#elif defined(OMIM_OS_MAC) || defined(OMIM_OS_IPHONE)
+  ::setpriority(PRIO_DARWIN_THREAD, 0, background ? PRIO_DARWIN_BG : 0);
+#else
+  // On Linux and Android setpriority() with a zero id applies to the
+  // calling thread only.
+  ::setpriority(PRIO_PROCESS, 0, background ? 10 : 0);
+#endif
+}
+
 /////////////////////////////////////////////////////////////////////
 // SimpleThread implementation
 
@@ -99,6 +99,18 @@ using ThreadID = std::thread::id;
 
 ThreadID GetCurrentThreadID();
 
+enum class ThreadPriority
+{
+  // For maintenance work which must not compete with rendering and
+  // user-interactive threads for cpu time.
+  Background,
+  Normal
+};
+
+/// Sets the priority of the calling thread. Best effort: keeps the default
+/// priority on platforms and configurations which do not allow to change it.
+void SetCurrentThreadPriority(ThreadPriority priority);
+
 /// A wrapper around a std thread which executes callable object in thread which is attached to JVM
 /// Class has the same interface as std::thread
 class SimpleThread
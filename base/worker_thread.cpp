@@ -6,7 +6,8 @@ using namespace std;
 
 namespace base
 {
-WorkerThread::WorkerThread(size_t threadsCount)
+WorkerThread::WorkerThread(size_t threadsCount, threads::ThreadPriority priority)
+  : m_priority(priority)
 {
   for (size_t i = 0; i < threadsCount; ++i)
     m_threads.emplace_back(threads::SimpleThread(&WorkerThread::ProcessTasks, this));
@@ -41,6 +42,9 @@ bool WorkerThread::PushDelayed(Duration const & delay, Task const & t)
 
 void WorkerThread::ProcessTasks()
 {
+  if (m_priority != threads::ThreadPriority::Normal)
+    threads::SetCurrentThreadPriority(m_priority);
+
   ImmediateQueue pendingImmediate;
   DelayedQueue pendingDelayed;
 
@@ -31,7 +31,8 @@ public:
     SkipPending
   };
 
-  explicit WorkerThread(size_t threadsCount = 1);
+  explicit WorkerThread(size_t threadsCount = 1,
+                        threads::ThreadPriority priority = threads::ThreadPriority::Normal);
   ~WorkerThread() override;
 
   // Pushes task to the end of the thread's queue of immediate tasks.
@@ -107,6 +108,7 @@ private:
 
   void ProcessTasks();
 
+  threads::ThreadPriority const m_priority;
   std::vector<threads::SimpleThread> m_threads;
   std::mutex m_mu;
   std::condition_variable m_cv;
@@ -0,0 +1,140 @@
+#include "coding/async_file_writer.hpp"
+
+#include "base/logging.hpp"
+
+using namespace std;
+
+namespace
+{
+// Big enough to keep the disk busy with large sequential writes, small
+// enough that two buffers per writer do not matter for the generator.
+size_t const kBufferSize = 1 << 20;
+}  // namespace
+
+AsyncFileWriter::AsyncFileWriter(string const & fileName, Op operation)
+  : FileWriter(fileName, operation)
+{
+  m_pos = FileWriter::Pos();
+  m_buffer.reserve(kBufferSize);
+  m_flushing.reserve(kBufferSize);
+  m_thread = thread(&AsyncFileWriter::ThreadRoutine, this);
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+  try
+  {
+    Drain();
+  }
+  catch (exception const & e)
+  {
+    LOG(LERROR, ("Can't flush", GetName(), ":", e.what()));
+  }
+
+  {
+    lock_guard<mutex> lock(m_mutex);
+    m_done = true;
+  }
+  m_cv.notify_all();
+  m_thread.join();
+}
+
+void AsyncFileWriter::Seek(uint64_t pos)
+{
+  Drain();
+  FileWriter::Seek(pos);
+  m_pos = pos;
+}
+
+uint64_t AsyncFileWriter::Pos() const { return m_pos; }
+
+void AsyncFileWriter::Write(void const * p, size_t size)
+{
+  RethrowIfFailed();
+
+  uint8_t const * src = static_cast<uint8_t const *>(p);
+  m_buffer.insert(m_buffer.end(), src, src + size);
+  m_pos += size;
+
+  if (m_buffer.size() >= kBufferSize)
+    EnqueueFlush();
+}
+
+void AsyncFileWriter::Flush()
+{
+  Drain();
+  FileWriter::Flush();
+}
+
+void AsyncFileWriter::EnqueueFlush()
+{
+  if (m_buffer.empty())
+    return;
+
+  {
+    unique_lock<mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]() { return !m_flushPending; });
+    m_flushing.swap(m_buffer);
+    m_flushPending = true;
+  }
+  m_cv.notify_all();
+}
+
+void AsyncFileWriter::Drain()
+{
+  EnqueueFlush();
+
+  {
+    unique_lock<mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]() { return !m_flushPending; });
+  }
+  RethrowIfFailed();
+}
+
+void AsyncFileWriter::ThreadRoutine()
+{
+  while (true)
+  {
+    unique_lock<mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]() { return m_flushPending || m_done; });
+    if (m_flushPending)
+    {
+      // |m_flushing| belongs to this thread until the flag is dropped,
+      // so the actual write happens outside the lock.
+      lock.unlock();
+      try
+      {
+        FileWriter::Write(m_flushing.data(), m_flushing.size());
+      }
+      catch (...)
+      {
+        lock.lock();
+        m_error = current_exception();
+        m_flushing.clear();
+        m_flushPending = false;
+        m_cv.notify_all();
+        continue;
+      }
+
+      lock.lock();
+      m_flushing.clear();
+      m_flushPending = false;
+      m_cv.notify_all();
+      continue;
+    }
+
+    if (m_done)
+      return;
+  }
+}
+
+void AsyncFileWriter::RethrowIfFailed()
+{
+  exception_ptr error;
+  {
+    lock_guard<mutex> lock(m_mutex);
+    error.swap(m_error);
+  }
+  if (error)
+    rethrow_exception(error);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "coding/file_writer.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Sequential file writer that overlaps the caller's CPU work with disk
+// I/O: Write() only appends to an in-memory buffer and a background
+// thread flushes filled buffers to disk (double buffering). Pos() is
+// the logical stream position; Seek() is supported but stalls until
+// all pending data is written, so the writer only pays off for
+// append-mostly streams such as the generator's intermediate section
+// files. Not thread safe, same as FileWriter.
+class AsyncFileWriter : public FileWriter
+{
+public:
+  explicit AsyncFileWriter(std::string const & fileName, Op operation = OP_WRITE_TRUNCATE);
+  ~AsyncFileWriter() override;
+
+  // Writer overrides:
+  void Seek(uint64_t pos) override;
+  uint64_t Pos() const override;
+  void Write(void const * p, size_t size) override;
+
+  // Waits until everything written so far is handed to the OS and
+  // flushes the underlying file. Shadows the non-virtual
+  // FileWriter::Flush(), so call it on the most derived type.
+  void Flush();
+
+private:
+  // Hands the filled buffer over to the background thread.
+  void EnqueueFlush();
+  // Blocks until the background thread has no pending data.
+  void Drain();
+  void ThreadRoutine();
+  void RethrowIfFailed();
+
+  std::vector<uint8_t> m_buffer;    // filled by Write()
+  std::vector<uint8_t> m_flushing;  // owned by the background thread while |m_flushPending|
+  uint64_t m_pos = 0;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_flushPending = false;
+  bool m_done = false;
+  std::exception_ptr m_error;
+
+  std::thread m_thread;
+};
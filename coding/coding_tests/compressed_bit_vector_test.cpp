@@ -467,3 +467,69 @@ UNIT_TEST(CompressedBitVector_SparseLeaveFirstNBits)
   for (uint64_t bit = 0; bit < (1 << 10); ++bit)
     TEST(!cbv->GetBit(bit), (bit));
 }
+
+UNIT_TEST(CompressedBitVector_StreamingBuilder)
+{
+  {
+    coding::StreamingCBVBuilder builder;
+    auto cbv = builder.Build();
+    TEST(coding::CompressedBitVector::IsEmpty(cbv), ());
+  }
+
+  {
+    // Dense enough to cross the builder's bitmap threshold.
+    vector<uint64_t> setBits;
+    for (uint64_t i = 0; i < 10000; ++i)
+    {
+      if (i % 2 == 0)
+        setBits.push_back(i);
+    }
+    coding::StreamingCBVBuilder builder;
+    for (uint64_t pos : setBits)
+      builder.PushBitPosition(pos);
+    auto cbv = builder.Build();
+    TEST_EQUAL(coding::CompressedBitVector::StorageStrategy::Dense, cbv->GetStorageStrategy(), ());
+    TEST_EQUAL(setBits.size(), cbv->PopCount(), ());
+    for (uint64_t pos : setBits)
+      TEST(cbv->GetBit(pos), (pos));
+    TEST(!cbv->GetBit(1), ());
+
+    // The builder is reset after Build().
+    builder.PushBitPosition(3);
+    auto another = builder.Build();
+    TEST_EQUAL(another->PopCount(), 1, ());
+    TEST(another->GetBit(3), ());
+  }
+
+  {
+    // Goes dense in the middle but ends up sparse.
+    vector<uint64_t> setBits;
+    for (uint64_t i = 0; i < 2048; ++i)
+      setBits.push_back(i);
+    setBits.push_back(1 << 20);
+    coding::StreamingCBVBuilder builder;
+    for (uint64_t pos : setBits)
+      builder.PushBitPosition(pos);
+    auto cbv = builder.Build();
+    TEST_EQUAL(coding::CompressedBitVector::StorageStrategy::Sparse, cbv->GetStorageStrategy(), ());
+    TEST_EQUAL(setBits.size(), cbv->PopCount(), ());
+    for (uint64_t pos : setBits)
+      TEST(cbv->GetBit(pos), (pos));
+  }
+
+  {
+    // Stays sparse: positions are never converted to a bitmap.
+    coding::StreamingCBVBuilder builder;
+    vector<uint64_t> setBits;
+    for (uint64_t i = 0; i < 4096; ++i)
+    {
+      setBits.push_back(100 * i);
+      builder.PushBitPosition(100 * i);
+    }
+    auto cbv = builder.Build();
+    TEST_EQUAL(coding::CompressedBitVector::StorageStrategy::Sparse, cbv->GetStorageStrategy(), ());
+    TEST_EQUAL(setBits.size(), cbv->PopCount(), ());
+    for (uint64_t pos : setBits)
+      TEST(cbv->GetBit(pos), (pos));
+  }
+}
@@ -7,8 +7,12 @@
 #include "coding/buffer_reader.hpp"
 #include "coding/reader_streambuf.hpp"
 
+#include "std/algorithm.hpp"
 #include "std/iostream.hpp"
 #include "std/cstring.hpp"
+#include "std/functional.hpp"
+#include "std/thread.hpp"
+#include "std/vector.hpp"
 
 
 namespace
@@ -36,6 +40,41 @@ UNIT_TEST(FileReaderSmokeTest)
   FileWriter::DeleteFileX("reader_test_tmp.dat");
 }
 
+UNIT_TEST(FileReaderSharedCacheTest)
+{
+  string const name = "reader_test_tmp.dat";
+  vector<char> data(100000);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<char>(i * 2654435761);
+
+  {
+    FileWriter writer(name);
+    writer.Write(&data[0], data.size());
+  }
+
+  {
+    // Both readers share one page cache, concurrent reads are allowed.
+    FileReader reader1(name, 10 /* logPageSize */, 4 /* logPageCount */, true /* sharedCache */);
+    FileReader reader2(name, 10 /* logPageSize */, 4 /* logPageCount */, true /* sharedCache */);
+
+    auto const check = [&](FileReader const & reader)
+    {
+      for (size_t pos = 0; pos + 1000 <= data.size(); pos += 997)
+      {
+        vector<char> buf(1000);
+        reader.Read(pos, &buf[0], buf.size());
+        TEST(equal(buf.begin(), buf.end(), data.begin() + pos), (pos));
+      }
+    };
+
+    thread t1(check, ref(reader1));
+    thread t2(check, ref(reader2));
+    t1.join();
+    t2.join();
+  }
+  FileWriter::DeleteFileX(name);
+}
+
 UNIT_TEST(BufferReaderSmokeTest)
 {
   BufferReader r1(&kData[0], kData.size());
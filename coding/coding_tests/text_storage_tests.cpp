@@ -129,4 +129,38 @@ UNIT_TEST(TextStorage_Random)
   for (size_t i = ts.GetNumStrings() - 1; i < ts.GetNumStrings(); --i)
     TEST_EQUAL(ts.ExtractString(i), strings[i], ());
 }
+
+UNIT_TEST(TextStorage_ForEachString)
+{
+  int const kSeed = 20180116;
+  int const kNumStrings = 1000;
+  int const kBlockSize = 100;
+  mt19937 engine(kSeed);
+
+  vector<string> strings;
+  for (int i = 0; i < kNumStrings; ++i)
+    strings.push_back(GenerateRandomString(engine));
+
+  vector<uint8_t> buffer;
+  DumpStrings(strings, kBlockSize, buffer);
+
+  MemReader reader(buffer.data(), buffer.size());
+  BlockedTextStorage<decltype(reader)> ts(reader);
+
+  // Every third string, in increasing order, touching many more blocks
+  // than the decoded-block cache holds.
+  vector<size_t> indices;
+  for (size_t i = 0; i < strings.size(); i += 3)
+    indices.push_back(i);
+
+  size_t numExtracted = 0;
+  ts.ForEachString(indices, [&](size_t stringIx, string const & s)
+                   {
+                     TEST_EQUAL(s, strings[stringIx], (stringIx));
+                     ++numExtracted;
+                   });
+  TEST_EQUAL(numExtracted, indices.size(), ());
+
+  ts.ForEachString({} /* stringIndices */, [](size_t, string const &) { TEST(false, ()); });
+}
 }  // namespace
@@ -23,6 +23,10 @@ namespace
 
     size_t const bytesRead = src.PtrUC() - &data[0];
     TEST_EQUAL(bytesRead, data.size(), (x));
+
+    uint8_t const * p = &data[0];
+    TEST_EQUAL(ReadVarUint64FromBuffer(p), static_cast<uint64_t>(x), ());
+    TEST_EQUAL(static_cast<size_t>(p - &data[0]), data.size(), (x));
   }
 
   template <typename T> void TestVarInt(T const x)
@@ -36,6 +40,10 @@ namespace
 
     size_t const bytesRead = src.PtrUC() - &data[0];
     TEST_EQUAL(bytesRead, data.size(), (x));
+
+    uint8_t const * p = &data[0];
+    TEST_EQUAL(ReadVarInt64FromBuffer(p), static_cast<int64_t>(x), ());
+    TEST_EQUAL(static_cast<size_t>(p - &data[0]), data.size(), (x));
   }
 }
 
@@ -68,6 +68,37 @@ UNIT_TEST(ZipReaderSmoke)
   FileWriter::DeleteFileX(ZIPFILE);
 }
 
+UNIT_TEST(ZipMmapReaderSmoke)
+{
+  string const ZIPFILE = "smoke_test.zip";
+  {
+    FileWriter f(ZIPFILE);
+    f.Write(zipBytes, ARRAY_SIZE(zipBytes) - 1);
+  }
+
+  // test.txt is stored (not compressed), so the zero-copy reader is returned.
+  {
+    auto reader = ZipFileReader::CreateMmapReaderIfStored(ZIPFILE, "test.txt");
+    TEST(reader, ());
+    string s;
+    ReaderPtr<ModelReader>(move(reader)).ReadAsString(s);
+    TEST_EQUAL(s, "Test\n", ("Invalid zip file contents"));
+  }
+
+  bool noException = true;
+  try
+  {
+    ZipFileReader::CreateMmapReaderIfStored(ZIPFILE, "test");
+  }
+  catch (std::exception const &)
+  {
+    noException = false;
+  }
+  TEST(!noException, ());
+
+  FileWriter::DeleteFileX(ZIPFILE);
+}
+
 /// zip file with 3 files inside: 1.txt, 2.txt, 3.ttt
 static char const zipBytes2[] = "\x50\x4b\x3\x4\xa\x0\x0\x0\x0\x0\x92\x6b\xf6\x3e\x53\xfc\x51\x67\x2\x0\x0"
 "\x0\x2\x0\x0\x0\x5\x0\x1c\x0\x31\x2e\x74\x78\x74\x55\x54\x9\x0\x3\xd3\x50\x29\x4e\xd4\x50\x29\x4e\x75\x78"
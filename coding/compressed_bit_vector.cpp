@@ -31,6 +31,7 @@ struct IntersectOp
                                                      coding::SparseCBV const & b) const
   {
     vector<uint64_t> resPos;
+    resPos.reserve(b.PopCount());
     for (size_t i = 0; i < b.PopCount(); ++i)
     {
       auto pos = b.Select(i);
@@ -49,8 +50,32 @@ struct IntersectOp
   unique_ptr<coding::CompressedBitVector> operator()(coding::SparseCBV const & a,
                                                      coding::SparseCBV const & b) const
   {
+    if (a.PopCount() > b.PopCount())
+      return operator()(b, a);
+
     vector<uint64_t> resPos;
-    set_intersection(a.Begin(), a.End(), b.Begin(), b.End(), back_inserter(resPos));
+    resPos.reserve(a.PopCount());
+
+    // The geocoder often intersects a small candidate set with a huge
+    // posting list; in that case searching for the candidates in the
+    // larger vector is much faster than the linear merge.
+    size_t constexpr kAsymmetryFactor = 64;
+    if (b.PopCount() >= kAsymmetryFactor * a.PopCount())
+    {
+      auto it = b.Begin();
+      for (auto i = a.Begin(); i != a.End(); ++i)
+      {
+        it = lower_bound(it, b.End(), *i);
+        if (it == b.End())
+          break;
+        if (*it == *i)
+          resPos.push_back(*i);
+      }
+    }
+    else
+    {
+      set_intersection(a.Begin(), a.End(), b.Begin(), b.End(), back_inserter(resPos));
+    }
     return make_unique<coding::SparseCBV>(move(resPos));
   }
 };
@@ -113,6 +138,7 @@ struct SubtractOp
                                                      coding::SparseCBV const & b) const
   {
     vector<uint64_t> resPos;
+    resPos.reserve(a.PopCount());
     set_difference(a.Begin(), a.End(), b.Begin(), b.End(), back_inserter(resPos));
     return CompressedBitVectorBuilder::FromBitPositions(move(resPos));
   }
@@ -454,6 +480,55 @@ unique_ptr<CompressedBitVector> CompressedBitVectorBuilder::FromBitGroups(
   return make_unique<SparseCBV>(setBits);
 }
 
+void StreamingCBVBuilder::PushBitPosition(uint64_t pos)
+{
+  ASSERT(m_popCount == 0 || pos >= m_maxBit, (pos, m_maxBit));
+  m_maxBit = max(m_maxBit, pos);
+  ++m_popCount;
+
+  if (!m_bitGroups.empty())
+  {
+    SetBitInGroups(pos);
+    return;
+  }
+
+  m_positions.push_back(pos);
+
+  // Do not bother switching for small vectors: the positions are cheap
+  // and the density estimate is unstable while maxBit is still moving.
+  uint64_t const kMinPopCountToSwitch = 1024;
+  if (m_popCount >= kMinPopCountToSwitch && DenseEnough(m_popCount, m_maxBit))
+  {
+    m_bitGroups.reserve(m_maxBit / DenseCBV::kBlockSize + 1);
+    for (uint64_t position : m_positions)
+      SetBitInGroups(position);
+    m_positions.clear();
+    m_positions.shrink_to_fit();
+  }
+}
+
+void StreamingCBVBuilder::SetBitInGroups(uint64_t pos)
+{
+  size_t const i = static_cast<size_t>(pos / DenseCBV::kBlockSize);
+  if (i >= m_bitGroups.size())
+    m_bitGroups.resize(i + 1, 0);
+  m_bitGroups[i] |= static_cast<uint64_t>(1) << (pos % DenseCBV::kBlockSize);
+}
+
+unique_ptr<CompressedBitVector> StreamingCBVBuilder::Build()
+{
+  // FromBitGroups rechecks the density, so a vector that went dense in
+  // the middle but ended up sparse still gets the right representation.
+  auto result = m_bitGroups.empty()
+                    ? CompressedBitVectorBuilder::FromBitPositions(move(m_positions))
+                    : CompressedBitVectorBuilder::FromBitGroups(move(m_bitGroups));
+  m_positions.clear();
+  m_bitGroups.clear();
+  m_maxBit = 0;
+  m_popCount = 0;
+  return result;
+}
+
 string DebugPrint(CompressedBitVector::StorageStrategy strat)
 {
   switch (strat)
@@ -216,6 +216,31 @@ public:
   }
 };
 
+// Accumulates bit positions one by one and builds a CompressedBitVector
+// without materializing the full list of positions: as soon as the
+// accumulated bits are dense enough to be stored as a bitmap, the
+// positions are converted to bit groups and further bits are set
+// directly in them. This cuts the peak memory of building large dense
+// bit vectors (e.g. the per-token feature lists of the search index
+// during generation) from 8 bytes per set bit to 1 bit per position.
+// Positions must be pushed in non-decreasing order.
+class StreamingCBVBuilder
+{
+public:
+  void PushBitPosition(uint64_t pos);
+
+  // Builds the resulting bit vector and resets the builder.
+  unique_ptr<CompressedBitVector> Build();
+
+private:
+  void SetBitInGroups(uint64_t pos);
+
+  vector<uint64_t> m_positions;
+  vector<uint64_t> m_bitGroups;
+  uint64_t m_maxBit = 0;
+  uint64_t m_popCount = 0;
+};
+
 // ForEach is generic and therefore cannot be virtual: a helper class is needed.
 class CompressedBitVectorEnumerator
 {
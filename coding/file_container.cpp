@@ -1,6 +1,7 @@
 #include "coding/file_container.hpp"
 
 #include "coding/internal/file_data.hpp"
+#include "coding/mmap_reader.hpp"
 #include "coding/read_write_utils.hpp"
 #include "coding/varint.hpp"
 #include "coding/write_to_sink.hpp"
@@ -92,6 +93,21 @@ FilesContainerR::TReader FilesContainerR::GetReader(Tag const & tag) const
   return m_source.SubReader(p->m_offset, p->m_size);
 }
 
+void FilesContainerR::PrimeSection(Tag const & tag) const
+{
+  Info const * p = GetInfo(tag);
+  if (!p)
+    return;
+
+  uint64_t const kChunkSize = 1 << 20;
+  vector<uint8_t> buffer(static_cast<size_t>(min(kChunkSize, p->m_size)));
+  for (uint64_t pos = 0; pos < p->m_size; pos += kChunkSize)
+  {
+    size_t const size = static_cast<size_t>(min(kChunkSize, p->m_size - pos));
+    m_source.Read(p->m_offset + pos, buffer.data(), size);
+  }
+}
+
 pair<uint64_t, uint64_t> FilesContainerR::GetAbsoluteOffsetAndSize(Tag const & tag) const
 {
   Info const * p = GetInfo(tag);
@@ -272,6 +288,12 @@ void FilesMappingContainer::Handle::Assign(Handle && h)
   h.Reset();
 }
 
+void FilesMappingContainer::Handle::Advise(coding::MemoryAdvice advice) const
+{
+  if (IsValid())
+    coding::AdviseMemory(m_origBase, m_origSize, advice);
+}
+
 void FilesMappingContainer::Handle::Unmap()
 {
   if (IsValid())
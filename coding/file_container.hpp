@@ -13,6 +13,11 @@
 #include <utility>
 #include <vector>
 
+namespace coding
+{
+enum class MemoryAdvice;
+}
+
 class FilesContainerBase
 {
 public:
@@ -134,6 +139,11 @@ public:
 
   std::pair<uint64_t, uint64_t> GetAbsoluteOffsetAndSize(Tag const & tag) const;
 
+  /// Reads the section through once to pull its pages into the OS cache.
+  /// Intended for warming up hot sections of a freshly registered mwm on a
+  /// background thread; a missing section is silently skipped.
+  void PrimeSection(Tag const & tag) const;
+
 private:
   TReader m_source;
 };
@@ -170,6 +180,10 @@ public:
     bool IsValid() const { return (m_base != 0); }
     uint64_t GetSize() const { return m_size; }
 
+    /// Declares the expected access pattern of the mapped section, so the
+    /// kernel can schedule (or stop) readahead accordingly. Best-effort.
+    void Advise(coding::MemoryAdvice advice) const;
+
     template <typename T>
     T const * GetData() const
     {
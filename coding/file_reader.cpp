@@ -5,6 +5,10 @@
 
 #include "base/logging.hpp"
 
+#include <map>
+#include <mutex>
+#include <vector>
+
 #ifndef LOG_FILE_READER_STATS
 #define LOG_FILE_READER_STATS 0
 #endif // LOG_FILE_READER_STATS
@@ -30,6 +34,40 @@ public:
 private:
   uint64_t m_Size;
 };
+
+// Serializes raw disk reads of a shared file: FileData seeks and then
+// reads, which can't be interleaved from several threads on one
+// descriptor.
+class LockedFileData
+{
+public:
+  LockedFileData(FileDataWithCachedSize & fileData, mutex & m)
+    : m_fileData(fileData), m_mutex(m)
+  {
+  }
+
+  uint64_t Size() const { return m_fileData.Size(); }
+
+  void Read(uint64_t pos, void * p, size_t size)
+  {
+    lock_guard<mutex> lock(m_mutex);
+    m_fileData.Read(pos, p, size);
+  }
+
+private:
+  FileDataWithCachedSize & m_fileData;
+  mutex & m_mutex;
+};
+
+// A shared cache is sharded by page number across this many
+// independently locked caches, so concurrent readers only contend when
+// they touch the same pages. The pages of one private cache are spread
+// over the shards, the total cache size does not change.
+uint32_t const kSharedCacheLogShardCount = 2;
+// Total size of pages committed to shared caches. When the budget is
+// spent, new readers get private caches, i.e. the behaviour they had
+// before sharing was introduced.
+uint64_t const kSharedCacheByteBudget = 32 << 20;
 }  // namespace
 
 // static
@@ -40,9 +78,23 @@ uint32_t const FileReader::kDefaultLogPageCount = 4;
 class FileReader::FileReaderData
 {
 public:
-  FileReaderData(string const & fileName, uint32_t logPageSize, uint32_t logPageCount)
-    : m_fileData(fileName), m_readerCache(logPageSize, logPageCount)
+  FileReaderData(string const & fileName, uint32_t logPageSize, uint32_t logPageCount,
+                 bool threadSafe = false)
+    : m_fileData(fileName), m_lockedFileData(m_fileData, m_fileDataMutex), m_logPageSize(logPageSize)
   {
+    if (threadSafe)
+    {
+      uint32_t const logShardPageCount =
+          logPageCount > kSharedCacheLogShardCount ? logPageCount - kSharedCacheLogShardCount : 1;
+      for (size_t i = 0; i < size_t(1) << kSharedCacheLogShardCount; ++i)
+        m_shards.emplace_back(new Shard(logPageSize, logShardPageCount));
+    }
+    else
+    {
+      m_readerCache.reset(new ReaderCache<FileDataWithCachedSize, LOG_FILE_READER_STATS>(
+          logPageSize, logPageCount));
+    }
+
 #if LOG_FILE_READER_STATS
     m_readCallCount = 0;
 #endif
@@ -51,8 +103,49 @@ public:
   ~FileReaderData()
   {
 #if LOG_FILE_READER_STATS
-    LOG(LINFO, ("FileReader", m_fileData.GetName(), m_readerCache.GetStatsStr()));
+    if (m_readerCache)
+      LOG(LINFO, ("FileReader", m_fileData.GetName(), m_readerCache->GetStatsStr()));
 #endif
+
+    if (m_sharedCacheBytes != 0)
+    {
+      lock_guard<mutex> lock(s_sharedMutex);
+      s_sharedCacheBytes -= m_sharedCacheBytes;
+      // Another reader may have replaced the registry entry already.
+      auto const it = s_shared.find(m_fileData.GetName());
+      if (it != s_shared.end() && it->second.expired())
+        s_shared.erase(it);
+    }
+  }
+
+  static shared_ptr<FileReaderData> Create(string const & fileName, uint32_t logPageSize,
+                                           uint32_t logPageCount, bool sharedCache)
+  {
+    if (!sharedCache)
+      return make_shared<FileReaderData>(fileName, logPageSize, logPageCount);
+
+    uint32_t const logShardPageCount =
+        logPageCount > kSharedCacheLogShardCount ? logPageCount - kSharedCacheLogShardCount : 1;
+    uint64_t const cacheBytes = uint64_t(1)
+                                << (kSharedCacheLogShardCount + logShardPageCount + logPageSize);
+
+    lock_guard<mutex> lock(s_sharedMutex);
+    auto const it = s_shared.find(fileName);
+    if (it != s_shared.end())
+    {
+      if (auto data = it->second.lock())
+        return data;
+    }
+
+    if (s_sharedCacheBytes + cacheBytes > kSharedCacheByteBudget)
+      return make_shared<FileReaderData>(fileName, logPageSize, logPageCount);
+
+    auto data = make_shared<FileReaderData>(fileName, logPageSize, logPageCount,
+                                            true /* threadSafe */);
+    data->m_sharedCacheBytes = cacheBytes;
+    s_sharedCacheBytes += cacheBytes;
+    s_shared[fileName] = data;
+    return data;
   }
 
   uint64_t Size() const { return m_fileData.Size(); }
@@ -60,34 +153,82 @@ public:
   void Read(uint64_t pos, void * p, size_t size)
   {
 #if LOG_FILE_READER_STATS
-    if (((++m_readCallCount) & LOG_FILE_READER_EVERY_N_READS_MASK) == 0)
+    if (m_readerCache && ((++m_readCallCount) & LOG_FILE_READER_EVERY_N_READS_MASK) == 0)
     {
-      LOG(LINFO, ("FileReader", m_fileData.GetName(), m_readerCache.GetStatsStr()));
+      LOG(LINFO, ("FileReader", m_fileData.GetName(), m_readerCache->GetStatsStr()));
     }
 #endif
 
-    return m_readerCache.Read(m_fileData, pos, p, size);
+    if (m_readerCache)
+      return m_readerCache->Read(m_fileData, pos, p, size);
+
+    char * pDst = static_cast<char *>(p);
+    size_t const pageSize = size_t(1) << m_logPageSize;
+    while (size > 0)
+    {
+      uint64_t const pageNum = pos >> m_logPageSize;
+      size_t const pageOffset = static_cast<size_t>(pos & (pageSize - 1));
+      size_t const chunkSize = min(size, pageSize - pageOffset);
+      Shard & shard = *m_shards[static_cast<size_t>(pageNum) & (m_shards.size() - 1)];
+      {
+        lock_guard<mutex> lock(shard.m_mutex);
+        shard.m_cache.Read(m_lockedFileData, pos, pDst, chunkSize);
+      }
+      pos += chunkSize;
+      pDst += chunkSize;
+      size -= chunkSize;
+    }
   }
 
 private:
+  struct Shard
+  {
+    Shard(uint32_t logPageSize, uint32_t logPageCount) : m_cache(logPageSize, logPageCount) {}
+
+    mutex m_mutex;
+    ReaderCache<LockedFileData> m_cache;
+  };
+
+  static mutex s_sharedMutex;
+  static map<string, weak_ptr<FileReaderData>> s_shared;
+  static uint64_t s_sharedCacheBytes;
+
   FileDataWithCachedSize m_fileData;
-  ReaderCache<FileDataWithCachedSize, LOG_FILE_READER_STATS> m_readerCache;
+  mutex m_fileDataMutex;
+  LockedFileData m_lockedFileData;
+  uint32_t const m_logPageSize;
+
+  // Exactly one of these is used: the private cache for an exclusive
+  // reader, the sharded one for readers sharing this data.
+  unique_ptr<ReaderCache<FileDataWithCachedSize, LOG_FILE_READER_STATS>> m_readerCache;
+  vector<unique_ptr<Shard>> m_shards;
+
+  // This data's contribution to |s_sharedCacheBytes|, 0 for a private cache.
+  uint64_t m_sharedCacheBytes = 0;
 
 #if LOG_FILE_READER_STATS
   uint32_t m_readCallCount;
 #endif
 };
 
+// static
+mutex FileReader::FileReaderData::s_sharedMutex;
+// static
+map<string, weak_ptr<FileReader::FileReaderData>> FileReader::FileReaderData::s_shared;
+// static
+uint64_t FileReader::FileReaderData::s_sharedCacheBytes = 0;
+
 FileReader::FileReader(std::string const & fileName)
   : FileReader(fileName, kDefaultLogPageSize, kDefaultLogPageCount)
 {
 }
 
-FileReader::FileReader(string const & fileName, uint32_t logPageSize, uint32_t logPageCount)
+FileReader::FileReader(string const & fileName, uint32_t logPageSize, uint32_t logPageCount,
+                       bool sharedCache)
   : ModelReader(fileName)
   , m_logPageSize(logPageSize)
   , m_logPageCount(logPageCount)
-  , m_fileData(new FileReaderData(fileName, logPageSize, logPageCount))
+  , m_fileData(FileReaderData::Create(fileName, logPageSize, logPageCount, sharedCache))
   , m_offset(0)
   , m_size(m_fileData->Size())
 {
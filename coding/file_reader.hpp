@@ -19,7 +19,14 @@ public:
   static uint32_t const kDefaultLogPageCount;
 
   explicit FileReader(std::string const & fileName);
-  FileReader(std::string const & fileName, uint32_t logPageSize, uint32_t logPageCount);
+  /// With |sharedCache| all FileReaders of |fileName| share one page cache
+  /// (with per-shard locks, so such readers may be used concurrently) instead
+  /// of each keeping a private one. Use it only for files that are never
+  /// rewritten in place while readers exist, e.g. map files. Cache parameters
+  /// of the first opener win; when the total shared cache budget is spent,
+  /// the reader silently falls back to a private cache.
+  FileReader(std::string const & fileName, uint32_t logPageSize, uint32_t logPageCount,
+             bool sharedCache = false);
 
   // Reader overrides:
   uint64_t Size() const override { return m_size; }
@@ -372,7 +372,9 @@ void Decode(DecodeFunT fn, DeltasT const & deltas, GeometryCodingParams const &
 void const * LoadInner(DecodeFunT fn, void const * pBeg, size_t count,
                        GeometryCodingParams const & params, OutPointsT & points)
 {
-  DeltasT deltas;
+  // See the note about scratch reuse in DecodeImpl.
+  static thread_local DeltasT deltas;
+  deltas.clear();
   deltas.reserve(count);
   void const * ret =
       ReadVarUint64Array(static_cast<char const *>(pBeg), count, base::MakeBackInsertFunctor(deltas));
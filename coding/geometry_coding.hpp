@@ -174,7 +174,10 @@ void DecodeImpl(TDecodeFun fn, DeltasT const & deltas, GeometryCodingParams cons
 {
   size_t const count = deltas.size() * reserveF;
 
-  pts::PointsU upoints;
+  // The geometry of every feature in a tile is decoded through here,
+  // so the scratch is reused across calls instead of being reallocated
+  // per feature.
+  static thread_local pts::PointsU upoints;
   upoints.resize(count);
 
   coding::OutPointsT adapt(upoints);
@@ -186,8 +189,9 @@ void DecodeImpl(TDecodeFun fn, DeltasT const & deltas, GeometryCodingParams cons
     points.reserve(count);
   }
 
-  std::transform(upoints.begin(), upoints.begin() + adapt.size(), std::back_inserter(points),
-                 std::bind(&pts::U2D, std::placeholders::_1, params.GetCoordBits()));
+  uint32_t const coordBits = params.GetCoordBits();
+  for (size_t i = 0; i < adapt.size(); ++i)
+    points.push_back(pts::U2D(upoints[i], coordBits));
 }
 
 template <class TSink>
@@ -245,11 +249,15 @@ void LoadOuter(DecodeFunT fn, TSource & src, GeometryCodingParams const & params
                size_t reserveF = 1)
 {
   uint32_t const count = ReadVarUint<uint32_t>(src);
-  std::vector<char> buffer(count);
-  char * p = &buffer[0];
+
+  // See the note about scratch reuse in DecodeImpl.
+  static thread_local std::vector<char> buffer;
+  buffer.resize(count);
+  char * p = buffer.data();
   src.Read(p, count);
 
-  DeltasT deltas;
+  static thread_local DeltasT deltas;
+  deltas.clear();
   deltas.reserve(count / 2);
   ReadVarUint64Array(p, p + count, base::MakeBackInsertFunctor(deltas));
 
@@ -1,6 +1,7 @@
 #include "coding/mmap_reader.hpp"
 
 #include "std/target_os.hpp"
+#include "std/cstdint.hpp"
 #include "std/cstring.hpp"
 
 // @TODO we don't support windows at the moment
@@ -15,6 +16,31 @@
   #endif
 #endif
 
+namespace coding
+{
+void AdviseMemory(void const * p, uint64_t size, MemoryAdvice advice)
+{
+#ifndef OMIM_OS_WINDOWS
+  long const pageSize = sysconf(_SC_PAGE_SIZE);
+  uintptr_t const addr = reinterpret_cast<uintptr_t>(p);
+  uintptr_t const alignedAddr = (addr / pageSize) * pageSize;
+  size_t const length = static_cast<size_t>(size + (addr - alignedAddr));
+
+  int nativeAdvice = MADV_NORMAL;
+  switch (advice)
+  {
+  case MemoryAdvice::Normal: nativeAdvice = MADV_NORMAL; break;
+  case MemoryAdvice::Random: nativeAdvice = MADV_RANDOM; break;
+  case MemoryAdvice::Sequential: nativeAdvice = MADV_SEQUENTIAL; break;
+  case MemoryAdvice::WillNeed: nativeAdvice = MADV_WILLNEED; break;
+  }
+
+  // Best-effort: an advice that the kernel rejects is not an error.
+  madvise(reinterpret_cast<void *>(alignedAddr), length, nativeAdvice);
+#endif
+}
+}  // namespace coding
+
 class MmapReader::MmapData
 {
   int m_fd;
@@ -91,6 +117,11 @@ uint8_t * MmapReader::Data() const
   return m_data->m_memory;
 }
 
+void MmapReader::Advise(coding::MemoryAdvice advice) const
+{
+  coding::AdviseMemory(m_data->m_memory + m_offset, m_size, advice);
+}
+
 void MmapReader::SetOffsetAndSize(uint64_t offset, uint64_t size)
 {
   ASSERT_LESS_OR_EQUAL(offset + size, Size(), (offset, size));
@@ -4,6 +4,23 @@
 
 #include "std/shared_ptr.hpp"
 
+namespace coding
+{
+/// Expected access pattern of a mapped memory region, see madvise(2).
+/// Advising is best-effort: platforms without madvise ignore it.
+enum class MemoryAdvice
+{
+  Normal,
+  Random,      // No readahead, pages are faulted in one by one.
+  Sequential,  // Aggressive readahead, read pages may be dropped early.
+  WillNeed,    // Start asynchronous readahead of the whole region now.
+};
+
+/// Applies |advice| to [p, p + size). |p| does not have to be page-aligned,
+/// the region is extended to page boundaries internally.
+void AdviseMemory(void const * p, uint64_t size, MemoryAdvice advice);
+}  // namespace coding
+
 /// @TODO Add Windows support
 class MmapReader : public ModelReader
 {
@@ -26,6 +43,11 @@ public:
   /// Direct file/memory access
   uint8_t * Data() const;
 
+  /// Declares the access pattern of this reader's region. Sub-readers
+  /// advise only their own sub-region, so different sections of one file
+  /// can be advised differently.
+  void Advise(coding::MemoryAdvice advice) const;
+
 protected:
   // Used in special derived readers.
   void SetOffsetAndSize(uint64_t offset, uint64_t size);
@@ -65,6 +65,9 @@ public:
     return make_unique<MemReaderTemplate>(m_pData + pos, static_cast<size_t>(size));
   }
 
+  // Direct memory access.
+  inline char const * Data() const { return m_pData; }
+
 private:
   bool GoodPosAndSize(uint64_t pos, uint64_t size) const
   {
@@ -11,6 +11,8 @@
 #include <cstdint>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace coding
 {
@@ -231,34 +233,8 @@ public:
     auto const blockIx = m_index.GetBlockIx(stringIx);
     CHECK_LESS(blockIx, m_index.GetNumBlockInfos(), ());
 
-    if (blockIx >= m_cache.size())
-      m_cache.resize(blockIx + 1);
-    ASSERT_LESS(blockIx, m_cache.size(), ());
-
     auto const & bi = m_index.GetBlockInfo(blockIx);
-
-    auto & entry = m_cache[blockIx];
-    if (!entry.m_valid)
-    {
-      NonOwningReaderSource source(reader);
-      source.Skip(bi.m_offset);
-
-      entry.m_value.clear();
-      entry.m_subs.resize(bi.m_subs);
-
-      uint64_t offset = 0;
-      for (size_t i = 0; i < entry.m_subs.size(); ++i)
-      {
-        auto & sub = entry.m_subs[i];
-        sub.m_offset = offset;
-        sub.m_length = ReadVarUint<uint64_t>(source);
-        CHECK_GREATER_OR_EQUAL(sub.m_offset + sub.m_length, sub.m_offset, ());
-        offset += sub.m_length;
-      }
-      BWTCoder::ReadAndDecodeBlock(source, std::back_inserter(entry.m_value));
-      entry.m_valid = true;
-    }
-    ASSERT(entry.m_valid, ());
+    auto const & entry = GetCachedBlock(reader, blockIx, bi);
 
     ASSERT_GREATER_OR_EQUAL(stringIx, bi.From(), ());
     ASSERT_LESS(stringIx, bi.To(), ());
@@ -272,7 +248,24 @@ public:
     return value.substr(si.m_offset, si.m_length);
   }
 
-  void ClearCache() { m_cache.clear(); }
+  // Extracts the strings with sorted |stringIndices| and calls |fn|
+  // with (stringIx, string) for each of them. Sorted indices group
+  // the lookups by block, so each touched block is decompressed at
+  // most once per call even when more blocks are touched than the
+  // cache may hold.
+  template <typename Reader, typename Fn>
+  void ForEachString(Reader & reader, std::vector<size_t> const & stringIndices, Fn && fn)
+  {
+    ASSERT(std::is_sorted(stringIndices.begin(), stringIndices.end()), ());
+    for (auto const stringIx : stringIndices)
+      fn(stringIx, ExtractString(reader, stringIx));
+  }
+
+  void ClearCache()
+  {
+    m_cache.clear();
+    m_numCachedBlocks = 0;
+  }
 
 private:
   struct StringInfo
@@ -291,8 +284,52 @@ private:
     bool m_valid = false;
   };
 
+  // Returns the decoded block |blockIx|, decompressing it on a cache
+  // miss. When the number of decoded blocks reaches the bound, the
+  // whole cache is dropped: blocks are hundreds of KB when decoded
+  // and simple full eviction is good enough for the access patterns
+  // we have.
+  template <typename Reader>
+  CacheEntry const & GetCachedBlock(Reader & reader, size_t blockIx,
+                                    BlockedTextStorageIndex::BlockInfo const & bi)
+  {
+    size_t const kMaxCachedBlocks = 16;
+
+    if (blockIx < m_cache.size() && m_cache[blockIx].m_valid)
+      return m_cache[blockIx];
+
+    if (m_numCachedBlocks >= kMaxCachedBlocks)
+      ClearCache();
+
+    if (blockIx >= m_cache.size())
+      m_cache.resize(blockIx + 1);
+
+    auto & entry = m_cache[blockIx];
+
+    NonOwningReaderSource source(reader);
+    source.Skip(bi.m_offset);
+
+    entry.m_value.clear();
+    entry.m_subs.resize(bi.m_subs);
+
+    uint64_t offset = 0;
+    for (size_t i = 0; i < entry.m_subs.size(); ++i)
+    {
+      auto & sub = entry.m_subs[i];
+      sub.m_offset = offset;
+      sub.m_length = ReadVarUint<uint64_t>(source);
+      CHECK_GREATER_OR_EQUAL(sub.m_offset + sub.m_length, sub.m_offset, ());
+      offset += sub.m_length;
+    }
+    BWTCoder::ReadAndDecodeBlock(source, std::back_inserter(entry.m_value));
+    entry.m_valid = true;
+    ++m_numCachedBlocks;
+    return entry;
+  }
+
   BlockedTextStorageIndex m_index;
   std::vector<CacheEntry> m_cache;
+  size_t m_numCachedBlocks = 0;
   bool m_initialized = false;
 };
 
@@ -307,6 +344,13 @@ public:
 
   size_t GetNumStrings() const { return m_storage.GetNumStrings(); }
   std::string ExtractString(size_t stringIx) { return m_storage.ExtractString(m_reader, stringIx); }
+
+  template <typename Fn>
+  void ForEachString(std::vector<size_t> const & stringIndices, Fn && fn)
+  {
+    m_storage.ForEachString(m_reader, stringIndices, std::forward<Fn>(fn));
+  }
+
   void ClearCache() { m_storage.ClearCache(); }
 
 private:
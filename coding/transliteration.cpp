@@ -1,6 +1,7 @@
 #include "coding/transliteration.hpp"
 #include "coding/multilang_utf8_string.hpp"
 
+#include "base/fifo_cache.hpp"
 #include "base/logging.hpp"
 #include "base/string_utils.hpp"
 
@@ -15,6 +16,12 @@
 #include <cstring>
 #include <mutex>
 
+namespace
+{
+// Maximum number of cached transliteration results per language.
+size_t const kMaxCachedResults = 1024;
+}  // namespace
+
 struct Transliteration::TransliteratorInfo
 {
   TransliteratorInfo()
@@ -24,10 +31,14 @@ struct Transliteration::TransliteratorInfo
   std::atomic<bool> m_initialized;
   std::mutex m_mutex;
   std::unique_ptr<Transliterator> m_transliterator;
+  // Cache of transliteration results, guarded by m_mutex. An empty
+  // cached value means the transliteration failed for that string.
+  std::unique_ptr<FifoCache<std::string, std::string>> m_cache;
 };
 
 Transliteration::Transliteration()
-  : m_mode(Mode::Enabled)
+  : m_inited(false)
+  , m_mode(Mode::Enabled)
 {}
 
 Transliteration::~Transliteration()
@@ -60,6 +71,10 @@ void Transliteration::Init(std::string const & icuDataDir)
 
     m_transliterators.emplace(lang.m_transliteratorId, make_unique<TransliteratorInfo>());
   }
+
+  // Publishes m_transliterators to the threads which check m_inited below:
+  // the map is never modified after this point.
+  m_inited = true;
 }
 
 void Transliteration::SetMode(Transliteration::Mode mode)
@@ -69,7 +84,7 @@ void Transliteration::SetMode(Transliteration::Mode mode)
 
 bool Transliteration::Transliterate(std::string const & str, int8_t langCode, std::string & out) const
 {
-  if (m_mode != Mode::Enabled)
+  if (!m_inited || m_mode != Mode::Enabled)
     return false;
 
   if (str.empty() || strings::IsASCIIString(str))
@@ -102,7 +117,22 @@ bool Transliteration::Transliterate(std::string const & str, int8_t langCode, st
       it->second->m_transliterator.reset(Transliterator::createInstance(translitId, UTRANS_FORWARD, status));
 
       if (it->second->m_transliterator == nullptr)
+      {
         LOG(LWARNING, ("Cannot create transliterator \"", transliteratorId, "\", icu error =", status));
+      }
+      else
+      {
+        Transliterator * transliterator = it->second->m_transliterator.get();
+        it->second->m_cache = make_unique<FifoCache<std::string, std::string>>(
+            kMaxCachedResults, [transliterator](std::string const & s, std::string & result) {
+              UnicodeString ustr(s.c_str());
+              transliterator->transliterate(ustr);
+
+              result.clear();
+              if (!ustr.isEmpty())
+                ustr.toUTF8String(result);
+            });
+      }
 
       it->second->m_initialized = true;
     }
@@ -111,12 +141,9 @@ bool Transliteration::Transliterate(std::string const & str, int8_t langCode, st
   if (it->second->m_transliterator == nullptr)
     return false;
 
-  UnicodeString ustr(str.c_str());
-  it->second->m_transliterator->transliterate(ustr);
-
-  if (ustr.isEmpty())
-    return false;
-
-  ustr.toUTF8String(out);
-  return true;
+  // The lock both guards the cache and serializes the use of the ICU
+  // transliterator, which is not thread-safe by itself.
+  std::lock_guard<std::mutex> lock(it->second->m_mutex);
+  out = it->second->m_cache->GetValue(str);
+  return !out.empty();
 }
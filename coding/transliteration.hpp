@@ -18,6 +18,8 @@ public:
 
   static Transliteration & Instance();
 
+  // May be called from any thread; Transliterate() returns false until
+  // the initialization is finished.
   void Init(std::string const & icuDataDir);
 
   void SetMode(Mode mode);
@@ -26,6 +28,7 @@ public:
 private:
   Transliteration();
 
+  std::atomic<bool> m_inited;
   std::atomic<Mode> m_mode;
 
   struct TransliteratorInfo;
@@ -178,6 +178,33 @@ template <typename T, typename TSource> T ReadVarInt(TSource & src)
   return bits::ZigZagDecode(ReadVarUint<std::make_unsigned_t<T>>(src));
 }
 
+/// Reads one varint directly from an in-memory buffer and advances |p|.
+/// Unlike ReadVarUint() this does not go through a source object, and the
+/// single-byte case, which dominates delta-coded sequences, returns without
+/// entering the continuation loop. Prefer it in hot loops that interleave
+/// varints with fixed-width fields and therefore cannot use the block
+/// readers below (ReadVarUint64Array() and friends).
+inline uint64_t ReadVarUint64FromBuffer(uint8_t const *& p)
+{
+  uint8_t t = *p++;
+  uint64_t res = t & 127;
+  if (!(t & 128))
+    return res;
+  uint32_t shift = 7;
+  do
+  {
+    t = *p++;
+    res |= static_cast<uint64_t>(t & 127) << shift;
+    shift += 7;
+  } while (t & 128);
+  return res;
+}
+
+inline int64_t ReadVarInt64FromBuffer(uint8_t const *& p)
+{
+  return bits::ZigZagDecode(ReadVarUint64FromBuffer(p));
+}
+
 DECLARE_EXCEPTION(ReadVarIntException, RootException);
 
 namespace impl
@@ -4,6 +4,7 @@
 #include "base/logging.hpp"
 
 #include "coding/constants.hpp"
+#include "coding/mmap_reader.hpp"
 
 #include "std/bind.hpp"
 
@@ -38,8 +39,50 @@ private:
   string const m_path;
   bool m_completed;
 };
+// Window into the mapped zip container for a stored entry.
+class ZipMmapReader : public MmapReader
+{
+public:
+  ZipMmapReader(string const & container, uint64_t offset, uint64_t size) : MmapReader(container)
+  {
+    SetOffsetAndSize(offset, size);
+  }
+};
 }  // namespace
 
+// static
+unique_ptr<ModelReader> ZipFileReader::CreateMmapReaderIfStored(string const & container,
+                                                                string const & file)
+{
+  unzFile zip = unzOpen64(container.c_str());
+  if (!zip)
+    MYTHROW(OpenZipException, ("Can't get zip file handle", container));
+
+  SCOPE_GUARD(zipGuard, bind(&unzClose, zip));
+
+  if (UNZ_OK != unzLocateFile(zip, file.c_str(), 1))
+    MYTHROW(LocateZipException, ("Can't locate file inside zip", file));
+
+  unz_file_info64 fileInfo;
+  if (UNZ_OK != unzGetCurrentFileInfo64(zip, &fileInfo, NULL, 0, NULL, 0, NULL, 0))
+    MYTHROW(LocateZipException, ("Can't get file info inside zip", file));
+
+  if (fileInfo.compression_method != 0 /* stored */)
+    return unique_ptr<ModelReader>();
+
+  if (UNZ_OK != unzOpenCurrentFile(zip))
+    MYTHROW(LocateZipException, ("Can't open file inside zip", file));
+
+  uint64_t const offset = unzGetCurrentFileZStreamPos64(zip);
+  (void) unzCloseCurrentFile(zip);
+
+  if (offset == 0)
+    MYTHROW(LocateZipException, ("Invalid offset inside zip", file));
+
+  // A stored entry's data is its byte-for-byte window of the container.
+  return make_unique<ZipMmapReader>(container, offset, fileInfo.compressed_size);
+}
+
 ZipFileReader::ZipFileReader(string const & container, string const & file, uint32_t logPageSize,
                              uint32_t logPageCount)
   : FileReader(container, logPageSize, logPageCount), m_uncompressedFileSize(0)
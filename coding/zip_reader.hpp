@@ -6,6 +6,7 @@
 #include "base/exception.hpp"
 
 #include "std/function.hpp"
+#include "std/unique_ptr.hpp"
 #include "std/utility.hpp"
 
 
@@ -38,6 +39,13 @@ public:
                 uint32_t logPageSize = FileReader::kDefaultLogPageSize,
                 uint32_t logPageCount = FileReader::kDefaultLogPageCount);
 
+  /// @return Zero-copy reader over the mapped |container| window of a
+  /// stored (uncompressed) |file|, nullptr if the entry is compressed.
+  /// Unlike ZipFileReader, reading it copies no container pages, which
+  /// matters for fonts and styles read straight from the apk on start.
+  static unique_ptr<ModelReader> CreateMmapReaderIfStored(string const & container,
+                                                          string const & file);
+
   /// @note Size() returns compressed file size inside zip
   uint64_t UncompressedSize() const { return m_uncompressedFileSize; }
 
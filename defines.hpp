@@ -14,6 +14,7 @@
 #define LOC_IDX_FILE_EXTENSION ".locidx"
 #define LOC_DATA_FILE_EXTENSION ".locdata"
 #define OSM_DATA_FILE_EXTENSION ".osm"
+#define TESS_CACHE_FILE_EXTENSION ".tesscache"
 
 #define NODES_FILE "nodes.dat"
 #define WAYS_FILE "ways.dat"
@@ -14,10 +14,12 @@ namespace dp
 class Batcher::CallbacksWrapper : public BatchCallbacks
 {
 public:
-  CallbacksWrapper(RenderState const & state, ref_ptr<OverlayHandle> overlay, ref_ptr<Batcher> batcher)
+  CallbacksWrapper(RenderState const & state, ref_ptr<OverlayHandle> overlay, ref_ptr<Batcher> batcher,
+                   IndexStorage & indexStorage)
     : m_state(state)
     , m_overlay(overlay)
     , m_batcher(batcher)
+    , m_indexStorage(indexStorage)
   {}
 
   void SetVAO(ref_ptr<VertexArrayBuffer> buffer)
@@ -96,7 +98,7 @@ private:
   ref_ptr<OverlayHandle> m_overlay;
   ref_ptr<Batcher> m_batcher;
   ref_ptr<VertexArrayBuffer> m_buffer;
-  IndexStorage m_indexStorage;
+  IndexStorage & m_indexStorage;
   IndicesRange m_indicesRange;
   bool m_vaoChanged = false;
 };
@@ -283,7 +285,7 @@ IndicesRange Batcher::InsertPrimitives(ref_ptr<GraphicsContext> context, RenderS
   drape_ptr<OverlayHandle> handle = std::move(transferHandle);
 
   {
-    Batcher::CallbacksWrapper wrapper(state, make_ref(handle), make_ref(this));
+    Batcher::CallbacksWrapper wrapper(state, make_ref(handle), make_ref(this), m_scratchIndexStorage);
     wrapper.SetVAO(vao);
 
     TBatcher batch(wrapper, batcherArgs ...);
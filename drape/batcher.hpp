@@ -2,6 +2,7 @@
 
 #include "drape/attribute_provider.hpp"
 #include "drape/graphics_context.hpp"
+#include "drape/index_storage.hpp"
 #include "drape/overlay_handle.hpp"
 #include "drape/pointers.hpp"
 #include "drape/render_bucket.hpp"
@@ -94,6 +95,10 @@ private:
   uint32_t m_indexBufferSize;
   uint32_t m_vertexBufferSize;
 
+  // Scratch storage for indices of a single insertion, reused by all
+  // insertions to avoid a buffer allocation per batched geometry.
+  IndexStorage m_scratchIndexStorage;
+
   int m_featureMinZoom = 0;
 };
 
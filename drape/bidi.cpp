@@ -6,15 +6,16 @@
 #include "3party/icu/common/unicode/unistr.h"
 #include "3party/icu/common/unicode/ushape.h"
 
+#include <map>
+#include <mutex>
+
 namespace bidi
 {
 
-strings::UniString log2vis(strings::UniString const & str)
+namespace
+{
+strings::UniString log2visImpl(strings::UniString const & str, std::string const & str8)
 {
-  std::string str8 = strings::ToUtf8(str);
-  if (strings::IsASCIIString(str8))
-    return str;
-
   UBiDi * bidi = ubidi_open();
   UErrorCode errorCode = U_ZERO_ERROR;
 
@@ -55,5 +56,35 @@ strings::UniString log2vis(strings::UniString const & str)
 
   return strings::MakeUniString(out);
 }
+}  // namespace
+
+strings::UniString log2vis(strings::UniString const & str)
+{
+  std::string str8 = strings::ToUtf8(str);
+  if (strings::IsASCIIString(str8))
+    return str;
+
+  // Reordering is expensive and the same labels are laid out again for every
+  // tile and every zoom level they appear on, so the results are memoized.
+  // The function is called from several tile reading threads simultaneously.
+  static std::mutex cacheMutex;
+  static std::map<strings::UniString, strings::UniString> cache;
+  size_t constexpr kMaxCacheSize = 2000;
+
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto const it = cache.find(str);
+    if (it != cache.end())
+      return it->second;
+  }
+
+  strings::UniString result = log2visImpl(str, str8);
+
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  if (cache.size() >= kMaxCacheSize)
+    cache.clear();
+  cache.emplace(str, result);
+  return result;
+}
 
 }
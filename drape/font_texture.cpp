@@ -211,7 +211,10 @@ void GlyphIndex::OnCompleteGlyphGeneration(GlyphGenerator::GlyphGenerationDataAr
 {
   std::lock_guard<std::mutex> lock(m_mutex);
   for (auto & g : glyphs)
+  {
+    m_mng->CacheGeneratedGlyph(g.m_glyph);
     m_pendingNodes.emplace_back(g.m_rect, g.m_glyph);
+  }
 }
 
 void GlyphIndex::UploadResources(ref_ptr<Texture> texture)
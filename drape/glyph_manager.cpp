@@ -3,15 +3,21 @@
 
 #include "platform/platform.hpp"
 
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
 #include "coding/reader.hpp"
+#include "coding/write_to_sink.hpp"
 
 #include "base/string_utils.hpp"
 #include "base/logging.hpp"
 #include "base/math.hpp"
 #include "base/timer.hpp"
 
+#include <cstring>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 
@@ -298,6 +304,192 @@ private:
 
   std::set<pair<strings::UniChar, int>> m_readyGlyphs;
 };
+
+// Persistent cache of final SDF glyph images. Rasterizing a glyph and
+// computing its distance field is by far the most expensive part of showing
+// a label for the first time, so every generated dynamic glyph is appended
+// to a file in the writable dir and reused on the following runs.
+uint32_t constexpr kGlyphCacheMagic = 0x31564347;  // "GCV1"
+size_t constexpr kGlyphCacheMaxRecords = 4096;
+char const kGlyphCacheFileName[] = "glyphs_sdf_cache.bin";
+
+class PersistentGlyphCache
+{
+public:
+  PersistentGlyphCache(std::string const & filePath, uint32_t baseGlyphHeight,
+                       uint32_t sdfScale, uint64_t fontsSignature)
+    : m_filePath(filePath)
+    , m_baseGlyphHeight(baseGlyphHeight)
+    , m_sdfScale(sdfScale)
+    , m_fontsSignature(fontsSignature)
+  {
+    bool consistent = false;
+    try
+    {
+      consistent = Load();
+    }
+    catch (Reader::Exception const &)
+    {
+      // Missing or truncated cache file, recreate it below.
+      m_glyphs.clear();
+      consistent = false;
+    }
+
+    if (consistent)
+    {
+      m_writer = std::make_unique<FileWriter>(m_filePath, FileWriter::OP_APPEND);
+    }
+    else
+    {
+      // Rewrite the file keeping the records which were read successfully.
+      m_writer = std::make_unique<FileWriter>(m_filePath, FileWriter::OP_WRITE_TRUNCATE);
+      WriteToSink(*m_writer, kGlyphCacheMagic);
+      WriteToSink(*m_writer, m_baseGlyphHeight);
+      WriteToSink(*m_writer, m_sdfScale);
+      WriteToSink(*m_writer, m_fontsSignature);
+      for (auto const & node : m_glyphs)
+        WriteRecord(node.first, node.second);
+      m_writer->Flush();
+    }
+  }
+
+  bool Get(strings::UniChar code, GlyphManager::Glyph & glyph)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const it = m_glyphs.find(code);
+    if (it == m_glyphs.end())
+      return false;
+
+    Record const & record = it->second;
+    size_t const bufferSize = base::NextPowOf2(record.m_width * record.m_height);
+    auto data = SharedBufferManager::instance().reserveSharedBuffer(bufferSize);
+    memcpy(data->data(), record.m_data.data(), record.m_data.size());
+
+    glyph.m_image = GlyphManager::GlyphImage
+    {
+      record.m_width, record.m_height,
+      0 /* bitmapRows */, 0 /* bitmapPitch */,
+      data
+    };
+    glyph.m_metrics = record.m_metrics;
+    glyph.m_code = code;
+    glyph.m_fixedSize = GlyphManager::kDynamicGlyphSize;
+    return true;
+  }
+
+  void Put(GlyphManager::Glyph const & glyph)
+  {
+    // Cache only valid final images of dynamic (SDF) glyphs: fixed size ones
+    // are generated without the expensive distance field pass.
+    if (glyph.m_fixedSize != GlyphManager::kDynamicGlyphSize ||
+        !glyph.m_metrics.m_isValid || glyph.m_image.m_data == nullptr ||
+        glyph.m_image.m_bitmapRows != 0)
+    {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_glyphs.size() >= kGlyphCacheMaxRecords ||
+        m_glyphs.find(glyph.m_code) != m_glyphs.end())
+    {
+      return;
+    }
+
+    Record record;
+    record.m_metrics = glyph.m_metrics;
+    record.m_width = glyph.m_image.m_width;
+    record.m_height = glyph.m_image.m_height;
+    size_t const dataSize = record.m_width * record.m_height;
+    if (dataSize == 0 || glyph.m_image.m_data->size() < dataSize)
+      return;
+    record.m_data.assign(glyph.m_image.m_data->begin(),
+                         glyph.m_image.m_data->begin() + dataSize);
+
+    auto const res = m_glyphs.emplace(glyph.m_code, std::move(record));
+    try
+    {
+      WriteRecord(res.first->first, res.first->second);
+      m_writer->Flush();
+    }
+    catch (Writer::Exception const & e)
+    {
+      LOG(LWARNING, ("Error writing glyph cache", m_filePath, ":", e.what()));
+      m_writer.reset();
+      m_glyphs.erase(res.first);
+    }
+  }
+
+private:
+  struct Record
+  {
+    GlyphManager::GlyphMetrics m_metrics;
+    uint32_t m_width;
+    uint32_t m_height;
+    std::vector<uint8_t> m_data;
+  };
+
+  // Returns false if the file tail can not be parsed (e.g. the process died
+  // in the middle of an append), loading as many records as possible.
+  bool Load()
+  {
+    FileReader reader(m_filePath);
+    ReaderSource<FileReader> src(reader);
+
+    if (ReadPrimitiveFromSource<uint32_t>(src) != kGlyphCacheMagic ||
+        ReadPrimitiveFromSource<uint32_t>(src) != m_baseGlyphHeight ||
+        ReadPrimitiveFromSource<uint32_t>(src) != m_sdfScale ||
+        ReadPrimitiveFromSource<uint64_t>(src) != m_fontsSignature)
+    {
+      return false;
+    }
+
+    size_t const kMinRecordSize = sizeof(uint32_t) * 3 + sizeof(float) * 4;
+    while (src.Size() >= kMinRecordSize && m_glyphs.size() < kGlyphCacheMaxRecords)
+    {
+      auto const code = ReadPrimitiveFromSource<uint32_t>(src);
+
+      Record record;
+      src.Read(&record.m_metrics.m_xAdvance, sizeof(float));
+      src.Read(&record.m_metrics.m_yAdvance, sizeof(float));
+      src.Read(&record.m_metrics.m_xOffset, sizeof(float));
+      src.Read(&record.m_metrics.m_yOffset, sizeof(float));
+      record.m_metrics.m_isValid = true;
+      record.m_width = ReadPrimitiveFromSource<uint32_t>(src);
+      record.m_height = ReadPrimitiveFromSource<uint32_t>(src);
+
+      uint64_t const dataSize = static_cast<uint64_t>(record.m_width) * record.m_height;
+      if (dataSize == 0 || dataSize > src.Size())
+        return false;
+      record.m_data.resize(static_cast<size_t>(dataSize));
+      src.Read(record.m_data.data(), record.m_data.size());
+
+      m_glyphs.emplace(static_cast<strings::UniChar>(code), std::move(record));
+    }
+
+    return src.Size() == 0;
+  }
+
+  void WriteRecord(strings::UniChar code, Record const & record)
+  {
+    WriteToSink(*m_writer, static_cast<uint32_t>(code));
+    m_writer->Write(&record.m_metrics.m_xAdvance, sizeof(float));
+    m_writer->Write(&record.m_metrics.m_yAdvance, sizeof(float));
+    m_writer->Write(&record.m_metrics.m_xOffset, sizeof(float));
+    m_writer->Write(&record.m_metrics.m_yOffset, sizeof(float));
+    WriteToSink(*m_writer, record.m_width);
+    WriteToSink(*m_writer, record.m_height);
+    m_writer->Write(record.m_data.data(), record.m_data.size());
+  }
+
+  std::string m_filePath;
+  uint32_t m_baseGlyphHeight;
+  uint32_t m_sdfScale;
+  uint64_t m_fontsSignature;
+
+  std::map<strings::UniChar, Record> m_glyphs;
+  std::unique_ptr<FileWriter> m_writer;
+  std::mutex m_mutex;
+};
 }  // namespace
 
 // Information about single unicode block.
@@ -360,6 +552,8 @@ struct GlyphManager::Impl
 
   uint32_t m_baseGlyphHeight;
   uint32_t m_sdfScale;
+
+  std::unique_ptr<PersistentGlyphCache> m_glyphCache;
 };
 
 GlyphManager::GlyphManager(GlyphManager::Params const & params)
@@ -395,6 +589,8 @@ GlyphManager::GlyphManager(GlyphManager::Params const & params)
 
   FREETYPE_CHECK(FT_Init_FreeType(&m_impl->m_library));
 
+  uint64_t fontsSignature = 0;
+
   for (auto const & fontName : params.m_fonts)
   {
     bool ignoreFont = false;
@@ -410,7 +606,10 @@ GlyphManager::GlyphManager(GlyphManager::Params const & params)
     std::vector<FT_ULong> charCodes;
     try
     {
-      m_impl->m_fonts.emplace_back(std::make_unique<Font>(params.m_sdfScale, GetPlatform().GetReader(fontName),
+      ReaderPtr<Reader> fontReader = GetPlatform().GetReader(fontName);
+      fontsSignature = fontsSignature * 0x100000001b3ULL +
+                       std::hash<std::string>()(fontName) + fontReader.Size();
+      m_impl->m_fonts.emplace_back(std::make_unique<Font>(params.m_sdfScale, fontReader,
                                                           m_impl->m_library));
       m_impl->m_fonts.back()->GetCharcodes(charCodes);
     }
@@ -486,6 +685,20 @@ GlyphManager::GlyphManager(GlyphManager::Params const & params)
   }
 
   m_impl->m_lastUsedBlock = m_impl->m_blocks.end();
+
+  if (!m_impl->m_fonts.empty())
+  {
+    try
+    {
+      m_impl->m_glyphCache = std::make_unique<PersistentGlyphCache>(
+          GetPlatform().WritablePathForFile(kGlyphCacheFileName),
+          params.m_baseGlyphHeight, params.m_sdfScale, fontsSignature);
+    }
+    catch (RootException const & e)
+    {
+      LOG(LWARNING, ("Persistent glyph cache is disabled:", e.what()));
+    }
+  }
 }
 
 GlyphManager::~GlyphManager()
@@ -569,13 +782,29 @@ GlyphManager::Glyph GlyphManager::GetGlyph(strings::UniChar unicodePoint, int fi
   if (fontIndex == kInvalidFont)
     return GetInvalidGlyph(fixedHeight);
 
-  auto const & f = m_impl->m_fonts[fontIndex];
   bool const isSdf = fixedHeight < 0;
+  if (isSdf && m_impl->m_glyphCache != nullptr)
+  {
+    Glyph glyph;
+    if (m_impl->m_glyphCache->Get(unicodePoint, glyph))
+    {
+      glyph.m_fontIndex = fontIndex;
+      return glyph;
+    }
+  }
+
+  auto const & f = m_impl->m_fonts[fontIndex];
   Glyph glyph = f->GetGlyph(unicodePoint, isSdf ? m_impl->m_baseGlyphHeight : fixedHeight, isSdf);
   glyph.m_fontIndex = fontIndex;
   return glyph;
 }
 
+void GlyphManager::CacheGeneratedGlyph(Glyph const & glyph)
+{
+  if (m_impl->m_glyphCache != nullptr)
+    m_impl->m_glyphCache->Put(glyph);
+}
+
 // static
 GlyphManager::Glyph GlyphManager::GenerateGlyph(Glyph const & glyph, uint32_t sdfScale)
 {
@@ -587,7 +816,9 @@ GlyphManager::Glyph GlyphManager::GenerateGlyph(Glyph const & glyph, uint32_t sd
     resultGlyph.m_code = glyph.m_code;
     resultGlyph.m_fixedSize = glyph.m_fixedSize;
 
-    if (glyph.m_fixedSize < 0)
+    // Glyphs restored from the persistent cache already hold the final image
+    // (bitmap rows are zeroed) and are simply copied like fixed size ones.
+    if (glyph.m_fixedSize < 0 && glyph.m_image.m_bitmapRows != 0)
     {
       sdf_image::SdfImage img(glyph.m_image.m_bitmapRows, glyph.m_image.m_bitmapPitch,
                               glyph.m_image.m_data->data(), sdfScale * kSdfBorder);
@@ -78,6 +78,11 @@ public:
 
   Glyph GetGlyph(strings::UniChar unicodePoints, int fixedHeight);
 
+  // Stores the final image of a generated dynamic glyph in a persistent
+  // cache, so on the following runs GetGlyph() returns it without
+  // rasterization and SDF generation. Can be called from any thread.
+  void CacheGeneratedGlyph(Glyph const & glyph);
+
   void MarkGlyphReady(Glyph const & glyph);
   bool AreGlyphsReady(strings::UniString const & str, int fixedSize) const;
 
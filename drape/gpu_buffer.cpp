@@ -31,6 +31,7 @@ GPUBuffer::GPUBuffer(Target t, void const * data, uint8_t elementSize, uint32_t
   : TBase(elementSize, capacity)
   , m_t(t)
   , m_mappingOffset(0)
+  , m_explicitFlush(false)
 #ifdef DEBUG
   , m_isMapped(false)
 #endif
@@ -64,6 +65,14 @@ void GPUBuffer::UploadData(void const * data, uint32_t elementCount)
   ASSERT_LESS_OR_EQUAL((elementCount + currentSize) * elementSize, size, ());
 #endif
 
+  // Orphan the storage at the start of a fill cycle, so the upload never
+  // waits for draw calls which still use the previous content of the buffer.
+  if (currentSize == 0)
+  {
+    GLFunctions::glBufferData(glTarget(m_t), GetCapacity() * elementSize, nullptr,
+                              gl_const::GLDynamicDraw);
+  }
+
   GLFunctions::glBufferSubData(glTarget(m_t), elementCount * elementSize, data,
                                currentSize * elementSize);
   TBase::UploadData(elementCount);
@@ -98,8 +107,11 @@ void * GPUBuffer::Map(uint32_t elementOffset, uint32_t elementCount)
     uint32_t const elementSize = GetElementSize();
     uint32_t const byteOffset = elementOffset * elementSize;
     uint32_t const byteCount = elementCount * elementSize;
+    // With explicit flushing the driver transfers only the byte ranges
+    // actually written instead of the whole mapped range on unmapping.
+    m_explicitFlush = true;
     return GLFunctions::glMapBufferRange(glTarget(m_t), byteOffset, byteCount,
-                                         gl_const::GLWriteBufferBit);
+                                         gl_const::GLWriteBufferBit | gl_const::GLFlushExplicit);
   }
   return nullptr;
 }
@@ -123,6 +135,8 @@ void GPUBuffer::UpdateData(void * gpuPtr, void const * data, uint32_t elementOff
   {
     ASSERT(gpuPtr != nullptr, ());
     memcpy((uint8_t *)gpuPtr + byteOffset, data, byteCount);
+    if (m_explicitFlush)
+      GLFunctions::glFlushMappedBufferRange(glTarget(m_t), byteOffset, byteCount);
   }
   else
   {
@@ -142,6 +156,7 @@ void GPUBuffer::Unmap()
 #endif
 
   m_mappingOffset = 0;
+  m_explicitFlush = false;
   if (IsMapBufferSupported())
     GLFunctions::glUnmapBuffer(glTarget(m_t));
 }
@@ -34,6 +34,7 @@ private:
   Target m_t;
   uint32_t m_bufferID;
   uint32_t m_mappingOffset;
+  bool m_explicitFlush;
 
 #ifdef DEBUG
   bool m_isMapped;
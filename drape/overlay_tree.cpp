@@ -86,7 +86,7 @@ void OverlayTree::Clear()
   m_displacers.clear();
 }
 
-bool OverlayTree::Frame()
+bool OverlayTree::Frame(ScreenBase const & screen)
 {
   if (IsNeedUpdate())
     return true;
@@ -105,7 +105,21 @@ bool OverlayTree::Frame()
 
   m_frameCounter++;
   if (m_frameCounter >= static_cast<int>(m_frameUpdatePeriod))
-    InvalidateOnNextFrame();
+  {
+    // Resolution depends only on the set of handles and their pixel
+    // rects, so with the same screen and untouched handles the periodic
+    // rebuild would reproduce the current placement; skip it and check
+    // again one period later.
+    auto const & lastScreen = GetModelView();
+    bool const screenChanged = !(lastScreen == screen) ||
+                               lastScreen.isPerspective() != screen.isPerspective() ||
+                               lastScreen.GetRotationAngle() != screen.GetRotationAngle() ||
+                               lastScreen.GetScale3d() != screen.GetScale3d();
+    if (m_contentChanged || screenChanged)
+      InvalidateOnNextFrame();
+    else
+      m_frameCounter = 0;
+  }
 
   return IsNeedUpdate();
 }
@@ -130,8 +144,15 @@ void OverlayTree::StartOverlayPlacing(ScreenBase const & screen, int zoomLevel)
   m_zoomLevel = zoomLevel;
 }
 
+void OverlayTree::SetContentChanged()
+{
+  m_contentChanged = true;
+}
+
 void OverlayTree::Remove(ref_ptr<OverlayHandle> handle)
 {
+  m_contentChanged = true;
+
   if (m_frameCounter == kInvalidFrame)
     return;
 
@@ -332,6 +353,7 @@ void OverlayTree::EndOverlayPlacing()
   }
 
   m_frameCounter = 0;
+  m_contentChanged = false;
 
 #ifdef DEBUG_OVERLAYS_OUTPUT
   LOG(LINFO, ("- END OVERLAYS PLACING"));
@@ -63,10 +63,15 @@ public:
   explicit OverlayTree(double visualScale);
 
   void Clear();
-  bool Frame();
+  bool Frame(ScreenBase const & screen);
   bool IsNeedUpdate() const;
   void InvalidateOnNextFrame();
 
+  // Tells the tree that the set of overlay handles has changed (a render
+  // group was added), so the next periodic update may not be skipped.
+  // Removals are tracked by Remove() itself.
+  void SetContentChanged();
+
   void StartOverlayPlacing(ScreenBase const & screen, int zoomLevel);
   void Add(ref_ptr<OverlayHandle> handle);
   void Remove(ref_ptr<OverlayHandle> handle);
@@ -123,6 +128,9 @@ private:
 
   HandlesCache m_displacers;
   uint32_t m_frameUpdatePeriod;
+  // True when handles were added or removed since the last placing, see
+  // Frame().
+  bool m_contentChanged = true;
   int m_zoomLevel = 1;
 };
 }  // namespace dp
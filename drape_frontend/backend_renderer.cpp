@@ -194,8 +194,17 @@ void BackendRenderer::AcceptMessage(ref_ptr<Message> message)
       CHECK(m_context != nullptr, ());
       if (msg->NeedForceUpdateUserMarks())
       {
+        // The generator rebatches only the tiles whose marks have changed;
+        // for the rest it reports the previously flushed generation, so the
+        // frontend keeps their render groups.
+        TTilesCollection tiles;
         for (auto const & tileKey : msg->GetTiles())
-          m_userMarkGenerator->GenerateUserMarksGeometry(m_context, tileKey, m_texMng);
+          tiles.insert(m_userMarkGenerator->GenerateUserMarksGeometry(m_context, tileKey, m_texMng));
+        m_commutator->PostMessage(ThreadsCommutator::RenderThread,
+                                  make_unique_dp<FinishTileReadMessage>(std::move(tiles),
+                                                                        true /* forceUpdateUserMarks */),
+                                  MessagePriority::Normal);
+        break;
       }
       m_commutator->PostMessage(ThreadsCommutator::RenderThread,
                                 make_unique_dp<FinishTileReadMessage>(msg->MoveTiles(),
@@ -228,6 +237,9 @@ void BackendRenderer::AcceptMessage(ref_ptr<Message> message)
       {
         CHECK(m_context != nullptr, ());
         ref_ptr<dp::Batcher> batcher = m_batchersPool->GetBatcher(tileKey);
+#if defined(DRAPE_MEASURER) && defined(TRACE_STATISTIC)
+        DrapeMeasurer::TraceGuard traceGuard("Batching");
+#endif
 #if defined(DRAPE_MEASURER) && defined(GENERATING_STATISTIC)
         DrapeMeasurer::Instance().StartShapesGeneration();
 #endif
@@ -252,6 +264,9 @@ void BackendRenderer::AcceptMessage(ref_ptr<Message> message)
         CHECK(m_context != nullptr, ());
         CleanupOverlays(tileKey);
 
+#if defined(DRAPE_MEASURER) && defined(TRACE_STATISTIC)
+        DrapeMeasurer::TraceGuard traceGuard("OverlayBatching");
+#endif
 #if defined(DRAPE_MEASURER) && defined(GENERATING_STATISTIC)
         DrapeMeasurer::Instance().StartOverlayShapesGeneration();
 #endif
@@ -424,10 +439,14 @@ void BackendRenderer::AcceptMessage(ref_ptr<Message> message)
   case Message::Type::UpdateTraffic:
     {
       ref_ptr<UpdateTrafficMessage> msg = message;
-      m_trafficGenerator->UpdateColoring(msg->GetSegmentsColoring());
-      m_commutator->PostMessage(ThreadsCommutator::RenderThread,
-                                make_unique_dp<RegenerateTrafficMessage>(),
-                                MessagePriority::Normal);
+      // Regeneration forces rereading of all the tiles, skip it when the
+      // update has not actually changed any speed group.
+      if (m_trafficGenerator->UpdateColoring(msg->GetSegmentsColoring()))
+      {
+        m_commutator->PostMessage(ThreadsCommutator::RenderThread,
+                                  make_unique_dp<RegenerateTrafficMessage>(),
+                                  MessagePriority::Normal);
+      }
       break;
     }
 
@@ -493,8 +512,14 @@ void BackendRenderer::AcceptMessage(ref_ptr<Message> message)
   case Message::Type::EnableTransitScheme:
     {
       ref_ptr<EnableTransitSchemeMessage> msg = message;
-      if (!msg->IsEnabled())
-        m_transitBuilder->Clear();
+      // Collected scheme data survives layer toggles (until the mwm is
+      // deregistered or evicted from the reader cache), so re-enabling only
+      // needs the meshes to be rebuilt.
+      if (msg->IsEnabled())
+      {
+        CHECK(m_context != nullptr, ());
+        m_transitBuilder->RebuildSchemes(m_context, m_texMng);
+      }
       m_commutator->PostMessage(ThreadsCommutator::RenderThread,
                                 make_unique_dp<EnableTransitSchemeMessage>(msg->IsEnabled()),
                                 MessagePriority::Normal);
@@ -655,7 +680,7 @@ void BackendRenderer::Routine::Do()
 void BackendRenderer::InitContextDependentResources()
 {
   uint32_t constexpr kBatchSize = 5000;
-  m_batchersPool = make_unique_dp<BatchersPool<TileKey, TileKeyStrictComparator>>(kReadingThreadsCount,
+  m_batchersPool = make_unique_dp<BatchersPool<TileKey, TileKeyStrictComparator>>(GetReadingThreadsCount(),
                                                std::bind(&BackendRenderer::FlushGeometry, this, _1, _2, _3),
                                                kBatchSize, kBatchSize);
   m_trafficGenerator->Init();
@@ -37,6 +37,14 @@ void DrapeMeasurer::StartBenchmark()
   }
 #endif
 
+#ifdef TRACE_STATISTIC
+  {
+    std::lock_guard<std::mutex> lock(m_traceMutex);
+    m_traceEvents.clear();
+    m_traceNextIndex = 0;
+  }
+#endif
+
 #ifdef RENDER_STATISTIC
   m_totalTPF = steady_clock::duration::zero();
   m_totalTPFCount = 0;
@@ -370,6 +378,69 @@ DrapeMeasurer::GPUMemoryStatistic DrapeMeasurer::GetGPUMemoryStatistic()
 }
 #endif
 
+#ifdef TRACE_STATISTIC
+namespace
+{
+size_t constexpr kMaxTraceEvents = 1 << 16;
+}  // namespace
+
+DrapeMeasurer::TraceGuard::TraceGuard(char const * stage)
+  : m_stage(stage)
+  , m_start(std::chrono::steady_clock::now())
+{}
+
+DrapeMeasurer::TraceGuard::~TraceGuard()
+{
+  DrapeMeasurer::Instance().AddTraceEvent(m_stage, m_start, std::chrono::steady_clock::now());
+}
+
+void DrapeMeasurer::AddTraceEvent(char const * stage,
+                                  std::chrono::time_point<std::chrono::steady_clock> const & start,
+                                  std::chrono::time_point<std::chrono::steady_clock> const & end)
+{
+  if (!m_isEnabled)
+    return;
+
+  TraceEvent event;
+  event.m_stage = stage;
+  event.m_threadId = threads::GetCurrentThreadID();
+  event.m_start = start;
+  event.m_end = end;
+
+  std::lock_guard<std::mutex> lock(m_traceMutex);
+  if (m_traceEvents.size() < kMaxTraceEvents)
+  {
+    m_traceEvents.push_back(event);
+  }
+  else
+  {
+    m_traceEvents[m_traceNextIndex] = event;
+    m_traceNextIndex = (m_traceNextIndex + 1) % kMaxTraceEvents;
+  }
+}
+
+std::string DrapeMeasurer::GetTraceInJson()
+{
+  using namespace std::chrono;
+
+  std::lock_guard<std::mutex> lock(m_traceMutex);
+  std::ostringstream ss;
+  ss << "{\"traceEvents\":[";
+  for (size_t i = 0; i < m_traceEvents.size(); ++i)
+  {
+    auto const & event = m_traceEvents[(m_traceNextIndex + i) % m_traceEvents.size()];
+    if (i != 0)
+      ss << ",";
+    ss << "{\"name\":\"" << event.m_stage << "\",\"ph\":\"X\",\"pid\":1"
+       << ",\"tid\":" << std::hash<threads::ThreadID>()(event.m_threadId)
+       << ",\"ts\":" << duration_cast<microseconds>(event.m_start.time_since_epoch()).count()
+       << ",\"dur\":" << duration_cast<microseconds>(event.m_end - event.m_start).count() << "}";
+  }
+  ss << "]}";
+  return ss.str();
+}
+#endif
+
 std::string DrapeMeasurer::DrapeStatistic::ToString() const
 {
   std::ostringstream ss;
@@ -96,6 +96,26 @@ public:
   void AfterRenderFrame();
 #endif
 
+#ifdef TRACE_STATISTIC
+  // Per-stage timings are ring-buffered and exportable in the
+  // chrome://tracing JSON format ("Load custom traces" in about:tracing).
+  class TraceGuard
+  {
+  public:
+    explicit TraceGuard(char const * stage);
+    ~TraceGuard();
+
+  private:
+    char const * m_stage;
+    std::chrono::time_point<std::chrono::steady_clock> m_start;
+  };
+
+  void AddTraceEvent(char const * stage,
+                     std::chrono::time_point<std::chrono::steady_clock> const & start,
+                     std::chrono::time_point<std::chrono::steady_clock> const & end);
+  std::string GetTraceInJson();
+#endif
+
   struct DrapeStatistic
   {
     std::string ToString() const;
@@ -163,6 +183,20 @@ private:
   uint32_t m_totalFramesCount = 0;
 #endif
 
+#ifdef TRACE_STATISTIC
+  struct TraceEvent
+  {
+    char const * m_stage;
+    threads::ThreadID m_threadId;
+    std::chrono::time_point<std::chrono::steady_clock> m_start;
+    std::chrono::time_point<std::chrono::steady_clock> m_end;
+  };
+  // The buffer keeps the most recent events once its capacity is reached.
+  std::vector<TraceEvent> m_traceEvents;
+  size_t m_traceNextIndex = 0;
+  std::mutex m_traceMutex;
+#endif
+
 #ifdef TRACK_GPU_MEM
   void TakeGPUMemorySnapshot();
 
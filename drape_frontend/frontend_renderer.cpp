@@ -67,9 +67,9 @@ double constexpr kVSyncIntervalMetal = 0.03;
 
 std::string const kTransitBackgroundColor = "TransitBackground";
 
-template <typename ToDo>
+template <typename ToDo, typename TDetachedConsumer>
 bool RemoveGroups(ToDo & filter, std::vector<drape_ptr<RenderGroup>> & groups,
-                  ref_ptr<dp::OverlayTree> tree)
+                  ref_ptr<dp::OverlayTree> tree, TDetachedConsumer && consumer)
 {
   size_t startCount = groups.size();
   size_t count = startCount;
@@ -80,6 +80,7 @@ bool RemoveGroups(ToDo & filter, std::vector<drape_ptr<RenderGroup>> & groups,
     if (filter(group))
     {
       group->RemoveOverlay(tree);
+      consumer(std::move(group));
       swap(group, groups.back());
       groups.pop_back();
       --count;
@@ -93,6 +94,13 @@ bool RemoveGroups(ToDo & filter, std::vector<drape_ptr<RenderGroup>> & groups,
   return startCount != count;
 }
 
+template <typename ToDo>
+bool RemoveGroups(ToDo & filter, std::vector<drape_ptr<RenderGroup>> & groups,
+                  ref_ptr<dp::OverlayTree> tree)
+{
+  return RemoveGroups(filter, groups, tree, [](drape_ptr<RenderGroup> &&) {});
+}
+
 struct RemoveTilePredicate
 {
   mutable bool m_deletionMark = false;
@@ -598,6 +606,8 @@ void FrontendRenderer::AcceptMessage(ref_ptr<Message> message)
         layer.m_renderGroups.clear();
         layer.m_isDirty = false;
       }
+      ClearRenderGroupsCache();
+      m_tileSnapshotValid = false;
 
       // Must be recreated on map style changing.
       CHECK(m_context != nullptr, ());
@@ -1017,6 +1027,8 @@ void FrontendRenderer::InvalidateRect(m2::RectD const & gRect)
       RemoveGroups(eraseFunction, layer.m_renderGroups, make_ref(m_overlayTree));
       layer.m_isDirty = true;
     }
+    for (auto const & key : tiles)
+      m_renderGroupsCache.erase(key);
 
     // Remove tiles to invalidate from backend renderer.
     BaseBlockingMessage::Blocker blocker;
@@ -1058,6 +1070,8 @@ void FrontendRenderer::OnResize(ScreenBase const & screen)
     CHECK(m_context != nullptr, ());
     m_context->Resize(sx, sy);
     m_buildingsFramebuffer->SetSize(m_context, sx, sy);
+    m_tileSnapshotFramebuffer->SetSize(m_context, std::max(sx / 2, 1u), std::max(sy / 2, 1u));
+    m_tileSnapshotValid = false;
     m_postprocessRenderer->Resize(m_context, sx, sy);
     m_needRestoreSize = false;
   }
@@ -1072,6 +1086,7 @@ void FrontendRenderer::AddToRenderGroup(dp::RenderState const & state,
                                         TileKey const & newTile)
 {
   RenderLayer & layer = m_layers[static_cast<size_t>(GetDepthLayer(state))];
+  m_overlayTree->SetContentChanged();
   for (auto const & g : layer.m_renderGroups)
   {
     if (!g->IsPendingOnDelete() && g->GetState() == state && g->GetTileKey().EqualStrict(newTile))
@@ -1101,6 +1116,55 @@ void FrontendRenderer::RemoveRenderGroupsLater(TRenderGroupRemovePredicate const
   }
 }
 
+void FrontendRenderer::CacheRenderGroup(drape_ptr<RenderGroup> && group)
+{
+  // User marks are invalidated independently of tile rereading, so showing
+  // their last known state can contradict the current marks generation.
+  if (group->IsUserMark() || group->IsPendingOnDelete() || group->IsEmpty())
+    return;
+
+  auto & entry = m_renderGroupsCache[group->GetTileKey()];
+  entry.m_groups.push_back(std::move(group));
+  entry.m_lastUsed = ++m_renderGroupsCacheUsageCounter;
+
+  size_t constexpr kMaxCachedTiles = 16;
+  while (m_renderGroupsCache.size() > kMaxCachedTiles)
+  {
+    auto oldestIt = m_renderGroupsCache.begin();
+    for (auto it = m_renderGroupsCache.begin(); it != m_renderGroupsCache.end(); ++it)
+    {
+      if (it->second.m_lastUsed < oldestIt->second.m_lastUsed)
+        oldestIt = it;
+    }
+    m_renderGroupsCache.erase(oldestIt);
+  }
+}
+
+void FrontendRenderer::RestoreCachedRenderGroups(TTilesCollection const & tiles)
+{
+  for (auto const & tileKey : tiles)
+  {
+    auto const it = m_renderGroupsCache.find(tileKey);
+    if (it == m_renderGroupsCache.end())
+      continue;
+
+    for (auto & group : it->second.m_groups)
+    {
+      group->SetRestoredFromCache();
+      RenderLayer & layer = m_layers[static_cast<size_t>(GetDepthLayer(group->GetState()))];
+      layer.m_renderGroups.push_back(std::move(group));
+      layer.m_isDirty = true;
+    }
+    m_renderGroupsCache.erase(it);
+    m_overlayTree->SetContentChanged();
+  }
+}
+
+void FrontendRenderer::ClearRenderGroupsCache()
+{
+  m_renderGroupsCache.clear();
+}
+
 bool FrontendRenderer::CheckTileGenerations(TileKey const & tileKey)
 {
   bool const result = (tileKey.m_generation >= m_maxGeneration);
@@ -1113,7 +1177,10 @@ bool FrontendRenderer::CheckTileGenerations(TileKey const & tileKey)
 
   auto removePredicate = [&tileKey](drape_ptr<RenderGroup> const & group)
   {
+    // Restored groups are dropped on the first freshly read data for their
+    // tile, even of the same generation, to not duplicate the new groups.
     return group->GetTileKey() == tileKey && (group->GetTileKey().m_generation < tileKey.m_generation ||
+        group->IsRestoredFromCache() ||
         (group->IsUserMark() && group->GetTileKey().m_userMarksGeneration < tileKey.m_userMarksGeneration));
   };
   RemoveRenderGroupsLater(removePredicate);
@@ -1201,7 +1268,7 @@ void FrontendRenderer::ProcessSelection(ref_ptr<SelectObjectMessage> msg)
 
 void FrontendRenderer::BeginUpdateOverlayTree(ScreenBase const & modelView)
 {
-  if (m_overlayTree->Frame())
+  if (m_overlayTree->Frame(modelView))
     m_overlayTree->StartOverlayPlacing(modelView, m_currentZoomLevel);
 }
 
@@ -1240,6 +1307,9 @@ void FrontendRenderer::RenderScene(ScreenBase const & modelView, bool activeFram
 #if defined(DRAPE_MEASURER) && (defined(RENDER_STATISTIC) || defined(TRACK_GPU_MEM))
   DrapeMeasurer::Instance().BeforeRenderFrame();
 #endif
+#if defined(DRAPE_MEASURER) && defined(TRACE_STATISTIC)
+  DrapeMeasurer::TraceGuard traceGuard("Draw");
+#endif
 
   CHECK(m_context != nullptr, ());
   if (m_postprocessRenderer->BeginFrame(m_context, activeFrame))
@@ -1249,10 +1319,13 @@ void FrontendRenderer::RenderScene(ScreenBase const & modelView, bool activeFram
     m_context->ApplyFramebuffer("Static frame");
     m_viewport.Apply(m_context);
 
+    RenderTileSnapshot(modelView);
+
     Render2dLayer(modelView);
     RenderUserMarksLayer(modelView, DepthLayer::UserLineLayer);
 
-    if (m_buildingsFramebuffer->IsSupported())
+    if (m_buildingsFramebuffer->IsSupported() &&
+        m_frameBudgetGovernor.m_reducedDetailLevel < 2)
     {
       RenderTrafficLayer(modelView);
       if (!HasTransitRouteData())
@@ -1320,6 +1393,8 @@ void FrontendRenderer::RenderScene(ScreenBase const & modelView, bool activeFram
 
     for (auto const & arrow : m_overlayTree->GetDisplacementInfo())
       m_debugRectRenderer->DrawArrow(m_context, modelView, arrow);
+
+    UpdateTileSnapshot(modelView);
   }
 
   if (!m_postprocessRenderer->EndFrame(m_context, make_ref(m_gpuProgramManager), m_viewport))
@@ -1345,8 +1420,19 @@ void FrontendRenderer::Render2dLayer(ScreenBase const & modelView)
   layer2d.Sort(make_ref(m_overlayTree));
 
   CHECK(m_context != nullptr, ());
+  // Groups are sorted by state, so the state of a group equal to the state
+  // of the previously rendered one is not reapplied.
+  // Debug rect rendering binds its own program inside a group, so state
+  // reuse between groups is only possible while it is disabled.
+  bool const stateReuseAllowed = m_debugRectRenderer == nullptr || !m_debugRectRenderer->IsEnabled();
+  dp::RenderState const * prevState = nullptr;
   for (drape_ptr<RenderGroup> const & group : layer2d.m_renderGroups)
-    RenderSingleGroup(m_context, modelView, make_ref(group));
+  {
+    bool const applyState = !stateReuseAllowed || prevState == nullptr ||
+                            !(group->GetState() == *prevState);
+    RenderSingleGroup(m_context, modelView, make_ref(group), applyState);
+    prevState = &group->GetState();
+  }
 }
 
 void FrontendRenderer::Render3dLayer(ScreenBase const & modelView, bool useFramebuffer)
@@ -1372,8 +1458,15 @@ void FrontendRenderer::Render3dLayer(ScreenBase const & modelView, bool useFrame
   }
 
   layer.Sort(make_ref(m_overlayTree));
+  bool const stateReuseAllowed = m_debugRectRenderer == nullptr || !m_debugRectRenderer->IsEnabled();
+  dp::RenderState const * prevState = nullptr;
   for (drape_ptr<RenderGroup> const & group : layer.m_renderGroups)
-    RenderSingleGroup(m_context, modelView, make_ref(group));
+  {
+    bool const applyState = !stateReuseAllowed || prevState == nullptr ||
+                            !(group->GetState() == *prevState);
+    RenderSingleGroup(m_context, modelView, make_ref(group), applyState);
+    prevState = &group->GetState();
+  }
 
   if (useFramebuffer)
   {
@@ -1393,8 +1486,16 @@ void FrontendRenderer::RenderOverlayLayer(ScreenBase const & modelView)
   CHECK(m_context != nullptr, ());
   RenderLayer & overlay = m_layers[static_cast<size_t>(DepthLayer::OverlayLayer)];
   BuildOverlayTree(modelView);
+  // Overlays keep their tile order, only runs of equal states are merged.
+  bool const stateReuseAllowed = m_debugRectRenderer == nullptr || !m_debugRectRenderer->IsEnabled();
+  dp::RenderState const * prevState = nullptr;
   for (drape_ptr<RenderGroup> & group : overlay.m_renderGroups)
-    RenderSingleGroup(m_context, modelView, make_ref(group));
+  {
+    bool const applyState = !stateReuseAllowed || prevState == nullptr ||
+                            !(group->GetState() == *prevState);
+    RenderSingleGroup(m_context, modelView, make_ref(group), applyState);
+    prevState = &group->GetState();
+  }
 
   if (GetStyleReader().IsCarNavigationStyle())
     RenderNavigationOverlayLayer(modelView);
@@ -1461,6 +1562,74 @@ void FrontendRenderer::RenderTransitBackground()
                                      region.GetTexture(), 1.0f /* opacity */, false /* invertV */);
 }
 
+void FrontendRenderer::UpdateTileSnapshot(ScreenBase const & modelView)
+{
+  if (m_tileSnapshotFramebuffer == nullptr || !m_tileSnapshotFramebuffer->IsSupported())
+    return;
+
+  // Capture only a stable viewport: every requested tile has been read and the
+  // map is not moving, so the geometry layer shows a complete scene.
+  if (modelView.isPerspective() || !m_notFinishedTiles.empty() ||
+      AnimationSystem::Instance().HasMapAnimations() || m_userEventStream.IsInUserAction())
+    return;
+
+  double const kEps = 1e-5;
+  if (m_tileSnapshotValid &&
+      m2::IsEqual(m_tileSnapshotScreen.ClipRect(), modelView.ClipRect(), kEps, kEps) &&
+      fabs(m_tileSnapshotScreen.GetAngle() - modelView.GetAngle()) < kEps)
+    return;
+
+  CHECK(m_context != nullptr, ());
+  m_context->SetFramebuffer(make_ref(m_tileSnapshotFramebuffer));
+  RefreshBgColor();
+  m_context->Clear(dp::ClearBits::ColorBit | dp::ClearBits::DepthBit);
+  m_context->ApplyFramebuffer("Tile snapshot");
+  dp::Viewport const snapshotViewport(0, 0, std::max(m_viewport.GetWidth() / 2, 1u),
+                                      std::max(m_viewport.GetHeight() / 2, 1u));
+  snapshotViewport.Apply(m_context);
+
+  Render2dLayer(modelView);
+
+  m_tileSnapshotFramebuffer->ApplyFallback();
+  m_context->ApplyFramebuffer("Static frame (after tile snapshot)");
+  m_viewport.Apply(m_context);
+
+  m_tileSnapshotScreen = modelView;
+  m_tileSnapshotValid = true;
+}
+
+void FrontendRenderer::RenderTileSnapshot(ScreenBase const & modelView)
+{
+  if (!m_tileSnapshotValid || m_notFinishedTiles.empty())
+    return;
+
+  // The snapshot stays an axis-aligned rect on the current screen only while
+  // the rotation is unchanged and perspective is off.
+  double const kEps = 1e-5;
+  if (modelView.isPerspective() ||
+      fabs(m_tileSnapshotScreen.GetAngle() - modelView.GetAngle()) >= kEps)
+    return;
+
+  m2::RectD const savedPixelRect = m_tileSnapshotScreen.PixelRect();
+  m2::PointD const lt = modelView.GtoP(m_tileSnapshotScreen.PtoG(savedPixelRect.LeftTop()));
+  m2::PointD const rb = modelView.GtoP(m_tileSnapshotScreen.PtoG(savedPixelRect.RightBottom()));
+
+  m2::RectD const pixelRect = modelView.PixelRect();
+  auto const toNdcX = [&pixelRect](double x) { return 2.0 * x / pixelRect.SizeX() - 1.0; };
+  auto const toNdcY = [&pixelRect](double y) { return 1.0 - 2.0 * y / pixelRect.SizeY(); };
+  m2::RectF const screenRect(static_cast<float>(toNdcX(lt.x)), static_cast<float>(toNdcY(rb.y)),
+                             static_cast<float>(toNdcX(rb.x)), static_cast<float>(toNdcY(lt.y)));
+  if (screenRect.minX() >= 1.0f || screenRect.maxX() <= -1.0f ||
+      screenRect.minY() >= 1.0f || screenRect.maxY() <= -1.0f)
+    return;
+
+  CHECK(m_context != nullptr, ());
+  m_tileSnapshotRenderer->SetScreenRect(screenRect);
+  m_tileSnapshotRenderer->RenderTexture(m_context, make_ref(m_gpuProgramManager),
+                                        m_tileSnapshotFramebuffer->GetTexture(),
+                                        1.0f /* opacity */);
+}
+
 void FrontendRenderer::RenderRouteLayer(ScreenBase const & modelView)
 {
   if (HasTransitRouteData())
@@ -1484,8 +1653,15 @@ void FrontendRenderer::RenderUserMarksLayer(ScreenBase const & modelView, DepthL
   CHECK(m_context != nullptr, ());
   m_context->Clear(dp::ClearBits::DepthBit);
 
+  bool const stateReuseAllowed = m_debugRectRenderer == nullptr || !m_debugRectRenderer->IsEnabled();
+  dp::RenderState const * prevState = nullptr;
   for (drape_ptr<RenderGroup> & group : renderGroups)
-    RenderSingleGroup(m_context, modelView, make_ref(group));
+  {
+    bool const applyState = !stateReuseAllowed || prevState == nullptr ||
+                            !(group->GetState() == *prevState);
+    RenderSingleGroup(m_context, modelView, make_ref(group), applyState);
+    prevState = &group->GetState();
+  }
 }
 
 void FrontendRenderer::RenderSearchMarksLayer(ScreenBase const & modelView)
@@ -1620,12 +1796,62 @@ void FrontendRenderer::RenderFrame()
   }
 
   m_frameData.m_frameTime = m_frameData.m_timer.ElapsedSeconds();
+  UpdateFrameBudget(isActiveFrameForScene, m_frameData.m_frameTime,
+                    (m_apiVersion == dp::ApiVersion::Metal) ? kVSyncIntervalMetal : kVSyncInterval);
   scaleFpsHelper.SetFrameTime(m_frameData.m_frameTime,
     m_frameData.m_inactiveFramesCounter + 1 < FrameData::kMaxInactiveFrames);
 }
 
+void FrontendRenderer::UpdateFrameBudget(bool activeFrame, double frameTime, double vsyncInterval)
+{
+  auto & governor = m_frameBudgetGovernor;
+  if (!activeFrame)
+  {
+    // Inactive frames are cheap and say nothing about the scene cost.
+    governor.m_framesOverBudget = 0;
+    return;
+  }
+
+  if (frameTime > 1.5 * vsyncInterval)
+  {
+    governor.m_framesWithHeadroom = 0;
+    if (++governor.m_framesOverBudget >= FrameBudgetGovernor::kFramesToReduce &&
+        governor.m_reducedDetailLevel < FrameBudgetGovernor::kMaxReducedDetailLevel)
+    {
+      governor.m_framesOverBudget = 0;
+      ++governor.m_reducedDetailLevel;
+      ApplyReducedDetailLevel();
+    }
+  }
+  else if (frameTime < 0.9 * vsyncInterval)
+  {
+    governor.m_framesOverBudget = 0;
+    if (++governor.m_framesWithHeadroom >= FrameBudgetGovernor::kFramesToRestore &&
+        governor.m_reducedDetailLevel > 0)
+    {
+      governor.m_framesWithHeadroom = 0;
+      --governor.m_reducedDetailLevel;
+      ApplyReducedDetailLevel();
+    }
+  }
+}
+
+void FrontendRenderer::ApplyReducedDetailLevel()
+{
+  int const level = m_frameBudgetGovernor.m_reducedDetailLevel;
+  LOG(LINFO, ("Rendering detail level is changed, reduction level =", level));
+
+  // Level 1 turns off the antialiasing pass, level 2 additionally makes
+  // 3d buildings bypass the separate framebuffer (see RenderScene()).
+  m_postprocessRenderer->SetEffectEnabled(m_context, PostprocessRenderer::Antialiasing,
+                                          level < 1 ? m_isAntialiasingEnabled : false);
+}
+
 void FrontendRenderer::BuildOverlayTree(ScreenBase const & modelView)
 {
+#if defined(DRAPE_MEASURER) && defined(TRACE_STATISTIC)
+  DrapeMeasurer::TraceGuard traceGuard("OverlayResolve");
+#endif
   static std::vector<DepthLayer> layers = {DepthLayer::OverlayLayer,
                                            DepthLayer::LocalAdsMarkLayer,
                                            DepthLayer::NavigationLayer,
@@ -1646,6 +1872,9 @@ void FrontendRenderer::BuildOverlayTree(ScreenBase const & modelView)
 
 void FrontendRenderer::PrepareBucket(dp::RenderState const & state, drape_ptr<dp::RenderBucket> & bucket)
 {
+#if defined(DRAPE_MEASURER) && defined(TRACE_STATISTIC)
+  DrapeMeasurer::TraceGuard traceGuard("Upload");
+#endif
   CHECK(m_context != nullptr, ());
   auto program = m_gpuProgramManager->GetProgram(state.GetProgram<gpu::Program>());
   auto program3d = m_gpuProgramManager->GetProgram(state.GetProgram3d<gpu::Program>());
@@ -1659,11 +1888,11 @@ void FrontendRenderer::PrepareBucket(dp::RenderState const & state, drape_ptr<dp
 
 void FrontendRenderer::RenderSingleGroup(ref_ptr<dp::GraphicsContext> context,
                                          ScreenBase const & modelView,
-                                         ref_ptr<BaseRenderGroup> group)
+                                         ref_ptr<BaseRenderGroup> group, bool applyState)
 {
   group->UpdateAnimation();
   group->Render(context, make_ref(m_gpuProgramManager), modelView, m_frameValues,
-                make_ref(m_debugRectRenderer));
+                make_ref(m_debugRectRenderer), applyState);
 }
 
 void FrontendRenderer::RefreshProjection(ScreenBase const & screen)
@@ -1964,23 +2193,54 @@ TTilesCollection FrontendRenderer::ResolveTileKeys(ScreenBase const & screen)
     }
   });
 
-  // Remove old tiles.
+  // During a kinetic scroll the fling destination is known, so tiles of the
+  // target viewport are requested while the animation is still running.
+  // Groups read in advance are kept until the speculation is over.
+  m_speculativeTiles.clear();
+  if (AnimationSystem::Instance().FindAnimation<Animation>(Animation::Type::KineticScroll) != nullptr)
+  {
+    ScreenBase targetScreen;
+    AnimationSystem::Instance().GetTargetScreen(screen, targetScreen);
+    m2::RectD targetRect = targetScreen.ClipRect();
+    targetRect.Inflate(extension, extension);
+    CalcTilesCoverage(targetRect, dataZoomLevel, [this, &targetRect, &tiles](int tileX, int tileY)
+    {
+      TileKey const key(tileX, tileY, m_currentZoomLevel);
+      if (targetRect.IsIntersect(key.GetGlobalRect()) && tiles.find(key) == tiles.end())
+      {
+        tiles.insert(key);
+        m_speculativeTiles.insert(key);
+      }
+    });
+  }
+
+  // Remove old tiles. Their render groups are detached into the cache,
+  // so coming back to a recently visited tile does not start from a blank one.
   auto removePredicate = [this, &result, &tilesToDelete](drape_ptr<RenderGroup> const & group)
   {
     TileKey const & key = group->GetTileKey();
     return group->GetTileKey().m_zoomLevel == m_currentZoomLevel &&
            (key.m_x < result.m_minTileX || key.m_x >= result.m_maxTileX ||
            key.m_y < result.m_minTileY || key.m_y >= result.m_maxTileY ||
-           std::find(tilesToDelete.begin(), tilesToDelete.end(), key) != tilesToDelete.end());
+           std::find(tilesToDelete.begin(), tilesToDelete.end(), key) != tilesToDelete.end()) &&
+           m_speculativeTiles.find(key) == m_speculativeTiles.end();
   };
   for (RenderLayer & layer : m_layers)
-    layer.m_isDirty |= RemoveGroups(removePredicate, layer.m_renderGroups, make_ref(m_overlayTree));
+  {
+    layer.m_isDirty |= RemoveGroups(removePredicate, layer.m_renderGroups, make_ref(m_overlayTree),
+                                    [this](drape_ptr<RenderGroup> && group)
+    {
+      CacheRenderGroup(std::move(group));
+    });
+  }
 
   RemoveRenderGroupsLater([this](drape_ptr<RenderGroup> const & group)
   {
     return group->GetTileKey().m_zoomLevel != m_currentZoomLevel;
   });
 
+  RestoreCachedRenderGroups(tiles);
+
   m_trafficRenderer->OnUpdateViewport(result, m_currentZoomLevel, tilesToDelete);
 
 #if defined(DRAPE_MEASURER) && defined(GENERATING_STATISTIC)
@@ -2000,6 +2260,7 @@ void FrontendRenderer::OnContextDestroy()
     layer.m_renderGroups.clear();
     layer.m_isDirty = false;
   }
+  ClearRenderGroupsCache();
 
   m_selectObjectMessage.reset();
   m_overlayTree->SetSelectedFeature(FeatureID());
@@ -2010,6 +2271,9 @@ void FrontendRenderer::OnContextDestroy()
   m_selectionShape.reset();
   m_buildingsFramebuffer.reset();
   m_screenQuadRenderer.reset();
+  m_tileSnapshotFramebuffer.reset();
+  m_tileSnapshotRenderer.reset();
+  m_tileSnapshotValid = false;
 
   m_myPositionController->ResetRenderShape();
   m_routeRenderer->ClearContextDependentResources();
@@ -2093,6 +2357,16 @@ void FrontendRenderer::OnContextCreate()
     return m_postprocessRenderer->OnFramebufferFallback(m_context);
   });
 
+  m_tileSnapshotFramebuffer = make_unique_dp<dp::Framebuffer>(dp::TextureFormat::RGBA8,
+                                                              true /* depthEnabled */,
+                                                              false /* stencilEnabled */);
+  m_tileSnapshotFramebuffer->SetFramebufferFallback([this]()
+  {
+    return m_postprocessRenderer->OnFramebufferFallback(m_context);
+  });
+  m_tileSnapshotRenderer = make_unique_dp<ScreenQuadRenderer>(m_context);
+  m_tileSnapshotValid = false;
+
   m_transitBackground = make_unique_dp<ScreenQuadRenderer>(m_context);
 }
 
@@ -2137,6 +2411,7 @@ void FrontendRenderer::ReleaseResources()
 {
   for (RenderLayer & layer : m_layers)
     layer.m_renderGroups.clear();
+  ClearRenderGroupsCache();
 
   m_guiRenderer.reset();
   m_myPositionController.reset();
@@ -2144,6 +2419,8 @@ void FrontendRenderer::ReleaseResources()
   m_routeRenderer.reset();
   m_buildingsFramebuffer.reset();
   m_screenQuadRenderer.reset();
+  m_tileSnapshotFramebuffer.reset();
+  m_tileSnapshotRenderer.reset();
   m_trafficRenderer.reset();
   m_transitSchemeRenderer.reset();
   m_postprocessRenderer.reset();
@@ -36,6 +36,8 @@
 
 #include <array>
 #include <functional>
+#include <map>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -146,7 +148,7 @@ private:
   void RenderScene(ScreenBase const & modelView, bool activeFrame);
   void PrepareBucket(dp::RenderState const & state, drape_ptr<dp::RenderBucket> & bucket);
   void RenderSingleGroup(ref_ptr<dp::GraphicsContext> context, ScreenBase const & modelView,
-                         ref_ptr<BaseRenderGroup> group);
+                         ref_ptr<BaseRenderGroup> group, bool applyState = true);
   void RefreshProjection(ScreenBase const & screen);
   void RefreshZScale(ScreenBase const & screen);
   void RefreshPivotTransform(ScreenBase const & screen);
@@ -159,6 +161,18 @@ private:
 
     void Sort(ref_ptr<dp::OverlayTree> overlayTree);
   };
+
+  // Render groups of recently hidden tiles are kept for a while, so panning
+  // back to them shows the last known content immediately, while the tiles
+  // are reread in background as usual.
+  struct CachedTileGroups
+  {
+    std::vector<drape_ptr<RenderGroup>> m_groups;
+    uint64_t m_lastUsed = 0;
+  };
+  void CacheRenderGroup(drape_ptr<RenderGroup> && group);
+  void RestoreCachedRenderGroups(TTilesCollection const & tiles);
+  void ClearRenderGroupsCache();
   // Render part of scene
   void Render2dLayer(ScreenBase const & modelView);
   void Render3dLayer(ScreenBase const & modelView, bool useFramebuffer);
@@ -170,8 +184,15 @@ private:
   void RenderRouteLayer(ScreenBase const & modelView);
   void RenderSearchMarksLayer(ScreenBase const & modelView);
   void RenderTransitBackground();
+  // A low-resolution snapshot of the geometry layer is captured on a stable
+  // viewport and shown under the scene while the tiles of a new viewport are
+  // still generating, so panning and zooming never uncover the bare background.
+  void UpdateTileSnapshot(ScreenBase const & modelView);
+  void RenderTileSnapshot(ScreenBase const & modelView);
   void RenderEmptyFrame();
   void RenderFrame();
+  void UpdateFrameBudget(bool activeFrame, double frameTime, double vsyncInterval);
+  void ApplyReducedDetailLevel();
 
   bool HasTransitRouteData() const;
   bool HasRouteData() const;
@@ -260,6 +281,8 @@ private:
   drape_ptr<gpu::ProgramManager> m_gpuProgramManager;
 
   std::array<RenderLayer, static_cast<size_t>(DepthLayer::LayersCount)> m_layers;
+  std::unordered_map<TileKey, CachedTileGroups, TileKeyHasher> m_renderGroupsCache;
+  uint64_t m_renderGroupsCacheUsageCounter = 0;
 
   drape_ptr<gui::LayerRenderer> m_guiRenderer;
   gui::TWidgetsLayoutInfo m_lastWidgetsLayout;
@@ -270,6 +293,10 @@ private:
   drape_ptr<TransitSchemeRenderer> m_transitSchemeRenderer;
   drape_ptr<dp::Framebuffer> m_buildingsFramebuffer;
   drape_ptr<ScreenQuadRenderer> m_screenQuadRenderer;
+  drape_ptr<dp::Framebuffer> m_tileSnapshotFramebuffer;
+  drape_ptr<ScreenQuadRenderer> m_tileSnapshotRenderer;
+  ScreenBase m_tileSnapshotScreen;
+  bool m_tileSnapshotValid = false;
   drape_ptr<GpsTrackRenderer> m_gpsTrackRenderer;
   drape_ptr<DrapeApiRenderer> m_drapeApiRenderer;
 
@@ -293,6 +320,9 @@ private:
 
   ScreenBase m_lastReadedModelView;
   TTilesCollection m_notFinishedTiles;
+  // Tiles of the predicted end-of-fling viewport, requested speculatively
+  // while the kinetic scroll animation is still running.
+  TTilesCollection m_speculativeTiles;
 
   int m_currentZoomLevel = -1;
 
@@ -366,6 +396,21 @@ private:
   };
   FrameData m_frameData;
 
+  // Adapts rendering detail to the measured frame time: when active frames
+  // keep blowing past the vsync budget, expensive passes are turned off one
+  // by one and restored after a long period of headroom.
+  struct FrameBudgetGovernor
+  {
+    static int constexpr kMaxReducedDetailLevel = 2;
+    static uint32_t constexpr kFramesToReduce = 30;
+    static uint32_t constexpr kFramesToRestore = 600;
+
+    int m_reducedDetailLevel = 0;
+    uint32_t m_framesOverBudget = 0;
+    uint32_t m_framesWithHeadroom = 0;
+  };
+  FrameBudgetGovernor m_frameBudgetGovernor;
+
 #ifdef DEBUG
   bool m_isTeardowned;
 #endif
@@ -1,5 +1,6 @@
 #include "drape_frontend/message_acceptor.hpp"
 
+#include "drape_frontend/drape_measurer.hpp"
 #include "drape_frontend/message.hpp"
 
 namespace df
@@ -17,6 +18,9 @@ bool MessageAcceptor::ProcessSingleMessage(bool waitForMessage)
   if (message == nullptr)
     return false;
 
+#if defined(DRAPE_MEASURER) && defined(TRACE_STATISTIC)
+  DrapeMeasurer::TraceGuard traceGuard("MessageDispatch");
+#endif
   AcceptMessage(make_ref(message));
   return true;
 }
@@ -17,6 +17,13 @@ MessageQueue::~MessageQueue()
 
 drape_ptr<Message> MessageQueue::PopMessage(bool waitForMessage)
 {
+  if (!m_batchedMessages.empty())
+  {
+    drape_ptr<Message> msg = std::move(m_batchedMessages.front());
+    m_batchedMessages.pop_front();
+    return msg;
+  }
+
   std::unique_lock<std::mutex> lock(m_mutex);
   if (waitForMessage && m_messages.empty() && m_lowPriorityMessages.empty())
   {
@@ -30,8 +37,18 @@ drape_ptr<Message> MessageQueue::PopMessage(bool waitForMessage)
 
   if (!m_messages.empty())
   {
-    drape_ptr<Message> msg = std::move(m_messages.front().first);
-    m_messages.pop_front();
+    // Drain a run of messages at once, the batch is bounded so that a high
+    // priority message pushed in the meantime still overtakes the backlog.
+    size_t constexpr kMaxBatchSize = 8;
+    while (!m_messages.empty() && m_batchedMessages.size() < kMaxBatchSize)
+    {
+      m_batchedMessages.emplace_back(std::move(m_messages.front().first));
+      m_messages.pop_front();
+    }
+    lock.unlock();
+
+    drape_ptr<Message> msg = std::move(m_batchedMessages.front());
+    m_batchedMessages.pop_front();
     return msg;
   }
 
@@ -42,7 +59,8 @@ drape_ptr<Message> MessageQueue::PopMessage(bool waitForMessage)
 
 void MessageQueue::PushMessage(drape_ptr<Message> && message, MessagePriority priority)
 {
-  std::lock_guard<std::mutex> lock(m_mutex);
+  bool needNotify = false;
+  std::unique_lock<std::mutex> lock(m_mutex);
 
   if (m_filter != nullptr && m_filter(make_ref(message)))
     return;
@@ -88,7 +106,14 @@ void MessageQueue::PushMessage(drape_ptr<Message> && message, MessagePriority pr
     ASSERT(false, ("Unknown message priority type"));
   }
 
-  CancelWaitImpl();
+  needNotify = m_isWaiting;
+  m_isWaiting = false;
+  lock.unlock();
+
+  // Notify outside of the lock, so the woken consumer does not immediately
+  // block on the mutex still held by the producer.
+  if (needNotify)
+    m_condition.notify_all();
 }
 
 void MessageQueue::FilterMessagesImpl()
@@ -110,6 +135,15 @@ void MessageQueue::FilterMessagesImpl()
     else
       ++it;
   }
+
+  // Filtering is enabled by the consumer thread, so its batch is accessible here.
+  for (auto it = m_batchedMessages.begin(); it != m_batchedMessages.end(); )
+  {
+    if (m_filter(make_ref(*it)))
+      it = m_batchedMessages.erase(it);
+    else
+      ++it;
+  }
 }
 
 void MessageQueue::EnableMessageFiltering(FilterMessageFn && filter)
@@ -129,13 +163,13 @@ void MessageQueue::DisableMessageFiltering()
 bool MessageQueue::IsEmpty() const
 {
   std::lock_guard<std::mutex> lock(m_mutex);
-  return m_messages.empty() && m_lowPriorityMessages.empty();
+  return m_messages.empty() && m_lowPriorityMessages.empty() && m_batchedMessages.empty();
 }
 
 size_t MessageQueue::GetSize() const
 {
   std::lock_guard<std::mutex> lock(m_mutex);
-  return m_messages.size() + m_lowPriorityMessages.size();
+  return m_messages.size() + m_lowPriorityMessages.size() + m_batchedMessages.size();
 }
 #endif
 
@@ -158,5 +192,6 @@ void MessageQueue::ClearQuery()
 {
   m_messages.clear();
   m_lowPriorityMessages.clear();
+  m_batchedMessages.clear();
 }
 }  // namespace df
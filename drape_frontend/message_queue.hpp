@@ -45,6 +45,9 @@ private:
   using TMessageNode = std::pair<drape_ptr<Message>, MessagePriority>;
   std::deque<TMessageNode> m_messages;
   std::deque<drape_ptr<Message>> m_lowPriorityMessages;
+  // Owned by the single consumer thread: PopMessage() drains a small run of
+  // messages under one lock acquisition and then serves them lock-free.
+  std::deque<drape_ptr<Message>> m_batchedMessages;
   FilterMessageFn m_filter;
 };
 }  // namespace df
@@ -5,10 +5,15 @@
 
 #include "drape/constants.hpp"
 
+#include "platform/platform.hpp"
+
 #include "base/buffer_vector.hpp"
+#include "base/math.hpp"
 #include "base/stl_helpers.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <functional>
 
 namespace df
@@ -35,8 +40,60 @@ struct LessCoverageCell
     return l->GetTileKey() < r->GetTileKey();
   }
 };
+
+// The point the user is most likely looking at: the screen center,
+// extrapolated one coverage update ahead along the pan direction, so
+// that during a fast pan the tiles the viewport is moving into are read
+// before the ones it is leaving. A jump between unrelated viewports
+// (bookmark, search result) is not a pan and is not extrapolated.
+m2::PointD GetFocusPoint(ScreenBase const & screen, ScreenBase const & prevScreen)
+{
+  m2::PointD const center = screen.GlobalRect().GlobalCenter();
+  if (df::GetDrawTileScale(screen) != df::GetDrawTileScale(prevScreen))
+    return center;
+
+  m2::PointD const shift = center - prevScreen.GlobalRect().GlobalCenter();
+  m2::RectD const & clipRect = screen.ClipRect();
+  if (fabs(shift.x) > clipRect.SizeX() || fabs(shift.y) > clipRect.SizeY())
+    return center;
+
+  return center + shift;
+}
+
+// Orders |tiles| so that the ones closest to |focus| come first. The
+// focused tiles are usually the heaviest to read (city centers against
+// oceans), and the reading pool picks tasks in push order, so this
+// starts decoding them while the cheap peripheral tiles fill the
+// remaining threads instead of leaving the heavy ones to the tail,
+// where part of the pool is already idle.
+template <typename TileCont>
+buffer_vector<TileKey, 8> SortTilesCenterFirst(TileCont const & tiles, m2::PointD const & focus)
+{
+  buffer_vector<TileKey, 8> keys(tiles.begin(), tiles.end());
+  if (keys.empty())
+    return keys;
+
+  TileKey const centerKey = GetTileKeyByPoint(focus, keys.front().m_zoomLevel);
+  std::sort(keys.begin(), keys.end(), [&centerKey](TileKey const & l, TileKey const & r)
+  {
+    int const lDist = std::abs(l.m_x - centerKey.m_x) + std::abs(l.m_y - centerKey.m_y);
+    int const rDist = std::abs(r.m_x - centerKey.m_x) + std::abs(r.m_y - centerKey.m_y);
+    return lDist < rDist;
+  });
+  return keys;
+}
 }  // namespace
 
+uint8_t GetReadingThreadsCount()
+{
+  // Two threads always fit, low-end devices have no cores to spare for
+  // more; on big devices extra threads cut the coverage reading time on
+  // dense viewports.
+  static uint8_t const count = static_cast<uint8_t>(
+      base::clamp(GetPlatform().CpuCores() / 2, 2U, 4U));
+  return count;
+}
+
 bool ReadManager::LessByTileInfo::operator()(std::shared_ptr<TileInfo> const & l,
                                              std::shared_ptr<TileInfo> const & r) const
 {
@@ -68,7 +125,7 @@ void ReadManager::Start()
     return;
 
   using namespace std::placeholders;
-  m_pool = make_unique_dp<threads::ThreadPool>(kReadingThreadsCount,
+  m_pool = make_unique_dp<threads::ThreadPool>(GetReadingThreadsCount(),
                                                std::bind(&ReadManager::OnTaskFinished, this, _1));
 }
 
@@ -137,6 +194,8 @@ void ReadManager::UpdateCoverage(ScreenBase const & screen, bool have3dBuildings
   m_modeChanged |= (m_have3dBuildings != have3dBuildings);
   m_have3dBuildings = have3dBuildings;
 
+  m2::PointD const focusPoint = GetFocusPoint(screen, m_currentViewport);
+
   if (m_modeChanged || forceUpdate || MustDropAllTiles(screen))
   {
     m_modeChanged = false;
@@ -149,7 +208,7 @@ void ReadManager::UpdateCoverage(ScreenBase const & screen, bool have3dBuildings
     ++m_generationCounter;
     ++m_userMarksGenerationCounter;
 
-    for (auto const & tileKey : tiles)
+    for (auto const & tileKey : SortTilesCenterFirst(tiles, focusPoint))
       PushTaskBackForTileKey(tileKey, texMng, metalineMng);
   }
   else
@@ -179,7 +238,7 @@ void ReadManager::UpdateCoverage(ScreenBase const & screen, bool have3dBuildings
     if (forceUpdateUserMarks)
       ++m_userMarksGenerationCounter;
     CheckFinishedTiles(readyTiles, forceUpdateUserMarks);
-    for (auto const & tileKey : newTiles)
+    for (auto const & tileKey : SortTilesCenterFirst(newTiles, focusPoint))
       PushTaskBackForTileKey(tileKey, texMng, metalineMng);
   }
 
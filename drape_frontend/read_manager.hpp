@@ -27,7 +27,8 @@ namespace df
 class MapDataProvider;
 class MetalineManager;
 
-uint8_t constexpr kReadingThreadsCount = 2;
+// Depends on the number of CPU cores, stable for the process lifetime.
+uint8_t GetReadingThreadsCount();
 
 class ReadManager
 {
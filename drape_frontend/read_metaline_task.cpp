@@ -7,6 +7,8 @@
 #include "drape_frontend/threads_commutator.hpp"
 
 #include "coding/file_container.hpp"
+#include "coding/geometry_coding.hpp"
+#include "coding/pointd_to_pointu.hpp"
 #include "coding/reader_wrapper.hpp"
 #include "coding/varint.hpp"
 
@@ -28,6 +30,9 @@ struct MetalineData
 {
   std::vector<FeatureID> m_features;
   std::set<FeatureID> m_reversed;
+  // Merged spline geometry, precomputed by the generator since section
+  // version 2. Empty for old maps, where features are read and merged here.
+  std::vector<m2::PointD> m_points;
 };
 
 std::vector<MetalineData> ReadMetalinesFromFile(MwmSet::MwmId const & mwmId)
@@ -56,6 +61,30 @@ std::vector<MetalineData> ReadMetalinesFromFile(MwmSet::MwmId const & mwmId)
           model.push_back(std::move(data));
       }
     }
+    else if (version == 2)
+    {
+      for (auto metalineIndex = ReadVarUint<uint32_t>(src); metalineIndex > 0; --metalineIndex)
+      {
+        MetalineData data {};
+        for (auto i = ReadVarUint<uint32_t>(src); i > 0; --i)
+        {
+          auto const fid = ReadVarInt<int32_t>(src);
+          data.m_features.emplace_back(mwmId, static_cast<uint32_t>(std::abs(fid)));
+        }
+
+        auto pointsCount = ReadVarUint<uint32_t>(src);
+        data.m_points.reserve(pointsCount);
+        m2::PointU prevPt(0, 0);
+        for (; pointsCount > 0; --pointsCount)
+        {
+          prevPt = coding::DecodePointDelta(src, prevPt);
+          data.m_points.push_back(PointUToPointD(prevPt, POINT_COORD_BITS));
+        }
+
+        if (!data.m_features.empty() && data.m_points.size() > 1)
+          model.push_back(std::move(data));
+      }
+    }
     return model;
   }
   catch (Reader::Exception const &)
@@ -155,7 +184,7 @@ void ReadMetalineTask::Run()
     return;
 
   auto metalines = ReadMetalinesFromFile(m_mwmId);
-  for (auto const & metaline : metalines)
+  for (auto & metaline : metalines)
   {
     if (m_isCancelled)
       return;
@@ -172,13 +201,22 @@ void ReadMetalineTask::Run()
     if (failed)
       continue;
 
-    auto const points = ReadPoints(m_model, metaline);
-    if (points.size() != metaline.m_features.size())
-      continue;
+    std::vector<m2::PointD> mergedPoints;
+    if (!metaline.m_points.empty())
+    {
+      // The generator has done the merge, the spline is ready to use.
+      mergedPoints = std::move(metaline.m_points);
+    }
+    else
+    {
+      auto const points = ReadPoints(m_model, metaline);
+      if (points.size() != metaline.m_features.size())
+        continue;
 
-    std::vector<m2::PointD> const mergedPoints = MergePoints(points, metaline.m_features);
-    if (mergedPoints.empty())
-      continue;
+      mergedPoints = MergePoints(points, metaline.m_features);
+      if (mergedPoints.empty())
+        continue;
+    }
 
     m2::SharedSpline const spline(mergedPoints);
     for (auto const & fid : metaline.m_features)
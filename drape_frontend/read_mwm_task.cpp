@@ -1,5 +1,7 @@
 #include "drape_frontend/read_mwm_task.hpp"
 
+#include "base/alloc_tracker.hpp"
+
 namespace df
 {
 ReadMWMTask::ReadMWMTask(MapDataProvider & model)
@@ -39,6 +41,8 @@ bool ReadMWMTask::IsCancelled() const
 
 void ReadMWMTask::Do()
 {
+  SCOPED_ALLOC_TAG("drape:read_tile");
+
 #ifdef DEBUG
   ASSERT(m_checker, ());
 #endif
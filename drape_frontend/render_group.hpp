@@ -37,8 +37,11 @@ public:
   TileKey const & GetTileKey() const { return m_tileKey; }
 
   virtual void UpdateAnimation();
+  // When applyState is false the program and the render state of the
+  // previously rendered group are reused without rebinding.
   virtual void Render(ref_ptr<dp::GraphicsContext> context, ref_ptr<gpu::ProgramManager> mng, ScreenBase const & screen,
-                      FrameValues const & frameValues, ref_ptr<DebugRectRenderer> debugRectRenderer) = 0;
+                      FrameValues const & frameValues, ref_ptr<DebugRectRenderer> debugRectRenderer,
+                      bool applyState) = 0;
 
 protected:
   dp::RenderState m_state;
@@ -61,7 +64,8 @@ public:
   void RemoveOverlay(ref_ptr<dp::OverlayTree> tree);
   void SetOverlayVisibility(bool isVisible);
   void Render(ref_ptr<dp::GraphicsContext> context, ref_ptr<gpu::ProgramManager> mng, ScreenBase const & screen,
-              FrameValues const & frameValues, ref_ptr<DebugRectRenderer> debugRectRenderer) override;
+              FrameValues const & frameValues, ref_ptr<DebugRectRenderer> debugRectRenderer,
+              bool applyState) override;
 
   void AddBucket(drape_ptr<dp::RenderBucket> && bucket);
 
@@ -71,6 +75,11 @@ public:
   bool IsPendingOnDelete() const { return m_pendingOnDelete; }
   bool CanBeDeleted() const { return m_canBeDeleted; }
 
+  // Restored groups show the last known content of a tile and must be
+  // replaced as soon as any freshly read data for this tile arrives.
+  void SetRestoredFromCache() { m_restoredFromCache = true; }
+  bool IsRestoredFromCache() const { return m_restoredFromCache; }
+
   bool UpdateCanBeDeletedStatus(bool canBeDeleted, int currentZoom,
                                 ref_ptr<dp::OverlayTree> tree);
 
@@ -81,6 +90,7 @@ private:
   std::vector<drape_ptr<dp::RenderBucket>> m_renderBuckets;
   mutable bool m_pendingOnDelete;
   mutable bool m_canBeDeleted;
+  bool m_restoredFromCache;
 
 private:
   friend std::string DebugPrint(RenderGroup const & group);
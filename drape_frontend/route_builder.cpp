@@ -5,6 +5,15 @@
 #include "drape/graphics_context.hpp"
 #include "drape/texture_manager.hpp"
 
+#include <algorithm>
+
+namespace
+{
+// Long routes are built and flushed in chunks of this many polyline points,
+// so the head of the route becomes visible before the whole geometry is ready.
+size_t constexpr kMaxPointsPerChunk = 512;
+}  // namespace
+
 namespace df
 {
 RouteBuilder::RouteBuilder(FlushFn && flushFn, FlushArrowsFn && flushArrowsFn,
@@ -23,30 +32,51 @@ void RouteBuilder::Build(ref_ptr<dp::GraphicsContext> context, dp::DrapeID subro
   cacheData.m_baseDepthIndex = subroute->m_baseDepthIndex;
   m_routeCache[subrouteId] = std::move(cacheData);
 
-  std::vector<drape_ptr<df::SubrouteData>> subrouteData;
-  subrouteData.reserve(subroute->m_style.size());
-
   ASSERT(!subroute->m_style.empty(), ());
   for (size_t styleIndex = 0; styleIndex < subroute->m_style.size(); ++styleIndex)
   {
-    subrouteData.push_back(RouteShape::CacheRoute(context, subrouteId, subroute,
-                                                  styleIndex, recacheId, textures));
-  }
+    size_t startIndex;
+    size_t endIndex;
+    if (subroute->m_styleType == df::SubrouteStyleType::Single)
+    {
+      ASSERT_EQUAL(styleIndex, 0, ());
+      startIndex = 0;
+      endIndex = subroute->m_polyline.GetSize() - 1;
+    }
+    else
+    {
+      startIndex = subroute->m_style[styleIndex].m_startIndex;
+      endIndex = subroute->m_style[styleIndex].m_endIndex;
+    }
 
-  auto markersData = RouteShape::CacheMarkers(context, subrouteId, subroute, recacheId, textures);
+    // Build and flush the style's points range chunk by chunk from the start
+    // of the route: each chunk is renderable as soon as it is flushed, so on
+    // long routes the preview appears progressively instead of waiting for
+    // the whole subroute geometry.
+    for (size_t chunkStart = startIndex; chunkStart < endIndex;)
+    {
+      size_t const chunkEnd = std::min(chunkStart + kMaxPointsPerChunk, endIndex);
+      auto data = RouteShape::CacheRoute(context, subrouteId, subroute, styleIndex,
+                                         chunkStart, chunkEnd, recacheId, textures);
+      chunkStart = chunkEnd;
+      if (data == nullptr)
+        continue;
 
-  // Flush route geometry.
-  context->Flush();
+      // Flush route geometry.
+      context->Flush();
 
-  if (m_flushFn != nullptr)
-  {
-    for (auto & data : subrouteData)
-      m_flushFn(std::move(data));
-    subrouteData.clear();
+      if (m_flushFn != nullptr)
+        m_flushFn(std::move(data));
+    }
   }
 
-  if (m_flushMarkersFn != nullptr && markersData != nullptr)
-    m_flushMarkersFn(std::move(markersData));
+  auto markersData = RouteShape::CacheMarkers(context, subrouteId, subroute, recacheId, textures);
+  if (markersData != nullptr)
+  {
+    context->Flush();
+    if (m_flushMarkersFn != nullptr)
+      m_flushMarkersFn(std::move(markersData));
+  }
 }
 
 void RouteBuilder::ClearRouteCache()
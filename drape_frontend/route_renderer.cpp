@@ -47,6 +47,50 @@ uint32_t const kPreviewPointsCount = 512;
 
 double const kInvalidDistance = -1.0;
 
+void CalculatePointsDistances(m2::PolylineD const & polyline, std::vector<double> & distances)
+{
+  distances.clear();
+  auto const & points = polyline.GetPoints();
+  if (points.empty())
+    return;
+  distances.reserve(points.size());
+  double dist = 0.0;
+  distances.push_back(dist);
+  for (size_t i = 1; i < points.size(); ++i)
+  {
+    dist += points[i - 1].Length(points[i]);
+    distances.push_back(dist);
+  }
+}
+
+// Returns the point of the polyline lying at the given distance from its start.
+// In contrast with m2::Polyline::GetPointByDistance it uses the precalculated
+// points distances to find the segment, so a lookup does not iterate over
+// the whole polyline.
+m2::PointD GetPointByDistance(m2::PolylineD const & polyline,
+                              std::vector<double> const & distances, double distance)
+{
+  auto const & points = polyline.GetPoints();
+  ASSERT_EQUAL(points.size(), distances.size(), ());
+  if (distance <= 0.0)
+    return points.front();
+
+  auto const it = std::lower_bound(distances.begin(), distances.end(), distance);
+  if (it == distances.end())
+    return points.back();
+
+  auto const i = static_cast<size_t>(std::distance(distances.begin(), it));
+  if (i == 0)
+    return points.front();
+
+  double const segmentLength = distances[i] - distances[i - 1];
+  if (segmentLength == 0.0)
+    return points[i];
+
+  double const t = (distance - distances[i - 1]) / segmentLength;
+  return points[i - 1] * (1.0 - t) + points[i] * t;
+}
+
 void InterpolateByZoom(SubrouteConstPtr const & subroute, ScreenBase const & screen,
                        float & halfWidth, double & zoom)
 {
@@ -185,14 +229,16 @@ std::vector<ArrowBorders> CalculateArrowBorders(ScreenBase const & screen, float
       continue;
     }
 
-    m2::PointD pt = polyline.GetPointByDistance(arrowBorders.m_startDistance);
+    m2::PointD pt = GetPointByDistance(polyline, subrouteInfo.m_pointsDistances,
+                                       arrowBorders.m_startDistance);
     if (screenRect.IsPointInside(pt))
     {
       newArrowBorders.push_back(arrowBorders);
       continue;
     }
 
-    pt = polyline.GetPointByDistance(arrowBorders.m_endDistance);
+    pt = GetPointByDistance(polyline, subrouteInfo.m_pointsDistances,
+                            arrowBorders.m_endDistance);
     if (screenRect.IsPointInside(pt))
     {
       newArrowBorders.push_back(arrowBorders);
@@ -580,6 +626,7 @@ void RouteRenderer::AddSubrouteData(ref_ptr<dp::GraphicsContext> context,
         it->m_subroute = subrouteData->m_subroute;
         it->m_subrouteId = subrouteData->m_subrouteId;
         it->m_length = subrouteData->m_subroute->m_polyline.GetLength();
+        CalculatePointsDistances(subrouteData->m_subroute->m_polyline, it->m_pointsDistances);
       }
       else if (recacheId > subrouteData->m_recacheId)
       {
@@ -597,6 +644,7 @@ void RouteRenderer::AddSubrouteData(ref_ptr<dp::GraphicsContext> context,
     info.m_subroute = subrouteData->m_subroute;
     info.m_subrouteId = subrouteData->m_subrouteId;
     info.m_length = subrouteData->m_subroute->m_polyline.GetLength();
+    CalculatePointsDistances(subrouteData->m_subroute->m_polyline, info.m_pointsDistances);
     info.m_subrouteData.push_back(std::move(subrouteData));
     BuildBuckets(context, info.m_subrouteData.back()->m_renderProperty, mng);
     m_subroutes.push_back(std::move(info));
@@ -43,6 +43,9 @@ public:
     dp::DrapeID m_subrouteId = 0;
     SubrouteConstPtr m_subroute;
     double m_length = 0.0;
+    // Distances from the start of the subroute polyline to each of its points.
+    // They allow fast point-by-distance lookups while updating route arrows.
+    std::vector<double> m_pointsDistances;
     std::vector<drape_ptr<SubrouteData>> m_subrouteData;
 
     drape_ptr<SubrouteArrowsData> m_arrowsData;
@@ -514,35 +514,22 @@ void RouteShape::CacheRouteArrows(ref_ptr<dp::GraphicsContext> context,
 drape_ptr<df::SubrouteData> RouteShape::CacheRoute(ref_ptr<dp::GraphicsContext> context,
                                                    dp::DrapeID subrouteId,
                                                    SubrouteConstPtr subroute, size_t styleIndex,
+                                                   size_t startPointIndex, size_t endPointIndex,
                                                    int recacheId,
                                                    ref_ptr<dp::TextureManager> textures)
 {
-  size_t startIndex;
-  size_t endIndex;
-  if (subroute->m_styleType == df::SubrouteStyleType::Single)
-  {
-    ASSERT_EQUAL(styleIndex, 0, ());
-    startIndex = 0;
-    endIndex = subroute->m_polyline.GetSize() - 1;
-  }
-  else
-  {
-    auto const & style = subroute->m_style[styleIndex];
-    startIndex = style.m_startIndex;
-    endIndex = style.m_endIndex;
-  }
-
-  ASSERT_LESS(startIndex, endIndex, ());
+  ASSERT_LESS(startPointIndex, endPointIndex, ());
+  ASSERT_LESS(endPointIndex, subroute->m_polyline.GetSize(), ());
 
-  auto const points = subroute->m_polyline.ExtractSegment(startIndex, endIndex);
+  auto const points = subroute->m_polyline.ExtractSegment(startPointIndex, endPointIndex);
   if (points.empty())
     return nullptr;
 
   std::vector<glsl::vec4> segmentsColors;
   if (!subroute->m_traffic.empty())
   {
-    segmentsColors.reserve(endIndex - startIndex);
-    for (size_t i = startIndex; i < endIndex; ++i)
+    segmentsColors.reserve(endPointIndex - startPointIndex);
+    for (size_t i = startPointIndex; i < endPointIndex; ++i)
     {
       auto const speedGroup = TrafficGenerator::CheckColorsSimplification(subroute->m_traffic[i]);
       auto const colorConstant = TrafficGenerator::GetColorBySpeedGroup(speedGroup, true /* route */);
@@ -557,12 +544,12 @@ drape_ptr<df::SubrouteData> RouteShape::CacheRoute(ref_ptr<dp::GraphicsContext>
   auto subrouteData = make_unique_dp<df::SubrouteData>();
   subrouteData->m_subrouteId = subrouteId;
   subrouteData->m_subroute = subroute;
-  subrouteData->m_startPointIndex = startIndex;
-  subrouteData->m_endPointIndex = endIndex;
+  subrouteData->m_startPointIndex = startPointIndex;
+  subrouteData->m_endPointIndex = endPointIndex;
   subrouteData->m_styleIndex = styleIndex;
   subrouteData->m_pivot = subroute->m_polyline.GetLimitRect().Center();
   subrouteData->m_recacheId = recacheId;
-  subrouteData->m_distanceOffset = subroute->m_polyline.GetLength(startIndex);
+  subrouteData->m_distanceOffset = subroute->m_polyline.GetLength(startPointIndex);
 
   TGeometryBuffer geometry;
   TGeometryBuffer joinsGeometry;
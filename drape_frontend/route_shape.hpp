@@ -202,9 +202,13 @@ public:
   using MV = gpu::RouteMarkerVertex;
   using TMarkersGeometryBuffer = buffer_vector<MV, 32>;
 
+  // Caches the geometry of the points range [startPointIndex, endPointIndex]
+  // of the subroute's polyline. The range must lie inside the style's one, so
+  // a long subroute can be built and flushed in several chunks.
   static drape_ptr<df::SubrouteData> CacheRoute(ref_ptr<dp::GraphicsContext> context,
                                                 dp::DrapeID subrouteId, SubrouteConstPtr subroute,
-                                                size_t styleIndex, int recacheId,
+                                                size_t styleIndex, size_t startPointIndex,
+                                                size_t endPointIndex, int recacheId,
                                                 ref_ptr<dp::TextureManager> textures);
 
   static drape_ptr<df::SubrouteMarkersData> CacheMarkers(ref_ptr<dp::GraphicsContext> context,
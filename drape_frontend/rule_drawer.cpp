@@ -7,6 +7,7 @@
 #include "drape_frontend/visual_params.hpp"
 
 #include "drape/drape_diagnostics.hpp"
+#include "drape/drape_routine.hpp"
 
 #include "indexer/feature.hpp"
 #include "indexer/feature_algo.hpp"
@@ -30,6 +31,7 @@
 #include "base/string_utils.hpp"
 #endif
 
+#include <algorithm>
 #include <functional>
 #include <utility>
 #include <vector>
@@ -216,8 +218,7 @@ RuleDrawer::~RuleDrawer()
   if (m_wasCancelled)
     return;
 
-  for (auto const & shape : m_mapShapes[df::OverlayType])
-    shape->Prepare(m_context->GetTextureManager());
+  PrepareShapes(m_mapShapes[df::OverlayType]);
 
   if (!m_mapShapes[df::OverlayType].empty())
   {
@@ -235,6 +236,49 @@ bool RuleDrawer::CheckCancelled()
   return m_wasCancelled;
 }
 
+void RuleDrawer::PrepareShapes(TMapShapes const & shapes)
+{
+  auto texMng = m_context->GetTextureManager();
+
+  // Preparation of shapes is independent (texture manager is shared by
+  // concurrently running tile readers anyway), so on heavy tiles it is fanned
+  // out to DrapeRoutine. Shapes stay in place, the flush order is unchanged.
+  size_t constexpr kMinShapesPerTask = 16;
+  size_t constexpr kMaxTasksCount = 4;
+  size_t const tasksCount = std::min(kMaxTasksCount, shapes.size() / kMinShapesPerTask);
+  if (tasksCount < 2)
+  {
+    for (auto const & shape : shapes)
+      shape->Prepare(texMng);
+    return;
+  }
+
+  std::vector<dp::DrapeRoutine::ResultPtr> results;
+  results.reserve(tasksCount - 1);
+  size_t const partSize = shapes.size() / tasksCount;
+  for (size_t i = 1; i < tasksCount; ++i)
+  {
+    size_t const from = i * partSize;
+    size_t const to = (i + 1 == tasksCount) ? shapes.size() : from + partSize;
+    auto result = dp::DrapeRoutine::Run([&shapes, texMng, from, to]()
+    {
+      for (size_t j = from; j < to; ++j)
+        shapes[j]->Prepare(texMng);
+    });
+    if (result != nullptr)
+      results.push_back(std::move(result));
+    else
+      for (size_t j = from; j < to; ++j)
+        shapes[j]->Prepare(texMng);
+  }
+
+  for (size_t j = 0; j < partSize; ++j)
+    shapes[j]->Prepare(texMng);
+
+  for (auto const & result : results)
+    result->Wait();
+}
+
 bool RuleDrawer::CheckCoastlines(FeatureType & f, Stylist const & s)
 {
   int const zoomLevel = m_context->GetTileKey().m_zoomLevel;
@@ -529,8 +573,7 @@ void RuleDrawer::operator()(FeatureType & f)
   if (CheckCancelled())
     return;
 
-  for (auto const & shape : m_mapShapes[df::GeometryType])
-    shape->Prepare(m_context->GetTextureManager());
+  PrepareShapes(m_mapShapes[df::GeometryType]);
 
   if (!m_mapShapes[df::GeometryType].empty())
   {
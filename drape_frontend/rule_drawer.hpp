@@ -54,6 +54,9 @@ private:
 
   bool CheckCoastlines(FeatureType & f, Stylist const & s);
 
+  // Prepares shapes for flushing, in parallel for heavy tiles.
+  void PrepareShapes(TMapShapes const & shapes);
+
 #ifdef DRAW_TILE_NET
   void DrawTileNet(TInsertShapeFn const & insertShape);
 #endif
@@ -47,14 +47,25 @@ ScreenQuadRenderer::ScreenQuadRenderer(ref_ptr<dp::GraphicsContext> context)
 
 void ScreenQuadRenderer::Rebuild()
 {
-  std::vector<float> vertices = {-1.0f, 1.0f,  m_textureRect.minX(), m_textureRect.maxY(),
-                                 1.0f,  1.0f,  m_textureRect.maxX(), m_textureRect.maxY(),
-                                 -1.0f, -1.0f, m_textureRect.minX(), m_textureRect.minY(),
-                                 1.0f,  -1.0f, m_textureRect.maxX(), m_textureRect.minY()};
+  std::vector<float> vertices = {m_screenRect.minX(), m_screenRect.maxY(),
+                                 m_textureRect.minX(), m_textureRect.maxY(),
+                                 m_screenRect.maxX(), m_screenRect.maxY(),
+                                 m_textureRect.maxX(), m_textureRect.maxY(),
+                                 m_screenRect.minX(), m_screenRect.minY(),
+                                 m_textureRect.minX(), m_textureRect.minY(),
+                                 m_screenRect.maxX(), m_screenRect.minY(),
+                                 m_textureRect.maxX(), m_textureRect.minY()};
   auto const bufferIndex = 0;
-  SetBuffer(bufferIndex, std::move(vertices), sizeof(float) * 4 /* stride */);
-  SetAttribute("a_pos", bufferIndex, 0 /* offset */, 2 /* componentsCount */);
-  SetAttribute("a_tcoord", bufferIndex, sizeof(float) * 2 /* offset */, 2 /* componentsCount */);
+  if (IsInitialized())
+  {
+    UpdateBuffer(bufferIndex, std::move(vertices));
+  }
+  else
+  {
+    SetBuffer(bufferIndex, std::move(vertices), sizeof(float) * 4 /* stride */);
+    SetAttribute("a_pos", bufferIndex, 0 /* offset */, 2 /* componentsCount */);
+    SetAttribute("a_tcoord", bufferIndex, sizeof(float) * 2 /* offset */, 2 /* componentsCount */);
+  }
 }
 
 void ScreenQuadRenderer::RenderTexture(ref_ptr<dp::GraphicsContext> context,
@@ -74,4 +85,10 @@ void ScreenQuadRenderer::SetTextureRect(m2::RectF const & rect)
   m_textureRect = rect;
   Rebuild();
 }
+
+void ScreenQuadRenderer::SetScreenRect(m2::RectF const & rect)
+{
+  m_screenRect = rect;
+  Rebuild();
+}
 }  // namespace df
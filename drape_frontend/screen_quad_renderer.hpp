@@ -20,6 +20,11 @@ public:
   void SetTextureRect(m2::RectF const & rect);
   m2::RectF const & GetTextureRect() const { return m_textureRect; }
 
+  // Rect of the rendered quad in normalized device coordinates. By default
+  // the quad covers the whole screen.
+  void SetScreenRect(m2::RectF const & rect);
+  m2::RectF const & GetScreenRect() const { return m_screenRect; }
+
   // The parameter invertV is necessary, since there are some APIs (e.g. Metal) there render target
   // coordinates system is inverted by V axis.
   void RenderTexture(ref_ptr<dp::GraphicsContext> context, ref_ptr<gpu::ProgramManager> mng,
@@ -29,5 +34,6 @@ private:
   void Rebuild();
 
   m2::RectF m_textureRect = m2::RectF(0.0f, 0.0f, 1.0f, 1.0f);
+  m2::RectF m_screenRect = m2::RectF(-1.0f, -1.0f, 1.0f, 1.0f);
 };
 }  // namespace df
@@ -7,6 +7,7 @@
 
 #include "geometry/mercator.hpp"
 
+#include <functional>
 #include <sstream>
 
 namespace df
@@ -101,6 +102,13 @@ math::Matrix<float, 4, 4> TileKey::GetTileBasedModelView(ScreenBase const & scre
   return screen.GetModelView(GetGlobalRect().Center(), kShapeCoordScalar);
 }
 
+size_t TileKeyHasher::operator()(TileKey const & key) const
+{
+  uint64_t const coords = (static_cast<uint64_t>(static_cast<uint32_t>(key.m_x)) << 32) |
+                          static_cast<uint32_t>(key.m_y);
+  return std::hash<uint64_t>{}(coords ^ (static_cast<uint64_t>(key.m_zoomLevel) << 17));
+}
+
 std::string DebugPrint(TileKey const & key)
 {
   std::ostringstream out;
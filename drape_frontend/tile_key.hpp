@@ -5,6 +5,7 @@
 
 #include "base/matrix.hpp"
 
+#include <cstddef>
 #include <string>
 
 namespace df
@@ -48,5 +49,13 @@ struct TileKeyStrictComparator
   }
 };
 
+// Hashes tile coordinates only, consistently with operator ==, which
+// does not consider generations. Suitable for unordered containers
+// keyed by TileKey.
+struct TileKeyHasher
+{
+  size_t operator()(TileKey const & key) const;
+};
+
 std::string DebugPrint(TileKey const & key);
 }  // namespace df
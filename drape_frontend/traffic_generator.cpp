@@ -266,10 +266,24 @@ void TrafficGenerator::FlushSegmentsGeometry(ref_ptr<dp::GraphicsContext> contex
   context->Flush();
 }
 
-void TrafficGenerator::UpdateColoring(TrafficSegmentsColoring const & coloring)
+bool TrafficGenerator::UpdateColoring(TrafficSegmentsColoring const & coloring)
 {
+  bool changed = false;
   for (auto const & p : coloring)
-    m_coloring[p.first] = p.second;
+  {
+    auto const it = m_coloring.find(p.first);
+    if (it == m_coloring.end())
+    {
+      m_coloring.emplace(p.first, p.second);
+      changed = true;
+    }
+    else if (it->second != p.second)
+    {
+      it->second = p.second;
+      changed = true;
+    }
+  }
+  return changed;
 }
 
 void TrafficGenerator::ClearCache()
@@ -172,7 +172,8 @@ public:
 
   void FlushSegmentsGeometry(ref_ptr<dp::GraphicsContext> context, TileKey const & tileKey,
                              TrafficSegmentsGeometry const & geom, ref_ptr<dp::TextureManager> textures);
-  void UpdateColoring(TrafficSegmentsColoring const & coloring);
+  // Returns true if the update has changed the speed group of any segment.
+  bool UpdateColoring(TrafficSegmentsColoring const & coloring);
 
   void ClearCache();
   void ClearCache(MwmSet::MwmId const & mwmId);
@@ -25,6 +25,9 @@ using namespace std;
 namespace df
 {
 int const kTransitSchemeMinZoomLevel = 10;
+// Ordinary stop markers are not rendered below this zoom. It must be equal to
+// the titles' kStopMinZoomLevel, so markers and titles of stops appear together.
+int const kTransitSchemeMinStopsZoomLevel = 12;
 float const kTransitLineHalfWidth = 0.8f;
 std::vector<float> const kTransitLinesWidthInPixel =
 {
@@ -41,7 +44,7 @@ float constexpr kDepthPerLine = 1.0f;
 float constexpr kBaseMarkerDepth = 300.0f;
 int constexpr kFinalStationMinZoomLevel = 10;
 int constexpr kTransferMinZoomLevel = 11;
-int constexpr kStopMinZoomLevel = 12;
+int const kStopMinZoomLevel = kTransitSchemeMinStopsZoomLevel;
 uint16_t constexpr kFinalStationPriorityInc = 2;
 
 float constexpr kOuterMarkerDepth = kBaseMarkerDepth + 0.5f;
@@ -595,11 +598,15 @@ void TransitSchemeBuilder::GenerateStops(ref_ptr<dp::GraphicsContext> context, M
 {
   MwmSchemeData const & scheme = m_schemes[mwmId];
 
-  auto const flusher = [this, &mwmId, &scheme](dp::RenderState const & state, drape_ptr<dp::RenderBucket> && b)
+  // Markers of ordinary stops are flushed as Type::Stops, so the renderer can
+  // drop them at the far scheme zooms where only lines and transfers are shown.
+  bool isStopsPass = true;
+  auto const flusher = [this, &mwmId, &scheme, &isStopsPass](dp::RenderState const & state,
+                                                            drape_ptr<dp::RenderBucket> && b)
   {
     TransitRenderData::Type type = TransitRenderData::Type::Stubs;
     if (state.GetProgram<gpu::Program>() == gpu::Program::TransitMarker)
-      type = TransitRenderData::Type::Markers;
+      type = isStopsPass ? TransitRenderData::Type::Stops : TransitRenderData::Type::Markers;
     else if (state.GetProgram<gpu::Program>() == gpu::Program::TextOutlined)
       type = TransitRenderData::Type::Text;
 
@@ -609,19 +616,24 @@ void TransitSchemeBuilder::GenerateStops(ref_ptr<dp::GraphicsContext> context, M
 
   uint32_t const kBatchSize = 5000;
   dp::Batcher batcher(kBatchSize, kBatchSize);
-  {
-    dp::SessionGuard guard(context, batcher, flusher);
 
-    float const kStopScale = 2.5f;
-    float const kTransferScale = 3.0f;
-    std::vector<m2::PointF> const transferMarkerSizes = GetTransitMarkerSizes(kTransferScale, 1000);
-    std::vector<m2::PointF> const stopMarkerSizes = GetTransitMarkerSizes(kStopScale, 1000);
+  float const kStopScale = 2.5f;
+  float const kTransferScale = 3.0f;
+  std::vector<m2::PointF> const transferMarkerSizes = GetTransitMarkerSizes(kTransferScale, 1000);
+  std::vector<m2::PointF> const stopMarkerSizes = GetTransitMarkerSizes(kStopScale, 1000);
 
+  {
+    dp::SessionGuard guard(context, batcher, flusher);
     for (auto const & stop : scheme.m_stops)
     {
       GenerateStop(context, stop.second, scheme.m_pivot, scheme.m_lines, batcher);
       GenerateTitles(context, stop.second, scheme.m_pivot, stopMarkerSizes, textures, batcher);
     }
+  }
+
+  isStopsPass = false;
+  {
+    dp::SessionGuard guard(context, batcher, flusher);
     for (auto const & transfer : scheme.m_transfers)
     {
       GenerateTransfer(context, transfer.second, scheme.m_pivot, batcher);
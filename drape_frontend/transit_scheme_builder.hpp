@@ -16,6 +16,7 @@
 namespace df
 {
 extern int const kTransitSchemeMinZoomLevel;
+extern int const kTransitSchemeMinStopsZoomLevel;
 extern float const kTransitLineHalfWidth;
 extern std::vector<float> const kTransitLinesWidthInPixel;
 
@@ -26,6 +27,9 @@ struct TransitRenderData
     LinesCaps,
     Lines,
     Markers,
+    // Markers of ordinary (non-transfer) stops. They are put in separate
+    // buckets, because the renderer drops them at the far scheme zooms.
+    Stops,
     Text,
     Stubs
   };
@@ -35,7 +35,7 @@ bool TransitSchemeRenderer::IsSchemeVisible(int zoomLevel) const
 bool TransitSchemeRenderer::HasRenderData() const
 {
   return !m_linesRenderData.empty() || !m_linesCapsRenderData.empty() || !m_markersRenderData.empty() ||
-    !m_textRenderData.empty() || !m_colorSymbolRenderData.empty();
+    !m_stopMarkersRenderData.empty() || !m_textRenderData.empty() || !m_colorSymbolRenderData.empty();
 }
 
 void TransitSchemeRenderer::ClearContextDependentResources(ref_ptr<dp::OverlayTree> tree)
@@ -49,6 +49,7 @@ void TransitSchemeRenderer::ClearContextDependentResources(ref_ptr<dp::OverlayTr
   m_linesRenderData.clear();
   m_linesCapsRenderData.clear();
   m_markersRenderData.clear();
+  m_stopMarkersRenderData.clear();
   m_textRenderData.clear();
   m_colorSymbolRenderData.clear();
 }
@@ -58,6 +59,7 @@ void TransitSchemeRenderer::Clear(MwmSet::MwmId const & mwmId, ref_ptr<dp::Overl
   ClearRenderData(mwmId, nullptr /* tree */, m_linesRenderData);
   ClearRenderData(mwmId, nullptr /* tree */, m_linesCapsRenderData);
   ClearRenderData(mwmId, nullptr /* tree */, m_markersRenderData);
+  ClearRenderData(mwmId, nullptr /* tree */, m_stopMarkersRenderData);
   ClearRenderData(mwmId, tree, m_textRenderData);
   ClearRenderData(mwmId, tree, m_colorSymbolRenderData);
 }
@@ -101,6 +103,9 @@ void TransitSchemeRenderer::AddRenderData(ref_ptr<dp::GraphicsContext> context,
     case TransitRenderData::Type::Markers:
       PrepareRenderData(context, mng, tree, m_markersRenderData, std::move(renderData));
       break;
+    case TransitRenderData::Type::Stops:
+      PrepareRenderData(context, mng, tree, m_stopMarkersRenderData, std::move(renderData));
+      break;
     case TransitRenderData::Type::Text:
       PrepareRenderData(context, mng, tree, m_textRenderData, std::move(renderData));
       break;
@@ -148,7 +153,13 @@ void TransitSchemeRenderer::RenderTransit(ref_ptr<dp::GraphicsContext> context,
 
   RenderLinesCaps(context, mng, screen, frameValues, pixelHalfWidth);
   RenderLines(context, mng, screen, frameValues, pixelHalfWidth);
-  RenderMarkers(context, mng, screen, frameValues, pixelHalfWidth);
+  context->Clear(dp::ClearBits::DepthBit);
+  RenderMarkers(context, mng, screen, frameValues, pixelHalfWidth, m_markersRenderData);
+  // At the far scheme zooms the markers of ordinary stops are dropped:
+  // only the lines and the transfers are informative there, and on big
+  // networks the stop markers dominate the vertex count.
+  if (zoomLevel >= kTransitSchemeMinStopsZoomLevel)
+    RenderMarkers(context, mng, screen, frameValues, pixelHalfWidth, m_stopMarkersRenderData);
   {
     StencilWriterGuard guard(postprocessRenderer, context);
     RenderText(context, mng, screen, frameValues, debugRectRenderer);
@@ -230,25 +241,25 @@ void TransitSchemeRenderer::RenderLines(ref_ptr<dp::GraphicsContext> context,
 void TransitSchemeRenderer::RenderMarkers(ref_ptr<dp::GraphicsContext> context,
                                           ref_ptr<gpu::ProgramManager> mng,
                                           ScreenBase const & screen,
-                                          FrameValues const & frameValues, float pixelHalfWidth)
+                                          FrameValues const & frameValues, float pixelHalfWidth,
+                                          std::vector<TransitRenderData> & renderData)
 {
-  context->Clear(dp::ClearBits::DepthBit);
-  for (auto & renderData : m_markersRenderData)
+  for (auto & data : renderData)
   {
-    auto program = mng->GetProgram(renderData.m_state.GetProgram<gpu::Program>());
+    auto program = mng->GetProgram(data.m_state.GetProgram<gpu::Program>());
     program->Bind();
-    dp::ApplyState(context, program, renderData.m_state);
+    dp::ApplyState(context, program, data.m_state);
 
     gpu::TransitProgramParams params;
     frameValues.SetTo(params);
-    math::Matrix<float, 4, 4> mv = screen.GetModelView(renderData.m_pivot, kShapeCoordScalar);
+    math::Matrix<float, 4, 4> mv = screen.GetModelView(data.m_pivot, kShapeCoordScalar);
     params.m_modelView = glsl::make_mat4(mv.m_data);
     params.m_params = glsl::vec3(static_cast<float>(cos(screen.GetAngle())),
                                  static_cast<float>(sin(screen.GetAngle())),
                                  pixelHalfWidth);
     mng->GetParamsSetter()->Apply(context, program, params);
 
-    renderData.m_bucket->Render(context, false /* draw as line */);
+    data.m_bucket->Render(context, false /* draw as line */);
   }
 }
 
@@ -62,7 +62,8 @@ private:
   void RenderLinesCaps(ref_ptr<dp::GraphicsContext> context, ref_ptr<gpu::ProgramManager> mng,
                        ScreenBase const & screen, FrameValues const & frameValues, float pixelHalfWidth);
   void RenderMarkers(ref_ptr<dp::GraphicsContext> context, ref_ptr<gpu::ProgramManager> mng, ScreenBase const & screen,
-                     FrameValues const & frameValues, float pixelHalfWidth);
+                     FrameValues const & frameValues, float pixelHalfWidth,
+                     std::vector<TransitRenderData> & renderData);
   void RenderText(ref_ptr<dp::GraphicsContext> context, ref_ptr<gpu::ProgramManager> mng, ScreenBase const & screen,
                   FrameValues const & frameValues, ref_ptr<DebugRectRenderer> debugRectRenderer);
   void RenderStubs(ref_ptr<dp::GraphicsContext> context, ref_ptr<gpu::ProgramManager> mng, ScreenBase const & screen,
@@ -74,6 +75,7 @@ private:
   std::vector<TransitRenderData> m_linesRenderData;
   std::vector<TransitRenderData> m_linesCapsRenderData;
   std::vector<TransitRenderData> m_markersRenderData;
+  std::vector<TransitRenderData> m_stopMarkersRenderData;
   std::vector<TransitRenderData> m_textRenderData;
   std::vector<TransitRenderData> m_colorSymbolRenderData;
 };
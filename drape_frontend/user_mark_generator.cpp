@@ -38,9 +38,19 @@ void UserMarkGenerator::SetRemovedUserMarks(drape_ptr<IDCollections> && ids)
   if (ids == nullptr)
     return;
   for (auto const & id : ids->m_markIds)
-    m_marks.erase(id);
+  {
+    auto const it = m_marks.find(id);
+    if (it != m_marks.end())
+    {
+      MarkDirtyTiles(*it->second);
+      m_marks.erase(it);
+    }
+  }
   for (auto const & id : ids->m_lineIds)
-    m_lines.erase(id);
+  {
+    if (m_lines.erase(id) > 0)
+      ++m_linesChangeCounter;
+  }
 }
 
 void UserMarkGenerator::SetCreatedUserMarks(drape_ptr<IDCollections> && ids)
@@ -48,7 +58,14 @@ void UserMarkGenerator::SetCreatedUserMarks(drape_ptr<IDCollections> && ids)
   if (ids == nullptr)
     return;
   for (auto const & id : ids->m_markIds)
-    m_marks[id]->m_justCreated = true;
+  {
+    auto const it = m_marks.find(id);
+    if (it != m_marks.end())
+    {
+      it->second->m_justCreated = true;
+      MarkDirtyTiles(*it->second);
+    }
+  }
 }
 
 void UserMarkGenerator::SetUserMarks(drape_ptr<UserMarksRenderCollection> && marks)
@@ -57,14 +74,24 @@ void UserMarkGenerator::SetUserMarks(drape_ptr<UserMarksRenderCollection> && mar
   {
     auto it = m_marks.find(pair.first);
     if (it != m_marks.end())
+    {
+      // The tiles of the old position must be rebatched as well.
+      MarkDirtyTiles(*it->second);
       it->second = std::move(pair.second);
+      MarkDirtyTiles(*it->second);
+    }
     else
-      m_marks.emplace(pair.first, std::move(pair.second));
+    {
+      auto const inserted = m_marks.emplace(pair.first, std::move(pair.second)).first;
+      MarkDirtyTiles(*inserted->second);
+    }
   }
 }
 
 void UserMarkGenerator::SetUserLines(drape_ptr<UserLinesRenderCollection> && lines)
 {
+  if (!lines->empty())
+    ++m_linesChangeCounter;
   for (auto & pair : *lines)
   {
     auto it = m_lines.find(pair.first);
@@ -75,13 +102,34 @@ void UserMarkGenerator::SetUserLines(drape_ptr<UserLinesRenderCollection> && lin
   }
 }
 
+void UserMarkGenerator::MarkDirtyTiles(UserMarkRenderParams const & params)
+{
+  for (int zoomLevel = params.m_minZoom; zoomLevel <= scales::GetUpperScale(); ++zoomLevel)
+    m_dirtyTiles.insert(GetTileKeyByPoint(params.m_pivot, zoomLevel));
+}
+
+void UserMarkGenerator::MarkDirtyGroupTiles(kml::MarkGroupId groupId)
+{
+  for (auto & tileGroups : m_index)
+  {
+    auto const itGroup = tileGroups.second->find(groupId);
+    if (itGroup != tileGroups.second->end() && !itGroup->second->IsEmpty())
+      m_dirtyTiles.insert(tileGroups.first);
+  }
+}
+
 void UserMarkGenerator::UpdateIndex(kml::MarkGroupId groupId)
 {
+  // Snapshot the group's per-tile content to find the tiles which actually
+  // change: they are the only ones that must be rebatched afterwards.
+  std::map<TileKey, IDCollections> oldContent;
   for (auto & tileGroups : m_index)
   {
     auto itGroupIndexes = tileGroups.second->find(groupId);
     if (itGroupIndexes != tileGroups.second->end())
     {
+      if (!itGroupIndexes->second->IsEmpty())
+        oldContent.emplace(tileGroups.first, *itGroupIndexes->second);
       itGroupIndexes->second->m_markIds.clear();
       itGroupIndexes->second->m_lineIds.clear();
     }
@@ -131,6 +179,25 @@ void UserMarkGenerator::UpdateIndex(kml::MarkGroupId groupId)
     }
   }
 
+  // Compare with the snapshot: tiles which gained, lost or changed the
+  // group's content go to the change-set.
+  for (auto & tileGroups : m_index)
+  {
+    auto const itGroup = tileGroups.second->find(groupId);
+    if (itGroup == tileGroups.second->end() || itGroup->second->IsEmpty())
+      continue;
+    auto const itOld = oldContent.find(tileGroups.first);
+    if (itOld == oldContent.end() || itOld->second.m_markIds != itGroup->second->m_markIds ||
+        itOld->second.m_lineIds != itGroup->second->m_lineIds)
+    {
+      m_dirtyTiles.insert(tileGroups.first);
+    }
+    if (itOld != oldContent.end())
+      oldContent.erase(itOld);
+  }
+  for (auto const & tileContent : oldContent)
+    m_dirtyTiles.insert(tileContent.first);
+
   CleanIndex();
 }
 
@@ -190,9 +257,15 @@ void UserMarkGenerator::CleanIndex()
 void UserMarkGenerator::SetGroupVisibility(kml::MarkGroupId groupId, bool isVisible)
 {
   if (isVisible)
-    m_groupsVisibility.insert(groupId);
+  {
+    if (m_groupsVisibility.insert(groupId).second)
+      MarkDirtyGroupTiles(groupId);
+  }
   else
-    m_groupsVisibility.erase(groupId);
+  {
+    if (m_groupsVisibility.erase(groupId) > 0)
+      MarkDirtyGroupTiles(groupId);
+  }
 }
 
 ref_ptr<MarksIDGroups> UserMarkGenerator::GetUserMarksGroups(TileKey const & tileKey)
@@ -217,17 +290,44 @@ ref_ptr<MarksIDGroups> UserMarkGenerator::GetUserLinesGroups(TileKey const & til
   return nullptr;
 }
 
-void UserMarkGenerator::GenerateUserMarksGeometry(ref_ptr<dp::GraphicsContext> context,
-                                                  TileKey const & tileKey,
-                                                  ref_ptr<dp::TextureManager> textures)
+TileKey UserMarkGenerator::GenerateUserMarksGeometry(ref_ptr<dp::GraphicsContext> context,
+                                                     TileKey const & tileKey,
+                                                     ref_ptr<dp::TextureManager> textures)
 {
   auto const clippedTileKey =
       TileKey(tileKey.m_x, tileKey.m_y, ClipTileZoomByMaxDataZoom(tileKey.m_zoomLevel));
   auto marksGroups = GetUserMarksGroups(clippedTileKey);
   auto linesGroups = GetUserLinesGroups(clippedTileKey);
 
+  auto const itFlushed = m_flushedTiles.find(clippedTileKey);
   if (marksGroups == nullptr && linesGroups == nullptr)
-    return;
+  {
+    // No content anymore. The current generation is reported, so the
+    // frontend drops the groups which could be flushed for this tile before.
+    if (itFlushed != m_flushedTiles.end())
+      m_flushedTiles.erase(itFlushed);
+    m_dirtyTiles.erase(clippedTileKey);
+    return tileKey;
+  }
+
+  bool dirty = itFlushed == m_flushedTiles.end() ||
+               itFlushed->second.second != m_linesChangeCounter ||
+               m_dirtyTiles.find(clippedTileKey) != m_dirtyTiles.end();
+  // The frontend purges render groups which fall behind the maximal user
+  // marks generation too far, so an unchanged tile is refreshed periodically
+  // to never cross that range.
+  uint64_t constexpr kMaxKeptGenerationRange = 4;
+  if (!dirty && tileKey.m_userMarksGeneration - itFlushed->second.first >= kMaxKeptGenerationRange)
+    dirty = true;
+
+  if (!dirty)
+  {
+    // Nothing changed in this tile: report the generation of the data the
+    // frontend already has, so its render groups survive.
+    TileKey result = tileKey;
+    result.m_userMarksGeneration = itFlushed->second.first;
+    return result;
+  }
 
   uint32_t constexpr kMaxSize = 65000;
   dp::Batcher batcher(kMaxSize, kMaxSize);
@@ -245,6 +345,10 @@ void UserMarkGenerator::GenerateUserMarksGeometry(ref_ptr<dp::GraphicsContext> c
       CacheUserLines(context, tileKey, *linesGroups.get(), textures, batcher);
   }
   m_flushFn(std::move(renderData));
+
+  m_flushedTiles[clippedTileKey] = std::make_pair(tileKey.m_userMarksGeneration, m_linesChangeCounter);
+  m_dirtyTiles.erase(clippedTileKey);
+  return tileKey;
 }
 
 void UserMarkGenerator::CacheUserLines(ref_ptr<dp::GraphicsContext> context,
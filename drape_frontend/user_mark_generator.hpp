@@ -32,11 +32,17 @@ public:
   void RemoveGroup(kml::MarkGroupId groupId);
   void SetGroupVisibility(kml::MarkGroupId groupId, bool isVisible);
 
-  void GenerateUserMarksGeometry(ref_ptr<dp::GraphicsContext> context, TileKey const & tileKey,
-                                 ref_ptr<dp::TextureManager> textures);
+  // Regenerates the tile geometry if the marks of this tile have changed
+  // since the last flush. Returns the tile key to report to the frontend:
+  // for an unchanged tile it keeps the last flushed user marks generation,
+  // so the render groups the frontend already has are not evicted.
+  TileKey GenerateUserMarksGeometry(ref_ptr<dp::GraphicsContext> context, TileKey const & tileKey,
+                                    ref_ptr<dp::TextureManager> textures);
 
 private:
   void UpdateIndex(kml::MarkGroupId groupId);
+  void MarkDirtyTiles(UserMarkRenderParams const & params);
+  void MarkDirtyGroupTiles(kml::MarkGroupId groupId);
 
   ref_ptr<IDCollections> GetIdCollection(TileKey const & tileKey, kml::MarkGroupId groupId);
   void CleanIndex();
@@ -61,6 +67,15 @@ private:
 
   MarksIndex m_index;
 
+  // Change-set of tiles whose marks were added, removed or modified since
+  // they were batched the last time. Only these tiles are rebatched.
+  std::set<TileKey> m_dirtyTiles;
+  // Per-tile user marks generation and lines counter of the last flush.
+  std::map<TileKey, std::pair<uint64_t, uint32_t>> m_flushedTiles;
+  // Lines are not indexed at data zoom levels, so any line change simply
+  // invalidates all tiles. Lines change rarely, unlike moving marks.
+  uint32_t m_linesChangeCounter = 0;
+
   TFlushFn m_flushFn;
 };
 }  // namespace df
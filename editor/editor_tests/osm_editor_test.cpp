@@ -1269,6 +1269,52 @@ void EditorTest::SaveTransactionTest()
   TEST(editor.m_features.Get()->empty(), ());
 }
 
+void EditorTest::SaveAfterStatusChangeTest()
+{
+  auto & editor = osm::Editor::Instance();
+
+  auto const mwmId = ConstructTestMwm([](TestMwmBuilder & builder)
+  {
+    TestCafe cafe(m2::PointD(1.0, 1.0), "London Cafe", "en");
+    builder.Add(cafe);
+  });
+
+  ForEachCafeAtPoint(m_dataSource, m2::PointD(1.0, 1.0), [&editor](FeatureType & ft)
+  {
+    osm::EditableMapObject emo;
+    FillEditableMapObject(editor, ft, emo);
+    emo.SetBuildingLevels("1");
+    TEST_EQUAL(editor.SaveEditedFeature(emo), osm::Editor::SaveResult::SavedSuccessfully, ());
+
+    {
+      pugi::xml_document doc;
+      TEST(editor.m_storage->Load(doc), ());
+      TEST(doc.select_node("//modify/node"), ());
+      TEST(!doc.select_node("//delete/node"), ());
+    }
+
+    // Deleting a previously edited feature must not reuse the XML cached by
+    // the save above: the fresh original feature snapshot and the new
+    // modification timestamp must be persisted under the new status.
+    editor.DeleteFeature(ft.GetID());
+
+    pugi::xml_document doc;
+    TEST(editor.m_storage->Load(doc), ());
+    TEST(!doc.select_node("//modify/node"), ());
+    auto const deletedNode = doc.select_node("//delete/node").node();
+    TEST(deletedNode, ());
+
+    editor::XMLFeature const xf(deletedNode);
+    TEST(!xf.HasTag("building:levels"), ());
+
+    auto const features = editor.m_features.Get();
+    auto const fti = editor.GetFeatureTypeInfo(*features, ft.GetID().m_mwmId, ft.GetID().m_index);
+    TEST_NOT_EQUAL(fti, 0, ());
+    TEST_EQUAL(fti->m_status, FeatureStatus::Deleted, ());
+    TEST_EQUAL(xf.GetModificationTime(), fti->m_modificationTimestamp, ());
+  });
+}
+
 void EditorTest::Cleanup(platform::LocalCountryFile const & map)
 {
   platform::CountryIndexes::DeleteFromDisk(map);
@@ -1387,4 +1433,9 @@ UNIT_CLASS_TEST(EditorTest, SaveEditedFeatureTest)
 }
 
 UNIT_CLASS_TEST(EditorTest, SaveTransactionTest) { EditorTest::SaveTransactionTest(); }
+
+UNIT_CLASS_TEST(EditorTest, SaveAfterStatusChangeTest)
+{
+  EditorTest::SaveAfterStatusChangeTest();
+}
 }  // namespace
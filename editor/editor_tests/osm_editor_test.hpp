@@ -43,6 +43,7 @@ public:
   void LoadMapEditsTest();
   void SaveEditedFeatureTest();
   void SaveTransactionTest();
+  void SaveAfterStatusChangeTest();
 
 private:
   template <typename TBuildFn>
@@ -255,26 +255,33 @@ bool Editor::Save(FeaturesContainer const & features) const
     for (auto & index : mwm.second)
     {
       FeatureTypeInfo const & fti = index.second;
-      // Temporary solution because of FeatureType does not have constant getters.
-      // TODO(a): Use constant reference instead of copy.
-      auto feature = fti.m_feature;
-      // TODO: Do we really need to serialize deleted features in full details? Looks like mwm ID
-      // and meta fields are enough.
-      XMLFeature xf =
-          editor::ToXML(feature, true /*type serializing helps during migration*/);
-      xf.SetMWMFeatureIndex(index.first);
-      if (!fti.m_street.empty())
-        xf.SetTagValue(kAddrStreetTag, fti.m_street);
-      ASSERT_NOT_EQUAL(0, fti.m_modificationTimestamp, ());
-      xf.SetModificationTime(fti.m_modificationTimestamp);
-      if (fti.m_uploadAttemptTimestamp != base::INVALID_TIME_STAMP)
+      // Serializing a feature is the costly part of Save, so the result is cached
+      // in |fti|: unchanged entries reuse it across the copy-on-write snapshots.
+      if (!fti.m_xmlCache)
       {
-        xf.SetUploadTime(fti.m_uploadAttemptTimestamp);
-        ASSERT(!fti.m_uploadStatus.empty(), ("Upload status updates with upload timestamp."));
-        xf.SetUploadStatus(fti.m_uploadStatus);
-        if (!fti.m_uploadError.empty())
-          xf.SetUploadError(fti.m_uploadError);
+        // Temporary solution because of FeatureType does not have constant getters.
+        // TODO(a): Use constant reference instead of copy.
+        auto feature = fti.m_feature;
+        // TODO: Do we really need to serialize deleted features in full details? Looks like mwm ID
+        // and meta fields are enough.
+        auto xml = make_shared<XMLFeature>(
+            editor::ToXML(feature, true /*type serializing helps during migration*/));
+        xml->SetMWMFeatureIndex(index.first);
+        if (!fti.m_street.empty())
+          xml->SetTagValue(kAddrStreetTag, fti.m_street);
+        ASSERT_NOT_EQUAL(0, fti.m_modificationTimestamp, ());
+        xml->SetModificationTime(fti.m_modificationTimestamp);
+        if (fti.m_uploadAttemptTimestamp != base::INVALID_TIME_STAMP)
+        {
+          xml->SetUploadTime(fti.m_uploadAttemptTimestamp);
+          ASSERT(!fti.m_uploadStatus.empty(), ("Upload status updates with upload timestamp."));
+          xml->SetUploadStatus(fti.m_uploadStatus);
+          if (!fti.m_uploadError.empty())
+            xml->SetUploadError(fti.m_uploadError);
+        }
+        fti.m_xmlCache = move(xml);
       }
+      XMLFeature const & xf = *fti.m_xmlCache;
       switch (fti.m_status)
       {
       case FeatureStatus::Deleted: VERIFY(xf.AttachToParentNode(deleted), ()); break;
@@ -894,6 +901,7 @@ void Editor::SaveUploadedInformation(FeatureID const & fid, UploadInfo const & u
   fti.m_uploadAttemptTimestamp = uploadInfo.m_uploadAttemptTimestamp;
   fti.m_uploadStatus = uploadInfo.m_uploadStatus;
   fti.m_uploadError = uploadInfo.m_uploadError;
+  fti.m_xmlCache.reset();
 
   SaveTransaction(editableFeatures);
 }
@@ -1161,6 +1169,9 @@ void Editor::MarkFeatureWithStatus(FeaturesContainer & editableFeatures, Feature
   fti.m_feature = *originalFeaturePtr;
   fti.m_status = status;
   fti.m_modificationTimestamp = time(nullptr);
+  // The entry may carry the XML cached for a previous status (e.g. on the
+  // edit -> delete path), it must not be saved instead of the new state.
+  fti.m_xmlCache.reset();
 }
 
 MwmSet::MwmId Editor::GetMwmIdByMapName(string const & name)
@@ -203,6 +203,11 @@ private:
     /// Is empty if upload has never occured or one of k* constants above otherwise.
     string m_uploadStatus;
     string m_uploadError;
+    /// Serialized XML of this revision, lazily filled in Save() and shared between
+    /// copy-on-write snapshots of FeaturesContainer, so saving one edited POI does
+    /// not re-serialize thousands of untouched ones. Filled and read on the main
+    /// thread only. Must be reset whenever any other field changes.
+    mutable shared_ptr<editor::XMLFeature> m_xmlCache;
   };
 
   using FeaturesContainer = map<MwmSet::MwmId, map<uint32_t, FeatureTypeInfo>>;
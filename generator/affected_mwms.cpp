@@ -0,0 +1,131 @@
+#include "generator/affected_mwms.hpp"
+
+#include "generator/gen_mwm_info.hpp"
+#include "generator/osm_source.hpp"
+
+#include "platform/platform.hpp"
+
+#include "coding/file_name_utils.hpp"
+#include "coding/parse_xml.hpp"
+
+#include "base/geo_object_id.hpp"
+#include "base/logging.hpp"
+#include "base/string_utils.hpp"
+
+#include <algorithm>
+#include <set>
+
+#include "defines.hpp"
+
+namespace generator
+{
+namespace
+{
+// Collects the ids of all elements mentioned in an osm change file. Only the
+// element headers are needed, so tags and nested members are ignored.
+class OscParser
+{
+public:
+  explicit OscParser(std::set<base::GeoObjectId> & ids) : m_ids(ids) {}
+
+  void CharData(std::string const &) {}
+
+  void AddAttr(std::string const & key, std::string const & value)
+  {
+    if (m_currentType == Type::None || key != "id")
+      return;
+
+    uint64_t id = 0;
+    CHECK(strings::to_uint64(value, id), ("Invalid osc element id:", value));
+    switch (m_currentType)
+    {
+    case Type::Node: m_ids.insert(base::MakeOsmNode(id)); break;
+    case Type::Way: m_ids.insert(base::MakeOsmWay(id)); break;
+    case Type::Relation: m_ids.insert(base::MakeOsmRelation(id)); break;
+    case Type::None: break;
+    }
+  }
+
+  bool Push(std::string const & tagName)
+  {
+    // osmChange / <create|modify|delete> / <node|way|relation> / ...
+    if (++m_depth == 3)
+    {
+      if (tagName == "node")
+        m_currentType = Type::Node;
+      else if (tagName == "way")
+        m_currentType = Type::Way;
+      else if (tagName == "relation")
+        m_currentType = Type::Relation;
+    }
+    return true;
+  }
+
+  void Pop(std::string const &)
+  {
+    if (m_depth-- == 3)
+      m_currentType = Type::None;
+  }
+
+private:
+  enum class Type
+  {
+    None,
+    Node,
+    Way,
+    Relation
+  };
+
+  std::set<base::GeoObjectId> & m_ids;
+  Type m_currentType = Type::None;
+  int m_depth = 0;
+};
+}  // namespace
+
+bool GetMwmsAffectedByOsmChange(std::string const & oscPath, std::string const & targetDir,
+                                std::vector<std::string> & affectedMwms)
+{
+  std::set<base::GeoObjectId> ids;
+  {
+    SourceReader reader(oscPath);
+    OscParser parser(ids);
+    if (ParseXMLSequence(reader, parser) == 0)
+    {
+      LOG(LERROR, ("Cannot parse osm change file", oscPath));
+      return false;
+    }
+  }
+  LOG(LINFO, ("Read", ids.size(), "changed elements from", oscPath));
+
+  Platform::FilesList files;
+  Platform::GetFilesByExt(targetDir, OSM2FEATURE_FILE_EXTENSION, files);
+
+  for (auto const & file : files)
+  {
+    gen::OsmID2FeatureID mapping;
+    if (!mapping.ReadFromFile(base::JoinPath(targetDir, file)))
+    {
+      LOG(LWARNING, ("Cannot read osm id to feature id mapping", file));
+      continue;
+    }
+
+    uint32_t featureId = 0;
+    auto const affected = std::any_of(ids.begin(), ids.end(), [&](base::GeoObjectId const & id)
+    {
+      return mapping.GetFeatureID(id, featureId);
+    });
+
+    if (affected)
+    {
+      // Strip ".mwm.osm2ft" to get the country name.
+      std::string country = file;
+      base::GetNameWithoutExt(country);
+      base::GetNameWithoutExt(country);
+      affectedMwms.push_back(std::move(country));
+    }
+  }
+
+  std::sort(affectedMwms.begin(), affectedMwms.end());
+  return true;
+}
+}  // namespace generator
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace generator
+{
+// Reads an OSM change file (.osc) and fills |affectedMwms| with the names of
+// the countries whose features are affected by the change, using the
+// osm-id-to-feature mappings written next to the mwms during generation.
+// Changed elements which did not produce a feature (e.g. a moved node of an
+// unchanged way) cannot be attributed to a country and are skipped, so the
+// result is a lower bound suitable for scheduling incremental rebuilds.
+bool GetMwmsAffectedByOsmChange(std::string const & oscPath, std::string const & targetDir,
+                                std::vector<std::string> & affectedMwms);
+}  // namespace generator
@@ -53,6 +53,16 @@ public:
     return m_srtmManager.GetHeight(MercatorBounds::ToLatLon(p));
   }
 
+  void GetAltitudes(std::vector<m2::PointD> const & points,
+                    feature::TAltitudes & altitudes) override
+  {
+    std::vector<ms::LatLon> coords;
+    coords.reserve(points.size());
+    for (auto const & p : points)
+      coords.push_back(MercatorBounds::ToLatLon(p));
+    m_srtmManager.GetBilinearHeights(coords, altitudes);
+  }
+
 private:
   generator::SrtmTileManager m_srtmManager;
 };
@@ -108,11 +118,17 @@ public:
     if (pointsCount == 0)
       return;
 
+    std::vector<m2::PointD> points;
+    points.reserve(pointsCount);
+    for (size_t i = 0; i < pointsCount; ++i)
+      points.push_back(f.GetPoint(i));
+
     TAltitudes altitudes;
+    m_altitudeGetter.GetAltitudes(points, altitudes);
+
     TAltitude minFeatureAltitude = kInvalidAltitude;
-    for (size_t i = 0; i < pointsCount; ++i)
+    for (TAltitude const a : altitudes)
     {
-      TAltitude const a = m_altitudeGetter.GetAltitude(f.GetPoint(i));
       if (a == kInvalidAltitude)
       {
         // One invalid point invalidates the whole feature.
@@ -123,8 +139,6 @@ public:
         minFeatureAltitude = a;
       else
         minFeatureAltitude = std::min(minFeatureAltitude, a);
-
-      altitudes.push_back(a);
     }
 
     hasAltitude = true;
@@ -5,6 +5,7 @@
 #include "indexer/feature_altitude.hpp"
 
 #include <string>
+#include <vector>
 
 namespace routing
 {
@@ -12,6 +13,16 @@ class AltitudeGetter
 {
 public:
   virtual feature::TAltitude GetAltitude(m2::PointD const & p) = 0;
+
+  // Appends altitudes of the whole polyline to |altitudes|. Getters
+  // backed by tiled sources override it to sample the run of points
+  // from the same tile without a per-point lookup.
+  virtual void GetAltitudes(std::vector<m2::PointD> const & points,
+                            feature::TAltitudes & altitudes)
+  {
+    for (auto const & p : points)
+      altitudes.push_back(GetAltitude(p));
+  }
 };
 
 /// \brief Adds altitude section to mwm. It has the following format:
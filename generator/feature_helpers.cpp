@@ -31,6 +31,11 @@ void CalculateMidPoints::operator()(FeatureBuilder1 const & ft, uint64_t pos)
   /// @todo Probably, we need to keep that objects if 9 scale (as we do in 17 scale).
   if (minScale != -1)
   {
+    // The order key buckets features by the minimal drawable scale first and
+    // within a bucket sorts them along the interleaved-bits (z-order) curve of
+    // the feature's middle point. Since a tile read visits the features of one
+    // scale bucket in a spatially compact area, the final mwm layout makes it
+    // a mostly sequential scan over a short span of the data section.
     uint64_t const order = (static_cast<uint64_t>(minScale) << 59) | (pointAsInt64 >> 5);
     m_vec.push_back(make_pair(order, pos));
   }
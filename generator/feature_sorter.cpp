@@ -6,6 +6,7 @@
 #include "generator/gen_mwm_info.hpp"
 #include "generator/geometry_holder.hpp"
 #include "generator/region_meta.hpp"
+#include "generator/tesselation_cache.hpp"
 #include "generator/tesselator.hpp"
 
 #include "indexer/data_header.hpp"
@@ -18,11 +19,13 @@
 
 #include "platform/mwm_version.hpp"
 
+#include "coding/async_file_writer.hpp"
 #include "coding/file_container.hpp"
 #include "coding/file_name_utils.hpp"
 #include "coding/internal/file_data.hpp"
 
 #include "geometry/polygon.hpp"
+#include "geometry/simplification.hpp"
 
 #include "base/assert.hpp"
 #include "base/logging.hpp"
@@ -33,6 +36,7 @@
 
 #include <list>
 #include <memory>
+#include <thread>
 #include <vector>
 
 using namespace std;
@@ -43,12 +47,13 @@ class FeaturesCollector2 : public FeaturesCollector
 {
 public:
   FeaturesCollector2(string const & fName, DataHeader const & header, RegionData const & regionData,
-                     uint32_t versionDate)
+                     uint32_t versionDate, string const & tessCachePath)
     : FeaturesCollector(fName + DATA_FILE_TAG)
     , m_writer(fName)
     , m_header(header)
     , m_regionData(regionData)
     , m_versionDate(versionDate)
+    , m_tessCache(tessCachePath)
   {
     for (size_t i = 0; i < m_header.GetScalesCount(); ++i)
     {
@@ -122,6 +127,8 @@ public:
       FileWriter osm2ftWriter(m_writer.GetFileName() + OSM2FEATURE_FILE_EXTENSION);
       m_osm2ft.Flush(osm2ftWriter);
     }
+
+    m_tessCache.Save();
   }
 
   void SetBounds(m2::RectD bounds) { m_bounds = bounds; }
@@ -130,76 +137,142 @@ public:
   {
     GeometryHolder holder([this](int i) -> FileWriter & { return *m_geoFile[i]; },
                           [this](int i) -> FileWriter & { return *m_trgFile[i]; }, fb, m_header);
+    holder.SetTesselationCache(&m_tessCache);
 
     bool const isLine = fb.IsLine();
     bool const isArea = fb.IsArea();
+    bool const isCoast = fb.IsCoastCell();
+    m2::RectD const rect = fb.GetLimitRect();
 
     int const scalesStart = static_cast<int>(m_header.GetScalesCount()) - 1;
+
+    vector<bool> isDrawable(scalesStart + 1, false);
     for (int i = scalesStart; i >= 0; --i)
     {
-      int const level = m_header.GetScale(i);
-      if (fb.IsDrawableInRange(i > 0 ? m_header.GetScale(i - 1) + 1 : 0, PatchScaleBound(level)))
+      isDrawable[i] = fb.IsDrawableInRange(i > 0 ? m_header.GetScale(i - 1) + 1 : 0,
+                                           PatchScaleBound(m_header.GetScale(i)));
+    }
+
+    // Area geometry is simplified from the immutable source polygons, so
+    // all its per-scale simplifications are independent and run as one
+    // batch, in parallel for heavy features. Linear geometry stays in the
+    // sequential loop below: for small features GeometryHolder feeds the
+    // simplified points of one scale as the source of the next one.
+    vector<Points> scalePoints(scalesStart + 1);
+    vector<vector<Points>> scalePolys(scalesStart + 1);
+    if (isArea)
+    {
+      struct Job
+      {
+        int m_level;
+        Points const * m_in;
+        Points * m_out;
+      };
+      vector<Job> jobs;
+      size_t pointsCount = 0;
+
+      Polygons const & polys = fb.GetGeometry();
+      for (int i = scalesStart; i >= 0; --i)
       {
-        bool const isCoast = fb.IsCoastCell();
-        m2::RectD const rect = fb.GetLimitRect();
+        if (!isDrawable[i])
+          continue;
+
+        int const level = m_header.GetScale(i);
+        if (!isLine)
+        {
+          jobs.push_back({level, &holder.GetSourcePoints(), &scalePoints[i]});
+          pointsCount += jobs.back().m_in->size();
+        }
+
+        scalePolys[i].resize(polys.size() - 1);
+        size_t k = 0;
+        auto iH = polys.begin();
+        for (++iH; iH != polys.end(); ++iH, ++k)
+        {
+          jobs.push_back({level, &(*iH), &scalePolys[i][k]});
+          pointsCount += iH->size();
+        }
+      }
+
+      // Threads pay off only for heavy geometry (coastlines, big areas).
+      size_t constexpr kMinPointsForConcurrency = 4096;
+      size_t const threadsCount =
+          pointsCount >= kMinPointsForConcurrency
+              ? min(jobs.size(), static_cast<size_t>(max(1u, thread::hardware_concurrency())))
+              : 1;
+      SimplifyBatch(jobs.size(), threadsCount, [&](size_t idx) {
+        Job const & job = jobs[idx];
+        SimplifyPoints(job.m_level, isCoast, rect, *job.m_in, *job.m_out);
+      });
+    }
+
+    for (int i = scalesStart; i >= 0; --i)
+    {
+      if (!isDrawable[i])
+        continue;
+
+      int const level = m_header.GetScale(i);
 
-        // Simplify and serialize geometry.
-        Points points;
+      // Simplify and serialize geometry.
+      Points points;
 
+      if (isLine)
+      {
         // Do not change linear geometry for the upper scale.
-        if (isLine && i == scalesStart && IsCountry() && fb.IsRoad())
+        if (i == scalesStart && IsCountry() && fb.IsRoad())
           points = holder.GetSourcePoints();
         else
           SimplifyPoints(level, isCoast, rect, holder.GetSourcePoints(), points);
 
-        if (isLine)
-          holder.AddPoints(points, i);
+        holder.AddPoints(points, i);
+      }
+      else
+      {
+        points.swap(scalePoints[i]);
+      }
 
-        if (isArea && holder.NeedProcessTriangles())
-        {
-          // simplify and serialize triangles
-          bool const good = isCoast || IsGoodArea(points, level);
+      if (isArea && holder.NeedProcessTriangles())
+      {
+        // simplify and serialize triangles
+        bool const good = isCoast || IsGoodArea(points, level);
 
-          // At this point we don't need last point equal to first.
-          CHECK_GREATER(points.size(), 0, ());
-          points.pop_back();
+        // At this point we don't need last point equal to first.
+        CHECK_GREATER(points.size(), 0, ());
+        points.pop_back();
 
-          Polygons const & polys = fb.GetGeometry();
-          if (polys.size() == 1 && good && holder.TryToMakeStrip(points))
-            continue;
+        Polygons const & polys = fb.GetGeometry();
+        if (polys.size() == 1 && good && holder.TryToMakeStrip(points))
+          continue;
 
-          Polygons simplified;
-          if (good)
+        Polygons simplified;
+        if (good)
+        {
+          simplified.push_back({});
+          simplified.back().swap(points);
+        }
+
+        for (Points & poly : scalePolys[i])
+        {
+          simplified.push_back({});
+          simplified.back().swap(poly);
+
+          // Increment level check for coastline polygons for the first scale level.
+          // This is used for better coastlines quality.
+          if (IsGoodArea(simplified.back(), (isCoast && i == 0) ? level + 1 : level))
           {
-            simplified.push_back({});
-            simplified.back().swap(points);
+            // At this point we don't need last point equal to first.
+            CHECK_GREATER(simplified.back().size(), 0, ());
+            simplified.back().pop_back();
           }
-
-          auto iH = polys.begin();
-          for (++iH; iH != polys.end(); ++iH)
+          else
           {
-            simplified.push_back({});
-
-            SimplifyPoints(level, isCoast, rect, *iH, simplified.back());
-
-            // Increment level check for coastline polygons for the first scale level.
-            // This is used for better coastlines quality.
-            if (IsGoodArea(simplified.back(), (isCoast && i == 0) ? level + 1 : level))
-            {
-              // At this point we don't need last point equal to first.
-              CHECK_GREATER(simplified.back().size(), 0, ());
-              simplified.back().pop_back();
-            }
-            else
-            {
-              // Remove small polygon.
-              simplified.pop_back();
-            }
+            // Remove small polygon.
+            simplified.pop_back();
           }
-
-          if (!simplified.empty())
-            holder.AddTriangles(simplified, i);
         }
+
+        if (!simplified.empty())
+          holder.AddTriangles(simplified, i);
       }
     }
 
@@ -237,10 +310,13 @@ private:
   using Points = vector<m2::PointD>;
   using Polygons = list<Points>;
 
-  class TmpFile : public FileWriter
+  // Sections are serialized into temporary files with plain appends, so
+  // the async writer overlaps geometry simplification and tesselation
+  // with the disk writes.
+  class TmpFile : public AsyncFileWriter
   {
   public:
-    explicit TmpFile(string const & filePath) : FileWriter(filePath) {}
+    explicit TmpFile(string const & filePath) : AsyncFileWriter(filePath) {}
     ~TmpFile() { DeleteFileX(GetName()); }
   };
 
@@ -295,6 +371,8 @@ private:
 
   gen::OsmID2FeatureID m_osm2ft;
 
+  TesselationCache m_tessCache;
+
   DISALLOW_COPY_AND_MOVE(FeaturesCollector2);
 };
 
@@ -349,7 +427,8 @@ bool GenerateFinalFeatures(feature::GenerateInfo const & info, string const & na
     // Transform features from raw format to optimized format.
     try
     {
-      FeaturesCollector2 collector(datFilePath, header, regionData, info.m_versionDate);
+      FeaturesCollector2 collector(datFilePath, header, regionData, info.m_versionDate,
+                                   info.GetIntermediateFileName(name, TESS_CACHE_FILE_EXTENSION));
 
       for (auto const & point : midPoints.GetVector())
       {
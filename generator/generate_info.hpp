@@ -20,7 +20,8 @@ struct GenerateInfo
   {
     Memory,
     Index,
-    File
+    File,
+    Chunked
   };
 
   enum class OsmSourceType
@@ -86,6 +87,8 @@ struct GenerateInfo
       m_nodeStorageType = NodeStorageType::Index;
     else if (type == "mem")
       m_nodeStorageType = NodeStorageType::Memory;
+    else if (type == "chunked")
+      m_nodeStorageType = NodeStorageType::Chunked;
     else
       LOG(LCRITICAL, ("Incorrect node_storage type:", type));
   }
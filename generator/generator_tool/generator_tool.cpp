@@ -1,3 +1,4 @@
+#include "generator/affected_mwms.hpp"
 #include "generator/altitude_generator.hpp"
 #include "generator/borders_generator.hpp"
 #include "generator/borders_loader.hpp"
@@ -49,9 +50,14 @@
 
 #include "base/timer.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "defines.hpp"
 
@@ -87,7 +93,8 @@ DEFINE_string(intermediate_data_path, "", "Path to stored nodes, ways, relations
 DEFINE_string(output, "", "File name for process (without 'mwm' ext).");
 DEFINE_bool(preload_cache, false, "Preload all ways and relations cache.");
 DEFINE_string(node_storage, "map",
-              "Type of storage for intermediate points representation. Available: raw, map, mem.");
+              "Type of storage for intermediate points representation. "
+              "Available: raw, map, mem, chunked.");
 DEFINE_uint64(planet_version, base::SecondsSinceEpoch(),
               "Version as seconds since epoch, by default - now.");
 
@@ -163,6 +170,9 @@ DEFINE_bool(unpack_mwm, false, "Unpack each section of mwm into a separate file
 DEFINE_bool(check_mwm, false, "Check map file to be correct.");
 DEFINE_string(delete_section, "", "Delete specified section (defines.hpp) from container.");
 DEFINE_bool(generate_addresses_file, false, "Generate .addr file (for '--output' option) with full addresses list.");
+DEFINE_string(osm_change_file, "",
+              "Path to an .osc change file. Prints the names of mwms in the data path affected "
+              "by the change, one per line, using the .osm2ft mappings written during generation.");
 DEFINE_bool(generate_traffic_keys, false,
             "Generate keys for the traffic map (road segment -> speed group).");
 
@@ -363,6 +373,49 @@ int main(int argc, char ** argv)
 
   // Enumerate over all dat files that were created.
   size_t const count = genInfo.m_bucketNames.size();
+
+  // Result features are generated for all buckets in parallel: every country
+  // job reads only its own tmp file and writes only its own mwm. The
+  // concurrency cap bounds the peak memory of simultaneous sorting and
+  // tesselation on planet builds.
+  vector<uint8_t> geometryGenerated(count, 0);
+  if (FLAGS_generate_geometry && count != 0)
+  {
+    auto const getMapType = [](string const & country)
+    {
+      if (country == WORLD_FILE_NAME)
+        return feature::DataHeader::world;
+      if (country == WORLD_COASTS_FILE_NAME)
+        return feature::DataHeader::worldcoasts;
+      return feature::DataHeader::country;
+    };
+
+    size_t const kMaxGeometryJobs = 8;
+    size_t const jobsCount = min({count, kMaxGeometryJobs,
+                                  static_cast<size_t>(max(1u, thread::hardware_concurrency()))});
+    atomic<size_t> nextBucket(0);
+    vector<thread> workers;
+    workers.reserve(jobsCount);
+    for (size_t j = 0; j < jobsCount; ++j)
+    {
+      workers.emplace_back([&]()
+      {
+        while (true)
+        {
+          size_t const i = nextBucket.fetch_add(1);
+          if (i >= count)
+            return;
+          string const & country = genInfo.m_bucketNames[i];
+          LOG(LINFO, ("Generating result features for", country));
+          if (feature::GenerateFinalFeatures(genInfo, country, getMapType(country)))
+            geometryGenerated[i] = 1;
+        }
+      });
+    }
+    for (auto & worker : workers)
+      worker.join();
+  }
+
   for (size_t i = 0; i < count; ++i)
   {
     string const & country = genInfo.m_bucketNames[i];
@@ -379,9 +432,7 @@ int main(int argc, char ** argv)
         mapType = feature::DataHeader::worldcoasts;
 
       // On error move to the next bucket without index generation.
-
-      LOG(LINFO, ("Generating result features for", country));
-      if (!feature::GenerateFinalFeatures(genInfo, country, mapType))
+      if (!geometryGenerated[i])
         continue;
 
       LOG(LINFO, ("Generating offsets table for", datFile));
@@ -586,5 +637,14 @@ int main(int argc, char ** argv)
   if (FLAGS_check_mwm)
     check_model::ReadFeatures(datFile);
 
+  if (!FLAGS_osm_change_file.empty())
+  {
+    vector<string> affectedMwms;
+    if (!GetMwmsAffectedByOsmChange(FLAGS_osm_change_file, path, affectedMwms))
+      return -1;
+    for (auto const & mwm : affectedMwms)
+      std::cout << mwm << std::endl;
+  }
+
   return 0;
 }
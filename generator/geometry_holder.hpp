@@ -3,8 +3,11 @@
 #include "generator/feature_builder.hpp"
 #include "generator/feature_generator.hpp"
 #include "generator/feature_helpers.hpp"
+#include "generator/tesselation_cache.hpp"
 #include "generator/tesselator.hpp"
 
+#include "coding/writer.hpp"
+
 #include "geometry/parametrized_segment.hpp"
 #include "geometry/point2d.hpp"
 #include "geometry/polygon.hpp"
@@ -52,6 +55,8 @@ public:
 
   void SetInner() { m_trgInner = true; }
 
+  void SetTesselationCache(TesselationCache * cache) { m_tessCache = cache; }
+
   FeatureBuilder2::SupportingData & GetBuffer() { return m_buffer; }
 
   Points const & GetSourcePoints()
@@ -171,37 +176,63 @@ private:
   {
     CHECK(m_trgFileGetter, ("m_trgFileGetter must be set to write outer triangles."));
 
-    // tesselation
-    tesselator::TrianglesInfo info;
-    if (0 == tesselator::TesselateInterior(polys, info))
+    auto const cp = m_header.GetGeometryCodingParams(i);
+
+    // The serialized chains depend on the polygon points and on the coding
+    // parameters, so both go into the cache key.
+    uint64_t key = 0;
+    size_t pointsCount = 0;
+    if (m_tessCache)
     {
-      LOG(LINFO, ("NO TRIANGLES in", polys));
-      return;
+      uint64_t const params[] = {cp.GetBasePointUint64(), cp.GetCoordBits()};
+      key = TesselationCache::Hash(params, sizeof(params), polys.size());
+      for (auto const & poly : polys)
+      {
+        pointsCount += poly.size();
+        key = TesselationCache::Hash(poly.data(), poly.size() * sizeof(m2::PointD), key);
+      }
     }
+    bool const useCache = m_tessCache && pointsCount >= TesselationCache::kMinPointsToCache;
 
-    auto const cp = m_header.GetGeometryCodingParams(i);
+    std::vector<char> serialized;
+    if (!useCache || !m_tessCache->Get(key, serialized))
+    {
+      // tesselation
+      tesselator::TrianglesInfo info;
+      if (0 == tesselator::TesselateInterior(polys, info))
+      {
+        LOG(LINFO, ("NO TRIANGLES in", polys));
+        return;
+      }
+
+      serial::TrianglesChainSaver saver(cp);
 
-    serial::TrianglesChainSaver saver(cp);
+      // points conversion
+      tesselator::PointsInfo points;
+      m2::PointU (*D2U)(m2::PointD const &, uint32_t) = &PointDToPointU;
+      info.GetPointsInfo(saver.GetBasePoint(), saver.GetMaxPoint(),
+                         std::bind(D2U, std::placeholders::_1, cp.GetCoordBits()), points);
 
-    // points conversion
-    tesselator::PointsInfo points;
-    m2::PointU (*D2U)(m2::PointD const &, uint32_t) = &PointDToPointU;
-    info.GetPointsInfo(saver.GetBasePoint(), saver.GetMaxPoint(),
-                       std::bind(D2U, std::placeholders::_1, cp.GetCoordBits()), points);
+      // triangles processing (should be optimal)
+      info.ProcessPortions(points, saver, true);
 
-    // triangles processing (should be optimal)
-    info.ProcessPortions(points, saver, true);
+      // check triangles processing (to compare with optimal)
+      // serial::TrianglesChainSaver checkSaver(cp);
+      // info.ProcessPortions(points, checkSaver, false);
 
-    // check triangles processing (to compare with optimal)
-    // serial::TrianglesChainSaver checkSaver(cp);
-    // info.ProcessPortions(points, checkSaver, false);
+      // CHECK_LESS_OR_EQUAL(saver.GetBufferSize(), checkSaver.GetBufferSize(), ());
 
-    // CHECK_LESS_OR_EQUAL(saver.GetBufferSize(), checkSaver.GetBufferSize(), ());
+      MemWriter<std::vector<char>> writer(serialized);
+      saver.Save(writer);
+
+      if (useCache)
+        m_tessCache->Add(key, serialized);
+    }
 
     // saving to file
     m_buffer.m_trgMask |= (1 << i);
     m_buffer.m_trgOffset.push_back(feature::FeaturesCollector::GetFileSize(m_trgFileGetter(i)));
-    saver.Save(m_trgFileGetter(i));
+    m_trgFileGetter(i).Write(serialized.data(), serialized.size());
   }
 
   void FillInnerPointsMask(Points const & points, uint32_t scaleIndex)
@@ -234,6 +265,8 @@ private:
   FileGetter m_geoFileGetter = {};
   FileGetter m_trgFileGetter = {};
 
+  TesselationCache * m_tessCache = nullptr;
+
   FeatureBuilder2 & m_fb;
 
   FeatureBuilder2::SupportingData m_buffer;
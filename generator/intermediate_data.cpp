@@ -1,9 +1,15 @@
 #include "generator/intermediate_data.hpp"
 
+#include <array>
+#include <iterator>
+#include <mutex>
 #include <new>
 #include <set>
 #include <string>
 
+#include "coding/reader.hpp"
+#include "coding/varint.hpp"
+
 #include "base/assert.hpp"
 #include "base/checked_cast.hpp"
 #include "base/logging.hpp"
@@ -21,6 +27,13 @@ namespace
 size_t const kFlushCount = 1024;
 double const kValueOrder = 1e7;
 string const kShortExtension = ".short";
+string const kChunkedExtension = ".chunked";
+string const kChunkedIndexExtension = ".chunkidx";
+
+// Number of points compressed together. A lookup decodes at most one chunk,
+// and points of a way have close ids, so consecutive lookups usually hit the
+// already decoded chunk.
+size_t const kPointsChunkSize = 256;
 
 // An estimation.
 // OSM had around 4.1 billion nodes on 2017-11-08,
@@ -79,7 +92,11 @@ class RawFilePointStorageMmapReader : public PointStorageReaderInterface
 public:
   explicit RawFilePointStorageMmapReader(string const & name) :
     m_mmapReader(name)
-  {}
+  {
+    // Points are fetched by node id in OSM file order, which is effectively
+    // random for a storage much larger than RAM.
+    m_mmapReader.Advise(coding::MemoryAdvice::Random);
+  }
 
   // PointStorageReaderInterface overrides:
   bool GetPoint(uint64_t id, double & lat, double & lon) const override
@@ -182,6 +199,166 @@ private:
   uint64_t m_numProcessedPoints = 0;
 };
 
+// ChunkedFilePointStorageWriter -------------------------------------------------------------------
+// Stores points in fixed-size id chunks. Each chunk holds a bitmask of the
+// present ids followed by the delta-encoded coordinates, which shrinks the
+// storage several times compared to the raw file at near-raw lookup speed.
+class ChunkedFilePointStorageWriter : public PointStorageWriterBase
+{
+public:
+  explicit ChunkedFilePointStorageWriter(string const & name)
+    : m_dataWriter(name + kChunkedExtension)
+    , m_indexWriter(name + kChunkedIndexExtension)
+  {}
+
+  ~ChunkedFilePointStorageWriter() override
+  {
+    FlushChunk();
+  }
+
+  // PointStorageWriterInterface overrides:
+  void AddPoint(uint64_t id, double lat, double lon) override
+  {
+    uint64_t const chunk = id / kPointsChunkSize;
+    if (chunk != m_currentChunk)
+    {
+      CHECK(m_currentChunk == kInvalidChunk || chunk > m_currentChunk,
+            ("Chunked point storage requires ascending node ids, got", id));
+      FlushChunk();
+      m_currentChunk = chunk;
+    }
+
+    size_t const pos = id % kPointsChunkSize;
+    ToLatLon(lat, lon, m_points[pos]);
+    m_present[pos / 64] |= uint64_t{1} << (pos % 64);
+
+    ++m_numProcessedPoints;
+  }
+
+private:
+  static uint64_t const kInvalidChunk = numeric_limits<uint64_t>::max();
+
+  void FlushChunk()
+  {
+    if (m_currentChunk == kInvalidChunk)
+      return;
+
+    uint64_t const offset = m_dataWriter.Pos();
+    m_indexWriter.Write(&m_currentChunk, sizeof(m_currentChunk));
+    m_indexWriter.Write(&offset, sizeof(offset));
+
+    m_dataWriter.Write(m_present.data(), m_present.size() * sizeof(uint64_t));
+    int32_t prevLat = 0;
+    int32_t prevLon = 0;
+    for (size_t i = 0; i < kPointsChunkSize; ++i)
+    {
+      if (!(m_present[i / 64] & (uint64_t{1} << (i % 64))))
+        continue;
+      WriteVarInt(m_dataWriter, static_cast<int64_t>(m_points[i].m_lat) - prevLat);
+      WriteVarInt(m_dataWriter, static_cast<int64_t>(m_points[i].m_lon) - prevLon);
+      prevLat = m_points[i].m_lat;
+      prevLon = m_points[i].m_lon;
+    }
+
+    m_points.fill(LatLon());
+    m_present.fill(0);
+  }
+
+  FileWriter m_dataWriter;
+  FileWriter m_indexWriter;
+  array<LatLon, kPointsChunkSize> m_points;
+  array<uint64_t, kPointsChunkSize / 64> m_present = {};
+  uint64_t m_currentChunk = kInvalidChunk;
+  uint64_t m_numProcessedPoints = 0;
+};
+
+// ChunkedFilePointStorageMmapReader ---------------------------------------------------------------
+class ChunkedFilePointStorageMmapReader : public PointStorageReaderInterface
+{
+public:
+  explicit ChunkedFilePointStorageMmapReader(string const & name)
+    : m_mmapReader(name + kChunkedExtension)
+  {
+    m_mmapReader.Advise(coding::MemoryAdvice::Random);
+
+    FileReader indexReader(name + kChunkedIndexExtension);
+    uint64_t const size = indexReader.Size();
+    CHECK_EQUAL(size % (2 * sizeof(uint64_t)), 0, ("Damaged chunk index."));
+    m_index.resize(base::checked_cast<size_t>(size / (2 * sizeof(uint64_t))));
+    if (!m_index.empty())
+      indexReader.Read(0, m_index.data(), base::checked_cast<size_t>(size));
+  }
+
+  // PointStorageReaderInterface overrides:
+  bool GetPoint(uint64_t id, double & lat, double & lon) const override
+  {
+    uint64_t const chunk = id / kPointsChunkSize;
+    size_t const pos = id % kPointsChunkSize;
+
+    lock_guard<mutex> lock(m_mutex);
+    if (chunk != m_cachedChunk && !DecodeChunk(chunk))
+    {
+      LOG(LERROR, ("Node with id =", id, "not found!"));
+      return false;
+    }
+
+    bool const ret = FromLatLon(m_cachedPoints[pos], lat, lon);
+    if (!ret)
+      LOG(LERROR, ("Node with id =", id, "not found!"));
+    return ret;
+  }
+
+private:
+  struct ChunkIndexEntry
+  {
+    uint64_t m_chunk;
+    uint64_t m_offset;
+  };
+  static_assert(sizeof(ChunkIndexEntry) == 16, "Invalid structure size");
+
+  bool DecodeChunk(uint64_t chunk) const
+  {
+    auto const it = lower_bound(m_index.begin(), m_index.end(), chunk,
+                                [](ChunkIndexEntry const & e, uint64_t c) { return e.m_chunk < c; });
+    if (it == m_index.end() || it->m_chunk != chunk)
+      return false;
+
+    uint64_t const offset = it->m_offset;
+    uint64_t const end = next(it) != m_index.end() ? next(it)->m_offset : m_mmapReader.Size();
+
+    vector<uint8_t> buffer(base::checked_cast<size_t>(end - offset));
+    m_mmapReader.Read(offset, buffer.data(), buffer.size());
+
+    MemReader const reader(buffer.data(), buffer.size());
+    ReaderSource<MemReader> source(reader);
+
+    array<uint64_t, kPointsChunkSize / 64> present;
+    source.Read(present.data(), present.size() * sizeof(uint64_t));
+
+    m_cachedPoints.fill(LatLon());
+    int32_t prevLat = 0;
+    int32_t prevLon = 0;
+    for (size_t i = 0; i < kPointsChunkSize; ++i)
+    {
+      if (!(present[i / 64] & (uint64_t{1} << (i % 64))))
+        continue;
+      prevLat += static_cast<int32_t>(ReadVarInt<int64_t>(source));
+      prevLon += static_cast<int32_t>(ReadVarInt<int64_t>(source));
+      m_cachedPoints[i].m_lat = prevLat;
+      m_cachedPoints[i].m_lon = prevLon;
+    }
+
+    m_cachedChunk = chunk;
+    return true;
+  }
+
+  MmapReader m_mmapReader;
+  vector<ChunkIndexEntry> m_index;
+  mutable array<LatLon, kPointsChunkSize> m_cachedPoints;
+  mutable uint64_t m_cachedChunk = numeric_limits<uint64_t>::max();
+  mutable mutex m_mutex;
+};
+
 // MapFilePointStorageReader -----------------------------------------------------------------------
 class MapFilePointStorageReader : public PointStorageReaderInterface
 {
@@ -406,6 +583,8 @@ CreatePointStorageReader(feature::GenerateInfo::NodeStorageType type, string con
     return make_shared<MapFilePointStorageReader>(name);
   case feature::GenerateInfo::NodeStorageType::Memory:
     return make_shared<RawMemPointStorageReader>(name);
+  case feature::GenerateInfo::NodeStorageType::Chunked:
+    return make_shared<ChunkedFilePointStorageMmapReader>(name);
   }
   CHECK_SWITCH();
 }
@@ -421,6 +600,8 @@ CreatePointStorageWriter(feature::GenerateInfo::NodeStorageType type, string con
     return make_shared<MapFilePointStorageWriter>(name);
   case feature::GenerateInfo::NodeStorageType::Memory:
     return make_shared<RawMemPointStorageWriter>(name);
+  case feature::GenerateInfo::NodeStorageType::Chunked:
+    return make_shared<ChunkedFilePointStorageWriter>(name);
   }
   CHECK_SWITCH();
 }
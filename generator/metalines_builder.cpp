@@ -3,8 +3,12 @@
 #include "generator/routing_helpers.hpp"
 
 #include "indexer/classificator.hpp"
+#include "indexer/features_vector.hpp"
+#include "indexer/scales.hpp"
 
 #include "coding/file_container.hpp"
+#include "coding/geometry_coding.hpp"
+#include "coding/pointd_to_pointu.hpp"
 #include "coding/varint.hpp"
 #include "coding/write_to_sink.hpp"
 
@@ -14,12 +18,48 @@
 
 #include "defines.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <map>
+#include <vector>
 
 namespace
 {
-uint8_t const kMetaLinesSectionVersion = 1;
+uint8_t const kMetaLinesSectionVersion = 2;
+double const kPointEqualityEps = 1e-7;
+
+/// Merges feature geometry into a single polyline, the same way the runtime
+/// did for section version 1. A negative feature id means reversed direction.
+/// Returns an empty vector if any of the features cannot be merged.
+std::vector<m2::PointD> MergeMetalineGeometry(FeaturesVector const & featuresVector,
+                                              std::vector<int32_t> const & featureIds)
+{
+  std::vector<m2::PointD> result;
+  for (int32_t const fid : featureIds)
+  {
+    FeatureType ft;
+    featuresVector.GetByIndex(static_cast<uint32_t>(std::abs(fid)), ft);
+
+    std::vector<m2::PointD> points;
+    ft.ForEachPoint([&points](m2::PointD const & pt)
+    {
+      if (points.empty() || !points.back().EqualDxDy(pt, kPointEqualityEps))
+        points.push_back(pt);
+    }, scales::GetUpperScale());
+
+    if (points.size() < 2)
+      return {};
+    if (fid < 0)
+      std::reverse(points.begin(), points.end());
+
+    for (auto const & pt : points)
+    {
+      if (result.empty() || !result.back().EqualDxDy(pt, kPointEqualityEps))
+        result.push_back(pt);
+    }
+  }
+  return result;
+}
 
 using Ways = std::vector<int32_t>;
 
@@ -202,30 +242,61 @@ bool WriteMetalinesSection(std::string const & mwmPath, std::string const & meta
   MemWriter<std::vector<uint8_t>> memWriter(buffer);
   uint32_t count = 0;
 
-  while (src.Size() > 0)
   {
-    std::vector<int32_t> featureIds;
-    uint16_t size = ReadPrimitiveFromSource<uint16_t>(src);
-    std::vector<int32_t> ways(size);
-    src.Read(ways.data(), size * sizeof(int32_t));
-    for (auto const wayId : ways)
+    // The features reader must be closed before the section is written.
+    FeaturesVectorTest featuresVector(mwmPath);
+
+    while (src.Size() > 0)
     {
-      // We get a negative wayId when a feature direction should be reversed.
-      auto fid = osmIdToFeatureId.find(base::MakeOsmWay(std::abs(wayId)));
-      if (fid == osmIdToFeatureId.cend())
-        break;
+      std::vector<int32_t> featureIds;
+      uint16_t size = ReadPrimitiveFromSource<uint16_t>(src);
+      std::vector<int32_t> ways(size);
+      src.Read(ways.data(), size * sizeof(int32_t));
+      for (auto const wayId : ways)
+      {
+        // We get a negative wayId when a feature direction should be reversed.
+        auto fid = osmIdToFeatureId.find(base::MakeOsmWay(std::abs(wayId)));
+        if (fid == osmIdToFeatureId.cend())
+          break;
 
-      // Keeping the sign for the feature direction.
-      int32_t const featureId = static_cast<int32_t>(fid->second);
-      featureIds.push_back(wayId > 0 ? featureId : -featureId);
-    }
+        // Keeping the sign for the feature direction.
+        int32_t const featureId = static_cast<int32_t>(fid->second);
+        featureIds.push_back(wayId > 0 ? featureId : -featureId);
+      }
+
+      if (featureIds.size() < 2)
+        continue;
+
+      // Merge the geometry here, so the device only deserializes ready
+      // splines instead of reading features and merging them at runtime.
+      auto const mergedPoints = MergeMetalineGeometry(featuresVector.GetVector(), featureIds);
+      if (mergedPoints.size() < 2)
+        continue;
+
+      // Quantized duplicates are dropped, so the runtime gets strictly
+      // distinct points after decoding.
+      std::vector<m2::PointU> quantized;
+      quantized.reserve(mergedPoints.size());
+      for (auto const & pt : mergedPoints)
+      {
+        m2::PointU const ptU = PointDToPointU(pt, POINT_COORD_BITS);
+        if (quantized.empty() || ptU != quantized.back())
+          quantized.push_back(ptU);
+      }
+      if (quantized.size() < 2)
+        continue;
 
-    if (featureIds.size() > 1)
-    {
-      // Write vector to buffer if we have got at least two segments.
       WriteVarUint(memWriter, featureIds.size());
       for (auto const & fid : featureIds)
-        WriteVarInt(memWriter, fid);
+        WriteVarInt(memWriter, std::abs(fid));
+
+      WriteVarUint(memWriter, quantized.size());
+      m2::PointU prevPt(0, 0);
+      for (auto const & ptU : quantized)
+      {
+        coding::EncodePointDelta(memWriter, prevPt, ptU);
+        prevPt = ptU;
+      }
       ++count;
     }
   }
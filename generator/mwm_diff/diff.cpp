@@ -52,8 +52,35 @@ bool MakeDiffVersion0(FileReader & oldReader, FileReader & newReader, FileWriter
   return true;
 }
 
+// Forwards writes to the wrapped writer and reports how much of the
+// resulting file is ready. The patch is applied block by block, so the
+// callback fires once per block.
+class WriterWithProgress
+{
+public:
+  WriterWithProgress(Writer & writer, generator::mwm_diff::ProgressFn const & progress, uint64_t expectedSize)
+    : m_writer(writer), m_progress(progress), m_expectedSize(expectedSize)
+  {
+  }
+
+  void Write(void const * data, size_t size)
+  {
+    m_writer.Write(data, size);
+    m_written += size;
+    if (m_progress)
+      m_progress(m_written, m_expectedSize);
+  }
+
+private:
+  Writer & m_writer;
+  generator::mwm_diff::ProgressFn const & m_progress;
+  uint64_t const m_expectedSize;
+  uint64_t m_written = 0;
+};
+
 bool ApplyDiffVersion0(FileReader & oldReader, FileWriter & newWriter,
-                       ReaderSource<FileReader> & diffFileSource)
+                       ReaderSource<FileReader> & diffFileSource,
+                       generator::mwm_diff::ProgressFn const & progress)
 {
   vector<uint8_t> deflatedDiff(diffFileSource.Size());
   diffFileSource.Read(deflatedDiff.data(), deflatedDiff.size());
@@ -66,7 +93,17 @@ bool ApplyDiffVersion0(FileReader & oldReader, FileWriter & newWriter,
 
   MemReader diffMemReader(diffBuf.data(), diffBuf.size());
 
-  auto status = bsdiff::ApplyBinaryPatch(oldReader, newWriter, diffMemReader);
+  // Peek the header for the size of the resulting mwm to report absolute progress.
+  uint64_t expectedSize = 0;
+  {
+    ReaderSource<MemReader> headerSource(diffMemReader);
+    bsdiff::MBSPatchHeader header;
+    if (bsdiff::MBS_ReadHeader(headerSource, &header) == bsdiff::OK)
+      expectedSize = header.dlen;
+  }
+
+  WriterWithProgress newWriterWithProgress(newWriter, progress, expectedSize);
+  auto status = bsdiff::ApplyBinaryPatch(oldReader, newWriterWithProgress, diffMemReader);
 
   if (status != bsdiff::BSDiffStatus::OK)
   {
@@ -113,6 +150,12 @@ bool MakeDiff(string const & oldMwmPath, string const & newMwmPath, string const
 }
 
 bool ApplyDiff(string const & oldMwmPath, string const & newMwmPath, string const & diffPath)
+{
+  return ApplyDiff(oldMwmPath, newMwmPath, diffPath, ProgressFn());
+}
+
+bool ApplyDiff(string const & oldMwmPath, string const & newMwmPath, string const & diffPath,
+               ProgressFn const & progress)
 {
   try
   {
@@ -125,7 +168,7 @@ bool ApplyDiff(string const & oldMwmPath, string const & newMwmPath, string cons
 
     switch (version)
     {
-    case VERSION_V0: return ApplyDiffVersion0(oldReader, newWriter, diffFileSource);
+    case VERSION_V0: return ApplyDiffVersion0(oldReader, newWriter, diffFileSource, progress);
     default: LOG(LERROR, ("Unknown version format of mwm diff:", version));
     }
   }
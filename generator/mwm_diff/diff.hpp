@@ -1,11 +1,17 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <string>
 
 namespace generator
 {
 namespace mwm_diff
 {
+// Called after every applied patch block with the number of bytes of the
+// resulting mwm written so far and its expected total size.
+using ProgressFn = std::function<void(uint64_t written, uint64_t total)>;
+
 // Makes a diff that, when applied to the mwm at |oldMwmPath|, will
 // result in the mwm at |newMwmPath|. The diff is stored at |diffPath|.
 // It is assumed that the files at |oldMwmPath| and |newMwmPath| are valid mwms.
@@ -20,5 +26,9 @@ bool MakeDiff(std::string const & oldMwmPath, std::string const & newMwmPath,
 // Returns true on success and false on failure.
 bool ApplyDiff(std::string const & oldMwmPath, std::string const & newMwmPath,
                std::string const & diffPath);
+
+// Same as above but additionally reports progress of the application.
+bool ApplyDiff(std::string const & oldMwmPath, std::string const & newMwmPath,
+               std::string const & diffPath, ProgressFn const & progress);
 }  // namespace mwm_diff
 }  // namespace generator
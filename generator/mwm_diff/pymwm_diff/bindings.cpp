@@ -22,5 +22,8 @@ BOOST_PYTHON_MODULE(pymwm_diff)
   using namespace boost::python;
 
   def("make_diff", generator::mwm_diff::MakeDiff);
-  def("apply_diff", generator::mwm_diff::ApplyDiff);
+  // Select the overload without the progress callback.
+  def("apply_diff",
+      static_cast<bool (*)(string const &, string const &, string const &)>(
+          &generator::mwm_diff::ApplyDiff));
 }
@@ -31,10 +31,12 @@
 #include "geometry/tree4d.hpp"
 
 #include "base/stl_helpers.hpp"
+#include "base/timer.hpp"
 
 #include "coding/file_name_utils.hpp"
 #include "coding/parse_xml.hpp"
 
+#include <future>
 #include <memory>
 #include <set>
 
@@ -69,6 +71,92 @@ uint64_t SourceReader::Read(char * buffer, uint64_t bufferSize)
   return m_file->gcount();
 }
 
+void AddElementToCache(cache::IntermediateDataWriter & cache,
+                       CameraNodeIntermediateDataProcessor & cameras, OsmElement & em);
+
+namespace
+{
+// The osm source streams are decoded strictly sequentially (o5m is
+// delta-coded), so the passes cannot be sharded by id range without a
+// prebuilt index. Instead decoding is pipelined with the consuming stage:
+// elements are parsed on the calling thread while the previous batch is
+// consumed on a separate one. A single in-flight batch bounds the queue;
+// waiting for it is the backpressure on the decode stage. Per-stage
+// throughput and wait counters are logged by Finish().
+class AsyncElementPipeline
+{
+public:
+  AsyncElementPipeline(string const & consumerStage, function<void(OsmElement &)> consumer)
+    : m_consumerStage(consumerStage), m_consumer(move(consumer))
+  {
+    m_batch.reserve(kBatchSize);
+  }
+
+  void Process(OsmElement const & em)
+  {
+    m_batch.push_back(em);
+    if (m_batch.size() >= kBatchSize)
+      Flush();
+  }
+
+  void Finish()
+  {
+    Flush();
+    if (m_writer.valid())
+      m_writer.get();
+
+    double const totalSeconds = m_timer.ElapsedSeconds();
+    LOG(LINFO, ("Pipeline stage Decode:", m_elements, "elements,",
+                totalSeconds - m_stallSeconds, "s busy,", m_stallSeconds, "s waiting for",
+                m_consumerStage));
+    LOG(LINFO, ("Pipeline stage", m_consumerStage, ":", m_elements, "elements,",
+                m_consumerSeconds, "s busy of", totalSeconds, "s total"));
+  }
+
+private:
+  static size_t constexpr kBatchSize = 4096;
+
+  void Flush()
+  {
+    if (m_batch.empty())
+      return;
+
+    m_elements += m_batch.size();
+
+    // A single in-flight batch keeps the memory usage bounded and the
+    // consumers strictly ordered.
+    if (m_writer.valid())
+    {
+      base::Timer stall;
+      m_writer.get();
+      m_stallSeconds += stall.ElapsedSeconds();
+    }
+
+    m_writer = async(launch::async, [this](vector<OsmElement> elements)
+    {
+      base::Timer busy;
+      for (auto & em : elements)
+        m_consumer(em);
+      // Read by Finish() only after the last get(), so no race here.
+      m_consumerSeconds += busy.ElapsedSeconds();
+    }, move(m_batch));
+
+    m_batch.clear();
+    m_batch.reserve(kBatchSize);
+  }
+
+  string const m_consumerStage;
+  function<void(OsmElement &)> m_consumer;
+  vector<OsmElement> m_batch;
+  future<void> m_writer;
+
+  base::Timer m_timer;
+  uint64_t m_elements = 0;
+  double m_stallSeconds = 0.0;
+  double m_consumerSeconds = 0.0;
+};
+}  // namespace
+
 // Functions ---------------------------------------------------------------------------------------
 void AddElementToCache(cache::IntermediateDataWriter & cache,
                        CameraNodeIntermediateDataProcessor & cameras, OsmElement & em)
@@ -133,12 +221,14 @@ void AddElementToCache(cache::IntermediateDataWriter & cache,
 void BuildIntermediateDataFromXML(SourceReader & stream, cache::IntermediateDataWriter & cache,
                                   TownsDumper & towns, CameraNodeIntermediateDataProcessor & cameras)
 {
-  XMLSource parser([&](OsmElement * e)
+  AsyncElementPipeline pipeline("CacheWrite", [&](OsmElement & em)
   {
-    towns.CheckElement(*e);
-    AddElementToCache(cache, cameras, *e);
+    towns.CheckElement(em);
+    AddElementToCache(cache, cameras, em);
   });
+  XMLSource parser([&pipeline](OsmElement * e) { pipeline.Process(*e); });
   ParseXMLSequence(stream, parser);
+  pipeline.Finish();
 }
 
 void ProcessOsmElementsFromXML(SourceReader & stream, function<void(OsmElement *)> processor)
@@ -150,14 +240,17 @@ void ProcessOsmElementsFromXML(SourceReader & stream, function<void(OsmElement *
 void BuildIntermediateDataFromO5M(SourceReader & stream, cache::IntermediateDataWriter & cache,
                                   TownsDumper & towns, CameraNodeIntermediateDataProcessor & cameras)
 {
-  auto processor = [&cache, &cameras, &towns](OsmElement * em) {
-    towns.CheckElement(*em);
-    AddElementToCache(cache, cameras, *em);
-  };
+  AsyncElementPipeline pipeline("CacheWrite", [&](OsmElement & em)
+  {
+    towns.CheckElement(em);
+    AddElementToCache(cache, cameras, em);
+  });
+  auto processor = [&pipeline](OsmElement * em) { pipeline.Process(*em); };
 
   // Use only this function here, look into ProcessOsmElementsFromO5M
   // for more details.
   ProcessOsmElementsFromO5M(stream, processor);
+  pipeline.Finish();
 }
 
 void ProcessOsmElementsFromO5M(SourceReader & stream, function<void(OsmElement *)> processor)
@@ -234,10 +327,14 @@ static bool GenerateRaw(feature::GenerateInfo & info, shared_ptr<EmitterInterfac
 {
   try
   {
-    auto const fn = [&](OsmElement * e) {
-      if (preEmit(e))
-        translator->EmitElement(e);
-    };
+    // Decoding the planet file is I/O-heavy while translating and emitting
+    // is CPU-heavy; running them through the pipeline overlaps the two.
+    AsyncElementPipeline pipeline("TranslateEmit", [&](OsmElement & em)
+    {
+      if (preEmit(&em))
+        translator->EmitElement(&em);
+    });
+    auto const fn = [&pipeline](OsmElement * e) { pipeline.Process(*e); };
 
     SourceReader reader = info.m_osmFileName.empty() ? SourceReader() : SourceReader(info.m_osmFileName);
     switch (info.m_osmFileType)
@@ -253,6 +350,7 @@ static bool GenerateRaw(feature::GenerateInfo & info, shared_ptr<EmitterInterfac
     LOG(LINFO, ("Processing", info.m_osmFileName, "done."));
 
     MixFakeNodes(GetPlatform().ResourcesDir() + MIXED_NODES_FILE, fn);
+    pipeline.Finish();
 
     // Stop if coasts are not merged and FLAG_fail_on_coasts is set
     if (!emitter->Finish())
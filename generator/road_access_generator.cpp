@@ -22,6 +22,7 @@
 #include "defines.hpp"
 
 #include <algorithm>
+#include <set>
 #include <utility>
 
 using namespace routing;
@@ -208,6 +209,27 @@ bool ParseRoadAccess(string const & roadAccessPath,
   return true;
 }
 
+// Keys of all the tags which can affect road access for any vehicle type.
+// Built once from the mappings above, so a single scan over an element's
+// tags decides whether the per-vehicle matching is needed at all.
+set<string> const & GetRelevantAccessKeys()
+{
+  static set<string> const kKeys = []()
+  {
+    set<string> keys;
+    for (auto const mapping :
+         {&kMotorCarTagMapping, &kMotorVehicleTagMapping, &kVehicleTagMapping,
+          &kCarBarriersTagMapping, &kPedestrianTagMapping, &kBicycleTagMapping,
+          &kBicycleBarriersTagMapping, &kDefaultTagMapping})
+    {
+      for (auto const & kv : *mapping)
+        keys.insert(kv.first.key);
+    }
+    return keys;
+  }();
+  return kKeys;
+}
+
 // If |elem| has access tag from |mapping|, returns corresponding RoadAccess::Type.
 // Tags in |mapping| should be mutually exclusive. Caller is responsible for that. If there are
 // multiple access tags from |mapping| in |elem|, returns RoadAccess::Type for any of them.
@@ -262,12 +284,15 @@ RoadAccessTagProcessor::RoadAccessTagProcessor(VehicleType vehicleType)
   }
 }
 
-void RoadAccessTagProcessor::Process(OsmElement const & elem, ofstream & oss)
+void RoadAccessTagProcessor::Process(OsmElement const & elem, ofstream & oss, bool hasAccessTags)
 {
   // We will process all nodes before ways because of o5m format:
   // all nodes are first, then all ways, then all relations.
   if (elem.type == OsmElement::EntityType::Node)
   {
+    if (!hasAccessTags)
+      return;
+
     RoadAccess::Type accessType = GetAccessType(elem);
     if (accessType != RoadAccess::Type::Yes)
       m_barriers[elem.id] = accessType;
@@ -278,12 +303,18 @@ void RoadAccessTagProcessor::Process(OsmElement const & elem, ofstream & oss)
     return;
 
   // All feature tags.
-  auto const accessType = GetAccessType(elem);
-  if (accessType != RoadAccess::Type::Yes)
-    oss << ToString(m_vehicleType) << " " << ToString(accessType) << " " << elem.id << " "
-        << 0 /* wildcard segment Idx */ << endl;
+  if (hasAccessTags)
+  {
+    auto const accessType = GetAccessType(elem);
+    if (accessType != RoadAccess::Type::Yes)
+      oss << ToString(m_vehicleType) << " " << ToString(accessType) << " " << elem.id << " "
+          << 0 /* wildcard segment Idx */ << endl;
+  }
 
   // Barrier tags.
+  if (m_barriers.empty())
+    return;
+
   for (size_t pointIdx = 0; pointIdx < elem.m_nds.size(); ++pointIdx)
   {
     auto const it = m_barriers.find(elem.m_nds[pointIdx]);
@@ -332,8 +363,22 @@ void RoadAccessWriter::Process(OsmElement const & elem)
     return;
   }
 
+  // One scan over the tags filters out the elements which cannot affect
+  // any vehicle type: a node without the relevant tags is not a barrier
+  // and for a way without them only the collected barrier points matter.
+  bool hasAccessTags = false;
+  auto const & keys = GetRelevantAccessKeys();
+  for (auto const & tag : elem.m_tags)
+  {
+    if (keys.count(tag.key) != 0)
+    {
+      hasAccessTags = true;
+      break;
+    }
+  }
+
   for (auto & p : m_tagProcessors)
-    p.Process(elem, m_stream);
+    p.Process(elem, m_stream, hasAccessTags);
 }
 
 bool RoadAccessWriter::IsOpened() const { return m_stream && m_stream.is_open(); }
@@ -29,7 +29,10 @@ public:
 
   explicit RoadAccessTagProcessor(VehicleType vehicleType);
 
-  void Process(OsmElement const & elem, std::ofstream & oss);
+  // |hasAccessTags| tells whether |elem| has at least one tag from the
+  // access mappings; without them only the barrier points of a way are
+  // checked.
+  void Process(OsmElement const & elem, std::ofstream & oss, bool hasAccessTags);
 
 private:
   RoadAccess::Type GetAccessType(OsmElement const & elem) const;
@@ -39,11 +39,15 @@
 #include "base/timer.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 using namespace feature;
@@ -356,13 +360,24 @@ void CalcCrossMwmConnectors(
       ", elapsed:", timer.ElapsedSeconds(), "seconds"));
 
   timer.Reset();
-  sort(transitions.begin(), transitions.end(),
-       [&](CrossMwmConnectorSerializer::Transition<CrossMwmId> const & lhs,
-           CrossMwmConnectorSerializer::Transition<CrossMwmId> const & rhs) {
-         return CalcDistanceAlongTheBorders(borders, lhs) <
-                CalcDistanceAlongTheBorders(borders, rhs);
+  // The distance along the borders is computed once per transition instead of
+  // at every comparison of the sort: every computation walks all the border
+  // points, which made the sort quadratic in the border size.
+  vector<pair<double, size_t>> distances;
+  distances.reserve(transitions.size());
+  for (size_t i = 0; i < transitions.size(); ++i)
+    distances.emplace_back(CalcDistanceAlongTheBorders(borders, transitions[i]), i);
+  sort(distances.begin(), distances.end(),
+       [](pair<double, size_t> const & lhs, pair<double, size_t> const & rhs) {
+         return lhs.first < rhs.first;
        });
 
+  vector<CrossMwmConnectorSerializer::Transition<CrossMwmId>> sortedTransitions;
+  sortedTransitions.reserve(transitions.size());
+  for (auto const & d : distances)
+    sortedTransitions.push_back(move(transitions[d.second]));
+  transitions.swap(sortedTransitions);
+
   LOG(LINFO, ("Transition sorted in", timer.ElapsedSeconds(), "seconds"));
 
   for (auto const & transition : transitions)
@@ -390,46 +405,81 @@ void FillWeights(string const & path, string const & mwmFile, string const & cou
 {
   base::Timer timer;
 
-  shared_ptr<VehicleModelInterface> vehicleModel =
-      CarModelFactory(countryParentNameGetterFn).GetVehicleModelForCountry(country);
-  IndexGraph graph(
-      make_shared<Geometry>(GeometryLoader::CreateFromFile(mwmFile, vehicleModel)),
-      EdgeEstimator::Create(VehicleType::Car, *vehicleModel, nullptr /* trafficStash */));
+  auto const numEnters = connector.GetEnters().size();
 
-  MwmValue mwmValue(LocalCountryFile(path, platform::CountryFile(country), 0 /* version */));
-  DeserializeIndexGraph(mwmValue, VehicleType::Car, graph);
+  size_t const threadsCount =
+      min(max(numEnters, size_t(1)),
+          static_cast<size_t>(max(1u, thread::hardware_concurrency())));
 
   map<Segment, map<Segment, RouteWeight>> weights;
-  auto const numEnters = connector.GetEnters().size();
   size_t foundCount = 0;
   size_t notFoundCount = 0;
-  for (size_t i = 0; i < numEnters; ++i)
-  {
-    if (!disableCrossMwmProgress && (i % 10 == 0) && (i != 0))
-      LOG(LINFO, ("Building leaps:", i, "/", numEnters, "waves passed"));
 
-    Segment const & enter = connector.GetEnter(i);
+  atomic<size_t> nextEnter(0);
+  mutex weightsMutex;
 
-    AStarAlgorithm<DijkstraWrapper> astar;
-    DijkstraWrapper wrapper(graph);
-    AStarAlgorithm<DijkstraWrapper>::Context context;
-    astar.PropagateWave(wrapper, enter,
-                        [](Segment const & /* vertex */) { return true; } /* visitVertex */,
-                        context);
+  // Dijkstra waves from different enters are independent, so the enters are
+  // spread between threads. Each thread deserializes its own index graph
+  // because the graph and its geometry caches are not thread safe.
+  auto const fn = [&]() {
+    shared_ptr<VehicleModelInterface> vehicleModel =
+        CarModelFactory(countryParentNameGetterFn).GetVehicleModelForCountry(country);
+    IndexGraph graph(
+        make_shared<Geometry>(GeometryLoader::CreateFromFile(mwmFile, vehicleModel)),
+        EdgeEstimator::Create(VehicleType::Car, *vehicleModel, nullptr /* trafficStash */));
 
-    for (Segment const & exit : connector.GetExits())
+    MwmValue mwmValue(LocalCountryFile(path, platform::CountryFile(country), 0 /* version */));
+    DeserializeIndexGraph(mwmValue, VehicleType::Car, graph);
+
+    map<Segment, map<Segment, RouteWeight>> localWeights;
+    size_t localFoundCount = 0;
+    size_t localNotFoundCount = 0;
+
+    while (true)
     {
-      if (context.HasDistance(exit))
-      {
-        weights[enter][exit] = context.GetDistance(exit);
-        ++foundCount;
-      }
-      else
+      size_t const i = nextEnter.fetch_add(1);
+      if (i >= numEnters)
+        break;
+
+      if (!disableCrossMwmProgress && (i % 10 == 0) && (i != 0))
+        LOG(LINFO, ("Building leaps:", i, "/", numEnters, "waves passed"));
+
+      Segment const & enter = connector.GetEnter(i);
+
+      AStarAlgorithm<DijkstraWrapper> astar;
+      DijkstraWrapper wrapper(graph);
+      AStarAlgorithm<DijkstraWrapper>::Context context;
+      astar.PropagateWave(wrapper, enter,
+                          [](Segment const & /* vertex */) { return true; } /* visitVertex */,
+                          context);
+
+      for (Segment const & exit : connector.GetExits())
       {
-        ++notFoundCount;
+        if (context.HasDistance(exit))
+        {
+          localWeights[enter][exit] = context.GetDistance(exit);
+          ++localFoundCount;
+        }
+        else
+        {
+          ++localNotFoundCount;
+        }
       }
     }
-  }
+
+    lock_guard<mutex> guard(weightsMutex);
+    for (auto & kv : localWeights)
+      weights.emplace(kv.first, move(kv.second));
+    foundCount += localFoundCount;
+    notFoundCount += localNotFoundCount;
+  };
+
+  vector<thread> threads;
+  for (size_t i = 1; i < threadsCount; ++i)
+    threads.emplace_back(fn);
+  fn();
+  for (auto & t : threads)
+    t.join();
 
   connector.FillWeights([&](Segment const & enter, Segment const & exit) {
     auto it0 = weights.find(enter);
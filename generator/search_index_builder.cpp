@@ -25,8 +25,11 @@
 #include "platform/platform.hpp"
 
 #include "coding/file_name_utils.hpp"
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
 #include "coding/fixed_bits_ddvector.hpp"
 #include "coding/reader_writer_ops.hpp"
+#include "coding/varint.hpp"
 #include "coding/writer.hpp"
 
 #include "base/assert.hpp"
@@ -39,8 +42,11 @@
 #include <algorithm>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <queue>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <thread>
 
@@ -52,7 +58,10 @@ namespace
 {
 class SynonymsHolder
 {
-  unordered_multimap<string, string> m_map;
+  // Maps a feature name to the normalized synonym tokens. Synonyms are
+  // normalized once at load time: the same few synonyms are emitted for
+  // thousands of features, so normalizing in ForEach callers is wasteful.
+  unordered_multimap<string, strings::UniString> m_map;
 
 public:
   SynonymsHolder(string const & fPath)
@@ -79,7 +88,7 @@ public:
           strings::Trim(tokens[i]);
           // synonym should not has any spaces
           ASSERT ( tokens[i].find_first_of(" \t") == string::npos, () );
-          m_map.insert(make_pair(tokens[0], tokens[i]));
+          m_map.insert(make_pair(tokens[0], search::NormalizeAndSimplifyString(tokens[i])));
         }
       }
     }
@@ -88,7 +97,7 @@ public:
   template <class ToDo>
   void ForEach(string const & key, ToDo toDo) const
   {
-    using TIter = unordered_multimap<string, string>::const_iterator;
+    using TIter = unordered_multimap<string, strings::UniString>::const_iterator;
 
     pair<TIter, TIter> range = m_map.equal_range(key);
     while (range.first != range.second)
@@ -131,18 +140,134 @@ void GetCategoryTypes(CategoriesHolder const & categories, pair<int, int> const
   }
 }
 
+// Accumulates key-value pairs and emits them in a sorted order under a
+// fixed memory budget: pairs overflowing the buffer are flushed as
+// sorted runs into a temporary file and the runs are merged back on
+// reading. This way search index builds for several mwms can run
+// concurrently without RSS growing with the mwm size.
 template <typename TKey, typename TValue>
+class ExternalKeyValueSorter
+{
+public:
+  ExternalKeyValueSorter(string const & tmpFilePath, size_t maxBufferedPairs)
+    : m_tmpFilePath(tmpFilePath), m_maxBufferedPairs(maxBufferedPairs)
+  {
+  }
+
+  ~ExternalKeyValueSorter()
+  {
+    if (m_writer)
+    {
+      m_writer.reset();
+      FileWriter::DeleteFileX(m_tmpFilePath);
+    }
+  }
+
+  void Emit(TKey const & key, TValue const & value)
+  {
+    m_buffer.emplace_back(key, value);
+    if (m_buffer.size() >= m_maxBufferedPairs)
+      FlushRun();
+  }
+
+  template <typename ToDo>
+  void ForEachSorted(ToDo && toDo)
+  {
+    if (m_runs.empty())
+    {
+      // Everything fits into the memory budget.
+      sort(m_buffer.begin(), m_buffer.end());
+      for (auto const & e : m_buffer)
+        toDo(e.first, e.second);
+      return;
+    }
+
+    FlushRun();
+    m_writer.reset();
+
+    FileReader reader(m_tmpFilePath);
+    SCOPE_GUARD(tmpFileGuard, bind(&FileWriter::DeleteFileX, m_tmpFilePath));
+
+    vector<ReaderSource<FileReader>> sources;
+    sources.reserve(m_runs.size());
+    for (auto const & run : m_runs)
+      sources.emplace_back(reader.SubReader(run.first, run.second - run.first));
+
+    using TQueueItem = pair<pair<TKey, TValue>, size_t>;
+    auto const greater = [](TQueueItem const & lhs, TQueueItem const & rhs)
+    {
+      return rhs.first < lhs.first;
+    };
+    priority_queue<TQueueItem, vector<TQueueItem>, decltype(greater)> queue(greater);
+
+    for (size_t i = 0; i < sources.size(); ++i)
+      queue.emplace(ReadPair(sources[i]), i);
+
+    while (!queue.empty())
+    {
+      auto const item = queue.top();
+      queue.pop();
+      toDo(item.first.first, item.first.second);
+      if (sources[item.second].Size() > 0)
+        queue.emplace(ReadPair(sources[item.second]), item.second);
+    }
+  }
+
+private:
+  void FlushRun()
+  {
+    if (m_buffer.empty())
+      return;
+
+    sort(m_buffer.begin(), m_buffer.end());
+
+    if (!m_writer)
+      m_writer = make_unique<FileWriter>(m_tmpFilePath);
+
+    uint64_t const beg = m_writer->Pos();
+    for (auto const & e : m_buffer)
+    {
+      WriteVarUint(*m_writer, static_cast<uint32_t>(e.first.size()));
+      for (auto const c : e.first)
+        WriteVarUint(*m_writer, c);
+      m_writer->Write(&e.second, sizeof(e.second));
+    }
+    m_runs.emplace_back(beg, m_writer->Pos());
+
+    m_buffer.clear();
+  }
+
+  static pair<TKey, TValue> ReadPair(ReaderSource<FileReader> & src)
+  {
+    pair<TKey, TValue> e;
+    uint32_t const size = ReadVarUint<uint32_t>(src);
+    e.first.resize(size);
+    for (uint32_t i = 0; i < size; ++i)
+      e.first[i] = ReadVarUint<uint32_t>(src);
+    src.Read(&e.second, sizeof(e.second));
+    return e;
+  }
+
+  string const m_tmpFilePath;
+  size_t const m_maxBufferedPairs;
+
+  vector<pair<TKey, TValue>> m_buffer;
+  unique_ptr<FileWriter> m_writer;
+  // Begin and end offsets of the sorted runs in the temporary file.
+  vector<pair<uint64_t, uint64_t>> m_runs;
+};
+
+template <typename TKey, typename TValue, typename TSorter>
 struct FeatureNameInserter
 {
   SynonymsHolder * m_synonyms;
-  vector<pair<TKey, TValue>> & m_keyValuePairs;
+  TSorter & m_sorter;
   TValue m_val;
 
   bool m_hasStreetType;
 
-  FeatureNameInserter(SynonymsHolder * synonyms, vector<pair<TKey, TValue>> & keyValuePairs,
-                      bool hasStreetType)
-    : m_synonyms(synonyms), m_keyValuePairs(keyValuePairs), m_hasStreetType(hasStreetType)
+  FeatureNameInserter(SynonymsHolder * synonyms, TSorter & sorter, bool hasStreetType)
+    : m_synonyms(synonyms), m_sorter(sorter), m_hasStreetType(hasStreetType)
   {
   }
 
@@ -153,7 +278,7 @@ struct FeatureNameInserter
     key.push_back(lang);
     key.append(s.begin(), s.end());
 
-    m_keyValuePairs.emplace_back(key, m_val);
+    m_sorter.Emit(key, m_val);
   }
 
   void operator()(signed char lang, string const & name) const
@@ -167,9 +292,9 @@ struct FeatureNameInserter
     // add synonyms for input native string
     if (m_synonyms)
     {
-      m_synonyms->ForEach(name, [&](string const & utf8str)
+      m_synonyms->ForEach(name, [&](strings::UniString const & uniStr)
                           {
-                            tokens.push_back(search::NormalizeAndSimplifyString(utf8str));
+                            tokens.push_back(uniStr);
                           });
     }
 
@@ -227,11 +352,11 @@ struct ValueBuilder<FeatureIndexValue>
   }
 };
 
-template <typename TKey, typename TValue>
+template <typename TKey, typename TValue, typename TSorter>
 class FeatureInserter
 {
   SynonymsHolder * m_synonyms;
-  vector<pair<TKey, TValue>> & m_keyValuePairs;
+  TSorter & m_sorter;
 
   CategoriesHolder const & m_categories;
 
@@ -240,11 +365,11 @@ class FeatureInserter
   ValueBuilder<TValue> const & m_valueBuilder;
 
 public:
-  FeatureInserter(SynonymsHolder * synonyms, vector<pair<TKey, TValue>> & keyValuePairs,
+  FeatureInserter(SynonymsHolder * synonyms, TSorter & sorter,
                   CategoriesHolder const & catHolder, pair<int, int> const & scales,
                   ValueBuilder<TValue> const & valueBuilder)
     : m_synonyms(synonyms)
-    , m_keyValuePairs(keyValuePairs)
+    , m_sorter(sorter)
     , m_categories(catHolder)
     , m_scales(scales)
     , m_valueBuilder(valueBuilder)
@@ -264,8 +389,8 @@ public:
 
     // Init inserter with serialized value.
     // Insert synonyms only for countries and states (maybe will add cities in future).
-    FeatureNameInserter<TKey, TValue> inserter(
-        skipIndex.IsCountryOrState(types) ? m_synonyms : nullptr, m_keyValuePairs, hasStreetType);
+    FeatureNameInserter<TKey, TValue, TSorter> inserter(
+        skipIndex.IsCountryOrState(types) ? m_synonyms : nullptr, m_sorter, hasStreetType);
     m_valueBuilder.MakeValue(f, index, inserter.m_val);
 
     string const postcode = f.GetMetadata().Get(feature::Metadata::FMD_POSTCODE);
@@ -301,10 +426,9 @@ public:
   }
 };
 
-template <typename TKey, typename TValue>
+template <typename TKey, typename TValue, typename TSorter>
 void AddFeatureNameIndexPairs(FeaturesVectorTest const & features,
-                              CategoriesHolder const & categoriesHolder,
-                              vector<pair<TKey, TValue>> & keyValuePairs)
+                              CategoriesHolder const & categoriesHolder, TSorter & sorter)
 {
   feature::DataHeader const & header = features.GetHeader();
 
@@ -314,8 +438,8 @@ void AddFeatureNameIndexPairs(FeaturesVectorTest const & features,
   if (header.GetType() == feature::DataHeader::world)
     synonyms.reset(new SynonymsHolder(GetPlatform().WritablePathForFile(SYNONYMS_FILE)));
 
-  features.GetVector().ForEach(FeatureInserter<TKey, TValue>(
-      synonyms.get(), keyValuePairs, categoriesHolder, header.GetScaleRange(), valueBuilder));
+  features.GetVector().ForEach(FeatureInserter<TKey, TValue, TSorter>(
+      synonyms.get(), sorter, categoriesHolder, header.GetScaleRange(), valueBuilder));
 }
 
 bool GetStreetIndex(search::MwmContext & ctx, uint32_t featureID, string const & streetName,
@@ -526,14 +650,21 @@ void BuildSearchIndex(FilesContainerR & container, Writer & indexWriter)
       trie::GetGeometryCodingParams(features.GetHeader().GetDefGeometryCodingParams());
   SingleValueSerializer<Value> serializer(codingParams);
 
-  vector<pair<Key, Value>> searchIndexKeyValuePairs;
-  AddFeatureNameIndexPairs(features, categoriesHolder, searchIndexKeyValuePairs);
-
-  sort(searchIndexKeyValuePairs.begin(), searchIndexKeyValuePairs.end());
-  LOG(LINFO, ("End sorting strings:", timer.ElapsedSeconds()));
-
-  trie::Build<Writer, Key, ValueList<Value>, SingleValueSerializer<Value>>(
-      indexWriter, serializer, searchIndexKeyValuePairs);
+  // Pairs overflowing the budget are sorted through a temporary file, so
+  // several concurrent search index builds keep a predictable RSS.
+  size_t const kMaxBufferedPairs = 1 << 21;
+  ExternalKeyValueSorter<Key, Value> sorter(
+      container.GetFileName() + "." SEARCH_INDEX_FILE_TAG ".sort" EXTENSION_TMP, kMaxBufferedPairs);
+  AddFeatureNameIndexPairs<Key, Value>(features, categoriesHolder, sorter);
+  LOG(LINFO, ("End reading strings:", timer.ElapsedSeconds()));
+
+  trie::Builder<Writer, Key, ValueList<Value>, SingleValueSerializer<Value>> builder(indexWriter,
+                                                                                     serializer);
+  sorter.ForEachSorted([&builder](Key const & key, Value const & value)
+                       {
+                         builder.Add(key, value);
+                       });
+  builder.Finish();
 
   LOG(LINFO, ("End building search index, elapsed seconds:", timer.ElapsedSeconds()));
 }
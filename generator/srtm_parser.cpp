@@ -5,6 +5,8 @@
 
 #include "base/logging.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <sstream>
 
@@ -99,7 +101,50 @@ feature::TAltitude SrtmTile::GetHeight(ms::LatLon const & coord)
 
   size_t const row = kArcSecondsInDegree * lt;
   size_t const col = kArcSecondsInDegree * ln;
+  return GetHeightRC(row, col);
+}
+
+feature::TAltitude SrtmTile::GetBilinearHeight(ms::LatLon const & coord)
+{
+  if (!IsValid())
+    return feature::kInvalidAltitude;
+
+  double ln = coord.lon - static_cast<int>(coord.lon);
+  if (ln < 0)
+    ln += 1;
+  double lt = coord.lat - static_cast<int>(coord.lat);
+  if (lt < 0)
+    lt += 1;
+  lt = 1 - lt;  // from North to South
+
+  double const row = kArcSecondsInDegree * lt;
+  double const col = kArcSecondsInDegree * ln;
+
+  size_t const row0 = std::min(static_cast<size_t>(row), kArcSecondsInDegree - 1);
+  size_t const col0 = std::min(static_cast<size_t>(col), kArcSecondsInDegree - 1);
+  double const dRow = row - row0;
+  double const dCol = col - col0;
+
+  feature::TAltitude const h00 = GetHeightRC(row0, col0);
+  feature::TAltitude const h01 = GetHeightRC(row0, col0 + 1);
+  feature::TAltitude const h10 = GetHeightRC(row0 + 1, col0);
+  feature::TAltitude const h11 = GetHeightRC(row0 + 1, col0 + 1);
+
+  // A void in any of the four samples would skew the interpolation, fall
+  // back to the nearest sample instead.
+  if (h00 == feature::kInvalidAltitude || h01 == feature::kInvalidAltitude ||
+      h10 == feature::kInvalidAltitude || h11 == feature::kInvalidAltitude)
+  {
+    return GetHeight(coord);
+  }
+
+  double const height = h00 * (1 - dRow) * (1 - dCol) + h01 * (1 - dRow) * dCol +
+                        h10 * dRow * (1 - dCol) + h11 * dRow * dCol;
+  return static_cast<feature::TAltitude>(std::lround(height));
+}
 
+feature::TAltitude SrtmTile::GetHeightRC(size_t row, size_t col) const
+{
   size_t const ix = row * (kArcSecondsInDegree + 1) + col;
 
   if (ix >= Size())
@@ -145,12 +190,42 @@ void SrtmTile::Invalidate()
 
 // SrtmTileManager ---------------------------------------------------------------------------------
 SrtmTileManager::SrtmTileManager(std::string const & dir) : m_dir(dir) {}
+
 feature::TAltitude SrtmTileManager::GetHeight(ms::LatLon const & coord)
 {
-  std::string const base = SrtmTile::GetBase(coord);
-  auto it = m_tiles.find(base);
+  return GetTile(coord).GetHeight(coord);
+}
+
+void SrtmTileManager::GetBilinearHeights(std::vector<ms::LatLon> const & coords,
+                                         feature::TAltitudes & altitudes)
+{
+  altitudes.reserve(altitudes.size() + coords.size());
+  for (auto const & coord : coords)
+    altitudes.push_back(GetTile(coord).GetBilinearHeight(coord));
+}
+
+SrtmTile & SrtmTileManager::GetTile(ms::LatLon const & coord)
+{
+  uint32_t const key = GetKey(coord);
+  if (m_lastTile != nullptr && key == m_lastKey)
+    return *m_lastTile;
+
+  auto it = m_tiles.find(key);
   if (it == m_tiles.end())
   {
+    if (m_tiles.size() >= kMaxCachedTiles)
+    {
+      auto lru = m_tiles.begin();
+      for (auto jt = m_tiles.begin(); jt != m_tiles.end(); ++jt)
+      {
+        if (jt->second.m_lastUsed < lru->second.m_lastUsed)
+          lru = jt;
+      }
+      if (&lru->second.m_tile == m_lastTile)
+        m_lastTile = nullptr;
+      m_tiles.erase(lru);
+    }
+
     SrtmTile tile;
     try
     {
@@ -158,14 +233,27 @@ feature::TAltitude SrtmTileManager::GetHeight(ms::LatLon const & coord)
     }
     catch (RootException const & e)
     {
-      LOG(LINFO, ("Can't init SRTM tile:", base, "reason:", e.Msg()));
+      LOG(LINFO, ("Can't init SRTM tile:", SrtmTile::GetBase(coord), "reason:", e.Msg()));
     }
 
     // It's OK to store even invalid tiles and return invalid height
     // for them later.
-    it = m_tiles.emplace(base, std::move(tile)).first;
+    it = m_tiles.emplace(key, Entry(std::move(tile))).first;
   }
 
-  return it->second.GetHeight(coord);
+  it->second.m_lastUsed = ++m_accessCounter;
+  m_lastKey = key;
+  m_lastTile = &it->second.m_tile;
+  return *m_lastTile;
+}
+
+// static
+uint32_t SrtmTileManager::GetKey(ms::LatLon const & coord)
+{
+  // Mirrors the rounding of SrtmTile::GetBase.
+  int lat = static_cast<int>(coord.lat < 0 ? -(-coord.lat + 1) : coord.lat);
+  int lon = static_cast<int>(coord.lon < 0 ? -(-coord.lon + 1) : coord.lon);
+  ASSERT(lat >= -91 && lat <= 90 && lon >= -181 && lon <= 180, (coord));
+  return static_cast<uint32_t>((lat + 91) * 362 + (lon + 181));
 }
 }  // namespace generator
@@ -9,6 +9,8 @@
 #include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace generator
 {
@@ -23,6 +25,10 @@ public:
   inline bool IsValid() const { return m_valid; }
   // Returns height in meters at |coord| or kInvalidAltitude.
   feature::TAltitude GetHeight(ms::LatLon const & coord);
+  // Returns bilinearly interpolated height in meters at |coord| or
+  // kInvalidAltitude. Falls back to the nearest sample when one of the
+  // four neighbour samples is a void.
+  feature::TAltitude GetBilinearHeight(ms::LatLon const & coord);
 
   static std::string GetBase(ms::LatLon coord);
 
@@ -33,6 +39,7 @@ private:
   };
 
   inline size_t Size() const { return m_data.size() / sizeof(feature::TAltitude); }
+  feature::TAltitude GetHeightRC(size_t row, size_t col) const;
   void Invalidate();
 
   std::string m_data;
@@ -48,9 +55,43 @@ public:
 
   feature::TAltitude GetHeight(ms::LatLon const & coord);
 
+  // Fills |altitudes| with bilinearly interpolated heights for the whole
+  // polyline at once. Consecutive polyline points almost always hit the
+  // same tile, so the per-point tile lookup is reduced to a key
+  // comparison.
+  void GetBilinearHeights(std::vector<ms::LatLon> const & coords,
+                          feature::TAltitudes & altitudes);
+
 private:
+  // Decoded tiles are around 26 MB each; the cap corresponds to about
+  // 1.7 GB of cache, enough to hold every tile of a large mountainous
+  // country without letting concurrent generators grow without bound.
+  static size_t constexpr kMaxCachedTiles = 64;
+
+  struct Entry
+  {
+    explicit Entry(SrtmTile && tile) : m_tile(std::move(tile)) {}
+
+    SrtmTile m_tile;
+    uint64_t m_lastUsed = 0;
+  };
+
+  // Returns the tile covering |coord|, loading it and evicting the least
+  // recently used one if needed. Invalid tiles are cached too and yield
+  // kInvalidAltitude.
+  SrtmTile & GetTile(ms::LatLon const & coord);
+
+  // Cell number of the tile covering |coord|, consistent with
+  // SrtmTile::GetBase.
+  static uint32_t GetKey(ms::LatLon const & coord);
+
   std::string m_dir;
-  std::unordered_map<std::string, SrtmTile> m_tiles;
+  std::unordered_map<uint32_t, Entry> m_tiles;
+  uint64_t m_accessCounter = 0;
+
+  // Fast path for runs of points hitting the same tile.
+  SrtmTile * m_lastTile = nullptr;
+  uint32_t m_lastKey = 0;
 
   DISALLOW_COPY(SrtmTileManager);
 };
@@ -0,0 +1,91 @@
+#include "generator/tesselation_cache.hpp"
+
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
+#include "coding/reader.hpp"
+#include "coding/varint.hpp"
+#include "coding/write_to_sink.hpp"
+
+#include "base/logging.hpp"
+
+#include <utility>
+
+namespace feature
+{
+TesselationCache::TesselationCache(std::string const & filePath) : m_filePath(filePath)
+{
+  try
+  {
+    FileReader reader(m_filePath);
+    ReaderSource<FileReader> src(reader);
+    while (src.Size() > 0)
+    {
+      auto const key = ReadPrimitiveFromSource<uint64_t>(src);
+      auto const size = ReadVarUint<uint32_t>(src);
+      std::vector<char> buffer(size);
+      src.Read(buffer.data(), size);
+      m_entries.emplace(key, std::move(buffer));
+    }
+  }
+  catch (Reader::Exception const &)
+  {
+    // First run or a damaged cache; it will be rewritten by Save().
+    m_entries.clear();
+  }
+}
+
+// static
+uint64_t TesselationCache::Hash(void const * data, size_t size, uint64_t seed)
+{
+  // FNV-1a mixed with the seed.
+  uint64_t hash = 14695981039346656037ULL ^ seed;
+  auto const * p = static_cast<uint8_t const *>(data);
+  for (size_t i = 0; i < size; ++i)
+  {
+    hash ^= p[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+bool TesselationCache::Get(uint64_t key, std::vector<char> & buffer) const
+{
+  auto const it = m_entries.find(key);
+  if (it == m_entries.end())
+  {
+    ++m_misses;
+    return false;
+  }
+
+  ++m_hits;
+  buffer = it->second;
+  return true;
+}
+
+void TesselationCache::Add(uint64_t key, std::vector<char> const & buffer)
+{
+  m_entries.emplace(key, buffer);
+}
+
+void TesselationCache::Save() const
+{
+  try
+  {
+    FileWriter writer(m_filePath);
+    for (auto const & entry : m_entries)
+    {
+      WriteToSink(writer, entry.first);
+      WriteVarUint(writer, static_cast<uint32_t>(entry.second.size()));
+      writer.Write(entry.second.data(), entry.second.size());
+    }
+  }
+  catch (Writer::Exception const & ex)
+  {
+    LOG(LWARNING, ("Cannot save tesselation cache", m_filePath, ":", ex.Msg()));
+    return;
+  }
+
+  LOG(LINFO, ("Tesselation cache", m_filePath, ":", m_entries.size(), "entries,", m_hits,
+              "hits,", m_misses, "misses."));
+}
+}  // namespace feature
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace feature
+{
+// Persistent cache of serialized triangle chains keyed by a hash of the
+// tesselation input. Coastline cells and administrative boundaries barely
+// change between planet builds, so reusing their triangulation skips the
+// most expensive part of the area geometry processing.
+class TesselationCache
+{
+public:
+  // Loads the entries saved by a previous run. A missing or damaged file
+  // is not an error - the cache simply starts empty.
+  explicit TesselationCache(std::string const & filePath);
+
+  // Hashes the tesselation input (polygon points and geometry coding
+  // parameters the result was serialized with).
+  static uint64_t Hash(void const * data, size_t size, uint64_t seed);
+
+  bool Get(uint64_t key, std::vector<char> & buffer) const;
+  void Add(uint64_t key, std::vector<char> const & buffer);
+
+  // Saves the entries for the next run and logs the hit statistics.
+  void Save() const;
+
+  // Tiny polygons are cheaper to tesselate than to store and look up.
+  static size_t constexpr kMinPointsToCache = 64;
+
+private:
+  std::string m_filePath;
+  std::unordered_map<uint64_t, std::vector<char>> m_entries;
+
+  mutable size_t m_hits = 0;
+  mutable size_t m_misses = 0;
+};
+}  // namespace feature
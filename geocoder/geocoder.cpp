@@ -8,6 +8,7 @@
 #include "base/timer.hpp"
 
 #include <algorithm>
+#include <thread>
 #include <utility>
 
 using namespace std;
@@ -148,6 +149,34 @@ void Geocoder::ProcessQuery(string const & query, vector<Result> & results) cons
   ctx.FillResults(results);
 }
 
+void Geocoder::ProcessQueries(vector<string> const & queries, vector<vector<Result>> & results,
+                              size_t numThreads) const
+{
+  results.resize(queries.size());
+
+  numThreads = max(size_t{1}, min(queries.size(), numThreads));
+  if (numThreads == 1)
+  {
+    for (size_t i = 0; i < queries.size(); ++i)
+      ProcessQuery(queries[i], results[i]);
+    return;
+  }
+
+  // Queries are dealt round-robin instead of in contiguous blocks:
+  // inputs are often sorted and the neighbouring queries have similar
+  // costs, so this keeps the shards balanced.
+  vector<thread> threads;
+  for (size_t shard = 0; shard < numThreads; ++shard)
+  {
+    threads.emplace_back([&, shard]() {
+      for (size_t i = shard; i < queries.size(); i += numThreads)
+        ProcessQuery(queries[i], results[i]);
+    });
+  }
+  for (auto & t : threads)
+    t.join();
+}
+
 Hierarchy const & Geocoder::GetHierarchy() const { return m_hierarchy; }
 
 void Geocoder::Go(Context & ctx, Type type) const
@@ -88,6 +88,13 @@ public:
 
   void ProcessQuery(std::string const & query, std::vector<Result> & results) const;
 
+  // Batch entry point for the server-side pipelines: geocodes |queries|
+  // on |numThreads| threads. ProcessQuery does not modify the geocoder,
+  // so the queries are simply sharded between the threads.
+  // |results| has the same size and order as |queries|.
+  void ProcessQueries(std::vector<std::string> const & queries,
+                      std::vector<std::vector<Result>> & results, size_t numThreads) const;
+
   Hierarchy const & GetHierarchy() const;
 
 private:
@@ -16,6 +16,7 @@ using namespace std;
 DEFINE_string(hierarchy_path, "", "Path to the hierarchy file for the geocoder");
 DEFINE_string(queries_path, "", "Path to the file with queries");
 DEFINE_int32(top, 5, "Number of top results to show for every query, -1 to show all results");
+DEFINE_int32(threads, 1, "Number of threads to geocode the queries from the file");
 
 void PrintResults(vector<Result> const & results)
 {
@@ -36,19 +37,25 @@ void ProcessQueriesFromFile(string const & path)
   ifstream stream(path.c_str());
   CHECK(stream.is_open(), ("Can't open", path));
 
-  Geocoder geocoder(FLAGS_hierarchy_path);
-
-  vector<Result> results;
+  vector<string> queries;
   string s;
   while (getline(stream, s))
   {
     strings::Trim(s);
-    if (s.empty())
-      continue;
+    if (!s.empty())
+      queries.emplace_back(move(s));
+  }
 
-    cout << s << endl;
-    geocoder.ProcessQuery(s, results);
-    PrintResults(results);
+  Geocoder geocoder(FLAGS_hierarchy_path);
+
+  CHECK_GREATER(FLAGS_threads, 0, ());
+  vector<vector<Result>> results;
+  geocoder.ProcessQueries(queries, results, static_cast<size_t>(FLAGS_threads));
+
+  for (size_t i = 0; i < queries.size(); ++i)
+  {
+    cout << queries[i] << endl;
+    PrintResults(results[i]);
     cout << endl;
   }
 }
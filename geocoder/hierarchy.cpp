@@ -7,12 +7,54 @@
 #include "base/logging.hpp"
 #include "base/macros.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <utility>
 
 using namespace std;
 
 namespace geocoder
 {
+namespace
+{
+void ParseEntries(vector<string> const & lines, size_t begin, size_t end,
+                  map<Tokens, vector<Hierarchy::Entry>> & entries,
+                  Hierarchy::ParsingStats & stats)
+{
+  for (size_t lineNumber = begin; lineNumber < end; ++lineNumber)
+  {
+    auto const & line = lines[lineNumber];
+    auto const i = line.find(' ');
+    int64_t encodedId;
+    if (i == string::npos || !strings::to_any(line.substr(0, i), encodedId))
+    {
+      LOG(LWARNING, ("Cannot read osm id. Line:", line));
+      ++stats.m_badOsmIds;
+      continue;
+    }
+
+    Hierarchy::Entry entry;
+    // todo(@m) We should really write uints as uints.
+    entry.m_osmId = base::GeoObjectId(static_cast<uint64_t>(encodedId));
+
+    if (!entry.DeserializeFromJSON(line.substr(i + 1), stats))
+      continue;
+
+    // The entry is indexed only by its address.
+    // todo(@m) Index it by name too.
+    if (entry.m_type != Type::Count)
+    {
+      ++stats.m_numLoaded;
+      size_t const t = static_cast<size_t>(entry.m_type);
+      entries[entry.m_address[t]].emplace_back(move(entry));
+    }
+  }
+}
+}  // namespace
+
 // Hierarchy::Entry --------------------------------------------------------------------------------
 bool Hierarchy::Entry::DeserializeFromJSON(string const & jsonStr, ParsingStats & stats)
 {
@@ -88,40 +130,50 @@ void Hierarchy::Entry::DeserializeFromJSONImpl(json_t * const root, string const
 // Hierarchy ---------------------------------------------------------------------------------------
 Hierarchy::Hierarchy(string const & pathToJsonHierarchy)
 {
-  ifstream ifs(pathToJsonHierarchy);
-  string line;
-  ParsingStats stats;
-
-  while (getline(ifs, line))
+  vector<string> lines;
   {
-    if (line.empty())
-      continue;
-
-    auto i = line.find(' ');
-    int64_t encodedId;
-    if (i == string::npos || !strings::to_any(line.substr(0, i), encodedId))
+    ifstream ifs(pathToJsonHierarchy);
+    string line;
+    while (getline(ifs, line))
     {
-      LOG(LWARNING, ("Cannot read osm id. Line:", line));
-      ++stats.m_badOsmIds;
-      continue;
+      if (!line.empty())
+        lines.emplace_back(move(line));
     }
-    line = line.substr(i + 1);
-
-    Entry entry;
-    // todo(@m) We should really write uints as uints.
-    entry.m_osmId = base::GeoObjectId(static_cast<uint64_t>(encodedId));
+  }
 
-    if (!entry.DeserializeFromJSON(line, stats))
-      continue;
+  // Parsing the lines is CPU-bound and dominates the startup time of
+  // a reasonably-sized geocoder, so the lines are sharded between worker
+  // threads. Every thread parses its contiguous block into its own map and
+  // the blocks are merged in their original order, so that entries with
+  // equal addresses keep the order they have in the file.
+  size_t const numShards =
+      max(size_t{1}, min(lines.size(), static_cast<size_t>(thread::hardware_concurrency())));
+  vector<map<Tokens, vector<Entry>>> shardEntries(numShards);
+  vector<ParsingStats> shardStats(numShards);
+  {
+    vector<thread> threads;
+    size_t const blockSize = lines.size() / numShards;
+    for (size_t shard = 0; shard < numShards; ++shard)
+    {
+      size_t const begin = shard * blockSize;
+      size_t const end = shard + 1 == numShards ? lines.size() : begin + blockSize;
+      threads.emplace_back(ParseEntries, cref(lines), begin, end, ref(shardEntries[shard]),
+                           ref(shardStats[shard]));
+    }
+    for (auto & t : threads)
+      t.join();
+  }
 
-    // The entry is indexed only by its address.
-    // todo(@m) Index it by name too.
-    if (entry.m_type != Type::Count)
+  ParsingStats stats;
+  for (size_t shard = 0; shard < numShards; ++shard)
+  {
+    for (auto & kv : shardEntries[shard])
     {
-      ++stats.m_numLoaded;
-      size_t const t = static_cast<size_t>(entry.m_type);
-      m_entries[entry.m_address[t]].emplace_back(entry);
+      auto & entries = m_entries[kv.first];
+      entries.insert(entries.end(), make_move_iterator(kv.second.begin()),
+                     make_move_iterator(kv.second.end()));
     }
+    stats.Add(shardStats[shard]);
   }
 
   LOG(LINFO, ("Finished reading the hierarchy. Stats:"));
@@ -45,6 +45,17 @@ public:
     // specific parts of their addresses.
     // This is expected from POIs but not from regions or streets.
     uint64_t m_mismatchedNames = 0;
+
+    void Add(ParsingStats const & other)
+    {
+      m_numLoaded += other.m_numLoaded;
+      m_badJsons += other.m_badJsons;
+      m_badOsmIds += other.m_badOsmIds;
+      m_duplicateAddresses += other.m_duplicateAddresses;
+      m_emptyAddresses += other.m_emptyAddresses;
+      m_emptyNames += other.m_emptyNames;
+      m_mismatchedNames += other.m_mismatchedNames;
+    }
   };
 
   // A single entry in the hierarchy directed acyclic graph.
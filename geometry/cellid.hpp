@@ -233,12 +233,9 @@ public:
     for (int i = 0; i <= m_level; ++i, bits >>= 2)
       res += bits + 1;
 
-    bits = m_bits;
-    for (int i = m_level + 1; i < depth; ++i)
-    {
-      bits <<= 2;
-      res += bits;
-    }
+    // Closed form of adding m_bits << 2, m_bits << 4, ... for the levels
+    // below m_level: m_bits * (4^1 + ... + 4^(depth - 1 - m_level)).
+    res += m_bits * (TreeSizeForDepth(depth - m_level) - 1);
 
     ASSERT_GREATER(res, 0, (m_bits, m_level));
     ASSERT_LESS_OR_EQUAL(res, TreeSizeForDepth(depth), (m_bits, m_level));
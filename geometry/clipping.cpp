@@ -2,7 +2,10 @@
 
 #include "geometry/rect_intersect.hpp"
 
+#include "base/buffer_vector.hpp"
+
 #include <algorithm>
+#include <array>
 
 using namespace std;
 
@@ -21,7 +24,7 @@ int GetRectSideIndex(int code)
   return 3;
 }
 
-void InsertCorners(vector<m2::PointD> const & corners, m2::PointD const & p1, m2::PointD const & p2,
+void InsertCorners(array<m2::PointD, 4> const & corners, m2::PointD const & p1, m2::PointD const & p2,
                    m2::PointD const & p3, AddPolygonPoint const & addPolygonPoint, int code1,
                    int code2)
 {
@@ -42,7 +45,7 @@ void InsertCorners(vector<m2::PointD> const & corners, m2::PointD const & p1, m2
   }
 }
 
-bool IntersectEdge(m2::RectD const & rect, vector<m2::PointD> const & corners,
+bool IntersectEdge(m2::RectD const & rect, array<m2::PointD, 4> const & corners,
                    m2::PointD const & pp1, m2::PointD const & pp2, m2::PointD const & pp3,
                    AddPolygonPoint const & addPolygonPoint, int prevClipCode, int nextClipCode,
                    int & firstClipCode, int & lastClipCode)
@@ -84,14 +87,17 @@ void ClipTriangleByRect(m2::RectD const & rect, m2::PointD const & p1, m2::Point
   }
 
   const double kEps = 1e-8;
-  vector<m2::PointD> poligon;
+  // A triangle clipped by a rect has a handful of vertices, so the polygon
+  // and the corners live on the stack: this function runs for every area
+  // triangle of every feature in a tile.
+  buffer_vector<m2::PointD, 16> poligon;
   auto const addPolygonPoint = [&poligon, kEps](m2::PointD const & pt) {
     if (poligon.empty() || !poligon.back().EqualDxDy(pt, kEps))
       poligon.push_back(pt);
   };
 
-  vector<m2::PointD> const corners = {rect.LeftTop(), rect.RightTop(), rect.RightBottom(),
-                                      rect.LeftBottom()};
+  array<m2::PointD, 4> const corners = {{rect.LeftTop(), rect.RightTop(), rect.RightBottom(),
+                                         rect.LeftBottom()}};
 
   int firstClipCode[3];
   int lastClipCode[3];
@@ -81,3 +81,26 @@ UNIT_TEST(Mercator_Sample1)
   LOG(LINFO, (MercatorBounds::XToLon(27.531491200000001385),
               MercatorBounds::YToLat(64.392864299248202542)));
 }
+
+UNIT_TEST(Mercator_Batch)
+{
+  std::vector<ms::LatLon> latLons;
+  for (int lat = -85; lat <= 85; lat += 5)
+    for (int lon = -180; lon <= 180; lon += 5)
+      latLons.emplace_back(lat, lon);
+
+  std::vector<m2::PointD> points;
+  MercatorBounds::FromLatLon(latLons, points);
+  TEST_EQUAL(points.size(), latLons.size(), ());
+
+  std::vector<ms::LatLon> latLons2;
+  MercatorBounds::ToLatLon(points, latLons2);
+  TEST_EQUAL(latLons2.size(), latLons.size(), ());
+
+  for (size_t i = 0; i < latLons.size(); ++i)
+  {
+    TEST_EQUAL(points[i], MercatorBounds::FromLatLon(latLons[i]), (i));
+    TEST_ALMOST_EQUAL_ULPS(latLons2[i].lat, latLons[i].lat, (i));
+    TEST_ALMOST_EQUAL_ULPS(latLons2[i].lon, latLons[i].lon, (i));
+  }
+}
@@ -4,6 +4,9 @@
 
 #include "geometry/region2d.hpp"
 
+#include <cmath>
+#include <vector>
+
 namespace
 {
 template <class Region>
@@ -262,3 +265,40 @@ UNIT_TEST(Region_border_intersecion_Test)
   TEST(!region.FindIntersection(P(5.0, 5.0), P(2.0, 2.0), intersection),
        ("This case has no intersection"));
 }
+
+UNIT_TEST(Region_StripIndex)
+{
+  // A star-shaped polygon with enough vertices for the index to kick in.
+  size_t const kVertices = 200;
+  std::vector<m2::PointD> points;
+  points.reserve(kVertices);
+  for (size_t i = 0; i < kVertices; ++i)
+  {
+    double const angle = 2.0 * math::pi * i / kVertices;
+    double const radius = (i & 1) == 0 ? 10.0 : 4.0;
+    points.emplace_back(radius * cos(angle), radius * sin(angle));
+  }
+
+  m2::RegionD const region(points);
+  m2::IndexedRegionD const indexedRegion(points);
+  m2::RegionStripIndex<m2::PointD> const index(region);
+
+  // The index must agree with the plain scan everywhere, including points
+  // on vertices, on edges and outside the bounding rect.
+  for (double x = -11.0; x <= 11.0; x += 0.25)
+  {
+    for (double y = -11.0; y <= 11.0; y += 0.25)
+    {
+      m2::PointD const pt(x, y);
+      bool const expected = region.Contains(pt);
+      TEST_EQUAL(expected, index.Contains(region, pt), (pt));
+      TEST_EQUAL(expected, indexedRegion.Contains(pt), (pt));
+    }
+  }
+
+  for (auto const & pt : points)
+  {
+    TEST(index.Contains(region, pt), (pt));
+    TEST(indexedRegion.Contains(pt), (pt));
+  }
+}
@@ -1,3 +1,4 @@
+#include "testing/benchmark.hpp"
 #include "testing/testing.hpp"
 
 #include "geometry/simplification.hpp"
@@ -14,6 +15,7 @@
 
 #include <cstdint>
 #include <limits>
+#include <thread>
 #include <vector>
 
 using namespace std;
@@ -136,6 +138,52 @@ UNIT_TEST(Simplification_Opt20_Polyline)
                            &SimplifyNearOptimal20);
 }
 
+UNIT_TEST(Simplification_Batch)
+{
+  size_t const kJobsCount = 16;
+  double const epsilon = 0.001;
+
+  auto const simplifyTo = [&](vector<m2::PointD> & result) {
+    SimplifyNearOptimal(20, LargePolylineTestData::m_Data,
+                        LargePolylineTestData::m_Data + LargePolylineTestData::m_Size, epsilon,
+                        DistanceFn(), base::MakeBackInsertFunctor(result));
+  };
+
+  vector<m2::PointD> expected;
+  simplifyTo(expected);
+
+  for (size_t threadsCount = 1; threadsCount <= 4; threadsCount *= 2)
+  {
+    vector<vector<m2::PointD>> results(kJobsCount);
+    SimplifyBatch(kJobsCount, threadsCount, [&](size_t i) { simplifyTo(results[i]); });
+    for (size_t i = 0; i < kJobsCount; ++i)
+      TEST_EQUAL(results[i], expected, (threadsCount, i));
+  }
+}
+
+BENCHMARK_TEST(Simplification_Batch)
+{
+  size_t const kJobsCount = 32;
+  double const epsilon = 0.0001;
+
+  vector<vector<m2::PointD>> results(kJobsCount);
+  auto const job = [&](size_t i) {
+    results[i].clear();
+    SimplifyNearOptimal(20, LargePolylineTestData::m_Data,
+                        LargePolylineTestData::m_Data + LargePolylineTestData::m_Size, epsilon,
+                        DistanceFn(), base::MakeBackInsertFunctor(results[i]));
+  };
+
+  size_t const threadsCounts[] = {1, max(thread::hardware_concurrency(), 1u)};
+  for (size_t const threadsCount : threadsCounts)
+  {
+    base::Timer timer;
+    SimplifyBatch(kJobsCount, threadsCount, job);
+    LOG(LINFO, ("Batch of", kJobsCount, "polylines on", threadsCount, "thread(s):",
+                timer.ElapsedSeconds(), "seconds"));
+  }
+}
+
 UNIT_TEST(Simpfication_DP_DegenerateTrg)
 {
   P arr1[] = {P(0, 0), P(100, 100), P(100, 500), P(0, 600)};
@@ -204,3 +204,40 @@ UNIT_TEST(Length)
   TEST_ALMOST_EQUAL_ULPS(len1, len2, ());
 }
 
+
+UNIT_TEST(GetPointByLength)
+{
+  // GetPoint finds the segment by a binary search in the prefix length
+  // sums; it must land exactly where a step-by-step advance does.
+  vector<PointD> path;
+  for (size_t i = 0; i < 100; ++i)
+    path.push_back(PointD(i * 2.0, (i & 1) == 0 ? 0.0 : 1.0 + i * 0.1));
+
+  Spline spl(path);
+  double const fullLength = spl.GetLength();
+
+  Spline incremental;
+  for (PointD const & pt : path)
+    incremental.AddPoint(pt);
+  TEST_ALMOST_EQUAL_ULPS(incremental.GetLength(), fullLength, ());
+
+  double const kEps = 1e-9;
+  for (double offset = 0.0; offset < fullLength; offset += fullLength / 77.0)
+  {
+    Spline::iterator const jump = spl.GetPoint(offset);
+    TEST_EQUAL(jump.BeginAgain(), false, (offset));
+    TEST(base::AlmostEqualAbs(jump.GetLength(), offset, kEps), (offset));
+
+    Spline::iterator walk;
+    walk.Attach(spl);
+    size_t const kSteps = 100;
+    for (size_t i = 0; i < kSteps; ++i)
+      walk.Advance(offset / kSteps);
+
+    TEST(m2::AlmostEqualAbs(jump.m_pos, walk.m_pos, kEps), (offset));
+    TEST(m2::AlmostEqualAbs(jump.m_dir, walk.m_dir, kEps), (offset));
+    TEST_EQUAL(jump.GetIndex(), walk.GetIndex(), (offset));
+  }
+
+  TEST_EQUAL(spl.GetPoint(fullLength + 1.0).BeginAgain(), true, ());
+}
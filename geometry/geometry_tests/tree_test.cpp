@@ -174,3 +174,46 @@ UNIT_TEST(Tree4D_ReplaceEqual)
   i = find(test.begin(), test.end(), T(1, 1, 2, 2, 2));
   TEST_EQUAL(R(*i), R(0, 0, 3, 3), ());
 }
+
+UNIT_TEST(StaticTree4D_ForEachInRect)
+{
+  // The static tree must return the same objects as the dynamic one for
+  // any query rect.
+  Tree dynTree;
+  m4::StaticTree<R, traits_t> statTree;
+
+  size_t const kCount = 1000;
+  uint32_t seed = 20210505;
+  auto const nextCoord = [&seed]() {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<double>(seed % 1000) / 10.0;
+  };
+
+  for (size_t i = 0; i < kCount; ++i)
+  {
+    double const x = nextCoord(), y = nextCoord();
+    R const r(x, y, x + nextCoord() / 10.0, y + nextCoord() / 10.0);
+    dynTree.Add(r);
+    statTree.Add(r);
+  }
+  statTree.Build();
+  TEST_EQUAL(dynTree.GetSize(), statTree.GetSize(), ());
+
+  for (size_t i = 0; i < 100; ++i)
+  {
+    double const x = nextCoord(), y = nextCoord();
+    R const query(x, y, x + nextCoord(), y + nextCoord());
+
+    vector<R> expected, actual;
+    dynTree.ForEachInRect(query, base::MakeBackInsertFunctor(expected));
+    statTree.ForEachInRect(query, base::MakeBackInsertFunctor(actual));
+
+    auto const byCoords = [](R const & l, R const & r) {
+      return make_tuple(l.minX(), l.minY(), l.maxX(), l.maxY()) <
+             make_tuple(r.minX(), r.minY(), r.maxX(), r.maxY());
+    };
+    sort(expected.begin(), expected.end(), byCoords);
+    sort(actual.begin(), actual.end(), byCoords);
+    TEST_EQUAL(expected, actual, (query));
+  }
+}
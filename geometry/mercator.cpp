@@ -12,6 +12,22 @@ double MercatorBounds::maxX = 180;
 double MercatorBounds::minY = -180;
 double MercatorBounds::maxY = 180;
 
+void MercatorBounds::FromLatLon(vector<ms::LatLon> const & src, vector<m2::PointD> & dst)
+{
+  dst.clear();
+  dst.reserve(src.size());
+  for (auto const & ll : src)
+    dst.push_back(FromLatLon(ll));
+}
+
+void MercatorBounds::ToLatLon(vector<m2::PointD> const & src, vector<ms::LatLon> & dst)
+{
+  dst.clear();
+  dst.reserve(src.size());
+  for (auto const & pt : src)
+    dst.push_back(ToLatLon(pt));
+}
+
 m2::RectD MercatorBounds::MetresToXY(double lon, double lat, double lonMetresR, double latMetresR)
 {
   double const latDegreeOffset = latMetresR * degreeInMetres;
@@ -6,6 +6,8 @@
 
 #include "base/math.hpp"
 
+#include <vector>
+
 struct MercatorBounds
 {
   static double minX;
@@ -88,6 +90,14 @@ struct MercatorBounds
     return {YToLat(point.y), XToLon(point.x)};
   }
 
+  /// @name Batch versions of FromLatLon/ToLatLon. |dst| is overwritten.
+  /// Converting a whole track or dataset in one tight loop keeps the
+  /// trigonometry pipelined instead of paying the call costs per point.
+  //@{
+  static void FromLatLon(std::vector<ms::LatLon> const & src, std::vector<m2::PointD> & dst);
+  static void ToLatLon(std::vector<m2::PointD> const & src, std::vector<ms::LatLon> & dst);
+  //@}
+
   /// Converts lat lon rect to mercator one
   static m2::RectD FromLatLonRect(m2::RectD const & latLonRect)
   {
@@ -187,13 +187,15 @@ public:
                        pt);
   }
 
-  /// Taken from Computational Geometry in C and modified
-  template <typename EqualFn>
-  bool Contains(Point const & pt, EqualFn equalF) const
+  /// Taken from Computational Geometry in C and modified.
+  /// Counts ray crossings over the edges enumerated by |forEachEdge|, which
+  /// must call its argument with the index of every edge
+  /// (m_points[i - 1], m_points[i]) whose y-span may contain pt.y; edge 0
+  /// closes the polygon. Extracted from Contains so that RegionStripIndex
+  /// can run the same logic over the edges of one strip only.
+  template <typename EqualFn, typename ForEachEdge>
+  bool ContainsForEdges(Point const & pt, EqualFn & equalF, ForEachEdge && forEachEdge) const
   {
-    if (!m_rect.IsPointInside(pt))
-      return false;
-
     int rCross = 0; /* number of right edge/ray crossings */
     int lCross = 0; /* number of left edge/ray crossings */
 
@@ -202,12 +204,16 @@ public:
     using BigCoord = typename Traits::BigType;
     using BigPoint = ::m2::Point<BigCoord>;
 
-    BigPoint prev = BigPoint(m_points[numPoints - 1]) - BigPoint(pt);
-    for (size_t i = 0; i < numPoints; ++i)
+    bool onVertex = false;
+    forEachEdge([&](size_t i)
     {
-      if (equalF.EqualPoints(m_points[i], pt))
-        return true;
+      if (onVertex || equalF.EqualPoints(m_points[i], pt))
+      {
+        onVertex = true;
+        return;
+      }
 
+      BigPoint const prev = BigPoint(m_points[i == 0 ? numPoints - 1 : i - 1]) - BigPoint(pt);
       BigPoint const curr = BigPoint(m_points[i]) - BigPoint(pt);
 
       bool const rCheck = ((curr.y > 0) != (prev.y > 0));
@@ -234,9 +240,10 @@ public:
             ++lCross;
         }
       }
+    });
 
-      prev = curr;
-    }
+    if (onVertex)
+      return true;
 
     /* q on the edge if left and right cross are not the same parity. */
     if ((rCross & 1) != (lCross & 1))
@@ -249,6 +256,20 @@ public:
       return false;  // outside
   }
 
+  template <typename EqualFn>
+  bool Contains(Point const & pt, EqualFn equalF) const
+  {
+    if (!m_rect.IsPointInside(pt))
+      return false;
+
+    size_t const numPoints = m_points.size();
+    return ContainsForEdges(pt, equalF, [numPoints](auto && fn)
+    {
+      for (size_t i = 0; i < numPoints; ++i)
+        fn(i);
+    });
+  }
+
   bool Contains(Point const & pt) const { return Contains(pt, typename Traits::EqualType()); }
 
   /// Finds point of intersection with the section.
@@ -322,6 +343,135 @@ private:
   m2::Rect<Coord> m_rect;
 };
 
+// Acceleration structure for Region::Contains. Edges are bucketed into
+// horizontal strips of the region's bounding rect, so a containment query
+// walks only the edges whose y-span overlaps the query point's strip
+// instead of the whole polygon. Built in O(n) once per loaded region; the
+// index stores edge numbers only, so it must be queried with the same
+// region it was built from.
+template <typename Point>
+class RegionStripIndex
+{
+public:
+  RegionStripIndex() = default;
+  explicit RegionStripIndex(Region<Point> const & region) { Build(region); }
+
+  void Build(Region<Point> const & region)
+  {
+    m_strips.clear();
+
+    auto const & points = region.Data();
+    size_t const n = points.size();
+    if (n < kMinPointsCount)
+      return;
+
+    double const minY = static_cast<double>(region.GetRect().minY());
+    double const maxY = static_cast<double>(region.GetRect().maxY());
+    size_t const stripsCount = n / kEdgesPerStrip;
+    double const stripHeight = (maxY - minY) / stripsCount;
+    if (!(stripHeight > 0.0))
+      return;
+
+    m_minY = minY;
+    m_stripHeight = stripHeight;
+    m_strips.resize(stripsCount);
+
+    // For floating point regions the spans are expanded so that a query for
+    // a point lying on a vertex within EqualPoints precision still visits
+    // the vertex's edges.
+    double const eps = std::is_floating_point<typename Point::value_type>::value
+                           ? detail::DefEqualFloat::kPrecision
+                           : 0.0;
+
+    size_t prev = n - 1;
+    for (uint32_t i = 0; i < n; ++i)
+    {
+      double const y1 = static_cast<double>(points[prev].y);
+      double const y2 = static_cast<double>(points[i].y);
+      size_t const last = GetStrip(std::max(y1, y2) + eps);
+      for (size_t s = GetStrip(std::min(y1, y2) - eps); s <= last; ++s)
+        m_strips[s].push_back(i);
+      prev = i;
+    }
+  }
+
+  template <typename EqualFn>
+  bool Contains(Region<Point> const & region, Point const & pt, EqualFn equalF) const
+  {
+    if (!region.GetRect().IsPointInside(pt))
+      return false;
+
+    // Small or degenerate regions are scanned directly.
+    if (m_strips.empty())
+      return region.Contains(pt, equalF);
+
+    auto const & edges = m_strips[GetStrip(static_cast<double>(pt.y))];
+    return region.ContainsForEdges(pt, equalF, [&edges](auto && fn)
+    {
+      for (uint32_t const i : edges)
+        fn(i);
+    });
+  }
+
+  bool Contains(Region<Point> const & region, Point const & pt) const
+  {
+    return Contains(region, pt, typename Region<Point>::Traits::EqualType());
+  }
+
+private:
+  // Average number of edges per strip the index aims at.
+  static size_t constexpr kEdgesPerStrip = 8;
+  // Regions smaller than this do not pay off to index.
+  static size_t constexpr kMinPointsCount = 64;
+
+  size_t GetStrip(double y) const
+  {
+    double const relative = std::max(0.0, (y - m_minY) / m_stripHeight);
+    return std::min(static_cast<size_t>(relative), m_strips.size() - 1);
+  }
+
+  std::vector<std::vector<uint32_t>> m_strips;
+  double m_minY = 0.0;
+  double m_stripHeight = 0.0;
+};
+
+// A region bundled with its strip index: Contains() goes through the
+// index, everything else behaves like a plain Region. The index is built
+// at construction, so the geometry must not be modified afterwards - the
+// mutating methods of the base class are hidden.
+template <typename Point>
+class IndexedRegion : public Region<Point>
+{
+public:
+  IndexedRegion() = default;
+
+  template <typename Points, typename = std::enable_if_t<
+                                 std::is_constructible<typename Region<Point>::Container, Points>::value>>
+  explicit IndexedRegion(Points && points)
+    : Region<Point>(std::forward<Points>(points)), m_index(*this)
+  {
+  }
+
+  template <typename EqualFn>
+  bool Contains(Point const & pt, EqualFn equalF) const
+  {
+    return m_index.Contains(*this, pt, equalF);
+  }
+
+  bool Contains(Point const & pt) const
+  {
+    return Contains(pt, typename Region<Point>::Traits::EqualType());
+  }
+
+private:
+  using Region<Point>::AddPoint;
+  using Region<Point>::Assign;
+  using Region<Point>::AssignEx;
+  using Region<Point>::Swap;
+
+  RegionStripIndex<Point> m_index;
+};
+
 template <typename Point>
 void swap(Region<Point> & r1, Region<Point> & r2)
 {
@@ -365,4 +515,5 @@ bool RegionsContain(std::vector<Region<Point>> const & regions, Point const & po
 using RegionD = Region<m2::PointD>;
 using RegionI = Region<m2::PointI>;
 using RegionU = Region<m2::PointU>;
+using IndexedRegionD = IndexedRegion<m2::PointD>;
 }  // namespace m2
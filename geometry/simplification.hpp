@@ -7,8 +7,10 @@
 #include "base/stl_helpers.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <iterator>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -126,6 +128,38 @@ void SimplifyNearOptimal(int maxFalseLookAhead, Iter beg, Iter end, double epsil
     out(*(beg + i));
 }
 
+// Runs |jobsCount| independent simplification jobs on up to |threadsCount|
+// threads: job(i) is called exactly once for every i in [0, jobsCount), in
+// unspecified order and possibly concurrently. Each job must only touch its
+// own input and output. With threadsCount <= 1 the jobs run in the calling
+// thread, so small batches do not pay for thread creation.
+template <typename Job>
+void SimplifyBatch(size_t jobsCount, size_t threadsCount, Job && job)
+{
+  threadsCount = std::min(threadsCount, jobsCount);
+  if (threadsCount <= 1)
+  {
+    for (size_t i = 0; i < jobsCount; ++i)
+      job(i);
+    return;
+  }
+
+  std::atomic<size_t> nextJob(0);
+  auto const worker = [&nextJob, jobsCount, &job]() {
+    size_t i;
+    while ((i = nextJob.fetch_add(1)) < jobsCount)
+      job(i);
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(threadsCount - 1);
+  for (size_t i = 0; i + 1 < threadsCount; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (auto & thread : threads)
+    thread.join();
+}
+
 // Additional points filter to use in simplification.
 // SimplifyDP can produce points that define degenerate triangle.
 template <typename DistanceFn, typename Point>
@@ -2,7 +2,7 @@
 
 #include "base/logging.hpp"
 
-#include "std/numeric.hpp"
+#include "std/algorithm.hpp"
 
 namespace m2
 {
@@ -14,11 +14,13 @@ Spline::Spline(vector<PointD> const & path)
   size_t cnt = m_position.size() - 1;
   m_direction = vector<PointD>(cnt);
   m_length = vector<double>(cnt);
+  m_lengthSum = vector<double>(cnt + 1, 0.0);
 
   for(size_t i = 0; i < cnt; ++i)
   {
     m_direction[i] = path[i + 1] - path[i];
     m_length[i] = m_direction[i].Length();
+    m_lengthSum[i + 1] = m_lengthSum[i] + m_length[i];
     m_direction[i] = m_direction[i].Normalize();
   }
 }
@@ -29,6 +31,7 @@ Spline::Spline(size_t reservedSize)
   m_position.reserve(reservedSize);
   m_direction.reserve(reservedSize - 1);
   m_length.reserve(reservedSize - 1);
+  m_lengthSum.reserve(reservedSize);
 }
 
 void Spline::AddPoint(PointD const & pt)
@@ -40,12 +43,16 @@ void Spline::AddPoint(PointD const & pt)
     return;
 
   if(IsEmpty())
+  {
     m_position.push_back(pt);
+    m_lengthSum.push_back(0.0);
+  }
   else
   {
     PointD dir = pt - m_position.back();
     m_position.push_back(pt);
     m_length.push_back(dir.Length());
+    m_lengthSum.push_back(m_lengthSum.back() + m_length.back());
     m_direction.push_back(dir.Normalize());
   }
 }
@@ -57,6 +64,7 @@ void Spline::ReplacePoint(PointD const & pt)
   ASSERT(!m_direction.empty(), ());
   m_position.pop_back();
   m_length.pop_back();
+  m_lengthSum.pop_back();
   m_direction.pop_back();
   AddPoint(pt);
 }
@@ -107,13 +115,14 @@ Spline const & Spline::operator = (Spline const & spl)
     m_position = spl.m_position;
     m_direction = spl.m_direction;
     m_length = spl.m_length;
+    m_lengthSum = spl.m_lengthSum;
   }
   return *this;
 }
 
 double Spline::GetLength() const
 {
-  return accumulate(m_length.begin(), m_length.end(), 0.0);
+  return m_lengthSum.empty() ? 0.0 : m_lengthSum.back();
 }
 
 void Spline::Clear()
@@ -121,6 +130,7 @@ void Spline::Clear()
   m_position.clear();
   m_direction.clear();
   m_length.clear();
+  m_lengthSum.clear();
 }
 
 Spline::iterator::iterator()
@@ -183,7 +193,7 @@ void Spline::iterator::Advance(double step)
 
 double Spline::iterator::GetLength() const
 {
-  return accumulate(m_spl->m_length.begin(), m_spl->m_length.begin() + m_index, m_dist);
+  return m_spl->m_lengthSum[m_index] + m_dist;
 }
 
 double Spline::iterator::GetFullLength() const
@@ -239,17 +249,22 @@ void Spline::iterator::AdvanceForward(double step)
     m_pos = m_spl->m_position[m_index] + m_dir * m_dist;
     return;
   }
-  while (m_dist > m_spl->m_length[m_index])
+  if (m_dist > m_spl->m_length[m_index])
   {
-    m_dist -= m_spl->m_length[m_index];
-    m_index++;
-    if (m_index >= m_spl->m_direction.size())
+    // Find the segment the offset falls into by a binary search in the
+    // prefix length sums instead of walking the segments one by one.
+    vector<double> const & sums = m_spl->m_lengthSum;
+    double const offset = sums[m_index] + m_dist;
+    if (offset > sums.back())
     {
-      m_index--;
-      m_dist += m_spl->m_length[m_index];
+      m_index = m_spl->m_direction.size() - 1;
       m_checker = true;
-      break;
     }
+    else
+    {
+      m_index = lower_bound(sums.begin() + m_index, sums.end(), offset) - sums.begin() - 1;
+    }
+    m_dist = offset - sums[m_index];
   }
   m_dir = m_spl->m_direction[m_index];
   m_avrDir = -m_pos;
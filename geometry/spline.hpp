@@ -85,6 +85,10 @@ private:
   vector<PointD> m_position;
   vector<PointD> m_direction;
   vector<double> m_length;
+  // m_lengthSum[i] is the path length up to the point i, so
+  // m_lengthSum.back() is the full length. Allows to find a segment by a
+  // length offset with a binary search instead of a linear walk.
+  vector<double> m_lengthSum;
 };
 
 class SharedSpline
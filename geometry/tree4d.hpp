@@ -3,9 +3,12 @@
 #include "geometry/point2d.hpp"
 #include "geometry/rect2d.hpp"
 
+#include "base/assert.hpp"
 #include "base/logging.hpp"
 #include "base/stl_helpers.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -21,54 +24,60 @@ struct TraitsDef
   m2::RectD const LimitRect(T const & t) const { return t.GetLimitRect(); }
 };
 
-template <typename T, typename Traits = TraitsDef<T>>
-class Tree
+namespace detail
+{
+template <typename T>
+class Value
 {
-  class Value
+public:
+  using value_type = double;
+
+  template <typename U>
+  Value(U && u, m2::RectD const & r) : m_val(std::forward<U>(u))
   {
-  public:
-    using value_type = double;
+    SetRect(r);
+  }
 
-    template <typename U>
-    Value(U && u, m2::RectD const & r) : m_val(std::forward<U>(u))
-    {
-      SetRect(r);
-    }
+  bool IsIntersect(m2::RectD const & r) const
+  {
+    return !((m_pts[2] <= r.minX()) || (m_pts[0] >= r.maxX()) || (m_pts[3] <= r.minY()) ||
+             (m_pts[1] >= r.maxY()));
+  }
 
-    bool IsIntersect(m2::RectD const & r) const
-    {
-      return !((m_pts[2] <= r.minX()) || (m_pts[0] >= r.maxX()) || (m_pts[3] <= r.minY()) ||
-               (m_pts[1] >= r.maxY()));
-    }
+  bool operator==(Value const & r) const { return (m_val == r.m_val); }
 
-    bool operator==(Value const & r) const { return (m_val == r.m_val); }
+  std::string DebugPrint() const
+  {
+    std::ostringstream out;
 
-    std::string DebugPrint() const
-    {
-      std::ostringstream out;
+    out << DebugPrint(m_val) << ", (" << m_pts[0] << ", " << m_pts[1] << ", " << m_pts[2] << ", "
+        << m_pts[3] << ")";
 
-      out << DebugPrint(m_val) << ", (" << m_pts[0] << ", " << m_pts[1] << ", " << m_pts[2] << ", "
-          << m_pts[3] << ")";
+    return out.str();
+  }
 
-      return out.str();
-    }
+  double operator[](size_t i) const { return m_pts[i]; }
 
-    double operator[](size_t i) const { return m_pts[i]; }
+  m2::RectD GetRect() const { return m2::RectD(m_pts[0], m_pts[1], m_pts[2], m_pts[3]); }
 
-    m2::RectD GetRect() const { return m2::RectD(m_pts[0], m_pts[1], m_pts[2], m_pts[3]); }
+  T m_val;
+  double m_pts[4];
 
-    T m_val;
-    double m_pts[4];
+private:
+  void SetRect(m2::RectD const & r)
+  {
+    m_pts[0] = r.minX();
+    m_pts[1] = r.minY();
+    m_pts[2] = r.maxX();
+    m_pts[3] = r.maxY();
+  }
+};
+}  // namespace detail
 
-  private:
-    void SetRect(m2::RectD const & r)
-    {
-      m_pts[0] = r.minX();
-      m_pts[1] = r.minY();
-      m_pts[2] = r.maxX();
-      m_pts[3] = r.maxY();
-    }
-  };
+template <typename T, typename Traits = TraitsDef<T>>
+class Tree
+{
+  using Value = detail::Value<T>;
 
   KDTree::KDTree<4, Value> m_tree;
 
@@ -255,4 +264,165 @@ std::string DebugPrint(Tree<T, Traits> const & t)
 {
   return t.DebugPrint();
 }
+
+// Read-mostly counterpart of Tree. The nodes are bulk-loaded into a flat
+// array forming an implicit (pointer-free) kd-tree in heap order, so range
+// queries walk a contiguous buffer instead of chasing nodes allocated one
+// by one. Usage: Add all objects, call Build once, then query; Add
+// invalidates the tree until the next Build.
+template <typename T, typename Traits = TraitsDef<T>>
+class StaticTree
+{
+  using Value = detail::Value<T>;
+
+public:
+  using elem_t = T;
+
+  StaticTree(Traits const & traits = Traits()) : m_traits(traits) {}
+
+  template <typename U>
+  void Add(U && obj)
+  {
+    Add(std::forward<U>(obj), m_traits.LimitRect(obj));
+  }
+
+  template <typename U>
+  void Add(U && obj, m2::RectD const & rect)
+  {
+    m_values.emplace_back(std::forward<U>(obj), rect);
+    m_dirty = true;
+  }
+
+  // Packs the added objects into the implicit layout, O(n log n).
+  void Build()
+  {
+    m_dirty = false;
+
+    size_t const n = m_values.size();
+    if (n < 2)
+      return;
+
+    std::vector<uint32_t> order(n);
+    for (uint32_t i = 0; i < n; ++i)
+      order[i] = i;
+
+    std::vector<uint32_t> layout(n);
+    Arrange(order, 0 /* beg */, n /* end */, 0 /* node */, 0 /* depth */, layout);
+
+    std::vector<Value> values;
+    values.reserve(n);
+    for (uint32_t const i : layout)
+      values.push_back(std::move(m_values[i]));
+    m_values.swap(values);
+  }
+
+  template <typename ToDo>
+  void ForEach(ToDo && toDo) const
+  {
+    for (Value const & v : m_values)
+      toDo(v.m_val);
+  }
+
+  template <typename ToDo>
+  void ForEachInRect(m2::RectD const & rect, ToDo && toDo) const
+  {
+    ForEachInRectImpl(rect, [&toDo](Value const & v) { toDo(v.m_val); });
+  }
+
+  template <typename ToDo>
+  void ForEachInRectEx(m2::RectD const & rect, ToDo && toDo) const
+  {
+    ForEachInRectImpl(rect, [&toDo](Value const & v) { toDo(v.GetRect(), v.m_val); });
+  }
+
+  bool IsEmpty() const { return m_values.empty(); }
+
+  size_t GetSize() const { return m_values.size(); }
+
+  void Clear()
+  {
+    m_values.clear();
+    m_dirty = false;
+  }
+
+private:
+  // Number of nodes in the left subtree of a complete binary tree with
+  // |n| nodes: all levels full except maybe the last one, filled from the
+  // left. This shape maps the nodes exactly onto array slots [0, n).
+  static size_t LeftSubtreeSize(size_t n)
+  {
+    ASSERT_GREATER(n, 1, ());
+
+    size_t m = 1;
+    while (m * 2 <= n)
+      m *= 2;
+    return (m / 2 - 1) + std::min(m / 2, n - m + 1);
+  }
+
+  void Arrange(std::vector<uint32_t> & order, size_t beg, size_t end, size_t node, size_t depth,
+               std::vector<uint32_t> & layout)
+  {
+    size_t const n = end - beg;
+    if (n == 0)
+      return;
+    if (n == 1)
+    {
+      layout[node] = order[beg];
+      return;
+    }
+
+    size_t const mid = beg + LeftSubtreeSize(n);
+    size_t const plane = depth & 3;
+    std::nth_element(order.begin() + beg, order.begin() + mid, order.begin() + end,
+                     [this, plane](uint32_t l, uint32_t r)
+                     {
+                       return m_values[l][plane] < m_values[r][plane];
+                     });
+
+    layout[node] = order[mid];
+    Arrange(order, beg, mid, 2 * node + 1, depth + 1, layout);
+    Arrange(order, mid + 1, end, 2 * node + 2, depth + 1, layout);
+  }
+
+  // The same plane-based pruning as Tree's for_each_helper: a subtree is
+  // skipped only when every rect in it lies fully to one side of the
+  // query rect along the node's split plane.
+  template <typename ToDo>
+  void ForEachInRectImpl(m2::RectD const & rect, ToDo && toDo) const
+  {
+    ASSERT(!m_dirty, ("Build() should be called after Add()"));
+    if (!m_values.empty())
+      ForEachInNode(0 /* node */, 0 /* depth */, rect, toDo);
+  }
+
+  template <typename ToDo>
+  void ForEachInNode(size_t node, size_t depth, m2::RectD const & rect, ToDo && toDo) const
+  {
+    Value const & v = m_values[node];
+    size_t const plane = depth & 3;
+
+    size_t const left = 2 * node + 1;
+    // Left subtree values are not greater along the split plane; for the
+    // max-coordinate planes that bounds their rects away from the query.
+    if (left < m_values.size() &&
+        (plane == 0 || plane == 1 || (plane == 2 ? rect.minX() < v[2] : rect.minY() < v[3])))
+    {
+      ForEachInNode(left, depth + 1, rect, toDo);
+    }
+
+    if (v.IsIntersect(rect))
+      toDo(v);
+
+    size_t const right = 2 * node + 2;
+    if (right < m_values.size() &&
+        (plane == 2 || plane == 3 || (plane == 0 ? rect.maxX() > v[0] : rect.maxY() > v[1])))
+    {
+      ForEachInNode(right, depth + 1, rect, toDo);
+    }
+  }
+
+  Traits m_traits;
+  std::vector<Value> m_values;
+  bool m_dirty = false;
+};
 }  // namespace m4
@@ -19,6 +19,12 @@ using namespace std;
 
 namespace
 {
+// Decoded altitudes are kept for the lifetime of the loader, so features
+// whose road geometry is evicted and reloaded during routing do not pay
+// for the bit-by-bit delta decoding again. An average feature holds a
+// dozen of int16 altitudes, so the bound amounts to ~100KB per mwm.
+size_t const kMaxCachedFeatures = 4096;
+
 template <class TCont>
 void LoadAndMap(size_t dataSize, ReaderSource<FilesContainerR::TReader> & src, TCont & cont,
                 unique_ptr<CopiedMemoryRegion> & region)
@@ -73,6 +79,9 @@ bool AltitudeLoader::HasAltitudes() const
 
 TAltitudes const & AltitudeLoader::GetAltitudes(uint32_t featureId, size_t pointCount)
 {
+  if (m_cache.size() >= kMaxCachedFeatures && m_cache.count(featureId) == 0)
+    m_cache.clear();
+
   if (!HasAltitudes())
   {
     // The version of mwm is less than version::Format::v8 or there's no altitude section in mwm.
@@ -207,6 +207,10 @@ void CategoriesHolder::AddCategory(Category & cat, vector<uint32_t> & types)
     for (uint32_t const t : types)
       m_type2cat.insert(make_pair(t, p));
 
+    // Tokens and keys are reused between synonyms to avoid
+    // reallocations: this loop dominates categories load time on
+    // application start.
+    vector<String> tokens;
     for (auto const & synonym : p->m_synonyms)
     {
       auto const locale = synonym.m_locale;
@@ -216,15 +220,16 @@ void CategoriesHolder::AddCategory(Category & cat, vector<uint32_t> & types)
 
       auto const uniName = search::NormalizeAndSimplifyString(synonym.m_name);
 
-      vector<String> tokens;
+      tokens.clear();
       SplitUniString(uniName, base::MakeBackInsertFunctor(tokens), search::Delimiters());
 
       for (auto const & token : tokens)
       {
         if (!ValidKeyToken(token))
           continue;
+        auto const key = localePrefix + token;
         for (uint32_t const t : types)
-          m_name2type.Add(localePrefix + token, t);
+          m_name2type.Add(key, t);
       }
     }
   }
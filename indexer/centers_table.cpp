@@ -17,6 +17,7 @@
 #include "base/checked_cast.hpp"
 #include "base/logging.hpp"
 
+#include <limits>
 #include <unordered_map>
 
 #include "3party/succinct/elias_fano.hpp"
@@ -140,6 +141,12 @@ public:
   {
   }
 
+  // Keeps the cache of decoded blocks below ~32KB per mwm: pre-ranker
+  // candidates are localized, so a small number of blocks serves almost
+  // all lookups of one query, while an unbounded cache slowly grows to
+  // the size of the whole decoded table on long sessions.
+  static const uint32_t kMaxCachedBlocks = 64;
+
   // CentersTable overrides:
   bool Get(uint32_t id, m2::PointD & center) override
   {
@@ -149,34 +156,51 @@ public:
     uint32_t const base = rank / kBlockSize;
     uint32_t const offset = rank % kBlockSize;
 
-    auto & entry = m_cache[base];
-    if (entry.empty())
+    // The pre-ranker requests centers in ascending feature id order,
+    // so consecutive lookups mostly hit the same block; short-circuit
+    // them past the cache map lookup.
+    if (base != m_lastBase)
     {
-      entry.resize(kBlockSize);
+      auto it = m_cache.find(base);
+      if (it == m_cache.end())
+      {
+        if (m_cache.size() >= kMaxCachedBlocks)
+        {
+          m_cache.clear();
+          m_lastBase = kInvalidBase;
+        }
 
-      auto const start = m_offsets.select(base);
-      auto const end = base + 1 < m_offsets.num_ones()
-                           ? m_offsets.select(base + 1)
-                           : m_header.m_endOffset - m_header.m_deltasOffset;
+        it = m_cache.emplace(base, vector<m2::PointU>()).first;
+        auto & entry = it->second;
+        entry.resize(kBlockSize);
 
-      vector<uint8_t> data(end - start);
+        auto const start = m_offsets.select(base);
+        auto const end = base + 1 < m_offsets.num_ones()
+                             ? m_offsets.select(base + 1)
+                             : m_header.m_endOffset - m_header.m_deltasOffset;
 
-      m_reader.Read(m_header.m_deltasOffset + start, data.data(), data.size());
+        m_readBuffer.resize(end - start);
 
-      MemReader mreader(data.data(), data.size());
-      NonOwningReaderSource msource(mreader);
+        m_reader.Read(m_header.m_deltasOffset + start, m_readBuffer.data(), m_readBuffer.size());
 
-      uint64_t delta = ReadVarUint<uint64_t>(msource);
-      entry[0] = coding::DecodePointDeltaFromUint(delta, m_codingParams.GetBasePoint());
+        MemReader mreader(m_readBuffer.data(), m_readBuffer.size());
+        NonOwningReaderSource msource(mreader);
 
-      for (size_t i = 1; i < kBlockSize && msource.Size() > 0; ++i)
-      {
-        delta = ReadVarUint<uint64_t>(msource);
-        entry[i] = coding::DecodePointDeltaFromUint(delta, entry[i - 1]);
+        uint64_t delta = ReadVarUint<uint64_t>(msource);
+        entry[0] = coding::DecodePointDeltaFromUint(delta, m_codingParams.GetBasePoint());
+
+        for (size_t i = 1; i < kBlockSize && msource.Size() > 0; ++i)
+        {
+          delta = ReadVarUint<uint64_t>(msource);
+          entry[i] = coding::DecodePointDeltaFromUint(delta, entry[i - 1]);
+        }
       }
+
+      m_lastBase = base;
+      m_lastBlock = &it->second;
     }
 
-    center = PointUToPointD(entry[offset], m_codingParams.GetCoordBits());
+    center = PointUToPointD((*m_lastBlock)[offset], m_codingParams.GetCoordBits());
     return true;
   }
 
@@ -223,7 +247,16 @@ private:
   succinct::rs_bit_vector m_ids;
   succinct::elias_fano m_offsets;
 
+  static const uint32_t kInvalidBase = numeric_limits<uint32_t>::max();
+
   unordered_map<uint32_t, vector<m2::PointU>> m_cache;
+  // Last accessed block, see Get(). The pointer stays valid across
+  // insertions since unordered_map never moves its nodes.
+  uint32_t m_lastBase = kInvalidBase;
+  vector<m2::PointU> const * m_lastBlock = nullptr;
+  // Scratch buffer for the encoded deltas of one block, reused between
+  // cache misses to avoid a heap allocation per block read.
+  vector<uint8_t> m_readBuffer;
 };
 }  // namespace
 
@@ -1,5 +1,6 @@
 #include "indexer/classificator.hpp"
 #include "indexer/map_style_reader.hpp"
+#include "indexer/scales.hpp"
 #include "indexer/tree_structure.hpp"
 
 #include "base/logging.hpp"
@@ -433,6 +434,86 @@ void Classificator::Clear()
 {
   ClassifObject("world").Swap(m_root);
   m_mapping.Clear();
+  m_drulesTableOffsets.clear();
+  m_drulesTableKeys.clear();
+  m_drulesVisibilityMasks.clear();
+}
+
+namespace
+{
+int constexpr kTableScalesCount = scales::UPPER_STYLE_SCALE + 1;
+int constexpr kTableGeomTypesCount = 3;
+
+static_assert(kTableScalesCount <= 32, "Scales should fit into a 32 bit visibility mask.");
+}  // namespace
+
+void Classificator::BuildDrawRulesTable()
+{
+  m_drulesTableOffsets.clear();
+  m_drulesTableKeys.clear();
+  m_drulesVisibilityMasks.clear();
+
+  if (!m_mapping.IsLoaded())
+    return;
+
+  uint32_t const typesCount = m_mapping.GetTypesCount();
+  m_drulesTableOffsets.reserve(typesCount * kTableScalesCount * kTableGeomTypesCount + 1);
+  m_drulesTableOffsets.push_back(0);
+  m_drulesVisibilityMasks.reserve(typesCount);
+
+  drule::KeysT keys;
+  for (uint32_t index = 0; index < typesCount; ++index)
+  {
+    ClassifObject const * p = GetObject(m_mapping.GetType(index));
+
+    uint32_t mask = 0;
+    for (int scale = 0; scale < kTableScalesCount; ++scale)
+    {
+      if (p->IsDrawable(scale))
+        mask |= 1 << scale;
+
+      for (int ft = 0; ft < kTableGeomTypesCount; ++ft)
+      {
+        keys.clear();
+        p->GetSuitable(scale, static_cast<feature::EGeomType>(ft), keys);
+        m_drulesTableKeys.insert(m_drulesTableKeys.end(), keys.begin(), keys.end());
+        m_drulesTableOffsets.push_back(static_cast<uint32_t>(m_drulesTableKeys.size()));
+      }
+    }
+    m_drulesVisibilityMasks.push_back(mask);
+  }
+}
+
+void Classificator::GetSuitableRules(uint32_t type, int scale, feature::EGeomType ft,
+                                     drule::KeysT & keys) const
+{
+  ASSERT(ft >= 0 && ft < kTableGeomTypesCount, ());
+
+  scale = min(scale, scales::GetUpperStyleScale());
+
+  if (m_drulesTableOffsets.empty() || !m_mapping.HasIndex(type))
+  {
+    // The table is not built yet or the type is not present in the
+    // mapping (e.g. a type used by the generator only).
+    GetObject(type)->GetSuitable(scale, ft, keys);
+    return;
+  }
+
+  size_t const cell =
+      (m_mapping.GetIndex(type) * kTableScalesCount + scale) * kTableGeomTypesCount + ft;
+  ASSERT_LESS(cell + 1, m_drulesTableOffsets.size(), ());
+  for (uint32_t i = m_drulesTableOffsets[cell]; i < m_drulesTableOffsets[cell + 1]; ++i)
+    keys.push_back(m_drulesTableKeys[i]);
+}
+
+bool Classificator::IsTypeDrawableForLevel(uint32_t type, int level) const
+{
+  ASSERT(level >= 0 && level < kTableScalesCount, (level));
+
+  if (m_drulesVisibilityMasks.empty() || !m_mapping.HasIndex(type))
+    return GetObject(type)->IsDrawable(level);
+
+  return (m_drulesVisibilityMasks[m_mapping.GetIndex(type)] >> level) & 1;
 }
 
 string Classificator::GetReadableObjectName(uint32_t type) const
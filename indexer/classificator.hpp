@@ -164,6 +164,17 @@ class Classificator
 
   uint32_t m_coastType;
 
+  /// Flat (type index, scale, geometry type) -> drawing rule keys
+  /// table, see BuildDrawRulesTable(). Keys of a single cell are
+  /// stored contiguously in m_drulesTableKeys, m_drulesTableOffsets
+  /// holds per-cell [begin, end) offsets into it.
+  std::vector<uint32_t> m_drulesTableOffsets;
+  std::vector<drule::Key> m_drulesTableKeys;
+
+  /// Per type index bit masks of scales the type is drawable at, see
+  /// IsTypeDrawableForLevel().
+  std::vector<uint32_t> m_drulesVisibilityMasks;
+
   static ClassifObject * AddV(ClassifObject * parent, std::string const & key, std::string const & value);
 
 public:
@@ -199,6 +210,27 @@ public:
   uint32_t GetTypeByReadableObjectName(std::string const & name) const;
   //@}
 
+  /// @name Flat (type, scale, geometry type) -> drawing rule keys table.
+  //@{
+  /// Builds the table from the classificator tree. Should be called
+  /// after drawing rules are loaded (rules fill the tree), see
+  /// drule::LoadRules(). The table is immutable afterwards, so it can
+  /// be read from multiple threads without synchronization.
+  void BuildDrawRulesTable();
+
+  /// Appends to |keys| drawing rule keys for |type| suitable for
+  /// |scale| and |ft|. Works via the precomputed table when it is
+  /// built and falls back to the classificator tree walk otherwise.
+  void GetSuitableRules(uint32_t type, int scale, feature::EGeomType ft,
+                        drule::KeysT & keys) const;
+
+  /// Returns true if |type| has at least one drawing rule at |level|.
+  /// Works via the precomputed visibility masks when the table is
+  /// built and falls back to the classificator tree walk otherwise.
+  bool IsTypeDrawableForLevel(uint32_t type, int level) const;
+  //@}
+
+  uint32_t GetTypesCount() const { return m_mapping.GetTypesCount(); }
   uint32_t GetIndexForType(uint32_t t) const { return m_mapping.GetIndex(t); }
   // Throws std::out_of_range exception.
   uint32_t GetTypeForIndex(uint32_t i) const { return m_mapping.GetType(i); }
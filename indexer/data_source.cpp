@@ -45,15 +45,12 @@ public:
       covering::Intervals const & intervals = cov.Get<RectId::DEPTH_LEVELS>(lastScale);
       ScaleIndex<ModelReaderPtr> index(mwmValue->m_cont.GetReader(INDEX_FILE_TAG), mwmValue->m_factory);
 
-      // iterate through intervals
-      for (auto const & i : intervals)
-      {
-        index.ForEachInIntervalAndScale(i.first, i.second, scale, [&](uint32_t index) {
-          if (!checkUnique(index))
-            return;
-          m_fn(index, *src);
-        });
-      }
+      // Process all the intervals in one batched pass over the index tree.
+      index.ForEachInIntervalsAndScale(intervals, scale, [&](uint32_t index) {
+        if (!checkUnique(index))
+          return;
+        m_fn(index, *src);
+      });
     }
     // Check created features container.
     // Need to do it on a per-mwm basis, because Drape relies on features in a sorted order.
@@ -186,6 +183,12 @@ pair<MwmSet::MwmId, MwmSet::RegResult> DataSource::RegisterMap(LocalCountryFile
   return Register(localFile);
 }
 
+vector<pair<MwmSet::MwmId, MwmSet::RegResult>> DataSource::RegisterMaps(
+    vector<LocalCountryFile> const & files)
+{
+  return Register(files);
+}
+
 bool DataSource::DeregisterMap(CountryFile const & countryFile) { return Deregister(countryFile); }
 
 void DataSource::ForEachInIntervals(ReaderCallback const & fn, covering::CoveringMode mode,
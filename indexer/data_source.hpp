@@ -33,6 +33,11 @@ public:
   /// Registers a new map.
   std::pair<MwmId, RegResult> RegisterMap(platform::LocalCountryFile const & localFile);
 
+  /// Registers a batch of new maps, reading their headers in parallel.
+  /// See MwmSet::Register() for details.
+  std::vector<std::pair<MwmId, RegResult>> RegisterMaps(
+      std::vector<platform::LocalCountryFile> const & files);
+
   /// Deregisters a map from internal records.
   ///
   /// \param countryFile A countryFile denoting a map to be deregistered.
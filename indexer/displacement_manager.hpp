@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <utility>
 #include <vector>
 
 namespace
@@ -110,20 +111,39 @@ public:
         acceptedNodes.Add(node);
         continue;
       }
-      for (; scale < scales::GetUpperScale(); ++scale)
+      // The displacement radius only shrinks as the scale grows, so a single
+      // tree query at the start scale covers all the subsequent scales.
+      std::vector<std::pair<m2::PointD, int>> displacers;
       {
         float const delta = CalculateDeltaForZoom(scale);
-        float const squaredDelta = delta * delta;
-
         m2::RectD const displacementRect(node.m_center, node.m_center);
-        bool isDisplaced = false;
         acceptedNodes.ForEachInRect(
             m2::Inflate(displacementRect, {delta, delta}),
-            [&isDisplaced, &node, &squaredDelta, &scale](DisplaceableNode const & rhs) {
-              if (node.m_center.SquaredLength(rhs.m_center) < squaredDelta &&
-                  rhs.m_maxScale > scale)
-                isDisplaced = true;
+            [&displacers, scale](DisplaceableNode const & rhs) {
+              if (rhs.m_maxScale > scale)
+                displacers.emplace_back(rhs.m_center, rhs.m_maxScale);
             });
+      }
+      for (; scale < scales::GetUpperScale(); ++scale)
+      {
+        float const delta = CalculateDeltaForZoom(scale);
+        float const squaredDelta = delta * delta;
+
+        bool isDisplaced = false;
+        for (size_t i = 0; i < displacers.size();)
+        {
+          // A displacer is dropped for good once the node leaves its shrinking
+          // displacement radius or the displacer is not drawn at this scale.
+          if (node.m_center.SquaredLength(displacers[i].first) >= squaredDelta ||
+              displacers[i].second <= scale)
+          {
+            std::swap(displacers[i], displacers.back());
+            displacers.pop_back();
+            continue;
+          }
+          isDisplaced = true;
+          break;
+        }
         if (isDisplaced)
           continue;
 
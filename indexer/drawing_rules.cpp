@@ -536,6 +536,10 @@ void LoadRules()
   string buffer;
   GetStyleReader().GetDrawingRulesReader().ReadAsString(buffer);
   rules().LoadFromBinaryProto(buffer);
+
+  // Rules are bound to the classificator tree now, precompute the
+  // flat rules table to keep per-feature rule resolution cheap.
+  classif().BuildDrawRulesTable();
 }
 
 } // namespace drule
@@ -236,6 +236,14 @@ private:
     }
   };
 
+  // *NOTE* Parsing is staged and lazy: each stage decodes only up to
+  // the fields it answers for, and the stages after it stay untouched
+  // until somebody asks for them. Within a stage the fields cannot be
+  // skipped selectively (e.g. the name when only the center is needed):
+  // the serialized form is a sequence of varints and strings with no
+  // per-field offsets, so reaching a later field requires decoding the
+  // earlier ones anyway. Finer granularity would need per-field offsets
+  // written at generation time, i.e. a data format change.
   void ParseTypes();
   void ParseCommon();
   void ParseHeader2();
@@ -11,6 +11,7 @@
 #include "coding/transliteration.hpp"
 
 #include "base/base.hpp"
+#include "base/buffer_vector.hpp"
 #include "base/control_flow.hpp"
 
 #include <unordered_map>
@@ -33,36 +34,64 @@ unordered_map<int8_t, vector<int8_t>> const kSimilarToDeviceLanguages =
   {GetIndex("be"), {GetIndex("ru")}}
 };
 
-void GetMwmLangName(feature::RegionData const & regionData, StringUtf8Multilang const & src, string & out)
+// All names of a feature, collected in a single pass over the
+// serialized multilang blob. Name resolution probes several languages
+// in priority order; resolving the probes against this snapshot
+// avoids rescanning the blob per language.
+using NamesList = buffer_vector<pair<int8_t, string>, 8>;
+
+void CollectNames(StringUtf8Multilang const & src, NamesList & names)
+{
+  src.ForEach([&names](int8_t code, string const & name)
+              {
+                names.emplace_back(code, name);
+                return base::ControlFlow::Continue;
+              });
+}
+
+bool GetName(NamesList const & names, int8_t code, string & out)
+{
+  for (auto const & name : names)
+  {
+    if (name.first == code)
+    {
+      out = name.second;
+      return true;
+    }
+  }
+  return false;
+}
+
+void GetMwmLangName(feature::RegionData const & regionData, NamesList const & names, string & out)
 {
   vector<int8_t> mwmLangCodes;
   regionData.GetLanguages(mwmLangCodes);
 
   for (auto const code : mwmLangCodes)
   {
-    if (src.GetString(code, out))
+    if (GetName(names, code, out))
       return;
   }
 }
 
-bool GetTransliteratedName(feature::RegionData const & regionData, StringUtf8Multilang const & src, string & out)
+bool GetTransliteratedName(feature::RegionData const & regionData, NamesList const & names, string & out)
 {
   vector<int8_t> mwmLangCodes;
   regionData.GetLanguages(mwmLangCodes);
 
   string srcName;
   for (auto const code : mwmLangCodes)
-    if (src.GetString(code, srcName) && Transliteration::Instance().Transliterate(srcName, code, out))
+    if (GetName(names, code, srcName) && Transliteration::Instance().Transliterate(srcName, code, out))
       return true;
 
   // If default name is available, interpret it as a name for the first mwm language.
-  if (!mwmLangCodes.empty() && src.GetString(StringUtf8Multilang::kDefaultCode, srcName))
+  if (!mwmLangCodes.empty() && GetName(names, StringUtf8Multilang::kDefaultCode, srcName))
     return Transliteration::Instance().Transliterate(srcName, mwmLangCodes[0], out);
 
   return false;
 }
 
-bool GetBestName(StringUtf8Multilang const & src, vector<int8_t> const & priorityList, string & out)
+bool GetBestName(NamesList const & names, vector<int8_t> const & priorityList, string & out)
 {
   auto bestIndex = priorityList.size();
 
@@ -77,14 +106,13 @@ bool GetBestName(StringUtf8Multilang const & src, vector<int8_t> const & priorit
     }
   };
 
-  src.ForEach([&](int8_t code, string const & name)
-              {
-                if (bestIndex == 0)
-                  return base::ControlFlow::Break;
+  for (auto const & name : names)
+  {
+    if (bestIndex == 0)
+      break;
 
-                findAndSet(priorityList, code, name, bestIndex, out);
-                return base::ControlFlow::Continue;
-              });
+    findAndSet(priorityList, name.first, name.second, bestIndex, out);
+  }
 
   // There are many "junk" names in Arabian island.
   if (bestIndex < priorityList.size() &&
@@ -132,24 +160,24 @@ vector<int8_t> MakePrimaryNamePriorityList(int8_t deviceLang, bool preferDefault
   return langPriority;
 }
 
-void GetReadableNameImpl(feature::RegionData const & regionData, StringUtf8Multilang const & src,
+void GetReadableNameImpl(feature::RegionData const & regionData, NamesList const & names,
                          int8_t deviceLang, bool preferDefault, bool allowTranslit, string & out)
 {
   vector<int8_t> langPriority = MakePrimaryNamePriorityList(deviceLang, preferDefault);
 
-  if (GetBestName(src, langPriority, out))
+  if (GetBestName(names, langPriority, out))
     return;
 
-  if (allowTranslit && GetTransliteratedName(regionData, src, out))
+  if (allowTranslit && GetTransliteratedName(regionData, names, out))
     return;
 
   if (!preferDefault)
   {
-    if (GetBestName(src, {StrUtf8::kDefaultCode}, out))
+    if (GetName(names, StrUtf8::kDefaultCode, out))
       return;
   }
 
-  GetMwmLangName(regionData, src, out);
+  GetMwmLangName(regionData, names, out);
 }
 }  // namespace
 
@@ -302,15 +330,18 @@ void GetPreferredNames(RegionData const & regionData, StringUtf8Multilang const
   if (src.IsEmpty())
     return;
 
+  NamesList names;
+  CollectNames(src, names);
+
   // When the language of the user is equal to one of the languages of the MWM
   // (or similar languages) only single name scheme is used.
   if (IsNativeLang(regionData, deviceLang))
-    return GetReadableNameImpl(regionData, src, deviceLang, true, allowTranslit, primary);
+    return GetReadableNameImpl(regionData, names, deviceLang, true, allowTranslit, primary);
 
   vector<int8_t> primaryCodes = MakePrimaryNamePriorityList(deviceLang, false);
 
-  if (!GetBestName(src, primaryCodes, primary) && allowTranslit)
-    GetTransliteratedName(regionData, src, primary);
+  if (!GetBestName(names, primaryCodes, primary) && allowTranslit)
+    GetTransliteratedName(regionData, names, primary);
 
   vector<int8_t> secondaryCodes = {StrUtf8::kDefaultCode, StrUtf8::kInternationalCode};
 
@@ -320,7 +351,7 @@ void GetPreferredNames(RegionData const & regionData, StringUtf8Multilang const
 
   secondaryCodes.push_back(StrUtf8::kEnglishCode);
 
-  GetBestName(src, secondaryCodes, secondary);
+  GetBestName(names, secondaryCodes, secondary);
 
   if (primary.empty())
     primary.swap(secondary);
@@ -339,7 +370,9 @@ void GetReadableName(RegionData const & regionData, StringUtf8Multilang const &
   // If MWM contains user's language.
   bool const preferDefault = IsNativeLang(regionData, deviceLang);
 
-  GetReadableNameImpl(regionData, src, deviceLang, preferDefault, allowTranslit, out);
+  NamesList names;
+  CollectNames(src, names);
+  GetReadableNameImpl(regionData, names, deviceLang, preferDefault, allowTranslit, out);
 }
 
 int8_t GetNameForSearchOnBooking(RegionData const & regionData, StringUtf8Multilang const & src,
@@ -367,6 +400,9 @@ int8_t GetNameForSearchOnBooking(RegionData const & regionData, StringUtf8Multil
 bool GetPreferredName(StringUtf8Multilang const & src, int8_t deviceLang, string & out)
 {
   auto const priorityList = MakePrimaryNamePriorityList(deviceLang, true /* preferDefault */);
-  return GetBestName(src, priorityList, out);
+
+  NamesList names;
+  CollectNames(src, names);
+  return GetBestName(names, priorityList, out);
 }
 } // namespace feature
@@ -64,43 +64,14 @@ string Classificator::GetFullObjectName(uint32_t type) const
 namespace feature
 {
 
-namespace
-{
-  class DrawRuleGetter
-  {
-    int m_scale;
-    EGeomType m_ft;
-    drule::KeysT & m_keys;
-
-  public:
-    DrawRuleGetter(int scale, EGeomType ft, drule::KeysT & keys)
-      : m_scale(scale), m_ft(ft), m_keys(keys)
-    {
-    }
-
-    typedef bool ResultType;
-
-    void operator() (ClassifObject const *)
-    {
-    }
-    bool operator() (ClassifObject const * p, bool & res)
-    {
-      res = true;
-      p->GetSuitable(min(m_scale, scales::GetUpperStyleScale()), m_ft, m_keys);
-      return false;
-    }
-  };
-}
-
 pair<int, bool> GetDrawRule(TypesHolder const & types, int level,
                             drule::KeysT & keys)
 {
   ASSERT ( keys.empty(), () );
   Classificator const & c = classif();
 
-  DrawRuleGetter doRules(level, types.GetGeoType(), keys);
   for (uint32_t t : types)
-    (void)c.ProcessObjects(t, doRules);
+    c.GetSuitableRules(t, level, types.GetGeoType(), keys);
 
   return make_pair(types.GetGeoType(), types.Has(c.GetCoastType()));
 }
@@ -112,10 +83,8 @@ void GetDrawRule(vector<uint32_t> const & types, int level, int geoType,
   ASSERT ( keys.empty(), () );
   Classificator const & c = classif();
 
-  DrawRuleGetter doRules(level, EGeomType(geoType), keys);
-
   for (uint32_t t : types)
-    (void)c.ProcessObjects(t, doRules);
+    c.GetSuitableRules(t, level, EGeomType(geoType), keys);
 }
 
 void FilterRulesByRuntimeSelector(FeatureType & f, int zoomLevel, drule::KeysT & keys)
@@ -131,27 +100,6 @@ void FilterRulesByRuntimeSelector(FeatureType & f, int zoomLevel, drule::KeysT &
 
 namespace
 {
-  class IsDrawableChecker
-  {
-    int m_scale;
-
-  public:
-    IsDrawableChecker(int scale) : m_scale(scale) {}
-
-    typedef bool ResultType;
-
-    void operator() (ClassifObject const *) {}
-    bool operator() (ClassifObject const * p, bool & res)
-    {
-      if (p->IsDrawable(m_scale))
-      {
-        res = true;
-        return true;
-      }
-      return false;
-    }
-  };
-
   class IsDrawableLikeChecker
   {
     EGeomType m_geomType;
@@ -325,10 +273,9 @@ bool IsDrawableForIndexGeometryOnly(TypesHolder const & types, m2::RectD limitRe
 bool IsDrawableForIndexClassifOnly(TypesHolder const & types, int level)
 {
   Classificator const & c = classif();
-  IsDrawableChecker doCheck(level);
   for (uint32_t t : types)
   {
-    if (TypeAlwaysExists(t) || c.ProcessObjects(t, doCheck))
+    if (TypeAlwaysExists(t) || c.IsTypeDrawableForLevel(t, level))
       return true;
   }
 
@@ -455,8 +402,7 @@ bool IsVisibleInRange(uint32_t type, pair<int, int> const & scaleRange)
   Classificator const & c = classif();
   for (int scale = scaleRange.first; scale <= scaleRange.second; ++scale)
   {
-    IsDrawableChecker doCheck(scale);
-    if (c.ProcessObjects(type, doCheck))
+    if (c.IsTypeDrawableForLevel(type, scale))
       return true;
   }
   return false;
@@ -31,6 +31,7 @@ namespace feature
   FeaturesOffsetsTable::FeaturesOffsetsTable(string const & filePath)
   {
     m_pReader.reset(new MmapReader(filePath));
+    m_pReader->Advise(coding::MemoryAdvice::WillNeed);
     succinct::mapper::map(m_table, reinterpret_cast<char const *>(m_pReader->Data()));
   }
 
@@ -71,6 +72,10 @@ namespace feature
     table->m_file.Open(cont.GetFileName());
     auto p = cont.GetAbsoluteOffsetAndSize(FEATURE_OFFSETS_FILE_TAG);
     table->m_handle.Assign(table->m_file.Map(p.first, p.second, FEATURE_OFFSETS_FILE_TAG));
+    // Every feature read starts with an offsets table lookup, so prefault
+    // the whole (small) section instead of paying a page fault storm on
+    // the first tiles drawn after the map is opened.
+    table->m_handle.Advise(coding::MemoryAdvice::WillNeed);
 
     succinct::mapper::map(table->m_table, table->m_handle.GetData<char>());
     return table;
@@ -66,11 +66,18 @@ namespace feature
     /// Load table by full path to the table file.
     static std::unique_ptr<FeaturesOffsetsTable> Load(std::string const & filePath);
 
+    /// Maps the frozen succinct structure from the FEATURE_OFFSETS_FILE_TAG
+    /// section of the mwm. The section is written by the generator
+    /// (see feature::BuildOffsetsTable()), so opening a map of the
+    /// current format is a pure mmap with no build step at runtime.
     static std::unique_ptr<FeaturesOffsetsTable> Load(FilesContainerR const & cont);
     static std::unique_ptr<FeaturesOffsetsTable> Build(FilesContainerR const & cont,
                                                        std::string const & storePath);
 
     /// Get table for the MWM map, represented by localFile and cont.
+    /// Only needed for pre-v6 maps that lack the offsets section: the
+    /// table is built from the features data once and cached next to
+    /// the map in the country indexes directory.
     static std::unique_ptr<FeaturesOffsetsTable> CreateIfNotExistsAndLoad(
              platform::LocalCountryFile const & localFile, FilesContainerR const & cont);
 
@@ -8,10 +8,15 @@
 
 void FeaturesVector::GetByIndex(uint32_t index, FeatureType & ft) const
 {
-  uint32_t offset = 0, size = 0;
-  auto const ftOffset = m_table ? m_table->GetFeatureOffset(index) : index;
-  m_recordReader.ReadRecord(ftOffset, m_buffer, offset, size);
-  ft.Deserialize(&m_loadInfo, &m_buffer[offset]);
+  if (!m_hasLast || index != m_lastIndex)
+  {
+    uint32_t size = 0;
+    auto const ftOffset = m_table ? m_table->GetFeatureOffset(index) : index;
+    m_recordReader.ReadRecord(ftOffset, m_buffer, m_lastOffset, size);
+    m_lastIndex = index;
+    m_hasLast = true;
+  }
+  ft.Deserialize(&m_loadInfo, &m_buffer[m_lastOffset]);
 }
 
 size_t FeaturesVector::GetNumFeatures() const
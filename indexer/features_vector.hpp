@@ -56,6 +56,14 @@ private:
   feature::SharedLoadInfo m_loadInfo;
   VarRecordReader<FilesContainerR::TReader, &VarRecordSizeReaderVarint> m_recordReader;
   mutable vector<char> m_buffer;
+  // Index and offset of the record that currently occupies |m_buffer|.
+  // Clients (search filters, editor, routing) often read the same feature
+  // back-to-back through the same source, and the mwm data is immutable
+  // while the instance is alive, so a repeated read skips the offsets
+  // table lookup and the record copy.
+  mutable uint32_t m_lastIndex = 0;
+  mutable uint32_t m_lastOffset = 0;
+  mutable bool m_hasLast = false;
   feature::FeaturesOffsetsTable const * m_table;
 };
 
@@ -122,9 +122,36 @@ uint32_t BaseChecker::PrepareToMatch(uint32_t type, uint8_t level)
   return type;
 }
 
+void BaseChecker::BuildMatchingTable() const
+{
+  // Types truncated to two levels are packed into 15 bits, so for the
+  // common checkers the table is at most 4KB. Checkers of deeper types
+  // would need a much larger table; they are few and keep the linear
+  // scan over |m_types|.
+  uint32_t const kMaxTableType = 1 << 16;
+
+  uint32_t maxType = 0;
+  for (uint32_t const t : m_types)
+    maxType = max(maxType, t);
+
+  if (m_types.empty() || maxType >= kMaxTableType)
+    return;
+
+  m_matched.assign(maxType + 1, false);
+  for (uint32_t const t : m_types)
+    m_matched[t] = true;
+}
+
 bool BaseChecker::IsMatched(uint32_t type) const
 {
-  return (find(m_types.begin(), m_types.end(), PrepareToMatch(type, m_level)) != m_types.end());
+  // The table cannot be built in the constructor: |m_types| is filled
+  // by the constructors of the derived checkers.
+  call_once(m_matchedOnce, &BaseChecker::BuildMatchingTable, this);
+
+  uint32_t const t = PrepareToMatch(type, m_level);
+  if (!m_matched.empty())
+    return t < m_matched.size() && m_matched[t];
+  return find(m_types.begin(), m_types.end(), t) != m_types.end();
 }
 
 bool BaseChecker::operator()(feature::TypesHolder const & types) const
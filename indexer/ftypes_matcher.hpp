@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -29,6 +30,15 @@ class BaseChecker
 {
   size_t const m_level;
 
+  // Direct-indexed matching table: |m_matched[t]| is set iff |t| is in
+  // |m_types|. Built lazily on the first check, because the types are
+  // pushed by the constructors of the derived checkers. See
+  // BuildMatchingTable() for the details.
+  mutable std::once_flag m_matchedOnce;
+  mutable std::vector<bool> m_matched;
+
+  void BuildMatchingTable() const;
+
 protected:
   std::vector<uint32_t> m_types;
 
@@ -191,6 +191,54 @@ UNIT_TEST(IntervalIndex_Simple)
   }
 }
 
+UNIT_TEST(IntervalIndex_Batched)
+{
+  vector<CellIdFeaturePairForTest> data;
+  data.push_back(CellIdFeaturePairForTest(0xA0B1C2D100ULL, 0));
+  data.push_back(CellIdFeaturePairForTest(0xA0B1C2D200ULL, 1));
+  data.push_back(CellIdFeaturePairForTest(0xA0B2C2D100ULL, 2));
+  vector<char> serialIndex;
+  MemWriter<vector<char> > writer(serialIndex);
+  BuildIntervalIndex(data.begin(), data.end(), writer, 40);
+  MemReader reader(&serialIndex[0], serialIndex.size());
+  IntervalIndex<MemReader, uint32_t> index(reader);
+  {
+    uint32_t expected [] = {0, 1, 2};
+    vector<pair<int64_t, int64_t>> const intervals = {{0x0LL, 0x10000000000LL}};
+    vector<uint32_t> values;
+    index.ForEach(base::MakeBackInsertFunctor(values), intervals);
+    TEST_EQUAL(values, vector<uint32_t>(expected, expected + ARRAY_SIZE(expected)), ());
+  }
+  {
+    // Two intervals that hit different subtrees of one root node.
+    uint32_t expected [] = {0, 2};
+    vector<pair<int64_t, int64_t>> const intervals = {{0xA0B1C2D100LL, 0xA0B1C2D101LL},
+                                                      {0xA0B2C2D100LL, 0xA0B2C2D101LL}};
+    vector<uint32_t> values;
+    index.ForEach(base::MakeBackInsertFunctor(values), intervals);
+    TEST_EQUAL(values, vector<uint32_t>(expected, expected + ARRAY_SIZE(expected)), ());
+  }
+  {
+    // Two intervals inside one leaf with a gap between them.
+    uint32_t expected [] = {0, 1};
+    vector<pair<int64_t, int64_t>> const intervals = {{0xA0B1C2D100LL, 0xA0B1C2D101LL},
+                                                      {0xA0B1C2D200LL, 0xA0B1C2D201LL}};
+    vector<uint32_t> values;
+    index.ForEach(base::MakeBackInsertFunctor(values), intervals);
+    TEST_EQUAL(values, vector<uint32_t>(expected, expected + ARRAY_SIZE(expected)), ());
+  }
+  {
+    // Empty and degenerate intervals.
+    vector<pair<int64_t, int64_t>> const intervals = {{0xA0B1C2D100LL, 0xA0B1C2D100LL},
+                                                      {0xA0B1000000LL, 0xA0B1B20000LL}};
+    vector<uint32_t> values;
+    index.ForEach(base::MakeBackInsertFunctor(values), intervals);
+    TEST_EQUAL(values, vector<uint32_t>(), ());
+    index.ForEach(base::MakeBackInsertFunctor(values), vector<pair<int64_t, int64_t>>());
+    TEST_EQUAL(values, vector<uint32_t>(), ());
+  }
+}
+
 UNIT_TEST(IntervalIndex_Empty)
 {
   vector<CellIdFeaturePairForTest> data;
@@ -27,7 +27,7 @@ namespace
 void TestTable(vector<uint8_t> const & ranks, search::RankTable const & table)
 {
   TEST_EQUAL(ranks.size(), table.Size(), ());
-  TEST_EQUAL(table.GetVersion(), search::RankTable::V0, ());
+  TEST_EQUAL(table.GetVersion(), search::RankTable::V1, ());
   for (size_t i = 0; i < ranks.size(); ++i)
     TEST_EQUAL(ranks[i], table.Get(i), ());
 }
@@ -72,6 +72,36 @@ UNIT_TEST(RankTableBuilder_Smoke)
   TestTable(ranks, kTestCont);
 }
 
+UNIT_TEST(RankTableBuilder_SparseRanks)
+{
+  char const kTestCont[] = "test.tmp";
+
+  FileWriter::DeleteFileX(kTestCont);
+  SCOPE_GUARD(cleanup, bind(&FileWriter::DeleteFileX, kTestCont));
+
+  // Mostly-zero ranks with a size that is not a multiple of the block
+  // size, so that both empty and partially filled blocks are covered.
+  vector<uint8_t> ranks(1000, 0);
+  ranks[0] = 1;
+  ranks[313] = 7;
+  ranks[999] = 255;
+
+  {
+    FilesContainerW wcont(kTestCont);
+    search::RankTableBuilder::Create(ranks, wcont, SEARCH_RANKS_FILE_TAG);
+  }
+
+  TestTable(ranks, kTestCont);
+
+  // Ranks of features out of the table are zero.
+  {
+    FilesContainerR rcont(kTestCont);
+    auto table = search::RankTable::Load(rcont, SEARCH_RANKS_FILE_TAG);
+    TEST(table, ());
+    TEST_EQUAL(table->Get(ranks.size()), 0, ());
+  }
+}
+
 UNIT_TEST(RankTableBuilder_EndToEnd)
 {
   classificator::Load();
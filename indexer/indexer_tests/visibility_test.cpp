@@ -91,3 +91,38 @@ UNIT_TEST(VisibleScales_Highway)
 
   doGet.Print();
 }
+
+UNIT_TEST(DrawRulesTable_MatchesTreeWalk)
+{
+  classificator::Load();
+  Classificator const & c = classif();
+
+  // The precomputed table must resolve to exactly the same rules as
+  // the classificator tree walk for every (type, scale, geometry).
+  for (uint32_t index = 0; index < c.GetTypesCount(); ++index)
+  {
+    uint32_t const type = c.GetTypeForIndex(index);
+    ClassifObject const * pObj = c.GetObject(type);
+
+    for (int scale = 0; scale <= scales::GetUpperStyleScale(); ++scale)
+    {
+      TEST_EQUAL(pObj->IsDrawable(scale), c.IsTypeDrawableForLevel(type, scale),
+                 (c.GetFullObjectName(type), scale));
+
+      for (int geom = 0; geom < 3; ++geom)
+      {
+        auto const ft = static_cast<feature::EGeomType>(geom);
+
+        drule::KeysT expected;
+        pObj->GetSuitable(scale, ft, expected);
+
+        drule::KeysT actual;
+        c.GetSuitableRules(type, scale, ft, actual);
+
+        TEST_EQUAL(expected.size(), actual.size(), (c.GetFullObjectName(type), scale, geom));
+        for (size_t i = 0; i < expected.size(); ++i)
+          TEST(expected[i] == actual[i], (c.GetFullObjectName(type), scale, geom, i));
+      }
+    }
+  }
+}
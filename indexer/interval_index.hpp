@@ -7,7 +7,11 @@
 #include "base/assert.hpp"
 #include "base/buffer_vector.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
 
 class IntervalIndexBase
 {
@@ -64,64 +68,145 @@ public:
         beg = KeyEnd();
       if (end > KeyEnd())
         end = KeyEnd();
-      --end;  // end is inclusive in ForEachImpl().
-      ForEachNode(f, beg, end, m_Header.m_Levels, 0,
-                  m_LevelOffsets[m_Header.m_Levels + 1] - m_LevelOffsets[m_Header.m_Levels]);
+      if (beg >= end)
+        return;
+      Range const range(beg, end - 1);  // ends are inclusive in ForEachRanges().
+      ForEachRanges(f, &range, &range + 1, m_Header.m_Levels, 0,
+                    m_LevelOffsets[m_Header.m_Levels + 1] - m_LevelOffsets[m_Header.m_Levels]);
+    }
+  }
+
+  // Batched version of ForEach() for all intervals of one query.
+  // |intervals| should be sorted and non-overlapping, as produced by
+  // covering::SortAndMergeIntervals(). An index node intersected by
+  // several intervals is read and decoded once instead of once per
+  // interval, which matters for the upper tree levels that almost every
+  // interval of a viewport covering passes through.
+  template <typename F>
+  void ForEach(F const & f, std::vector<std::pair<int64_t, int64_t>> const & intervals) const
+  {
+    if (m_Header.m_Levels == 0)
+      return;
+
+    buffer_vector<Range, 8> ranges;
+    for (auto const & i : intervals)
+    {
+      uint64_t beg = static_cast<uint64_t>(i.first);
+      uint64_t end = static_cast<uint64_t>(i.second);
+      if (beg > KeyEnd())
+        beg = KeyEnd();
+      if (end > KeyEnd())
+        end = KeyEnd();
+      if (beg >= end)
+        continue;
+      ranges.emplace_back(beg, end - 1);  // ends are inclusive in ForEachRanges().
+    }
+
+    if (!ranges.empty())
+    {
+      ForEachRanges(f, ranges.data(), ranges.data() + ranges.size(), m_Header.m_Levels, 0,
+                    m_LevelOffsets[m_Header.m_Levels + 1] - m_LevelOffsets[m_Header.m_Levels]);
     }
   }
 
 private:
+  // A key range with inclusive ends, truncated to the key bits of the
+  // node that is being visited.
+  using Range = std::pair<uint64_t, uint64_t>;
+
+  // Returns a pointer to the |size| bytes of the node at |offset|.
+  // The generic version copies them into |buffer| with one Read() call
+  // (virtual for reader-pointer types such as ModelReaderPtr).
+  template <class R, size_t N>
+  static uint8_t const * GetBlock(R const & reader, uint32_t offset, uint32_t size,
+                                  buffer_vector<uint8_t, N> & buffer)
+  {
+    buffer.resize_no_init(size);
+    reader.Read(offset, &buffer[0], size);
+    return &buffer[0];
+  }
+
+  // Memory-backed readers decode nodes in place, so the whole tree walk
+  // is free of virtual calls and block copies.
+  template <bool WithExceptions, size_t N>
+  static uint8_t const * GetBlock(MemReaderTemplate<WithExceptions> const & reader,
+                                  uint32_t offset, uint32_t size,
+                                  buffer_vector<uint8_t, N> & /* buffer */)
+  {
+    ASSERT_LESS_OR_EQUAL(offset + static_cast<uint64_t>(size), reader.Size(), ());
+    return reinterpret_cast<uint8_t const *>(reader.Data()) + offset;
+  }
 
   template <typename F>
-  void ForEachLeaf(F const & f, uint64_t const beg, uint64_t const end,
+  void ForEachLeaf(F const & f, Range const * rBeg, Range const * rEnd,
                    uint32_t const offset, uint32_t const size) const
   {
-    buffer_vector<uint8_t, 1024> data;
-    data.resize_no_init(size);
-
-    m_Reader.Read(offset, &data[0], size);
-    ArrayByteSource src(&data[0]);
-
-    void const * pEnd = &data[0] + size;
+    buffer_vector<uint8_t, 1024> buffer;
+    uint8_t const * p = GetBlock(m_Reader, offset, size, buffer);
+    uint8_t const * const pEnd = p + size;
     Value value = 0;
-    while (src.Ptr() < pEnd)
+    while (p < pEnd)
     {
       uint32_t key = 0;
-      src.Read(&key, m_Header.m_LeafBytes);
+      memcpy(&key, p, m_Header.m_LeafBytes);
+      p += m_Header.m_LeafBytes;
       key = SwapIfBigEndianMacroBased(key);
-      if (key > end)
+      while (rBeg != rEnd && rBeg->second < key)
+        ++rBeg;
+      if (rBeg == rEnd)
         break;
-      value += ReadVarInt<int64_t>(src);
-      if (key >= beg)
+      value += ReadVarInt64FromBuffer(p);
+      if (key >= rBeg->first)
         f(value);
     }
   }
 
+  // |rBeg|, |rEnd| delimit a non-empty sequence of sorted non-overlapping
+  // ranges that all intersect the node at |offset|.
   template <typename F>
-  void ForEachNode(F const & f, uint64_t beg, uint64_t end, int level,
-                   uint32_t offset, uint32_t size) const
+  void ForEachRanges(F const & f, Range const * rBeg, Range const * rEnd, int level,
+                     uint32_t offset, uint32_t size) const
   {
     offset += m_LevelOffsets[level];
 
     if (level == 0)
     {
-      ForEachLeaf(f, beg, end, offset, size);
+      ForEachLeaf(f, rBeg, rEnd, offset, size);
       return;
     }
 
     uint8_t const skipBits = (m_Header.m_LeafBytes << 3) + (level - 1) * m_Header.m_BitsPerLevel;
-    ASSERT_LESS_OR_EQUAL(beg, end, (skipBits));
 
     uint64_t const levelBytesFF = (1ULL << skipBits) - 1;
-    uint32_t const beg0 = static_cast<uint32_t>(beg >> skipBits);
-    uint32_t const end0 = static_cast<uint32_t>(end >> skipBits);
-    ASSERT_LESS(end0, (1U << m_Header.m_BitsPerLevel), (beg, end, skipBits));
+    uint32_t const beg0 = static_cast<uint32_t>(rBeg->first >> skipBits);
+    uint32_t const end0 = static_cast<uint32_t>((rEnd - 1)->second >> skipBits);
+    ASSERT_LESS(end0, (1U << m_Header.m_BitsPerLevel), (beg0, skipBits));
 
-    buffer_vector<uint8_t, 576> data;
-    data.resize_no_init(size);
+    buffer_vector<uint8_t, 576> buffer;
+    uint8_t const * const pData = GetBlock(m_Reader, offset, size, buffer);
+    ArrayByteSource src(pData);
 
-    m_Reader.Read(offset, &data[0], size);
-    ArrayByteSource src(&data[0]);
+    buffer_vector<Range, 8> childRanges;
+    auto const forEachChild = [&](uint32_t i, uint32_t childOffset, uint32_t childSize)
+    {
+      uint64_t const childBeg = static_cast<uint64_t>(i) << skipBits;
+      uint64_t const childEnd = childBeg + levelBytesFF;
+      // Children are visited in the ascending order, so the ranges that
+      // end before this child are not needed anymore.
+      while (rBeg != rEnd && rBeg->second < childBeg)
+        ++rBeg;
+      childRanges.clear();
+      for (Range const * r = rBeg; r != rEnd && r->first <= childEnd; ++r)
+      {
+        childRanges.emplace_back(std::max(r->first, childBeg) & levelBytesFF,
+                                 std::min(r->second, childEnd) & levelBytesFF);
+      }
+      if (!childRanges.empty())
+      {
+        ForEachRanges(f, childRanges.data(), childRanges.data() + childRanges.size(), level - 1,
+                      childOffset, childSize);
+      }
+    };
 
     uint32_t const offsetAndFlag = ReadVarUint<uint32_t>(src);
     uint32_t childOffset = offsetAndFlag >> 1;
@@ -136,21 +221,17 @@ private:
         {
           uint32_t childSize = ReadVarUint<uint32_t>(src);
           if (i >= beg0)
-          {
-            uint64_t const beg1 = (i == beg0) ? (beg & levelBytesFF) : 0;
-            uint64_t const end1 = (i == end0) ? (end & levelBytesFF) : levelBytesFF;
-            ForEachNode(f, beg1, end1, level - 1, childOffset, childSize);
-          }
+            forEachChild(i, childOffset, childSize);
           childOffset += childSize;
         }
       }
       ASSERT(end0 != (static_cast<uint32_t>(1) << m_Header.m_BitsPerLevel) - 1 ||
-             static_cast<uint8_t const *>(src.Ptr()) - &data[0] == size,
-             (beg, end, beg0, end0, offset, size, src.Ptr(), &data[0]));
+             static_cast<uint8_t const *>(src.Ptr()) - pData == size,
+             (beg0, end0, offset, size, src.Ptr(), pData));
     }
     else
     {
-      void const * pEnd = &data[0] + size;
+      void const * pEnd = pData + size;
       while (src.Ptr() < pEnd)
       {
         uint8_t const i = src.ReadByte();
@@ -158,11 +239,7 @@ private:
           break;
         uint32_t childSize = ReadVarUint<uint32_t>(src);
         if (i >= beg0)
-        {
-          uint64_t const beg1 = (i == beg0) ? (beg & levelBytesFF) : 0;
-          uint64_t const end1 = (i == end0) ? (end & levelBytesFF) : levelBytesFF;
-          ForEachNode(f, beg1, end1, level - 1, childOffset, childSize);
-        }
+          forEachChild(i, childOffset, childSize);
         childOffset += childSize;
       }
     }
@@ -9,8 +9,10 @@
 #include "base/exception.hpp"
 #include "base/logging.hpp"
 #include "base/stl_helpers.hpp"
+#include "base/thread.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
 #include <sstream>
 
@@ -95,6 +97,66 @@ MwmSet::MwmId MwmSet::GetMwmIdByCountryFileImpl(CountryFile const & countryFile)
 }
 
 pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const & localFile)
+{
+  return Register(localFile, nullptr /* preloadedInfo */);
+}
+
+vector<pair<MwmSet::MwmId, MwmSet::RegResult>> MwmSet::Register(
+    vector<LocalCountryFile> const & files)
+{
+  // Reading mwm headers is dominated by opening the files and faulting
+  // their first pages in, so a few threads are enough to overlap the
+  // I/O latencies even on flash storage.
+  size_t const kMaxThreads = 4;
+
+  vector<unique_ptr<MwmInfo>> infos(files.size());
+  // Not vector<bool>: the flags are set from several threads and must
+  // not share their storage.
+  vector<uint8_t> failed(files.size(), false);
+
+  atomic<size_t> next(0);
+  auto const worker = [&]()
+  {
+    while (true)
+    {
+      size_t const i = next.fetch_add(1);
+      if (i >= files.size())
+        return;
+      try
+      {
+        infos[i] = CreateInfo(files[i]);
+      }
+      catch (RootException const & ex)
+      {
+        LOG(LERROR, ("IO error while reading", files[i].GetCountryName(), "map.", ex.Msg()));
+        failed[i] = true;
+      }
+    }
+  };
+
+  size_t const numThreads = min(files.size(), kMaxThreads);
+  vector<threads::SimpleThread> threads;
+  for (size_t i = 0; i < numThreads; ++i)
+    threads.emplace_back(worker);
+  for (auto & thread : threads)
+    thread.join();
+
+  // Publish the maps sequentially: registration is cheap once the info
+  // is in hand, and this keeps the order of events for observers.
+  vector<pair<MwmId, RegResult>> results;
+  results.reserve(files.size());
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    if (failed[i])
+      results.emplace_back(MwmId(), RegResult::BadFile);
+    else
+      results.push_back(Register(files[i], move(infos[i])));
+  }
+  return results;
+}
+
+pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const & localFile,
+                                                        unique_ptr<MwmInfo> preloadedInfo)
 {
   pair<MwmSet::MwmId, MwmSet::RegResult> result;
   auto registerFile = [&](EventList & events)
@@ -103,7 +165,7 @@ pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const &
     MwmId const id = GetMwmIdByCountryFileImpl(countryFile);
     if (!id.IsAlive())
     {
-      result = RegisterImpl(localFile, events);
+      result = RegisterImpl(localFile, move(preloadedInfo), events);
       return;
     }
 
@@ -114,7 +176,7 @@ pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const &
     {
       EventList subEvents;
       DeregisterImpl(id, subEvents);
-      result = RegisterImpl(localFile, subEvents);
+      result = RegisterImpl(localFile, move(preloadedInfo), subEvents);
 
       // In the case of success all sub-events are
       // replaced with a single UPDATE event. Otherwise,
@@ -148,10 +210,11 @@ pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const &
 }
 
 pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::RegisterImpl(LocalCountryFile const & localFile,
+                                                            unique_ptr<MwmInfo> preloadedInfo,
                                                             EventList & events)
 {
   // This function can throw an exception for a bad mwm file.
-  shared_ptr<MwmInfo> info(CreateInfo(localFile));
+  shared_ptr<MwmInfo> info(preloadedInfo ? move(preloadedInfo) : CreateInfo(localFile));
   if (!info)
     return make_pair(MwmId(), RegResult::UnsupportedFileFormat);
 
@@ -266,16 +329,6 @@ void MwmSet::ProcessEventList(EventList & events)
 }
 
 unique_ptr<MwmSet::MwmValueBase> MwmSet::LockValue(MwmId const & id)
-{
-  unique_ptr<MwmSet::MwmValueBase> result;
-  WithEventLog([&](EventList & events)
-               {
-                 result = LockValueImpl(id, events);
-               });
-  return result;
-}
-
-unique_ptr<MwmSet::MwmValueBase> MwmSet::LockValueImpl(MwmId const & id, EventList & events)
 {
   if (!id.IsAlive())
     return nullptr;
@@ -286,19 +339,28 @@ unique_ptr<MwmSet::MwmValueBase> MwmSet::LockValueImpl(MwmId const & id, EventLi
   //if (!info->IsUpToDate())
   //  return TMwmValueBasePtr();
 
-  ++info->m_numRefs;
-
-  // Search in cache.
-  for (auto it = m_cache.begin(); it != m_cache.end(); ++it)
   {
-    if (it->first == id)
+    lock_guard<mutex> lock(m_lock);
+
+    ++info->m_numRefs;
+
+    // Search in cache.
+    for (auto it = m_cache.begin(); it != m_cache.end(); ++it)
     {
-      unique_ptr<MwmValueBase> result = move(it->second);
-      m_cache.erase(it);
-      return result;
+      if (it->first == id)
+      {
+        unique_ptr<MwmValueBase> result = move(it->second);
+        m_cache.erase(it);
+        return result;
+      }
     }
   }
 
+  // Opening an mwm reads its file containers and the offsets table -
+  // the most expensive part of taking a handle. It is done without
+  // |m_lock| on purpose: the info is already pinned by the reference
+  // above, and holding the global lock here would serialize every
+  // concurrent reader of every other mwm behind this I/O.
   try
   {
     return CreateValue(*info);
@@ -306,6 +368,7 @@ unique_ptr<MwmSet::MwmValueBase> MwmSet::LockValueImpl(MwmId const & id, EventLi
   catch (Reader::TooManyFilesException const & ex)
   {
     LOG(LERROR, ("Too many open files, can't open:", info->GetCountryName()));
+    lock_guard<mutex> lock(m_lock);
     --info->m_numRefs;
     return nullptr;
   }
@@ -313,8 +376,11 @@ unique_ptr<MwmSet::MwmValueBase> MwmSet::LockValueImpl(MwmId const & id, EventLi
   {
     LOG(LERROR, ("Can't create MWMValue for", info->GetCountryName(), "Reason", ex.what()));
 
-    --info->m_numRefs;
-    DeregisterImpl(id, events);
+    WithEventLog([&](EventList & events)
+                 {
+                   --info->m_numRefs;
+                   DeregisterImpl(id, events);
+                 });
     return nullptr;
   }
 }
@@ -375,29 +441,14 @@ MwmSet::MwmId MwmSet::GetMwmIdByCountryFile(CountryFile const & countryFile) con
 
 MwmSet::MwmHandle MwmSet::GetMwmHandleByCountryFile(CountryFile const & countryFile)
 {
-  MwmSet::MwmHandle handle;
-  WithEventLog([&](EventList & events)
-               {
-                 handle = GetMwmHandleByIdImpl(GetMwmIdByCountryFileImpl(countryFile), events);
-               });
-  return handle;
+  return GetMwmHandleById(GetMwmIdByCountryFile(countryFile));
 }
 
 MwmSet::MwmHandle MwmSet::GetMwmHandleById(MwmId const & id)
-{
-  MwmSet::MwmHandle handle;
-  WithEventLog([&](EventList & events)
-               {
-                 handle = GetMwmHandleByIdImpl(id, events);
-               });
-  return handle;
-}
-
-MwmSet::MwmHandle MwmSet::GetMwmHandleByIdImpl(MwmId const & id, EventList & events)
 {
   unique_ptr<MwmValueBase> value;
   if (id.IsAlive())
-    value = LockValueImpl(id, events);
+    value = LockValue(id);
   return MwmHandle(*this, id, move(value));
 }
 
@@ -426,6 +477,7 @@ void MwmValue::SetTable(MwmInfoEx & info)
   if (version < version::Format::v5)
     return;
 
+  lock_guard<mutex> lock(info.m_tableMutex);
   m_table = info.m_table.lock();
   if (!m_table)
   {
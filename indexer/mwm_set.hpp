@@ -98,9 +98,10 @@ private:
   // MwmSet's cache. We can't use shared_ptr because of offsets table
   // must be removed as soon as the last corresponding MwmValue is
   // destroyed. Also, note that this value must be used and modified
-  // only in MwmValue::SetTable() method, which, in turn, is called
-  // only in the MwmSet critical section, protected by a lock.  So,
-  // there's an implicit synchronization on this field.
+  // only in MwmValue::SetTable() method under |m_tableMutex|: values
+  // are created outside of the MwmSet critical section, so two threads
+  // may load the same mwm concurrently.
+  std::mutex m_tableMutex;
   std::weak_ptr<feature::FeaturesOffsetsTable> m_table;
 };
 
@@ -270,10 +271,28 @@ public:
   /// are older than the localFile (in this case mwm handle will point
   /// to just-registered file).
 protected:
-  pair<MwmId, RegResult> RegisterImpl(platform::LocalCountryFile const & localFile, EventList & events);
+  pair<MwmId, RegResult> RegisterImpl(platform::LocalCountryFile const & localFile,
+                                      std::unique_ptr<MwmInfo> preloadedInfo, EventList & events);
+
+  // Same as public Register(), but uses |preloadedInfo| instead of
+  // calling CreateInfo() when the map is actually new.
+  pair<MwmId, RegResult> Register(platform::LocalCountryFile const & localFile,
+                                  std::unique_ptr<MwmInfo> preloadedInfo);
 
 public:
   pair<MwmId, RegResult> Register(platform::LocalCountryFile const & localFile);
+
+  /// Registers a batch of new maps at once. The expensive part of the
+  /// registration - opening every map file and reading its headers
+  /// (CreateInfo()) - is done on several threads, while the maps are
+  /// published one by one in the order of |files|, so observers see the
+  /// same sequence of events as with separate Register() calls.
+  ///
+  /// \return One result per input file, in the same order. A file that
+  ///         could not be read yields (invalid id, RegResult::BadFile)
+  ///         instead of throwing, as the rest of the batch is still
+  ///         registered.
+  std::vector<pair<MwmId, RegResult>> Register(std::vector<platform::LocalCountryFile> const & files);
   //@}
 
   /// @name Remove mwm.
@@ -354,11 +373,11 @@ private:
   // Triggers observers on each event in |events|.
   void ProcessEventList(EventList & events);
 
-  /// @precondition This function is always called under mutex m_lock.
-  MwmHandle GetMwmHandleByIdImpl(MwmId const & id, EventList & events);
-
+  // Pins |id| and returns its value. Takes |m_lock| only to update the
+  // reference count and to probe the cache; on a cache miss the value
+  // is created without the lock, so concurrent readers of other mwms
+  // are not serialized behind the I/O.
   std::unique_ptr<MwmValueBase> LockValue(MwmId const & id);
-  std::unique_ptr<MwmValueBase> LockValueImpl(MwmId const & id, EventList & events);
   void UnlockValue(MwmId const & id, std::unique_ptr<MwmValueBase> p);
   void UnlockValueImpl(MwmId const & id, std::unique_ptr<MwmValueBase> p, EventList & events);
 
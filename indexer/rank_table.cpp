@@ -15,6 +15,7 @@
 #include "coding/file_container.hpp"
 #include "coding/file_writer.hpp"
 #include "coding/memory_region.hpp"
+#include "coding/mmap_reader.hpp"
 #include "coding/reader.hpp"
 #include "coding/simple_dense_coding.hpp"
 #include "coding/succinct_mapper.hpp"
@@ -42,6 +43,12 @@ uint64_t const kVersionOffset = 0;
 uint64_t const kFlagsOffset = 1;
 uint64_t const kHeaderSize = 8;
 
+// Number of ranks in a single block of RankTableV1. A block occupies
+// exactly one cache line on most platforms.
+uint64_t const kRanksPerBlock = 64;
+// Value in the offset table of RankTableV1 marking an all-zero block.
+uint32_t const kEmptyBlock = numeric_limits<uint32_t>::max();
+
 enum class CheckResult
 {
   CorruptedHeader,
@@ -80,10 +87,13 @@ unique_ptr<MappedMemoryRegion> GetMemoryRegionForTag(FilesMappingContainer const
   if (!mcont.IsExist(tag))
     return unique_ptr<MappedMemoryRegion>();
   FilesMappingContainer::Handle handle = mcont.Map(tag);
+  // Ranks are looked up by scattered feature ids, readahead would only
+  // evict pages that are still needed.
+  handle.Advise(coding::MemoryAdvice::Random);
   return make_unique<MappedMemoryRegion>(move(handle));
 }
 
-// RankTable version 1, uses simple dense coding to store and access
+// RankTable version 0, uses simple dense coding to store and access
 // array of ranks.
 class RankTableV0 : public RankTable
 {
@@ -167,6 +177,201 @@ private:
   coding::SimpleDenseCoding m_coding;
 };
 
+// RankTable version 1, stores ranks in a blocked layout optimized for
+// dense scattered access: ranks are split into blocks of
+// kRanksPerBlock entries, all-zero blocks (the vast majority, as most
+// features are unranked) are elided via an offset table, non-zero
+// blocks are stored as raw bytes in a data area aligned to the cache
+// line size. Rank lookup is two dependent loads, in contrast to
+// rank/select on succinct structures in version 0.
+//
+// Data layout (offsets are relative to the common 8-bytes header):
+//
+// Data offset (bytes)  Field name  Field size (bytes)
+// 0                    num ranks   8
+// 8                    offsets     4 * ceil(num ranks / kRanksPerBlock)
+// *                    padding     up to the next 64-bytes boundary
+// *                    blocks      kRanksPerBlock * (number of non-zero blocks)
+class RankTableV1 : public RankTable
+{
+public:
+  RankTableV1() = default;
+
+  explicit RankTableV1(vector<uint8_t> const & ranks) : m_size(ranks.size())
+  {
+    uint64_t const numBlocks = (m_size + kRanksPerBlock - 1) / kRanksPerBlock;
+    m_offsetsBuf.reserve(numBlocks);
+    for (uint64_t block = 0; block < numBlocks; ++block)
+    {
+      size_t const from = static_cast<size_t>(block * kRanksPerBlock);
+      size_t const to = static_cast<size_t>(min(from + kRanksPerBlock, m_size));
+      bool const empty = all_of(ranks.begin() + from, ranks.begin() + to,
+                                [](uint8_t rank) { return rank == 0; });
+      if (empty)
+      {
+        m_offsetsBuf.push_back(kEmptyBlock);
+        continue;
+      }
+      m_offsetsBuf.push_back(static_cast<uint32_t>(m_dataBuf.size()));
+      m_dataBuf.insert(m_dataBuf.end(), ranks.begin() + from, ranks.begin() + to);
+      m_dataBuf.resize(m_dataBuf.size() + (kRanksPerBlock - (to - from)));
+    }
+    m_offsets = m_offsetsBuf.data();
+    m_data = m_dataBuf.data();
+    m_dataSize = m_dataBuf.size();
+  }
+
+  // RankTable overrides:
+  uint8_t Get(uint64_t i) const override
+  {
+    // i can be greater than Size() for features created by user in
+    // the Editor, see the note in RankTableV0::Get().
+    if (i >= m_size)
+      return 0;
+
+    uint32_t const offset = m_offsets[i / kRanksPerBlock];
+    if (offset == kEmptyBlock)
+      return 0;
+    return m_data[offset + i % kRanksPerBlock];
+  }
+  uint64_t Size() const override { return m_size; }
+  RankTable::Version GetVersion() const override { return V1; }
+  void Serialize(Writer & writer, bool preserveHostEndianness) override
+  {
+    static uint64_t const zeroes = 0;
+
+    uint8_t const version = GetVersion();
+    uint8_t const flags = preserveHostEndianness ? IsBigEndianMacroBased() : !IsBigEndianMacroBased();
+    writer.Write(&version, sizeof(version));
+    writer.Write(&flags, sizeof(flags));
+    writer.Write(&zeroes, 6);
+
+    uint64_t const numBlocks = (m_size + kRanksPerBlock - 1) / kRanksPerBlock;
+    uint64_t const size = preserveHostEndianness ? m_size : ReverseByteOrder(m_size);
+    writer.Write(&size, sizeof(size));
+    for (uint64_t block = 0; block < numBlocks; ++block)
+    {
+      uint32_t const offset =
+          preserveHostEndianness ? m_offsets[block] : ReverseByteOrder(m_offsets[block]);
+      writer.Write(&offset, sizeof(offset));
+    }
+
+    uint64_t const dataOffset = DataOffset(numBlocks);
+    for (uint64_t pos = kHeaderSize + sizeof(m_size) + numBlocks * sizeof(uint32_t);
+         pos < dataOffset; ++pos)
+    {
+      writer.Write(&zeroes, 1);
+    }
+    writer.Write(m_data, m_dataSize);
+  }
+
+  // Loads RankTableV1 from a raw memory region.
+  static unique_ptr<RankTableV1> Load(unique_ptr<MappedMemoryRegion> && region)
+  {
+    if (!region.get())
+      return unique_ptr<RankTableV1>();
+
+    auto const result = CheckEndianness(MemReader(region->ImmutableData(), region->Size()));
+    if (result != CheckResult::EndiannessMatch)
+      return unique_ptr<RankTableV1>();
+
+    unique_ptr<RankTableV1> table(new RankTableV1());
+    if (!table->Init(region->ImmutableData(), region->Size()))
+      return unique_ptr<RankTableV1>();
+    table->m_region = move(region);
+    return table;
+  }
+
+  // Loads RankTableV1 from a raw memory region. Modifies region in
+  // the case of endianness mismatch.
+  static unique_ptr<RankTableV1> Load(unique_ptr<CopiedMemoryRegion> && region)
+  {
+    if (!region.get())
+      return unique_ptr<RankTableV1>();
+
+    switch (CheckEndianness(MemReader(region->ImmutableData(), region->Size())))
+    {
+    case CheckResult::CorruptedHeader:
+      return unique_ptr<RankTableV1>();
+    case CheckResult::EndiannessMismatch:
+      if (!ReverseFixedWidthFields(*region))
+        return unique_ptr<RankTableV1>();
+      break;
+    case CheckResult::EndiannessMatch:
+      break;
+    }
+
+    unique_ptr<RankTableV1> table(new RankTableV1());
+    if (!table->Init(region->ImmutableData(), region->Size()))
+      return unique_ptr<RankTableV1>();
+    table->m_region = move(region);
+    return table;
+  }
+
+private:
+  // Blocks are aligned to the cache line size, so a single rank
+  // lookup never touches more than one cache line of the data area.
+  static uint64_t DataOffset(uint64_t numBlocks)
+  {
+    uint64_t const unaligned = kHeaderSize + sizeof(uint64_t) + numBlocks * sizeof(uint32_t);
+    return (unaligned + 63) & ~static_cast<uint64_t>(63);
+  }
+
+  // Initializes table from a serialized representation. Returns false
+  // when the region is too small to be a valid rank table.
+  bool Init(uint8_t const * data, uint64_t size)
+  {
+    if (size < kHeaderSize + sizeof(m_size))
+      return false;
+
+    m_size = *reinterpret_cast<uint64_t const *>(data + kHeaderSize);
+    uint64_t const numBlocks = (m_size + kRanksPerBlock - 1) / kRanksPerBlock;
+    uint64_t const dataOffset = DataOffset(numBlocks);
+    if (size < dataOffset)
+      return false;
+
+    m_offsets = reinterpret_cast<uint32_t const *>(data + kHeaderSize + sizeof(m_size));
+    m_data = data + dataOffset;
+    m_dataSize = size - dataOffset;
+    for (uint64_t block = 0; block < numBlocks; ++block)
+    {
+      if (m_offsets[block] != kEmptyBlock && m_offsets[block] + kRanksPerBlock > m_dataSize)
+        return false;
+    }
+    return true;
+  }
+
+  // Reverses byte order of all fixed-width fields in place. Returns
+  // false when the region is too small to be a valid rank table.
+  static bool ReverseFixedWidthFields(CopiedMemoryRegion & region)
+  {
+    if (region.Size() < kHeaderSize + sizeof(uint64_t))
+      return false;
+
+    uint64_t * size = reinterpret_cast<uint64_t *>(region.MutableData() + kHeaderSize);
+    *size = ReverseByteOrder(*size);
+
+    uint64_t const numBlocks = (*size + kRanksPerBlock - 1) / kRanksPerBlock;
+    if (region.Size() < kHeaderSize + sizeof(uint64_t) + numBlocks * sizeof(uint32_t))
+      return false;
+
+    uint32_t * offsets =
+        reinterpret_cast<uint32_t *>(region.MutableData() + kHeaderSize + sizeof(uint64_t));
+    for (uint64_t block = 0; block < numBlocks; ++block)
+      offsets[block] = ReverseByteOrder(offsets[block]);
+    return true;
+  }
+
+  unique_ptr<MemoryRegion> m_region;
+  vector<uint32_t> m_offsetsBuf;
+  vector<uint8_t> m_dataBuf;
+
+  uint64_t m_size = 0;
+  uint32_t const * m_offsets = nullptr;
+  uint8_t const * m_data = nullptr;
+  uint64_t m_dataSize = 0;
+};
+
 // Following two functions create a rank section and serialize |table|
 // to it. If there was an old section with ranks, these functions
 // overwrite it.
@@ -213,6 +418,8 @@ unique_ptr<RankTable> LoadRankTable(unique_ptr<TRegion> && region)
   {
   case RankTable::V0:
     return RankTableV0::Load(move(region));
+  case RankTable::V1:
+    return RankTableV1::Load(move(region));
   case RankTable::VERSION_COUNT:
     ASSERT(false, ("Wrong rank table version."));
     return unique_ptr<RankTable>();
@@ -287,7 +494,7 @@ unique_ptr<RankTable> CreateSearchRankTableIfNotExists(FilesContainerR & rcont)
   {
     vector<uint8_t> ranks;
     SearchRankTableBuilder::CalcSearchRanks(rcont, ranks);
-    table = make_unique<RankTableV0>(ranks);
+    table = make_unique<RankTableV1>(ranks);
   }
 
   return table;
@@ -374,7 +581,7 @@ bool SearchRankTableBuilder::CreateIfNotExists(string const & mapPath) noexcept
 void RankTableBuilder::Create(vector<uint8_t> const & ranks, FilesContainerW & wcont,
                               string const & sectionName)
 {
-  RankTableV0 table(ranks);
+  RankTableV1 table(ranks);
   SerializeRankTable(table, wcont, sectionName);
 }
 }  // namespace search
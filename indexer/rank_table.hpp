@@ -43,6 +43,7 @@ public:
   enum Version
   {
     V0 = 0,
+    V1 = 1,
     VERSION_COUNT
   };
 
@@ -7,6 +7,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 
@@ -62,6 +63,20 @@ public:
     }
   }
 
+  // Processes all |intervals| of one query in a single batched pass over
+  // every index tree, see IntervalIndex::ForEach. |intervals| should be
+  // sorted and non-overlapping (see covering::SortAndMergeIntervals).
+  void ForEachInIntervalsAndScale(std::vector<std::pair<int64_t, int64_t>> const & intervals,
+                                  int scale, std::function<void(uint32_t)> const & fn) const
+  {
+    auto const scaleBucket = BucketByScale(scale);
+    if (scaleBucket < m_IndexForScale.size())
+    {
+      for (size_t i = 0; i <= scaleBucket; ++i)
+        m_IndexForScale[i]->ForEach(fn, intervals);
+    }
+  }
+
 private:
   std::vector<std::unique_ptr<IntervalIndex<Reader, uint32_t>>> m_IndexForScale;
 };
@@ -62,6 +62,17 @@ public:
       // This is not immediately obvious and in fact there was an idea to map
       // a bucket to a contiguous range of scales.
       // todo(@pimenov): We probably should remove scale_index.hpp altogether.
+      //
+      // A finer bucketing (e.g. splitting each scale bucket by coarse
+      // draw class - areas/lines/points - so that tile readers could
+      // skip classes the current style does not draw) was considered
+      // and rejected: it changes the layout of the INDEX_FILE_TAG
+      // section, which none of the already shipped maps have, and the
+      // style that decides what is drawn is chosen at runtime, while
+      // the buckets would have to be fixed here at generation time.
+      // Features drawable only in styles we do not draw with are
+      // discarded by RuleDrawer after parsing just their types, which
+      // the lazy FeatureType parsing keeps cheap.
       if (!FeatureShouldBeIndexed(ft, static_cast<int>(bucket), bucket == minScaleClassif /* needReset */))
       {
         continue;
@@ -44,6 +44,20 @@ void RemoveNumeroSigns(UniString & s)
 
 UniString NormalizeAndSimplifyString(string const & s)
 {
+  // Fast path: for plain ASCII the whole pipeline below (character
+  // replacement hacks, lowercasing, NFKD, accent stripping) reduces to
+  // lowercasing, with no utf8 decoding and no reallocations. Search
+  // queries and a large share of indexed names hit it.
+  if (IsASCIIString(s))
+  {
+    UniString uniString;
+    uniString.reserve(s.size());
+    for (char const c : s)
+      uniString.push_back(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+    RemoveNumeroSigns(uniString);
+    return uniString;
+  }
+
   UniString uniString = MakeUniString(s);
   for (size_t i = 0; i < uniString.size(); ++i)
   {
@@ -14,6 +14,8 @@ public:
   void Load(std::istream & s);
   bool IsLoaded() const { return !m_types.empty(); }
 
+  uint32_t GetTypesCount() const { return static_cast<uint32_t>(m_types.size()); }
+
   // Throws std::out_of_range exception.
   uint32_t GetType(uint32_t ind) const
   {
@@ -245,9 +245,7 @@ template<>
 boost::python::list VectorAdapter<m2::PointD>::Get(std::vector<m2::PointD> const & points)
 {
   std::vector<ms::LatLon> latLonArray;
-  latLonArray.reserve(points.size());
-  for (size_t i = 0; i < points.size(); ++i)
-    latLonArray.emplace_back(MercatorBounds::YToLat(points[i].y), MercatorBounds::XToLon(points[i].x));
+  MercatorBounds::ToLatLon(points, latLonArray);
   return std_vector_to_python_list(latLonArray);
 }
 
@@ -259,9 +257,7 @@ void VectorAdapter<m2::PointD>::Set(std::vector<m2::PointD> & v, boost::python::
     return;
 
   auto const latLon = python_list_to_std_vector<ms::LatLon>(iterable);
-  v.reserve(latLon.size());
-  for (size_t i = 0; i < latLon.size(); ++i)
-    v.emplace_back(MercatorBounds::LonToX(latLon[i].lon), MercatorBounds::LatToY(latLon[i].lat));
+  MercatorBounds::FromLatLon(latLon, v);
 }
 
 std::string LatLonToString(ms::LatLon const & latLon);
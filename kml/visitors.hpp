@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace kml
@@ -168,14 +169,22 @@ private:
     }
     else
     {
-      subIndex.insert(std::make_pair(code, m_counter));
-      m_counter++;
-      m_collection.push_back(str);
+      // Identical strings are collected once and shared by index. Property
+      // keys and author names repeat for every bookmark of a file, so on big
+      // files deduplication shrinks the strings block considerably.
+      auto const result = m_stringToId.emplace(str, m_counter);
+      if (result.second)
+      {
+        m_counter++;
+        m_collection.push_back(str);
+      }
+      subIndex.insert(std::make_pair(code, result.first->second));
     }
   }
 
   uint32_t m_counter = kEmptyStringId + 1;
   std::vector<std::string> m_collection;
+  std::unordered_map<std::string, uint32_t> m_stringToId;
 };
 
 namespace binary
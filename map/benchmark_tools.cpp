@@ -9,16 +9,28 @@
 #include "platform/http_client.hpp"
 #include "platform/platform.hpp"
 
+#include "coding/file_name_utils.hpp"
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
+
+#include "base/logging.hpp"
+
 #include "3party/jansson/myjansson.hpp"
 
 #include <algorithm>
 #include <atomic>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
 namespace
 {
+// A local file with scenarios. If it is present in the writable directory,
+// it is preferred over the server ones: pinned scenarios make benchmark
+// runs comparable across devices and releases.
+char const kScenariosFile[] = "graphics_benchmark.json";
+char const kReportFile[] = "graphics_benchmark_report.json";
 struct BenchmarkHandle
 {
   std::vector<df::ScenarioManager::ScenarioData> m_scenariosToRun;
@@ -31,6 +43,57 @@ struct BenchmarkHandle
 #endif
 };
 
+#ifdef DRAPE_MEASURER
+// Dumps the collected per-scenario statistic to a JSON file in the writable
+// directory, so the numbers can be compared between runs by scripts.
+void SaveBenchmarkReport(
+    std::vector<std::pair<string, df::DrapeMeasurer::DrapeStatistic>> const & statistic)
+{
+  auto root = base::NewJSONObject();
+  auto scenarios = base::NewJSONArray();
+  for (auto const & it : statistic)
+  {
+    auto scenario = base::NewJSONObject();
+    ToJSONObject(*scenario, "name", it.first);
+#ifdef RENDER_STATISTIC
+    ToJSONObject(*scenario, "fps", it.second.m_renderStatistic.m_FPS);
+    ToJSONObject(*scenario, "minFps", it.second.m_renderStatistic.m_minFPS);
+    ToJSONObject(*scenario, "frameRenderTimeMs", it.second.m_renderStatistic.m_frameRenderTimeInMs);
+#endif
+#ifdef TILES_STATISTIC
+    ToJSONObject(*scenario, "tilesCount", it.second.m_tileStatistic.m_totalTilesCount);
+    ToJSONObject(*scenario, "tileReadTimeMs", it.second.m_tileStatistic.m_tileReadTimeInMs);
+#endif
+#ifdef GENERATING_STATISTIC
+    ToJSONObject(*scenario, "maxScenePreparingTimeMs",
+                 it.second.m_generatingStatistic.m_maxScenePreparingTimeInMs);
+    ToJSONObject(*scenario, "shapesCount", it.second.m_generatingStatistic.m_shapesCount);
+    ToJSONObject(*scenario, "shapeGenTimeMs", it.second.m_generatingStatistic.m_shapeGenTimeInMs);
+    ToJSONObject(*scenario, "overlayShapesCount",
+                 it.second.m_generatingStatistic.m_overlayShapesCount);
+    ToJSONObject(*scenario, "overlayShapeGenTimeMs",
+                 it.second.m_generatingStatistic.m_overlayShapeGenTimeInMs);
+#endif
+    json_array_append_new(scenarios.get(), scenario.release());
+  }
+  ToJSONObject(*root, "scenarios", scenarios);
+
+  auto const path = base::JoinFoldersToPath(GetPlatform().WritableDir(), kReportFile);
+  try
+  {
+    std::unique_ptr<char, JSONFreeDeleter> buffer(
+        json_dumps(root.get(), JSON_INDENT(2) | JSON_ENSURE_ASCII));
+    FileWriter writer(path);
+    writer.Write(buffer.get(), strlen(buffer.get()));
+    LOG(LINFO, ("Graphics benchmark report is saved to", path));
+  }
+  catch (FileWriter::Exception const & e)
+  {
+    LOG(LWARNING, ("Error writing file:", path, e.Msg()));
+  }
+}
+#endif
+
 void RunScenario(Framework * framework, std::shared_ptr<BenchmarkHandle> handle)
 {
   if (handle->m_currentScenario >= handle->m_scenariosToRun.size())
@@ -43,6 +106,7 @@ void RunScenario(Framework * framework, std::shared_ptr<BenchmarkHandle> handle)
                   "\n ***** Report for scenario", it.first, "*****\n"));
 
     }
+    SaveBenchmarkReport(handle->m_drapeStatistic);
 #endif
     return;
   }
@@ -79,16 +143,33 @@ void RunGraphicsBenchmark(Framework * framework)
 #ifdef SCENARIO_ENABLE
   using namespace df;
 
-  // Request scenarios from the server.
-  platform::HttpClient request("http://osmz.ru/mwm/graphics_benchmark.json");
-  if (!request.RunHttpRequest())
-    return;
+  // Read scenarios from a local file if it exists or request them from the server.
+  std::string result;
+  auto const scenariosPath = base::JoinFoldersToPath(GetPlatform().WritableDir(), kScenariosFile);
+  if (GetPlatform().IsFileExistsByFullPath(scenariosPath))
+  {
+    try
+    {
+      FileReader(scenariosPath).ReadAsString(result);
+    }
+    catch (FileReader::Exception const & e)
+    {
+      LOG(LWARNING, ("Error reading file:", scenariosPath, e.Msg()));
+      return;
+    }
+  }
+  else
+  {
+    platform::HttpClient request("http://osmz.ru/mwm/graphics_benchmark.json");
+    if (!request.RunHttpRequest())
+      return;
+    result = request.ServerResponse();
+  }
 
   std::shared_ptr<BenchmarkHandle> handle = std::make_shared<BenchmarkHandle>();
 
   // Parse scenarios.
   std::vector<m2::PointD> points;
-  string const & result = request.ServerResponse();
   try
   {
     base::Json root(result.c_str());
@@ -40,6 +40,7 @@
 #include <iomanip>
 #include <list>
 #include <memory>
+#include <set>
 #include <sstream>
 
 using namespace std::placeholders;
@@ -1491,6 +1492,13 @@ void BookmarkManager::CreateCategories(KMLDataCollection && dataCollection, bool
   CHECK_THREAD_CHECKER(m_threadChecker, ());
   kml::GroupIdSet loadedGroups;
 
+  // Names are made unique among all the categories, so scanning m_categories
+  // for each loaded category is quadratic in their number. Collect the names
+  // once and keep the set up to date while the categories are created.
+  std::set<std::string> usedNames;
+  for (auto const & c : m_categories)
+    usedNames.insert(c.second->GetName());
+
   for (auto const & data : dataCollection)
   {
     auto const & fileName = data.first;
@@ -1515,8 +1523,9 @@ void BookmarkManager::CreateCategories(KMLDataCollection && dataCollection, bool
 
     auto uniqueName = originalName;
     int counter = 0;
-    while (IsUsedCategoryName(uniqueName))
+    while (usedNames.count(uniqueName) != 0)
       uniqueName = originalName + strings::to_string(++counter);
+    usedNames.insert(uniqueName);
 
     if (counter > 0)
     {
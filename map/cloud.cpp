@@ -683,21 +683,22 @@ void Cloud::ScheduleUploadingTask(EntryPtr const & entry, uint32_t timeout)
 
     // Prepare file to uploading.
     std::string hash;
-    auto const uploadedName = PrepareFileToUploading(entryName, hash);
+    auto const uploadedName = PrepareFileToUploading(entryName, entryHash, hash);
     auto deleteAfterUploading = [uploadedName]() {
       if (!uploadedName.empty())
         base::DeleteFileX(uploadedName);
     };
     SCOPE_GUARD(deleteAfterUploadingGuard, deleteAfterUploading);
 
-    if (uploadedName.empty())
+    if (hash.empty())
     {
       FinishUploading(SynchronizationResult::DiskError, "File preparation error");
       return;
     }
 
-    // Upload only if calculated hash is not equal to previous one.
-    if (entryHash != hash && !UploadFile(uploadedName))
+    // An empty path with a calculated hash means the file did not change
+    // since the previous synchronization, so uploading is not needed.
+    if (!uploadedName.empty() && !UploadFile(uploadedName))
       return;
 
     // Mark entry as not outdated.
@@ -810,7 +811,8 @@ void Cloud::FinishUploadingOnRequestError(Cloud::RequestResult const & result)
   }
 }
 
-std::string Cloud::PrepareFileToUploading(std::string const & fileName, std::string & hash)
+std::string Cloud::PrepareFileToUploading(std::string const & fileName,
+                                          std::string const & lastHash, std::string & hash)
 {
   // 1. Get path to the original uploading file.
   std::string filePath;
@@ -824,11 +826,20 @@ std::string Cloud::PrepareFileToUploading(std::string const & fileName, std::str
   if (!GetPlatform().IsFileExistsByFullPath(filePath))
     return {};
 
-  // 2. Calculate SHA1 of the original uploading file.
+  // 2. Calculate SHA1 of the original uploading file. The backup converter is
+  // deterministic, so the hash of the original file is enough to detect that
+  // the entry did not change since the previous synchronization. In this case
+  // copying, conversion and uploading are skipped.
   auto const originalSha1 = coding::SHA1::CalculateBase64(filePath);
   if (originalSha1.empty())
     return {};
 
+  if (!lastHash.empty() && lastHash == originalSha1)
+  {
+    hash = originalSha1;
+    return {};
+  }
+
   // 3. Create a temporary file from the original uploading file.
   auto name = ExtractFileNameWithoutExtension(filePath);
   auto const tmpPath = base::JoinFoldersToPath(GetPlatform().TmpDir(), name + ".tmp");
@@ -850,11 +861,20 @@ std::string Cloud::PrepareFileToUploading(std::string const & fileName, std::str
   // 5. Convert temporary file and save to output path.
   CHECK(m_params.m_backupConverter, ());
   auto const convertionResult = m_params.m_backupConverter(tmpPath, outputPath);
-  hash = convertionResult.m_hash;
-  if (convertionResult.m_isSuccessful)
-    return outputPath;
-  
-  return {};
+  if (!convertionResult.m_isSuccessful)
+    return {};
+
+  // Indexes saved by previous versions store the hash of the converted file.
+  // A match means the entry did not change either; the entry migrates to the
+  // hash of the original file without uploading.
+  hash = originalSha1;
+  if (!lastHash.empty() && lastHash == convertionResult.m_hash)
+  {
+    base::DeleteFileX(outputPath);
+    return {};
+  }
+
+  return outputPath;
 }
 
 Cloud::RequestResult Cloud::CreateSnapshot(std::vector<std::string> const & files) const
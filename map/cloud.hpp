@@ -323,9 +323,12 @@ private:
   void SetAccessToken(std::string const & token);
   std::string GetAccessToken() const;
 
-  // This function always returns path to a temporary file or the empty string
-  // in case of a disk error.
-  std::string PrepareFileToUploading(std::string const & fileName, std::string & hash);
+  // This function returns path to a temporary file ready to be uploaded.
+  // The empty string is returned in two cases: a disk error (|hash| is empty
+  // then) or the file did not change since the previous synchronization
+  // (|hash| is filled then and uploading is not needed).
+  std::string PrepareFileToUploading(std::string const & fileName, std::string const & lastHash,
+                                     std::string & hash);
 
   RequestResult CreateSnapshot(std::vector<std::string> const & files) const;
   RequestResult FinishSnapshot() const;
@@ -53,6 +53,10 @@ class FeaturesFetcher : public MwmSet::Observer
     pair<MwmSet::MwmId, MwmSet::RegResult> RegisterMap(
         platform::LocalCountryFile const & localFile);
 
+    /// Registers a batch of new maps, reading their headers in parallel.
+    vector<pair<MwmSet::MwmId, MwmSet::RegResult>> RegisterMaps(
+        vector<platform::LocalCountryFile> const & files);
+
     /// Deregisters a map denoted by file from internal records.
     bool DeregisterMap(platform::CountryFile const & countryFile);
 
@@ -14,7 +14,7 @@
 #include "private.h"
 
 #include "routing/index_router.hpp"
-#include "routing/online_absent_fetcher.hpp"
+#include "routing/absent_countries_fetcher.hpp"
 #include "routing/route.hpp"
 #include "routing/routing_helpers.hpp"
 
@@ -73,6 +73,7 @@
 #include "platform/socket.hpp"
 
 #include "coding/endianness.hpp"
+#include "coding/file_container.hpp"
 #include "coding/file_name_utils.hpp"
 #include "coding/multilang_utf8_string.hpp"
 #include "coding/transliteration.hpp"
@@ -107,6 +108,8 @@
 
 #include "3party/Alohalytics/src/alohalytics.h"
 
+#include <list>
+#include <map>
 #include <memory>
 
 using namespace storage;
@@ -600,7 +603,29 @@ void Framework::OnCountryFileDownloaded(storage::TCountryId const & countryId, s
     auto p = m_model.RegisterMap(*localFile);
     MwmSet::MwmId const & id = p.first;
     if (id.IsAlive())
+    {
       rect = id.GetInfo()->m_bordersRect;
+
+      // Pull the sections read by the first tiles and searches of a freshly
+      // downloaded map into the OS page cache, so browsing it does not
+      // stutter on cold page faults.
+      string const path = localFile->GetPath(MapOptions::Map);
+      GetPlatform().RunTask(Platform::Thread::Background, [path] {
+        try
+        {
+          FilesContainerR cont(path);
+          for (char const * tag : {INDEX_FILE_TAG, GEOMETRY_FILE_TAG, TRIANGLE_FILE_TAG,
+                                   SEARCH_INDEX_FILE_TAG})
+          {
+            cont.PrimeSection(tag);
+          }
+        }
+        catch (Reader::Exception const & ex)
+        {
+          LOG(LWARNING, ("Can't prime sections of", path, ":", ex.Msg()));
+        }
+      });
+    }
   }
   m_trafficManager.Invalidate();
   m_transitManager.Invalidate();
@@ -703,9 +728,19 @@ void Framework::RegisterAllMaps()
 
   vector<shared_ptr<LocalCountryFile>> maps;
   m_storage.GetLocalMaps(maps);
+
+  // Register all the maps in one batch: their headers are read in
+  // parallel, which considerably shortens the cold start with dozens of
+  // downloaded maps.
+  vector<LocalCountryFile> files;
+  files.reserve(maps.size());
   for (auto const & localFile : maps)
+    files.push_back(*localFile);
+
+  auto const results = m_model.RegisterMaps(files);
+  for (size_t i = 0; i < results.size(); ++i)
   {
-    auto p = RegisterMap(*localFile);
+    auto const & p = results[i];
     if (p.second != MwmSet::RegResult::Success)
       continue;
 
@@ -714,7 +749,7 @@ void Framework::RegisterAllMaps()
     minFormat = min(minFormat, static_cast<int>(id.GetInfo()->m_version.GetFormat()));
     if (needStatisticsUpdate)
     {
-      listRegisteredMaps << localFile->GetCountryName() << ":" << id.GetInfo()->GetVersion() << ";";
+      listRegisteredMaps << files[i].GetCountryName() << ":" << id.GetInfo()->GetVersion() << ";";
     }
   }
 
@@ -833,16 +868,14 @@ void Framework::FillInfoFromFeatureType(FeatureType & ft, place_page::Info & inf
                    ("Deleted features cannot be selected from UI."));
   info.SetFeatureStatus(featureStatus);
 
-  ASSERT(m_cityFinder, ());
-  auto const city =
-      m_cityFinder->GetCityName(feature::GetCenter(ft), StringUtf8Multilang::kEnglishCode);
-  feature::TypesHolder buildingHolder;
-  buildingHolder.Assign(classif().GetTypeByPath({"building"}));
+  // The center is used several times below and its calculation for an area
+  // feature is not free, so do it once per tap.
+  auto const center = feature::GetCenter(ft);
 
   info.SetLocalizedWifiString(m_stringsBundle.GetString("wifi"));
 
   if (ftypes::IsAddressObjectChecker::Instance()(ft))
-    info.SetAddress(GetAddressInfoAtPoint(feature::GetCenter(ft)).FormatHouseAndStreet());
+    info.SetAddress(GetAddressInfoAtPoint(center).FormatHouseAndStreet());
 
   info.SetFromFeatureType(ft);
 
@@ -926,7 +959,7 @@ void Framework::FillInfoFromFeatureType(FeatureType & ft, place_page::Info & inf
     info.SetLocalAdsStatus(place_page::LocalAdsStatus::NotAvailable);
   }
 
-  auto const latlon = MercatorBounds::ToLatLon(feature::GetCenter(ft));
+  auto const latlon = MercatorBounds::ToLatLon(center);
   ASSERT(m_taxiEngine, ());
   info.SetReachableByTaxiProviders(m_taxiEngine->GetProvidersAtPos(latlon));
   info.SetPopularity(m_popularityLoader.Get(ft.GetID()));
@@ -1423,27 +1456,33 @@ void Framework::InitDiscoveryManager()
 
 void Framework::InitTransliteration()
 {
-#if defined(OMIM_OS_ANDROID)
-  if (!GetPlatform().IsFileExistsByFullPath(GetPlatform().WritableDir() + kICUDataFile))
+  if (!LoadTransliteration())
+    Transliteration::Instance().SetMode(Transliteration::Mode::Disabled);
+
+  // Transliteration is consulted by search ranking only and returns
+  // untransliterated results until Init() completes, so the data file
+  // unpacking and ICU setup are moved off the cold start path.
+  GetPlatform().RunTask(Platform::Thread::File, []
   {
-    try
-    {
-      ZipFileReader::UnzipFile(GetPlatform().ResourcesDir(),
-                               string("assets/") + kICUDataFile,
-                               GetPlatform().WritableDir() + kICUDataFile);
-    }
-    catch (RootException const & e)
+#if defined(OMIM_OS_ANDROID)
+    if (!GetPlatform().IsFileExistsByFullPath(GetPlatform().WritableDir() + kICUDataFile))
     {
-      LOG(LWARNING, ("Can't get transliteration data file \"", kICUDataFile, "\", reason:", e.Msg()));
+      try
+      {
+        ZipFileReader::UnzipFile(GetPlatform().ResourcesDir(),
+                                 string("assets/") + kICUDataFile,
+                                 GetPlatform().WritableDir() + kICUDataFile);
+      }
+      catch (RootException const & e)
+      {
+        LOG(LWARNING, ("Can't get transliteration data file \"", kICUDataFile, "\", reason:", e.Msg()));
+      }
     }
-  }
-  Transliteration::Instance().Init(GetPlatform().WritableDir());
+    Transliteration::Instance().Init(GetPlatform().WritableDir());
 #else
-  Transliteration::Instance().Init(GetPlatform().ResourcesDir());
+    Transliteration::Instance().Init(GetPlatform().ResourcesDir());
 #endif
-
-  if (!LoadTransliteration())
-    Transliteration::Instance().SetMode(Transliteration::Mode::Disabled);
+  });
 }
 
 storage::TCountryId Framework::GetCountryIndex(m2::PointD const & pt) const
@@ -1641,49 +1680,95 @@ void Framework::FillSearchResultsMarks(search::Results::ConstIter begin,
                                        search::Results::ConstIter end, bool clear,
                                        SearchMarkPostProcessing fn)
 {
-  auto editSession = GetBookmarkManager().GetEditSession();
-  if (clear)
-    editSession.ClearGroup(UserMark::Type::SEARCH);
+  auto & bm = GetBookmarkManager();
+  auto editSession = bm.GetEditSession();
   editSession.SetIsVisible(UserMark::Type::SEARCH, true);
 
+  // When the marks are replaced (a new search or a new viewport), the results
+  // which are still present keep their marks instead of being recreated:
+  // the mark setters only become dirty on an actual change, so panning during
+  // viewport search does not make drape rebuild the unchanged marks.
+  std::map<FeatureID, kml::MarkId> oldMarks;
+  if (clear)
+  {
+    std::list<kml::MarkId> marksToDelete;
+    for (auto markId : bm.GetUserMarkIds(UserMark::Type::SEARCH))
+    {
+      auto const & featureId = bm.GetMark<SearchMarkPoint>(markId)->GetFeatureID();
+      if (!featureId.IsValid() || !oldMarks.emplace(featureId, markId).second)
+        marksToDelete.push_back(markId);
+    }
+    for (auto markId : marksToDelete)
+      editSession.DeleteUserMark(markId);
+  }
+
   for (auto it = begin; it != end; ++it)
   {
     auto const & r = *it;
     if (!r.HasPoint())
       continue;
 
-    auto * mark = editSession.CreateUserMark<SearchMarkPoint>(r.GetFeatureCenter());
     auto const isFeature = r.GetResultType() == search::Result::Type::Feature;
+
+    SearchMarkPoint * mark = nullptr;
     if (isFeature)
-      mark->SetFoundFeature(r.GetFeatureID());
+    {
+      auto const oldIt = oldMarks.find(r.GetFeatureID());
+      if (oldIt != oldMarks.end())
+      {
+        mark = editSession.GetMarkForEdit<SearchMarkPoint>(oldIt->second);
+        oldMarks.erase(oldIt);
+      }
+    }
+    if (mark == nullptr)
+    {
+      mark = editSession.CreateUserMark<SearchMarkPoint>(r.GetFeatureCenter());
+      if (isFeature)
+        mark->SetFoundFeature(r.GetFeatureID());
+    }
 
     mark->SetMatchedName(r.GetString());
 
+    // All the attributes are set unconditionally: for a reused mark this
+    // resets the values which are absent in the new result.
+    auto type = SearchMarkType::Default;
+    auto rating = 0.0f;
+    auto pricing = 0;
     if (r.m_metadata.m_isSponsoredHotel)
     {
-      mark->SetMarkType(SearchMarkType::Booking);
-      mark->SetRating(r.m_metadata.m_hotelRating);
-      mark->SetPricing(r.m_metadata.m_hotelPricing);
+      type = SearchMarkType::Booking;
+      rating = r.m_metadata.m_hotelRating;
+      pricing = r.m_metadata.m_hotelPricing;
     }
     else if (isFeature)
     {
       auto product = GetProductInfo(r);
       if (product.m_ugcRating != search::ProductInfo::kInvalidRating)
       {
-        mark->SetMarkType(SearchMarkType::UGC);
-        mark->SetRating(product.m_ugcRating);
+        type = SearchMarkType::UGC;
+        rating = product.m_ugcRating;
       }
     }
 
     if (isFeature && m_localAdsManager.Contains(r.GetFeatureID()))
     {
-      mark->SetMarkType(r.m_metadata.m_isSponsoredHotel ? SearchMarkType::LocalAdsBooking
-                                                        : SearchMarkType::LocalAds);
+      type = r.m_metadata.m_isSponsoredHotel ? SearchMarkType::LocalAdsBooking
+                                             : SearchMarkType::LocalAds;
     }
 
+    mark->SetMarkType(type);
+    mark->SetRating(rating);
+    mark->SetPricing(pricing);
+    mark->SetPreparing(false /* isPreparing */);
+    mark->SetSale(false /* hasSale */);
+
     if (fn)
       fn(*mark);
   }
+
+  // The results which are gone from the search are the only marks to remove.
+  for (auto const & mark : oldMarks)
+    editSession.DeleteUserMark(mark.second);
 }
 
 bool Framework::GetDistanceAndAzimut(m2::PointD const & point,
@@ -2547,10 +2632,14 @@ void Framework::Save3dMode(bool allow3d, bool allow3dBuildings)
 
 void Framework::Load3dMode(bool & allow3d, bool & allow3dBuildings)
 {
-  if (!settings::Get(kAllow3dKey, allow3d))
+  // Queried from frame-adjacent code, so the parsed values are cached.
+  static settings::CachedValue<bool> allow3dValue(kAllow3dKey);
+  static settings::CachedValue<bool> allow3dBuildingsValue(kAllow3dBuildingsKey);
+
+  if (!allow3dValue.Get(allow3d))
     allow3d = true;
 
-  if (!settings::Get(kAllow3dBuildingsKey, allow3dBuildings))
+  if (!allow3dBuildingsValue.Get(allow3dBuildings))
     allow3dBuildings = true;
 }
 
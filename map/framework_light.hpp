@@ -1,22 +1,28 @@
 #pragma once
 
-#include "map/bookmark_manager.hpp"
-#include "map/user.hpp"
-
-#include "ugc/storage.hpp"
-
 #include "storage/country_info_reader_light.hpp"
 
 #include "geometry/point2d.hpp"
 
 #include "base/assert.hpp"
 
+#include <cstddef>
 #include <memory>
 
 namespace lightweight
 {
 struct LightFrameworkTest;
 
+// The functions below are defined in the heavy parts of the map library
+// (ugc/storage.cpp, map/user.cpp, map/bookmark_manager.cpp), but they read
+// small files and settings directly, without initializing the corresponding
+// subsystems. They are declared here on purpose: this header must not drag
+// the heavy headers in, so that the users of the lightweight framework
+// (background services, JNI calls) do not pay for the full engine.
+size_t GetNumberOfUnsentUGC();
+bool IsUserAuthenticated();
+bool IsBookmarksCloudEnabled();
+
 enum RequestType
 {
   REQUEST_TYPE_EMPTY = 0u,
@@ -13,10 +13,15 @@ namespace
 {
 
 // Current file format version
-uint32_t constexpr kCurrentVersion = 1;
+uint32_t constexpr kCurrentVersion = 2;
 
-// Header size in bytes, header consists of uint32_t 'version' only
-uint32_t constexpr kHeaderSize = sizeof(uint32_t);
+// Header is uint32_t 'version' followed by uint64_t 'capacity', 'first item slot'
+// and 'item count'. The items form a ring over 'capacity' slots, so eviction of
+// the oldest items only moves the first slot instead of rewriting the file.
+uint32_t constexpr kHeaderSize = sizeof(uint32_t) + 3 * sizeof(uint64_t);
+
+// Offset of the mutable part of the header - the first item slot and the item count.
+uint32_t constexpr kIndexOffset = sizeof(uint32_t) + sizeof(uint64_t);
 
 // Number of items for batch processing
 size_t constexpr kItemBlockSize = 1000;
@@ -45,7 +50,7 @@ T MemRead(void const * ptr)
 }
 
 void Pack(char * p, location::GpsInfo const & info)
-{  
+{
   MemWrite<double>(p + 0 * sizeof(double), info.m_timestamp);
   MemWrite<double>(p + 1 * sizeof(double), info.m_latitude);
   MemWrite<double>(p + 2 * sizeof(double), info.m_longitude);
@@ -73,31 +78,41 @@ void Unpack(char const * p, location::GpsInfo & info)
   info.m_source = static_cast<location::TLocationSource>(source);
 }
 
-inline size_t GetItemOffset(size_t itemIndex)
+inline size_t GetItemOffset(size_t slot)
 {
-  return kHeaderSize + itemIndex * kPointSize;
+  return kHeaderSize + slot * kPointSize;
 }
 
-inline size_t GetItemCount(size_t fileSize)
+inline bool WriteHeader(fstream & f, uint64_t capacity, uint64_t firstSlot, uint64_t itemCount)
 {
-  ASSERT_GREATER_OR_EQUAL(fileSize, kHeaderSize, ());
-  return (fileSize - kHeaderSize) / kPointSize;
-}
-
-inline bool WriteVersion(fstream & f, uint32_t version)
-{
-  static_assert(kHeaderSize == sizeof(version), "");
-  version = SwapIfBigEndianMacroBased(version);
-  f.write(reinterpret_cast<char const *>(&version), kHeaderSize);
+  char buff[kHeaderSize];
+  MemWrite<uint32_t>(buff, kCurrentVersion);
+  MemWrite<uint64_t>(buff + sizeof(uint32_t), capacity);
+  MemWrite<uint64_t>(buff + kIndexOffset, firstSlot);
+  MemWrite<uint64_t>(buff + kIndexOffset + sizeof(uint64_t), itemCount);
+  f.seekp(0, ios::beg);
+  f.write(buff, kHeaderSize);
   return f.good();
 }
 
-inline bool ReadVersion(fstream & f, uint32_t & version)
+inline bool ReadHeader(fstream & f, uint32_t & version, uint64_t & capacity, uint64_t & firstSlot,
+                       uint64_t & itemCount)
 {
-  static_assert(kHeaderSize == sizeof(version), "");
-  f.read(reinterpret_cast<char *>(&version), kHeaderSize);
-  version = SwapIfBigEndianMacroBased(version);
-  return f.good();
+  char buff[kHeaderSize];
+  f.seekg(0, ios::beg);
+  f.read(buff, sizeof(uint32_t));
+  if (!f.good())
+    return false;
+  version = MemRead<uint32_t>(buff);
+  if (version != kCurrentVersion)
+    return true;  // the caller checks the version
+  f.read(buff + sizeof(uint32_t), kHeaderSize - sizeof(uint32_t));
+  if (!f.good())
+    return false;
+  capacity = MemRead<uint64_t>(buff + sizeof(uint32_t));
+  firstSlot = MemRead<uint64_t>(buff + kIndexOffset);
+  itemCount = MemRead<uint64_t>(buff + kIndexOffset + sizeof(uint64_t));
+  return true;
 }
 
 } // namespace
@@ -105,6 +120,7 @@ inline bool ReadVersion(fstream & f, uint32_t & version)
 GpsTrackStorage::GpsTrackStorage(string const & filePath, size_t maxItemCount)
   : m_filePath(filePath)
   , m_maxItemCount(maxItemCount)
+  , m_firstSlot(0)
   , m_itemCount(0)
 {
   ASSERT_GREATER(m_maxItemCount, 0, ());
@@ -115,25 +131,29 @@ GpsTrackStorage::GpsTrackStorage(string const & filePath, size_t maxItemCount)
   if (m_stream)
   {
     uint32_t version = 0;
-    if (!ReadVersion(m_stream, version))
-      MYTHROW(OpenException, ("Read version error.", m_filePath));
+    uint64_t capacity = 0, firstSlot = 0, itemCount = 0;
 
-    if (version == kCurrentVersion)
+    bool ok = ReadHeader(m_stream, version, capacity, firstSlot, itemCount) &&
+              version == kCurrentVersion && capacity == m_maxItemCount &&
+              firstSlot < capacity && itemCount <= capacity;
+    if (ok)
     {
-      // Seek to end to get file size
-      m_stream.seekp(0, ios::end);
-      if (!m_stream.good())
-        MYTHROW(OpenException, ("Seek to the end error.", m_filePath));
-
-      size_t const fileSize = m_stream.tellp();
-
-      m_itemCount = GetItemCount(fileSize);
+      // Check that all used slots are backed by the file.
+      m_stream.seekg(0, ios::end);
+      ok = m_stream.good();
+      if (ok)
+      {
+        size_t const fileSize = m_stream.tellg();
+        size_t const usedSlots =
+            (firstSlot + itemCount <= capacity) ? firstSlot + itemCount : capacity;
+        ok = GetItemOffset(usedSlots) <= fileSize;
+      }
+    }
 
-      // Set write position after last item position
-      size_t const offset = GetItemOffset(m_itemCount);
-      m_stream.seekp(offset, ios::beg);
-      if (!m_stream.good())
-        MYTHROW(OpenException, ("Seek to the offset error:", offset, m_filePath));
+    if (ok)
+    {
+      m_firstSlot = firstSlot;
+      m_itemCount = itemCount;
     }
     else
     {
@@ -143,17 +163,19 @@ GpsTrackStorage::GpsTrackStorage(string const & filePath, size_t maxItemCount)
     }
   }
 
-  if (!m_stream)
+  if (!m_stream.is_open())
   {
     // Create new file
+    m_stream.clear();
     m_stream.open(m_filePath, ios::in | ios::out | ios::binary | ios::trunc);
 
     if (!m_stream)
       MYTHROW(OpenException, ("Open file error.", m_filePath));
 
-    if (!WriteVersion(m_stream, kCurrentVersion))
-      MYTHROW(OpenException, ("Write version error.", m_filePath));
+    if (!WriteHeader(m_stream, m_maxItemCount, 0 /* firstSlot */, 0 /* itemCount */))
+      MYTHROW(OpenException, ("Write header error.", m_filePath));
 
+    m_firstSlot = 0;
     m_itemCount = 0;
   }
 }
@@ -165,41 +187,54 @@ void GpsTrackStorage::Append(vector<TItem> const & items)
   if (items.empty())
     return;
 
-  bool const needTrunc = (m_itemCount + items.size()) > (m_maxItemCount * 2); // see NOTE in declaration
+  // If the batch alone overflows the ring then only its last m_maxItemCount
+  // items can survive.
+  size_t i = (items.size() > m_maxItemCount) ? items.size() - m_maxItemCount : 0;
 
-  if (needTrunc)
-    TruncFile();
+  size_t slot = (m_firstSlot + m_itemCount) % m_maxItemCount;
 
-  // Write position must be after last item position
-  ASSERT_EQUAL(m_stream.tellp(), static_cast<typename fstream::pos_type>(
-                   GetItemOffset(m_itemCount)), ());
-
-  vector<char> buff(min(kItemBlockSize, items.size()) * kPointSize);
-  for (size_t i = 0; i < items.size();)
+  vector<char> buff(min(kItemBlockSize, items.size() - i) * kPointSize);
+  while (i < items.size())
   {
-    size_t const n = min(items.size() - i, kItemBlockSize);
+    // Process a contiguous run of slots, so the ring wrap is the only extra seek.
+    size_t const n = min(min(items.size() - i, kItemBlockSize), m_maxItemCount - slot);
 
     for (size_t j = 0; j < n; ++j)
       Pack(&buff[0] + j * kPointSize, items[i + j]);
 
+    m_stream.seekp(GetItemOffset(slot), ios::beg);
     m_stream.write(&buff[0], n * kPointSize);
     if (!m_stream.good())
       MYTHROW(WriteException, ("File:", m_filePath));
 
     i += n;
+    slot = (slot + n) % m_maxItemCount;
   }
 
+  size_t const total = m_itemCount + min(items.size(), m_maxItemCount);
+  if (total > m_maxItemCount)
+  {
+    // O(1) eviction: the oldest items are simply overwritten.
+    m_firstSlot = (m_firstSlot + (total - m_maxItemCount)) % m_maxItemCount;
+    m_itemCount = m_maxItemCount;
+  }
+  else
+  {
+    m_itemCount = total;
+  }
+
+  WriteIndex();
+
   m_stream.flush();
   if (!m_stream.good())
     MYTHROW(WriteException, ("File:", m_filePath));
-
-  m_itemCount += items.size();
 }
 
 void GpsTrackStorage::Clear()
 {
   ASSERT(m_stream.is_open(), ());
 
+  m_firstSlot = 0;
   m_itemCount = 0;
 
   m_stream.close();
@@ -209,112 +244,51 @@ void GpsTrackStorage::Clear()
   if (!m_stream)
     MYTHROW(WriteException, ("File:", m_filePath));
 
-  if (!WriteVersion(m_stream, kCurrentVersion))
+  if (!WriteHeader(m_stream, m_maxItemCount, 0 /* firstSlot */, 0 /* itemCount */))
     MYTHROW(WriteException, ("File:", m_filePath));
-
-  // Write position is set to the first item in the file
-  ASSERT_EQUAL(m_stream.tellp(), static_cast<typename fstream::pos_type>(
-                   GetItemOffset(0)), ());
 }
 
 void GpsTrackStorage::ForEach(std::function<bool(TItem const & item)> const & fn)
 {
   ASSERT(m_stream.is_open(), ());
 
-  size_t i = GetFirstItemIndex();
+  if (m_itemCount == 0)
+    return;
 
-  // Set read position to the first item
-  m_stream.seekg(GetItemOffset(i), ios::beg);
-  if (!m_stream.good())
-    MYTHROW(ReadException, ("File:", m_filePath));
+  size_t slot = m_firstSlot;
+  size_t remaining = m_itemCount;
 
   vector<char> buff(min(kItemBlockSize, m_itemCount) * kPointSize);
-  for (; i < m_itemCount;)
+  while (remaining > 0)
   {
-    size_t const n = min(m_itemCount - i, kItemBlockSize);
+    size_t const n = min(min(remaining, kItemBlockSize), m_maxItemCount - slot);
 
+    m_stream.seekg(GetItemOffset(slot), ios::beg);
     m_stream.read(&buff[0], n * kPointSize);
     if (!m_stream.good())
       MYTHROW(ReadException, ("File:", m_filePath));
 
     for (size_t j = 0; j < n; ++j)
-    {      
+    {
       TItem item;
       Unpack(&buff[0] + j * kPointSize, item);
       if (!fn(item))
         return;
     }
 
-    i += n;
+    slot = (slot + n) % m_maxItemCount;
+    remaining -= n;
   }
 }
 
-void GpsTrackStorage::TruncFile()
+void GpsTrackStorage::WriteIndex()
 {
-  string const tmpFilePath = m_filePath + ".tmp";
-
-  // Create a tmp file
-  fstream tmp(tmpFilePath, ios::in | ios::out | ios::binary | ios::trunc);
-
-  if (!tmp)
-    MYTHROW(WriteException, ("Unable to create temporary file:", tmpFilePath));
-
-  if (!WriteVersion(tmp, kCurrentVersion))
-    MYTHROW(WriteException, ("File:", tmpFilePath));
+  char buff[2 * sizeof(uint64_t)];
+  MemWrite<uint64_t>(buff, static_cast<uint64_t>(m_firstSlot));
+  MemWrite<uint64_t>(buff + sizeof(uint64_t), static_cast<uint64_t>(m_itemCount));
 
-  size_t i = GetFirstItemIndex();
-
-  // Set read position to the first item
-  m_stream.seekg(GetItemOffset(i), ios::beg);
+  m_stream.seekp(kIndexOffset, ios::beg);
+  m_stream.write(buff, sizeof(buff));
   if (!m_stream.good())
-    MYTHROW(ReadException, ("File:", m_filePath));
-
-  size_t newItemCount = 0;
-
-  // Copy items
-  vector<char> buff(min(kItemBlockSize, m_itemCount) * kPointSize);
-  for (; i < m_itemCount;)
-  {
-    size_t const n = min(m_itemCount - i, kItemBlockSize);
-
-    m_stream.read(&buff[0], n * kPointSize);
-    if (!m_stream.good())
-      MYTHROW(ReadException, ("File:", m_filePath));
-
-    tmp.write(&buff[0], n * kPointSize);
-    if (!tmp.good())
-      MYTHROW(WriteException, ("File:", tmpFilePath));
-
-    i += n;
-    newItemCount += n;
-  }
-  buff.clear();
-  buff.shrink_to_fit();
-
-  tmp.close();
-  m_stream.close();
-
-  // Replace file
-  if (!base::DeleteFileX(m_filePath) ||
-      !base::RenameFileX(tmpFilePath, m_filePath))
-  {
     MYTHROW(WriteException, ("File:", m_filePath));
-  }
-
-  // Reopen stream
-  m_stream.open(m_filePath, ios::in | ios::out | ios::binary | ios::ate);
-
-  if (!m_stream)
-    MYTHROW(WriteException, ("File:", m_filePath));
-
-  m_itemCount = newItemCount;
-
-  // Write position must be after last item position (end of file)
-  ASSERT_EQUAL(m_stream.tellp(), static_cast<typename fstream::pos_type>(
-                   GetItemOffset(m_itemCount)), ());
-}
-
-size_t GpsTrackStorage::GetFirstItemIndex() const
-{
-  return (m_itemCount > m_maxItemCount) ? (m_itemCount - m_maxItemCount) : 0; // see NOTE in declaration
 }
@@ -42,23 +42,19 @@ public:
 private:
   DISALLOW_COPY_AND_MOVE(GpsTrackStorage);
 
-  void TruncFile();
-  size_t GetFirstItemIndex() const;
+  /// Saves m_firstSlot and m_itemCount in the file header.
+  void WriteIndex();
 
   string const m_filePath;
   size_t const m_maxItemCount;
   fstream m_stream;
+  size_t m_firstSlot; // slot of the oldest item, read note
   size_t m_itemCount; // current number of items in file, read note
 
   // NOTE
-  // New items append to the end of file, when file become too big, it is truncated.
-  // Here 'silly window sindrome' is possible: for example max file size is 100k items,
-  // and 99k items are filled, when 2k items is coming, then 98k items is copying to the tmp file
-  // which replaces origin file, and 2k added to the new file. Next time, when 1k items
-  // is comming, then again file truncated. That means that trunc will happens every time.
-  // Similar problem in TCP called 'silly window sindrome'.
-  // To prevent that problem, max file size can be 2 x m_maxItemCount items, when current number of items m_itemCount
-  // exceed 2 x m_maxItemCount, then second half of file - m_maxItemCount items is copying to the tmp file,
-  // which replaces origin file. That means that trunc will happens only then new m_maxItemCount items will be
-  // added but not every time.
+  // The file is a ring buffer of m_maxItemCount fixed size slots after the header.
+  // New items are appended at slot (m_firstSlot + m_itemCount) % m_maxItemCount,
+  // and when the ring is full the oldest items are overwritten in place:
+  // eviction only advances m_firstSlot in the header, so the file is never
+  // copied or truncated while the track is recorded.
 };
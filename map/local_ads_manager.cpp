@@ -284,6 +284,7 @@ LocalAdsManager::LocalAdsManager(GetMwmsByRectFn && getMwmsByRectFn,
   , m_getFeatureByIdFn(std::move(getFeatureByIDFn))
   , m_isStarted(false)
   , m_bmManager(nullptr)
+  , m_featuresCacheIsEmpty(true)
 {
   CHECK(m_getMwmsByRectFn != nullptr, ());
   CHECK(m_getMwmIdByNameFn != nullptr, ());
@@ -459,6 +460,7 @@ void LocalAdsManager::ProcessRequests(std::set<Request> && requests)
   GetPlatform().RunTask(Platform::Thread::Network, [this, requests = std::move(requests)]
   {
     std::string const campaignFile = GetPath(kCampaignFile);
+    bool campaignsChanged = false;
     for (auto const & request : requests)
     {
       auto const & mwm = request.first;
@@ -491,17 +493,23 @@ void LocalAdsManager::ProcessRequests(std::set<Request> && requests)
         std::lock_guard<std::mutex> lock(m_campaignsMutex);
         m_campaigns[countryName] = true;
         m_info[countryName] = info;
+        campaignsChanged = true;
       }
       else if (type == RequestType::Delete)
       {
         std::lock_guard<std::mutex> lock(m_campaignsMutex);
         m_campaigns.erase(countryName);
-        m_info.erase(countryName);
+        if (m_info.erase(countryName) != 0)
+          campaignsChanged = true;
         ClearLocalAdsForMwm(mwm);
       }
     }
-    
-    // Save data persistently.
+
+    // Save data persistently. Failed or skipped requests must not trigger
+    // re-serialization of all cached campaigns.
+    if (!campaignsChanged)
+      return;
+
     GetPlatform().RunTask(Platform::Thread::File, [this, campaignFile]
     {
       WriteCampaignFile(campaignFile);
@@ -613,6 +621,7 @@ void LocalAdsManager::UpdateFeaturesCache(df::CustomFeatures && features)
     std::lock_guard<std::mutex> lock(m_featuresCacheMutex);
     if (!features.empty())
       m_featuresCache.insert(features.begin(), features.end());
+    m_featuresCacheIsEmpty = m_featuresCache.empty();
     featuresCache = m_featuresCache;
   }
   m_drapeEngine.SafeCall(&df::DrapeEngine::SetCustomFeatures, std::move(featuresCache));
@@ -630,6 +639,7 @@ void LocalAdsManager::ClearLocalAdsForMwm(MwmSet::MwmId const & mwmId)
       else
         ++it;
     }
+    m_featuresCacheIsEmpty = m_featuresCache.empty();
   }
 
   // Remove custom features in graphics engine.
@@ -641,6 +651,9 @@ void LocalAdsManager::ClearLocalAdsForMwm(MwmSet::MwmId const & mwmId)
 
 bool LocalAdsManager::Contains(FeatureID const & featureId) const
 {
+  if (m_featuresCacheIsEmpty)
+    return false;
+
   std::lock_guard<std::mutex> lock(m_featuresCacheMutex);
   return m_featuresCache.find(featureId) != m_featuresCache.cend();
 }
@@ -689,6 +702,7 @@ void LocalAdsManager::OnSubscriptionChanged(SubscriptionType type, bool isActive
       {
         std::lock_guard<std::mutex> lock(m_featuresCacheMutex);
         m_featuresCache.clear();
+        m_featuresCacheIsEmpty = true;
       }
 
       // Clear all graphics.
@@ -116,6 +116,9 @@ private:
 
   df::CustomFeatures m_featuresCache;
   mutable std::mutex m_featuresCacheMutex;
+  // Cheap pre-filter for Contains(): the common case of a device without
+  // a single local ads campaign skips the mutex and the cache lookup.
+  std::atomic<bool> m_featuresCacheIsEmpty;
 
   ftypes::HashSetMatcher<uint32_t> m_supportedTypes;
 
@@ -9,7 +9,7 @@
 
 #include "routing/checkpoint_predictor.hpp"
 #include "routing/index_router.hpp"
-#include "routing/online_absent_fetcher.hpp"
+#include "routing/absent_countries_fetcher.hpp"
 #include "routing/route.hpp"
 #include "routing/routing_helpers.hpp"
 
@@ -408,13 +408,20 @@ void RoutingManager::SetRouterImpl(RouterType type)
     return m_callbacks.m_countryInfoGetter().GetLimitRectForLeaf(countryId);
   };
 
-  auto fetcher = make_unique<OnlineAbsentCountriesFetcher>(countryFileGetter, localFileChecker);
+  auto const countryFileBatchGetter = [this](vector<m2::PointD> const & points,
+                                             vector<string> & countries) {
+    m_callbacks.m_countryInfoGetter().GetRegionCountryIds(points, countries);
+  };
+
+  auto fetcher = make_unique<AbsentCountriesFetcher>(countryFileGetter, localFileChecker,
+                                                           countryFileBatchGetter);
   auto router = make_unique<IndexRouter>(vehicleType, m_loadAltitudes, m_callbacks.m_countryParentNameGetterFn,
                                          countryFileGetter, getMwmRectByName, numMwmIds,
                                          MakeNumMwmTree(*numMwmIds, m_callbacks.m_countryInfoGetter()),
                                          m_routingSession, dataSource);
 
   m_routingSession.SetRoutingSettings(GetRoutingSettings(vehicleType));
+  m_routingSession.SetNumMwmIds(numMwmIds);
   m_routingSession.SetRouter(move(router), move(fetcher));
   m_currentRouterType = type;
 }
@@ -1057,8 +1064,13 @@ bool RoutingManager::IsTrackingReporterEnabled() const
   if (!m_routingSession.IsFollowing())
     return false;
 
+  // Queried on every location update, so the parsed value is cached.
+  static settings::CachedValue<bool> enableTrackingValue(
+      tracking::Reporter::kEnableTrackingKey);
+
   bool enableTracking = true;
-  settings::TryGet(tracking::Reporter::kEnableTrackingKey, enableTracking);
+  if (!enableTrackingValue.Get(enableTracking))
+    enableTracking = true;
 
   return enableTracking;
 }
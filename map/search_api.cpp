@@ -35,6 +35,18 @@ using BookmarkIdDoc = pair<bookmarks::Id, bookmarks::Doc>;
 
 double const kDistEqualQueryMeters = 100.0;
 
+// A pan that is small relative to the viewport does not noticeably change
+// the set of covered features, so such pans do not restart a search.
+// Without the relative part every minor pan at low zoom levels would cost
+// a full research, although the geometry and token caches of the
+// processor make its results identical to the displayed ones.
+double const kDistEqualQueryViewportFraction = 0.05;
+
+// Safety net for pathological interactive queries: a query that is
+// still running after this long returns what has been found so far
+// instead of blocking the search session, see SearchParams::m_timeoutSec.
+double const kInteractiveSearchTimeoutSec = 10.0;
+
 // Cancels search query by |handle|.
 void CancelQuery(weak_ptr<ProcessorHandle> & handle)
 {
@@ -166,6 +178,7 @@ bool SearchAPI::SearchEverywhere(EverywhereSearchParams const & params)
   p.m_needAddress = true;
   p.m_needHighlighting = true;
   p.m_hotelsFilter = params.m_hotelsFilter;
+  p.m_timeoutSec = kInteractiveSearchTimeoutSec;
 
   p.m_onResults = EverywhereSearchCallback(
       static_cast<EverywhereSearchCallback::Delegate &>(*this),
@@ -201,6 +214,7 @@ bool SearchAPI::SearchInViewport(ViewportSearchParams const & params)
   p.m_needAddress = false;
   p.m_needHighlighting = false;
   p.m_hotelsFilter = params.m_hotelsFilter;
+  p.m_timeoutSec = kInteractiveSearchTimeoutSec;
 
   p.m_onStarted = [this, params] {
     if (params.m_onStarted)
@@ -406,11 +420,15 @@ bool SearchAPI::QueryMayBeSkipped(SearchParams const & prevParams,
   if (!prevParams.IsEqualCommon(currParams))
     return false;
 
-  if (!prevViewport.IsValid() ||
-      !IsEqualMercator(prevViewport, currViewport, kDistEqualQueryMeters))
-  {
+  if (!prevViewport.IsValid())
+    return false;
+
+  double const viewportDiagonalMeters =
+      MercatorBounds::DistanceOnEarth(currViewport.LeftTop(), currViewport.RightBottom());
+  double const epsMeters =
+      max(kDistEqualQueryMeters, kDistEqualQueryViewportFraction * viewportDiagonalMeters);
+  if (!IsEqualMercator(prevViewport, currViewport, epsMeters))
     return false;
-  }
 
   if (prevParams.m_position && currParams.m_position &&
       MercatorBounds::DistanceOnEarth(*prevParams.m_position, *currParams.m_position) >
@@ -29,19 +29,12 @@ m2::RectD Track::GetLimitRect() const
 
 double Track::GetLengthMeters() const
 {
-  double res = 0.0;
+  std::vector<ms::LatLon> latLons;
+  MercatorBounds::ToLatLon(m_data.m_points, latLons);
 
-  auto it = m_data.m_points.begin();
-  double lat1 = MercatorBounds::YToLat(it->y);
-  double lon1 = MercatorBounds::XToLon(it->x);
-  for (++it; it != m_data.m_points.end(); ++it)
-  {
-    double const lat2 = MercatorBounds::YToLat(it->y);
-    double const lon2 = MercatorBounds::XToLon(it->x);
-    res += ms::DistanceOnEarth(lat1, lon1, lat2, lon2);
-    lat1 = lat2;
-    lon1 = lon2;
-  }
+  double res = 0.0;
+  for (size_t i = 1; i < latLons.size(); ++i)
+    res += ms::DistanceOnEarth(latLons[i - 1], latLons[i]);
 
   return res;
 }
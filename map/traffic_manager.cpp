@@ -128,6 +128,7 @@ void TrafficManager::Clear()
   m_activeRoutingMwms.clear();
   m_requestedMwms.clear();
   m_trafficETags.clear();
+  m_trafficKeys.clear();
 }
 
 void TrafficManager::SetDrapeEngine(ref_ptr<df::DrapeEngine> engine)
@@ -249,15 +250,36 @@ void TrafficManager::ThreadRoutine()
       if (!mwm.IsAlive())
         continue;
 
-      traffic::TrafficInfo info(mwm, m_currentDataVersion);
-
       string tag;
+      vector<traffic::TrafficInfo::RoadSegmentId> keys;
       {
         lock_guard<mutex> lock(m_mutex);
         tag = m_trafficETags[mwm];
+        auto const it = m_trafficKeys.find(mwm);
+        if (it != m_trafficKeys.end())
+        {
+          keys = move(it->second);
+          m_trafficKeys.erase(it);
+        }
       }
 
-      if (info.ReceiveTrafficData(tag))
+      // The keys are decoded from the mwm section only on the first request;
+      // afterwards they round-trip through m_trafficKeys between the cycles.
+      traffic::TrafficInfo info =
+          keys.empty() ? traffic::TrafficInfo(mwm, m_currentDataVersion)
+                       : traffic::TrafficInfo(mwm, m_currentDataVersion, move(keys));
+
+      bool const received = info.ReceiveTrafficData(tag);
+
+      {
+        lock_guard<mutex> lock(m_mutex);
+        m_trafficETags[mwm] = tag;
+        keys = info.TakeKeys();
+        if (!keys.empty())
+          m_trafficKeys[mwm] = move(keys);
+      }
+
+      if (received)
       {
         OnTrafficDataResponse(move(info));
       }
@@ -266,11 +288,6 @@ void TrafficManager::ThreadRoutine()
         LOG(LWARNING, ("Traffic request failed. Mwm =", mwm));
         OnTrafficRequestFailed(move(info));
       }
-
-      {
-        lock_guard<mutex> lock(m_mutex);
-        m_trafficETags[mwm] = tag;
-      }
     }
     mwms.clear();
   }
@@ -457,6 +474,7 @@ void TrafficManager::ClearCache(MwmSet::MwmId const & mwmId)
   }
   m_mwmCache.erase(it);
   m_trafficETags.erase(mwmId);
+  m_trafficKeys.erase(mwmId);
   m_activeDrapeMwms.erase(mwmId);
   m_activeRoutingMwms.erase(mwmId);
   m_lastDrapeMwmsByRect.clear();
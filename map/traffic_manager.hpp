@@ -176,6 +176,11 @@ private:
   // which allows a client to make conditional requests.
   map<MwmSet::MwmId, string> m_trafficETags;
 
+  // Keys decoded from the traffic section of each mwm. They are constant
+  // for an mwm's lifetime, so they are kept here between the update cycles
+  // instead of being re-read from disk every time.
+  map<MwmSet::MwmId, vector<traffic::TrafficInfo::RoadSegmentId>> m_trafficKeys;
+
   atomic<bool> m_isPaused;
 
   vector<MwmSet::MwmId> m_requestedMwms;
@@ -187,16 +187,10 @@ void TransitReadManager::EnableTransitSchemeMode(bool enable)
   if (m_isSchemeModeBlocked)
     return;
 
-  if (!m_isSchemeMode)
-  {
-    m_lastActiveMwms.clear();
-    m_mwmCache.clear();
-    m_cacheSize = 0;
-  }
-  else
-  {
+  // The cache of read transit data is kept on disabling, so toggling the
+  // layer back on does not reread and rebuild schemes of the same mwms.
+  if (m_isSchemeMode)
     Invalidate();
-  }
 }
 
 void TransitReadManager::BlockTransitSchemeMode(bool isBlocked)
@@ -35,6 +35,7 @@
 #include "base/timer.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <functional>
@@ -423,17 +424,29 @@ template <typename Decoder, typename Stats>
 void OpenLRDecoder::Decode(vector<LinearSegment> const & segments,
                            uint32_t const numThreads, vector<DecodedPath> & paths)
 {
-  auto const worker = [&segments, &paths, numThreads, this](size_t threadNum, DataSource const & dataSource,
+  // Batches are taken from a shared counter instead of being assigned to the
+  // threads statically: decoding costs vary a lot between segments (number of
+  // LRPs, candidates, failed routes), so with a static assignment the whole
+  // run waits for the unluckiest thread at the tail.
+  atomic<size_t> nextBatch(0);
+  auto const worker = [&segments, &paths, &nextBatch, this](size_t threadNum,
+                                                            DataSource const & dataSource,
                                                             Stats & stat) {
     size_t constexpr kBatchSize = GetOptimalBatchSize();
     size_t constexpr kProgressFrequency = 100;
 
     size_t const numSegments = segments.size();
+    size_t const numBatches = (numSegments + kBatchSize - 1) / kBatchSize;
 
     Decoder decoder(dataSource, make_unique<CarModelFactory>(m_countryParentNameGetter));
     base::Timer timer;
-    for (size_t i = threadNum * kBatchSize; i < numSegments; i += numThreads * kBatchSize)
+    while (true)
     {
+      size_t const batch = nextBatch.fetch_add(1);
+      if (batch >= numBatches)
+        break;
+
+      size_t const i = batch * kBatchSize;
       for (size_t j = i; j < numSegments && j < i + kBatchSize; ++j)
       {
         if (!decoder.DecodeSegment(segments[j], paths[j], stat))
@@ -11,12 +11,18 @@
 
 namespace downloader
 {
+namespace
+{
+uint32_t constexpr kFnvBasis = 0x811C9DC5;
+uint32_t constexpr kFnvPrime = 16777619;
+}  // namespace
 
-ChunksDownloadStrategy::ChunksDownloadStrategy(vector<string> const & urls)
+ChunksDownloadStrategy::ChunksDownloadStrategy(vector<string> const & urls, size_t streamsPerServer)
 {
   // init servers list
   for (size_t i = 0; i < urls.size(); ++i)
-    m_servers.push_back(ServerT(urls[i], SERVER_READY));
+    for (size_t j = 0; j < max(streamsPerServer, size_t(1)); ++j)
+      m_servers.push_back(ServerT(urls[i], SERVER_READY));
 }
 
 pair<ChunksDownloadStrategy::ChunkT *, int>
@@ -36,12 +42,31 @@ ChunksDownloadStrategy::GetChunk(RangeT const & range)
   }
 }
 
+bool ChunksDownloadStrategy::IsChunksListConsistent(int64_t fileSize) const
+{
+  if (m_chunks.size() < 2 || m_chunks.back().m_pos != fileSize ||
+      m_chunks.back().m_status != CHUNK_AUX)
+  {
+    return false;
+  }
+
+  for (size_t i = 1; i < m_chunks.size(); ++i)
+  {
+    if (m_chunks[i-1].m_pos >= m_chunks[i].m_pos)
+      return false;
+  }
+  return true;
+}
+
 void ChunksDownloadStrategy::InitChunks(int64_t fileSize, int64_t chunkSize, ChunkStatusT status)
 {
+  m_chunks.clear();
   m_chunks.reserve(fileSize / chunkSize + 2);
   for (int64_t i = 0; i < fileSize; i += chunkSize)
     m_chunks.push_back(ChunkT(i, status));
   m_chunks.push_back(ChunkT(fileSize, CHUNK_AUX));
+
+  m_checksums.assign(m_chunks.size(), 0);
 }
 
 void ChunksDownloadStrategy::AddChunk(RangeT const & range, ChunkStatusT status)
@@ -61,6 +86,90 @@ void ChunksDownloadStrategy::AddChunk(RangeT const & range, ChunkStatusT status)
   m_chunks.push_back(ChunkT(range.second + 1, CHUNK_AUX));
 }
 
+// static
+uint32_t ChunksDownloadStrategy::InitChecksum()
+{
+  return kFnvBasis;
+}
+
+// static
+uint32_t ChunksDownloadStrategy::UpdateChecksum(uint32_t checksum, void const * data, size_t size)
+{
+  unsigned char const * p = static_cast<unsigned char const *>(data);
+  for (size_t i = 0; i < size; ++i)
+  {
+    checksum ^= p[i];
+    checksum *= kFnvPrime;
+  }
+  return checksum;
+}
+
+void ChunksDownloadStrategy::SetChunkChecksum(RangeT const & range, uint32_t checksum)
+{
+  pair<ChunkT *, int> const res = GetChunk(range);
+  if (res.first)
+  {
+    if (m_checksums.size() < m_chunks.size())
+      m_checksums.resize(m_chunks.size(), 0);
+    m_checksums[res.second] = checksum;
+  }
+}
+
+int64_t ChunksDownloadStrategy::ValidateDownloadedChunks(string const & dataFile)
+{
+  int64_t downloadedSize = 0;
+  try
+  {
+    FileReader r(dataFile);
+    vector<char> buffer;
+    for (size_t i = 0; i + 1 < m_chunks.size(); ++i)
+    {
+      if (m_chunks[i].m_status != CHUNK_COMPLETE)
+        continue;
+
+      int64_t const chunkSize = m_chunks[i+1].m_pos - m_chunks[i].m_pos;
+      // Zero checksum means "not stored" (e.g. resume data from an older
+      // version); trust such chunks the way it worked before.
+      if (i < m_checksums.size() && m_checksums[i] != 0)
+      {
+        uint32_t checksum = InitChecksum();
+        int64_t pos = m_chunks[i].m_pos;
+        int64_t left = chunkSize;
+        while (left > 0)
+        {
+          size_t const portion = static_cast<size_t>(min(left, int64_t(64 * 1024)));
+          buffer.resize(portion);
+          r.Read(pos, &buffer[0], portion);
+          checksum = UpdateChecksum(checksum, &buffer[0], portion);
+          pos += portion;
+          left -= portion;
+        }
+
+        if (checksum != m_checksums[i])
+        {
+          LOG(LWARNING, ("Chunk checksum mismatch, will download again chunk at", m_chunks[i].m_pos));
+          m_chunks[i].m_status = CHUNK_FREE;
+          m_checksums[i] = 0;
+          continue;
+        }
+      }
+
+      downloadedSize += chunkSize;
+    }
+  }
+  catch (FileReader::Exception const & e)
+  {
+    LOG(LWARNING, ("Can't validate downloaded chunks:", e.Msg()));
+    for (size_t i = 0; i + 1 < m_chunks.size(); ++i)
+    {
+      if (m_chunks[i].m_status == CHUNK_COMPLETE)
+        m_chunks[i].m_status = CHUNK_FREE;
+    }
+    return 0;
+  }
+  return downloadedSize;
+}
+
 void ChunksDownloadStrategy::SaveChunks(int64_t fileSize, string const & fName)
 {
   if (!m_chunks.empty())
@@ -71,6 +180,10 @@ void ChunksDownloadStrategy::SaveChunks(int64_t fileSize, string const & fName)
       WriteVarInt(w, fileSize);
 
       w.Write(&m_chunks[0], sizeof(ChunkT) * m_chunks.size());
+
+      if (m_checksums.size() < m_chunks.size())
+        m_checksums.resize(m_chunks.size(), 0);
+      w.Write(&m_checksums[0], sizeof(uint32_t) * m_checksums.size());
       return;
     }
     catch (FileWriter::Exception const & e)
@@ -97,26 +210,37 @@ int64_t ChunksDownloadStrategy::LoadOrInitChunks(string const & fName, int64_t f
     int64_t const readSize = ReadVarInt<int64_t>(src);
     if (readSize == fileSize)
     {
-      // Load chunks.
+      // Load chunks with their checksums. Files saved by older versions have
+      // another record size and fail the consistency check below, falling
+      // back to a fresh chunks list.
       uint64_t const size = src.Size();
-      int const stSize = sizeof(ChunkT);
+      size_t const stSize = sizeof(ChunkT) + sizeof(uint32_t);
       size_t const count = size / stSize;
-      ASSERT_EQUAL(size, stSize * count, ());
-
-      m_chunks.resize(count);
-      src.Read(&m_chunks[0], stSize * count);
 
-      // Reset status "downloading" to "free".
-      int64_t downloadedSize = 0;
-      for (size_t i = 0; i < count-1; ++i)
+      if (count > 0 && size == stSize * count)
       {
-        if (m_chunks[i].m_status != CHUNK_COMPLETE)
-          m_chunks[i].m_status = CHUNK_FREE;
-        else
-          downloadedSize += (m_chunks[i+1].m_pos - m_chunks[i].m_pos);
+        m_chunks.resize(count);
+        src.Read(&m_chunks[0], sizeof(ChunkT) * count);
+        m_checksums.resize(count);
+        src.Read(&m_checksums[0], sizeof(uint32_t) * count);
+
+        if (IsChunksListConsistent(fileSize))
+        {
+          // Reset status "downloading" to "free".
+          int64_t downloadedSize = 0;
+          for (size_t i = 0; i < count-1; ++i)
+          {
+            if (m_chunks[i].m_status != CHUNK_COMPLETE)
+              m_chunks[i].m_status = CHUNK_FREE;
+            else
+              downloadedSize += (m_chunks[i+1].m_pos - m_chunks[i].m_pos);
+          }
+
+          return downloadedSize;
+        }
       }
 
-      return downloadedSize;
+      LOG(LWARNING, ("Corrupted or obsolete resume file", fName));
     }
   }
   catch (FileReader::Exception const & e)
@@ -33,6 +33,9 @@ private:
 #pragma pack(pop)
 
   vector<ChunkT> m_chunks;
+  /// FNV-1a of every downloaded chunk, parallel to m_chunks (the aux slot is
+  /// unused). Zero means "not stored" and such chunks are trusted on resume.
+  vector<uint32_t> m_checksums;
 
   static const int SERVER_READY = -1;
   struct ServerT
@@ -57,8 +60,14 @@ private:
   /// @return Chunk pointer and it's index for given file offsets range.
   pair<ChunkT *, int> GetChunk(RangeT const & range);
 
+  /// Sanity check for a loaded chunks list.
+  bool IsChunksListConsistent(int64_t fileSize) const;
+
 public:
-  ChunksDownloadStrategy(vector<string> const & urls);
+  /// Each mirror is represented by streamsPerServer independent entries, so
+  /// several range requests run against it in parallel. A failed chunk still
+  /// removes only one entry, degrading a bad mirror gradually.
+  ChunksDownloadStrategy(vector<string> const & urls, size_t streamsPerServer = 1);
 
   /// Init chunks vector for fileSize.
   void InitChunks(int64_t fileSize, int64_t chunkSize, ChunkStatusT status = CHUNK_FREE);
@@ -66,6 +75,18 @@ public:
   /// Used in unit tests only!
   void AddChunk(RangeT const & range, ChunkStatusT status);
 
+  /// Streaming FNV-1a checksum of chunk contents.
+  static uint32_t InitChecksum();
+  static uint32_t UpdateChecksum(uint32_t checksum, void const * data, size_t size);
+
+  /// Remembers checksum of a downloaded chunk to be saved with the chunks.
+  void SetChunkChecksum(RangeT const & range, uint32_t checksum);
+
+  /// Rechecks completed chunks of |dataFile| against stored checksums and
+  /// marks mismatched ones as free again.
+  /// @return Size of the chunks which passed the check.
+  int64_t ValidateDownloadedChunks(string const & dataFile);
+
   void SaveChunks(int64_t fileSize, string const & fName);
   /// @return Already downloaded size.
   int64_t LoadOrInitChunks(string const & fName, int64_t fileSize, int64_t chunkSize);
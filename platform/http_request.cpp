@@ -127,14 +127,26 @@ public:
 class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
 {
   ChunksDownloadStrategy m_strategy;
-  typedef pair<HttpThread *, int64_t> ThreadHandleT;
+  struct ThreadHandleT
+  {
+    ThreadHandleT(HttpThread * thread, int64_t beg, int64_t end)
+      : m_thread(thread), m_begRange(beg), m_endRange(end),
+        m_checksum(ChunksDownloadStrategy::InitChecksum())
+    {
+    }
+
+    HttpThread * m_thread;
+    int64_t m_begRange;
+    int64_t m_endRange;
+    /// Accumulated checksum of the chunk being downloaded.
+    uint32_t m_checksum;
+  };
   typedef list<ThreadHandleT> ThreadsContainerT;
   ThreadsContainerT m_threads;
 
   string m_filePath;
   unique_ptr<FileWriter> m_writer;
 
-  size_t m_goodChunksCount;
   bool m_doCleanProgressFiles;
 
   ChunksDownloadStrategy::ResultT StartThreads()
@@ -146,7 +158,7 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
     {
       HttpThread * p = CreateNativeHttpThread(url, *this, range.first, range.second, m_progress.second);
       ASSERT ( p, () );
-      m_threads.push_back(make_pair(p, range.first));
+      m_threads.push_back(ThreadHandleT(p, range.first, range.second));
     }
     return result;
   }
@@ -158,7 +170,7 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
     ThreadByPos(int64_t pos) : m_pos(pos) {}
     inline bool operator() (ThreadHandleT const & p) const
     {
-      return (p.second == m_pos);
+      return (p.m_begRange == m_pos);
     }
   };
 
@@ -168,7 +180,7 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
                                              ThreadByPos(begRange));
     if (it != m_threads.end())
     {
-      HttpThread * p = it->first;
+      HttpThread * p = it->m_thread;
       m_threads.erase(it);
       DeleteNativeHttpThread(p);
     }
@@ -187,6 +199,16 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
     {
       m_writer->Seek(offset);
       m_writer->Write(buffer, size);
+
+      // Accumulate the chunk checksum; writes inside one chunk arrive in order.
+      for (ThreadsContainerT::iterator it = m_threads.begin(); it != m_threads.end(); ++it)
+      {
+        if (offset >= it->m_begRange && offset <= it->m_endRange)
+        {
+          it->m_checksum = ChunksDownloadStrategy::UpdateChecksum(it->m_checksum, buffer, size);
+          break;
+        }
+      }
       return true;
     }
     catch (Writer::Exception const & e)
@@ -220,6 +242,13 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
 #endif
 
     bool const isChunkOk = (httpOrErrorCode == 200);
+    if (isChunkOk)
+    {
+      ThreadsContainerT::iterator const it = find_if(m_threads.begin(), m_threads.end(),
+                                                     ThreadByPos(begRange));
+      if (it != m_threads.end())
+        m_strategy.SetChunkChecksum(make_pair(begRange, endRange), it->m_checksum);
+    }
     string const urlError = m_strategy.ChunkFinished(isChunkOk, make_pair(begRange, endRange));
 
     // remove completed chunk from the list, beg is the key
@@ -248,13 +277,10 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
     else if (result == ChunksDownloadStrategy::EDownloadSucceeded)
       m_status = Status::Completed;
 
-    if (isChunkOk)
-    {
-      // save information for download resume
-      ++m_goodChunksCount;
-      if (m_status != Status::Completed && m_goodChunksCount % 10 == 0)
-        SaveResumeChunks();
-    }
+    // Save information for download resume after every chunk, so a restart
+    // loses one in-flight chunk per stream at most.
+    if (isChunkOk && m_status != Status::Completed)
+      SaveResumeChunks();
 
     if (m_status == Status::InProgress)
       return;
@@ -301,9 +327,9 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
 public:
   FileHttpRequest(vector<string> const & urls, string const & filePath, int64_t fileSize,
                   Callback const & onFinish, Callback const & onProgress,
-                  int64_t chunkSize, bool doCleanProgressFiles)
-    : HttpRequest(onFinish, onProgress), m_strategy(urls), m_filePath(filePath),
-      m_goodChunksCount(0), m_doCleanProgressFiles(doCleanProgressFiles)
+                  int64_t chunkSize, bool doCleanProgressFiles, size_t streamsPerServer)
+    : HttpRequest(onFinish, onProgress), m_strategy(urls, streamsPerServer), m_filePath(filePath),
+      m_doCleanProgressFiles(doCleanProgressFiles)
   {
     ASSERT ( !urls.empty(), () );
 
@@ -319,7 +345,12 @@ public:
       uint64_t size;
       if (base::GetFileSize(filePath + DOWNLOADING_FILE_EXTENSION, size) &&
               size <= static_cast<uint64_t>(fileSize))
+      {
         openMode = FileWriter::OP_WRITE_EXISTING;
+        // Chunks which fail the checksum check are downloaded again.
+        m_progress.first =
+            m_strategy.ValidateDownloadedChunks(filePath + DOWNLOADING_FILE_EXTENSION);
+      }
       else
         m_strategy.InitChunks(fileSize, chunkSize);
     }
@@ -341,7 +372,7 @@ public:
     // can produce final notifications to this->OnFinish().
     while (!m_threads.empty())
     {
-      HttpThread * p = m_threads.back().first;
+      HttpThread * p = m_threads.back().m_thread;
       m_threads.pop_back();
       DeleteNativeHttpThread(p);
     }
@@ -390,11 +421,13 @@ HttpRequest * HttpRequest::PostJson(string const & url, string const & postData,
 HttpRequest * HttpRequest::GetFile(vector<string> const & urls,
                                    string const & filePath, int64_t fileSize,
                                    Callback const & onFinish, Callback const & onProgress,
-                                   int64_t chunkSize, bool doCleanOnCancel)
+                                   int64_t chunkSize, bool doCleanOnCancel,
+                                   size_t streamsPerServer)
 {
   try
   {
-    return new FileHttpRequest(urls, filePath, fileSize, onFinish, onProgress, chunkSize, doCleanOnCancel);
+    return new FileHttpRequest(urls, filePath, fileSize, onFinish, onProgress, chunkSize,
+                               doCleanOnCancel, streamsPerServer);
   }
   catch (FileWriter::Exception const & e)
   {
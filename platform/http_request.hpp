@@ -62,12 +62,15 @@ public:
 
   /// Download file to filePath.
   /// @param[in]  fileSize  Correct file size (needed for resuming and reserving).
+  /// @param[in]  streamsPerServer  How many chunks are downloaded from each
+  ///                               mirror in parallel.
   static HttpRequest * GetFile(vector<string> const & urls,
                                string const & filePath, int64_t fileSize,
                                Callback const & onFinish,
                                Callback const & onProgress = Callback(),
                                int64_t chunkSize = 512 * 1024,
-                               bool doCleanOnCancel = true);
+                               bool doCleanOnCancel = true,
+                               size_t streamsPerServer = 4);
 };
 
 string DebugPrint(HttpRequest::Status status);
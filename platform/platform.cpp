@@ -22,6 +22,14 @@ using namespace std;
 
 namespace
 {
+// Tasks on Thread::Network are blocking http round trips. Several consumers
+// (downloader metaserver, diff scheme, partners apis, user stats) post their
+// requests on application start, and with a single thread they are executed
+// strictly one after another, each paying a full TLS handshake. A small pool
+// lets independent requests overlap; flows which need ordering chain their
+// requests via callbacks and are not affected.
+size_t constexpr kNetworkThreadsCount = 4;
+
 bool IsSpecialDirName(string const & dirName)
 {
   return dirName == "." || dirName == "..";
@@ -283,9 +291,13 @@ void Platform::ShutdownThreads()
 void Platform::RunThreads()
 {
   ASSERT(!m_networkThread && !m_fileThread && !m_backgroundThread, ());
-  m_networkThread = make_unique<base::WorkerThread>();
+  m_networkThread = make_unique<base::WorkerThread>(kNetworkThreadsCount);
   m_fileThread = make_unique<base::WorkerThread>();
-  m_backgroundThread = make_unique<base::WorkerThread>();
+  // Background tasks (statistics uploads, cloud synchronization and the
+  // like) must not compete for cpu time with rendering and interactive
+  // threads.
+  m_backgroundThread =
+      make_unique<base::WorkerThread>(1 /* threadsCount */, threads::ThreadPriority::Background);
 }
 
 string DebugPrint(Platform::EError err)
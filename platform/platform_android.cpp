@@ -99,6 +99,9 @@ unique_ptr<ModelReader> Platform::GetReader(string const & file, string const &
 
   uint32_t const logPageSize = (ext == DATA_FILE_EXTENSION) ? READER_CHUNK_LOG_SIZE : 10;
   uint32_t const logPageCount = (ext == DATA_FILE_EXTENSION) ? READER_CHUNK_LOG_COUNT : 4;
+  // Map files are immutable while registered, so concurrent readers
+  // share one page cache instead of each keeping a copy of the same pages.
+  bool const sharedCache = (ext == DATA_FILE_EXTENSION);
 
   SourceT sources[SOURCE_COUNT];
   size_t n = 0;
@@ -139,6 +142,8 @@ unique_ptr<ModelReader> Platform::GetReader(string const & file, string const &
       {
         try
         {
+          if (auto reader = ZipFileReader::CreateMmapReaderIfStored(m_extResFiles[j], file))
+            return reader;
           return make_unique<ZipFileReader>(m_extResFiles[j], file, logPageSize, logPageCount);
         }
         catch (Reader::OpenException const &)
@@ -151,7 +156,7 @@ unique_ptr<ModelReader> Platform::GetReader(string const & file, string const &
     {
       string const path = m_writableDir + file;
       if (IsFileExistsByFullPath(path))
-        return make_unique<FileReader>(path, logPageSize, logPageCount);
+        return make_unique<FileReader>(path, logPageSize, logPageCount, sharedCache);
       break;
     }
 
@@ -159,19 +164,23 @@ unique_ptr<ModelReader> Platform::GetReader(string const & file, string const &
     {
       string const path = m_settingsDir + file;
       if (IsFileExistsByFullPath(path))
-        return make_unique<FileReader>(path, logPageSize, logPageCount);
+        return make_unique<FileReader>(path, logPageSize, logPageCount, sharedCache);
       break;
     }
 
     case FULL_PATH:
       if (IsFileExistsByFullPath(file))
-        return make_unique<FileReader>(file, logPageSize, logPageCount);
+        return make_unique<FileReader>(file, logPageSize, logPageCount, sharedCache);
       break;
 
     case RESOURCE:
       ASSERT_EQUAL(file.find("assets/"), string::npos, ());
       try
       {
+        // Resources are read straight from the apk: stored entries
+        // (fonts, styles) are mapped in place without copying.
+        if (auto reader = ZipFileReader::CreateMmapReaderIfStored(m_resourcesDir, "assets/" + file))
+          return reader;
         return make_unique<ZipFileReader>(m_resourcesDir, "assets/" + file, logPageSize, logPageCount);
       }
       catch (Reader::OpenException const & e)
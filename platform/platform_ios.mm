@@ -5,6 +5,7 @@
 #include "platform/platform_unix_impl.hpp"
 #include "platform/settings.hpp"
 
+#include "coding/file_name_utils.hpp"
 #include "coding/file_reader.hpp"
 
 #include <utility>
@@ -119,8 +120,11 @@ bool Platform::GetFileSizeByName(std::string const & fileName, uint64_t & size)
 
 unique_ptr<ModelReader> Platform::GetReader(std::string const & file, std::string const & searchScope) const
 {
+  // Map files are immutable while registered, so concurrent readers
+  // share one page cache instead of each keeping a copy of the same pages.
+  bool const sharedCache = (base::GetFileExtension(file) == DATA_FILE_EXTENSION);
   return make_unique<FileReader>(ReadPathForFile(file, searchScope), READER_CHUNK_LOG_SIZE,
-                                 READER_CHUNK_LOG_COUNT);
+                                 READER_CHUNK_LOG_COUNT, sharedCache);
 }
 
 int Platform::VideoMemoryLimit() const { return 8 * 1024 * 1024; }
@@ -3,6 +3,7 @@
 #include "platform/platform.hpp"
 #include "platform/settings.hpp"
 
+#include "coding/file_name_utils.hpp"
 #include "coding/file_reader.hpp"
 
 #include "base/logging.hpp"
@@ -19,8 +20,11 @@
 
 unique_ptr<ModelReader> Platform::GetReader(string const & file, string const & searchScope) const
 {
+  // Map files are immutable while registered, so concurrent readers
+  // share one page cache instead of each keeping a copy of the same pages.
+  bool const sharedCache = (base::GetFileExtension(file) == DATA_FILE_EXTENSION);
   return make_unique<FileReader>(ReadPathForFile(file, searchScope),
-                                 READER_CHUNK_LOG_SIZE, READER_CHUNK_LOG_COUNT);
+                                 READER_CHUNK_LOG_SIZE, READER_CHUNK_LOG_COUNT, sharedCache);
 }
 
 bool Platform::GetFileSizeByName(string const & fileName, uint64_t & size) const
@@ -0,0 +1,143 @@
+#include "platform/remote_file_reader.hpp"
+
+#include "platform/http_client.hpp"
+#include "platform/platform.hpp"
+
+#include "base/logging.hpp"
+#include "base/string_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace platform
+{
+namespace
+{
+double constexpr kRequestTimeoutInSec = 30.0;
+// Number of cached blocks is 2 ^ kLogBlockCacheSize.
+uint32_t constexpr kLogBlockCacheSize = 6;
+
+bool IsSuccessCode(int code) { return code >= 200 && code < 300; }
+
+// Header names are case-insensitive by RFC 7230 and are not normalized
+// by the platform http clients.
+bool FindHeaderNoCase(HttpClient const & request, std::string const & name, std::string & value)
+{
+  for (auto const & header : request.GetHeaders())
+  {
+    if (strings::EqualNoCase(header.first, name))
+    {
+      value = header.second;
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace
+
+// RemoteFileReader::File ------------------------------------------------------------------------
+RemoteFileReader::File::File(std::string const & url, uint64_t blockSize)
+  : m_url(url), m_blockSize(blockSize)
+{
+  CHECK_GREATER(blockSize, 0, ());
+
+  HttpClient request(m_url);
+  request.SetHttpMethod("HEAD");
+  request.SetTimeout(kRequestTimeoutInSec);
+  request.SetRawHeader("User-Agent", GetPlatform().GetAppUserAgent());
+  request.LoadHeaders(true);
+
+  std::string length;
+  if (!request.RunHttpRequest() || !IsSuccessCode(request.ErrorCode()) ||
+      !FindHeaderNoCase(request, "Content-Length", length) || !strings::to_uint64(length, m_size))
+  {
+    MYTHROW(Reader::OpenException, (m_url, request.ErrorCode()));
+  }
+
+  m_blocks.Init(kLogBlockCacheSize);
+}
+
+void RemoteFileReader::File::Read(uint64_t pos, void * p, size_t size)
+{
+  uint8_t * dst = static_cast<uint8_t *>(p);
+  while (size > 0)
+  {
+    auto const & block = GetBlock(pos / m_blockSize);
+    size_t const offset = static_cast<size_t>(pos % m_blockSize);
+    size_t const count = std::min(size, block.size() - offset);
+    memcpy(dst, block.data() + offset, count);
+    dst += count;
+    pos += count;
+    size -= count;
+  }
+}
+
+std::vector<uint8_t> const & RemoteFileReader::File::GetBlock(uint64_t blockIndex)
+{
+  bool found = false;
+  auto & block = m_blocks.Find(blockIndex, found);
+  // An empty block means a previous download of this cache slot has failed.
+  if (found && !block.empty())
+    return block;
+  block.clear();
+
+  uint64_t const beg = blockIndex * m_blockSize;
+  uint64_t const end = std::min(beg + m_blockSize, m_size) - 1;
+  CHECK_LESS_OR_EQUAL(beg, end, (m_url, m_size));
+
+  HttpClient request(m_url);
+  request.SetTimeout(kRequestTimeoutInSec);
+  request.SetRawHeader("User-Agent", GetPlatform().GetAppUserAgent());
+  request.SetRawHeader("Range",
+                       "bytes=" + strings::to_string(beg) + "-" + strings::to_string(end));
+
+  if (!request.RunHttpRequest() || !IsSuccessCode(request.ErrorCode()))
+    MYTHROW(Reader::ReadException, (m_url, beg, end, request.ErrorCode()));
+
+  auto const & response = request.ServerResponse();
+  size_t const count = static_cast<size_t>(end - beg + 1);
+  if (request.ErrorCode() == 206 && response.size() >= count)
+  {
+    block.assign(response.begin(), response.begin() + count);
+  }
+  else if (response.size() == m_size)
+  {
+    // The server has ignored the Range header and sent the whole file.
+    LOG(LWARNING, ("Range requests are not supported by the server for", m_url));
+    block.assign(response.begin() + static_cast<size_t>(beg),
+                 response.begin() + static_cast<size_t>(end + 1));
+  }
+  else
+  {
+    MYTHROW(Reader::ReadException,
+            (m_url, beg, end, request.ErrorCode(), response.size()));
+  }
+  return block;
+}
+
+// RemoteFileReader ------------------------------------------------------------------------------
+RemoteFileReader::RemoteFileReader(std::string const & url, uint64_t blockSize)
+  : ModelReader(url), m_file(std::make_shared<File>(url, blockSize)), m_offset(0)
+{
+  m_size = m_file->Size();
+}
+
+RemoteFileReader::RemoteFileReader(std::shared_ptr<File> file, uint64_t offset, uint64_t size,
+                                   std::string const & name)
+  : ModelReader(name), m_file(std::move(file)), m_offset(offset), m_size(size)
+{}
+
+void RemoteFileReader::Read(uint64_t pos, void * p, size_t size) const
+{
+  if (pos + size > m_size)
+    MYTHROW(Reader::SizeException, (GetName(), pos, size, m_size));
+  m_file->Read(m_offset + pos, p, size);
+}
+
+std::unique_ptr<Reader> RemoteFileReader::CreateSubReader(uint64_t pos, uint64_t size) const
+{
+  if (pos + size > m_size)
+    MYTHROW(Reader::SizeException, (GetName(), pos, size, m_size));
+  return std::unique_ptr<Reader>(new RemoteFileReader(m_file, m_offset + pos, size, GetName()));
+}
+}  // namespace platform
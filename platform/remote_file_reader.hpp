@@ -0,0 +1,62 @@
+#pragma once
+
+#include "coding/reader.hpp"
+
+#include "base/cache.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace platform
+{
+// Reader over a file accessible by an url, based on HTTP range requests.
+// Allows tools and services to read separate mwm sections (e.g. only the
+// routing section) directly from object storage without downloading the
+// whole file. Reads are served from a cache of fixed-size blocks, so
+// sequential access does not issue a request per Read() call.
+// Not thread-safe, as any Reader. Subreaders share the block cache with
+// the parent reader.
+class RemoteFileReader : public ModelReader
+{
+public:
+  static uint64_t constexpr kDefaultBlockSize = 1 << 17;  // 128 KB
+
+  // Requests the file size; throws Reader::OpenException if the server
+  // is unreachable or does not report the size.
+  explicit RemoteFileReader(std::string const & url, uint64_t blockSize = kDefaultBlockSize);
+
+  // Reader overrides:
+  uint64_t Size() const override { return m_size; }
+  void Read(uint64_t pos, void * p, size_t size) const override;
+  std::unique_ptr<Reader> CreateSubReader(uint64_t pos, uint64_t size) const override;
+
+private:
+  // State shared by a reader and all its subreaders.
+  class File
+  {
+  public:
+    File(std::string const & url, uint64_t blockSize);
+
+    uint64_t Size() const { return m_size; }
+    void Read(uint64_t pos, void * p, size_t size);
+
+  private:
+    // Returns the cached block with index |blockIndex|, downloading it
+    // when it is missing. Throws Reader::ReadException on failure.
+    std::vector<uint8_t> const & GetBlock(uint64_t blockIndex);
+
+    std::string const m_url;
+    uint64_t const m_blockSize;
+    uint64_t m_size = 0;
+    base::Cache<uint64_t, std::vector<uint8_t>> m_blocks;
+  };
+
+  RemoteFileReader(std::shared_ptr<File> file, uint64_t offset, uint64_t size,
+                   std::string const & name);
+
+  std::shared_ptr<File> m_file;
+  uint64_t m_offset;
+  uint64_t m_size;
+};
+}  // namespace platform
@@ -14,15 +14,28 @@
 
 #include "base/logging.hpp"
 
+#include "std/atomic.hpp"
 #include "std/cmath.hpp"
 #include "std/iostream.hpp"
 #include "std/sstream.hpp"
 
 namespace settings
 {
+namespace
+{
+atomic<uint64_t> g_version(0);
+}  // namespace
+
 char const * kLocationStateMode = "LastLocationStateMode";
 char const * kMeasurementUnits = "Units";
 
+uint64_t Version() { return g_version.load(std::memory_order_acquire); }
+
+namespace impl
+{
+void BumpVersion() { g_version.fetch_add(1, std::memory_order_release); }
+}  // namespace impl
+
 StringStorage::StringStorage() : StringStorageBase(GetPlatform().SettingsPathForFile(SETTINGS_FILE_NAME)) {}
 
 StringStorage & StringStorage::Instance()
@@ -4,6 +4,8 @@
 
 #include "base/macros.hpp"
 
+#include "std/cstdint.hpp"
+#include "std/shared_ptr.hpp"
 #include "std/string.hpp"
 
 namespace settings
@@ -43,15 +45,81 @@ void TryGet(string const & key, Value & outValue)
     UNUSED_VALUE(unused);
 }
 
+/// Number of settings modifications since the application start.
+/// Incremented on every Set/Delete/Clear; lets cached readers detect
+/// changes without taking the storage lock.
+uint64_t Version();
+
+namespace impl
+{
+void BumpVersion();
+}  // namespace impl
+
 /// Automatically saves setting to external file
 template <class Value>
 void Set(string const & key, Value const & value)
 {
   StringStorage::Instance().SetValue(key, ToString(value));
+  impl::BumpVersion();
+}
+
+inline void Delete(string const & key)
+{
+  StringStorage::Instance().DeleteKeyAndValue(key);
+  impl::BumpVersion();
 }
 
-inline void Delete(string const & key) { StringStorage::Instance().DeleteKeyAndValue(key); }
-inline void Clear() { StringStorage::Instance().Clear(); }
+inline void Clear()
+{
+  StringStorage::Instance().Clear();
+  impl::BumpVersion();
+}
+
+/// Typed cached view of a single setting for hot-path readers which query
+/// flags on timers or from the render loop. While the settings are not
+/// modified Get() costs an atomic pointer load instead of the storage
+/// lock and string parsing. Thread-safe.
+template <class Value>
+class CachedValue
+{
+public:
+  explicit CachedValue(string const & key) : m_key(key) {}
+
+  /// @return false if the setting is absent or cannot be parsed.
+  WARN_UNUSED_RESULT bool Get(Value & outValue) const
+  {
+    // The version is read before the storage: if a concurrent Set happens
+    // in between, the fresh value is tagged with the old version and the
+    // next call rereads the storage.
+    uint64_t const version = Version();
+    shared_ptr<Snapshot const> snapshot = std::atomic_load(&m_snapshot);
+    if (!snapshot || snapshot->m_version != version)
+    {
+      auto fresh = make_shared<Snapshot>();
+      fresh->m_version = version;
+      fresh->m_exists = settings::Get(m_key, fresh->m_value);
+      snapshot = fresh;
+      std::atomic_store(&m_snapshot, shared_ptr<Snapshot const>(move(fresh)));
+    }
+
+    if (!snapshot->m_exists)
+      return false;
+
+    outValue = snapshot->m_value;
+    return true;
+  }
+
+private:
+  struct Snapshot
+  {
+    uint64_t m_version = 0;
+    bool m_exists = false;
+    Value m_value = Value();
+  };
+
+  string const m_key;
+  mutable shared_ptr<Snapshot const> m_snapshot;
+};
 
 /// Use this function for running some stuff once according to date.
 /// @param[in]  date  Current date in format yymmdd.
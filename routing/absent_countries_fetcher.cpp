@@ -0,0 +1,92 @@
+#include "routing/absent_countries_fetcher.hpp"
+
+#include "geometry/mercator.hpp"
+
+#include "base/assert.hpp"
+#include "base/stl_helpers.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/cmath.hpp"
+
+namespace
+{
+// Step between samples on a checkpoint segment. A region narrower than the
+// step along the segment may be missed, which is in line with approximating
+// the route by straight segments in the first place.
+double const kSampleStepMeters = 5000.0;
+}  // namespace
+
+namespace routing
+{
+AbsentCountriesFetcher::AbsentCountriesFetcher(TCountryFileFn const & countryFileFn,
+                                               TCountryLocalFileFn const & countryLocalFileFn,
+                                               TCountryFileBatchFn const & countryFileBatchFn)
+  : m_countryFileFn(countryFileFn)
+  , m_countryLocalFileFn(countryLocalFileFn)
+  , m_countryFileBatchFn(countryFileBatchFn)
+{
+  CHECK(m_countryFileFn, ());
+  CHECK(m_countryLocalFileFn, ());
+}
+
+void AbsentCountriesFetcher::GenerateRequest(Checkpoints const & checkpoints)
+{
+  m_absentCountries.clear();
+
+  // Single mwm case.
+  if (AllPointsInSameMwm(checkpoints))
+    return;
+
+  vector<m2::PointD> points;
+  for (size_t i = 0; i < checkpoints.GetNumSubroutes(); ++i)
+  {
+    m2::PointD const from = checkpoints.GetPoint(i);
+    m2::PointD const to = checkpoints.GetPoint(i + 1);
+    auto const samplesCount = max(
+        size_t(1), static_cast<size_t>(ceil(MercatorBounds::DistanceOnEarth(from, to) /
+                                            kSampleStepMeters)));
+    for (size_t s = 0; s <= samplesCount; ++s)
+      points.push_back(from + (to - from) * (static_cast<double>(s) / samplesCount));
+  }
+
+  vector<string> names;
+  if (m_countryFileBatchFn)
+  {
+    m_countryFileBatchFn(points, names);
+  }
+  else
+  {
+    names.reserve(points.size());
+    for (auto const & point : points)
+      names.push_back(m_countryFileFn(point));
+  }
+
+  for (auto & name : names)
+  {
+    // A sample over the sea or a not covered territory resolves to an empty name.
+    if (name.empty() || m_countryLocalFileFn(name))
+      continue;
+
+    m_absentCountries.emplace_back(move(name));
+  }
+
+  base::SortUnique(m_absentCountries);
+}
+
+void AbsentCountriesFetcher::GetAbsentCountries(vector<string> & countries)
+{
+  countries = move(m_absentCountries);
+  m_absentCountries.clear();
+}
+
+bool AbsentCountriesFetcher::AllPointsInSameMwm(Checkpoints const & checkpoints) const
+{
+  for (size_t i = 0; i < checkpoints.GetNumSubroutes(); ++i)
+  {
+    if (m_countryFileFn(checkpoints.GetPoint(i)) != m_countryFileFn(checkpoints.GetPoint(i + 1)))
+      return false;
+  }
+
+  return true;
+}
+}  // namespace routing
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "routing/checkpoints.hpp"
+#include "routing/router.hpp"
+
+#include "geometry/point2d.hpp"
+
+#include "std/string.hpp"
+#include "std/vector.hpp"
+
+namespace routing
+{
+using TCountryLocalFileFn = function<bool(string const &)>;
+// Resolves several points to country file names at once; the output is
+// aligned with the input. Batch resolution lets the country info getter
+// exploit the locality of consecutive route points.
+using TCountryFileBatchFn = function<void(vector<m2::PointD> const &, vector<string> &)>;
+
+class IAbsentFetcher
+{
+public:
+  virtual ~IAbsentFetcher() = default;
+  virtual void GenerateRequest(Checkpoints const &) = 0;
+  virtual void GetAbsentCountries(vector<string> & countries) = 0;
+};
+
+/// \brief Predicts which countries a route is going to cross and reports the
+/// ones without a downloaded map file. The prediction samples the straight
+/// segments between checkpoints and resolves the samples to countries, so it
+/// is coarse by design: a road route may detour into a region the segment
+/// does not touch. In return it runs fully offline and takes milliseconds.
+class AbsentCountriesFetcher : public IAbsentFetcher
+{
+public:
+  AbsentCountriesFetcher(TCountryFileFn const &, TCountryLocalFileFn const &,
+                         TCountryFileBatchFn const & countryFileBatchFn = nullptr);
+
+  // IAbsentFetcher overrides:
+  void GenerateRequest(Checkpoints const &) override;
+  void GetAbsentCountries(vector<string> & countries) override;
+
+private:
+  bool AllPointsInSameMwm(Checkpoints const &) const;
+
+  TCountryFileFn const m_countryFileFn;
+  TCountryLocalFileFn const m_countryLocalFileFn;
+  TCountryFileBatchFn const m_countryFileBatchFn;
+  vector<string> m_absentCountries;
+};
+}  // namespace routing
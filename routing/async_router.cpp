@@ -195,7 +195,7 @@ AsyncRouter::~AsyncRouter()
   m_thread.join();
 }
 
-void AsyncRouter::SetRouter(unique_ptr<IRouter> && router, unique_ptr<IOnlineFetcher> && fetcher)
+void AsyncRouter::SetRouter(unique_ptr<IRouter> && router, unique_ptr<IAbsentFetcher> && fetcher)
 {
   unique_lock<mutex> ul(m_guard);
 
@@ -227,6 +227,25 @@ void AsyncRouter::CalculateRoute(Checkpoints const & checkpoints, m2::PointD con
   m_threadCondVar.notify_one();
 }
 
+void AsyncRouter::PrefetchRouteCorridor(vector<m2::PointD> && points)
+{
+  shared_ptr<IRouter> router;
+  {
+    unique_lock<mutex> ul(m_guard);
+    router = m_router;
+  }
+
+  if (!router)
+    return;
+
+  // The router outlives the task because the task shares its ownership. A possible
+  // concurrent route calculation is safe: PrefetchRouteCorridor() implementations
+  // are restricted to thread-safe data.
+  GetPlatform().RunTask(Platform::Thread::File, [router, points = move(points)]() {
+    router->PrefetchRouteCorridor(points);
+  });
+}
+
 void AsyncRouter::ClearState()
 {
   unique_lock<mutex> ul(m_guard);
@@ -334,7 +353,7 @@ void AsyncRouter::CalculateRoute()
   shared_ptr<RouterDelegateProxy> delegate;
   m2::PointD startDirection;
   bool adjustToPrevRoute = false;
-  shared_ptr<IOnlineFetcher> absentFetcher;
+  shared_ptr<IAbsentFetcher> absentFetcher;
   shared_ptr<IRouter> router;
   uint64_t routeId = 0;
   RoutingStatisticsCallback routingStatisticsCallback;
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "routing/checkpoints.hpp"
-#include "routing/online_absent_fetcher.hpp"
+#include "routing/absent_countries_fetcher.hpp"
 #include "routing/route.hpp"
 #include "routing/router.hpp"
 #include "routing/router_delegate.hpp"
@@ -34,7 +34,7 @@ public:
   /// Sets a synchronous router, current route calculation will be cancelled
   /// @param router pointer to a router implementation
   /// @param fetcher pointer to a online fetcher
-  void SetRouter(std::unique_ptr<IRouter> && router, std::unique_ptr<IOnlineFetcher> && fetcher);
+  void SetRouter(std::unique_ptr<IRouter> && router, std::unique_ptr<IAbsentFetcher> && fetcher);
 
   /// Main method to calulate new route from startPt to finalPt with start direction
   /// Processed result will be passed to callback. Callback will called at GUI thread.
@@ -54,6 +54,10 @@ public:
                       ProgressCallback const & progressCallback,
                       uint32_t timeoutSec);
 
+  /// Warms up router caches for a deviation rebuild along the route polyline |points|.
+  /// The work is done on the low priority file thread and never blocks route calculation.
+  void PrefetchRouteCorridor(std::vector<m2::PointD> && points);
+
   /// Interrupt routing and clear buffers
   void ClearState();
 
@@ -115,7 +119,7 @@ private:
   m2::PointD m_startDirection = m2::PointD::Zero();
   bool m_adjustToPrevRoute = false;
   std::shared_ptr<RouterDelegateProxy> m_delegate;
-  std::shared_ptr<IOnlineFetcher> m_absentFetcher;
+  std::shared_ptr<IAbsentFetcher> m_absentFetcher;
   std::shared_ptr<IRouter> m_router;
 
   RoutingStatisticsCallback const m_routingStatisticsCallback;
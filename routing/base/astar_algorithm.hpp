@@ -3,6 +3,7 @@
 #include "routing/base/astar_weight.hpp"
 #include "routing/base/routing_result.hpp"
 
+#include "base/arena_allocator.hpp"
 #include "base/assert.hpp"
 #include "base/cancellable.hpp"
 
@@ -173,6 +174,11 @@ private:
   // Periodicity of switching a wave of bidirectional algorithm.
   static uint32_t constexpr kQueueSwitchPeriod = 128;
 
+  // Number of best frontier states expanded at once by the bidirectional algorithm.
+  // Expanding a batch amortizes calls into the graph and keeps deserialization of
+  // geometry for neighbouring segments together.
+  static size_t constexpr kExpansionBatchSize = 16;
+
   // Precision of comparison weights.
   static Weight constexpr kEpsilon = GetAStarWeightEpsilon<Weight>();
   static Weight constexpr kZeroDistance = GetAStarWeightZero<Weight>();
@@ -212,6 +218,12 @@ private:
   // purpose is to make the code that changes directions more readable.
   struct BidirectionalStepContext
   {
+    // Per-search maps die together with the context, so their nodes are carved
+    // from one bump-pointer arena instead of being allocated one by one.
+    template <typename V>
+    using ArenaMap =
+        std::map<Vertex, V, std::less<Vertex>, base::ArenaAllocator<std::pair<Vertex const, V>>>;
+
     BidirectionalStepContext(bool forward, Vertex const & startVertex, Vertex const & finalVertex,
                              Graph & graph)
       : forward(forward)
@@ -220,6 +232,9 @@ private:
       , graph(graph)
       , m_piRT(graph.HeuristicCostEstimate(finalVertex, startVertex))
       , m_piFS(graph.HeuristicCostEstimate(startVertex, finalVertex))
+      , bestDistance(base::ArenaAllocator<std::pair<Vertex const, Weight>>(m_arena))
+      , parent(base::ArenaAllocator<std::pair<Vertex const, Vertex>>(m_arena))
+      , m_pi(base::ArenaAllocator<std::pair<Vertex const, Weight>>(m_arena))
     {
       bestVertex = forward ? startVertex : finalVertex;
       pS = ConsistentHeuristic(bestVertex);
@@ -234,22 +249,33 @@ private:
     // p_f(v) = 0.5*(π_f(v) - π_r(v)) + 0.5*π_r(t)
     // p_r(v) = 0.5*(π_r(v) - π_f(v)) + 0.5*π_f(s)
     // p_r(v) + p_f(v) = const. Note: this condition is called consistence.
-    Weight ConsistentHeuristic(Vertex const & v) const
+    // The value for a vertex does not change while the search is running, so it is
+    // memoized: the search asks for it several times per vertex (once per ingoing
+    // edge relaxation and once per expansion) and every evaluation costs two
+    // geodesic distance calculations.
+    Weight ConsistentHeuristic(Vertex const & v)
     {
+      auto const it = m_pi.find(v);
+      if (it != m_pi.cend())
+        return it->second;
+
       auto const piF = graph.HeuristicCostEstimate(v, finalVertex);
       auto const piR = graph.HeuristicCostEstimate(v, startVertex);
+      Weight p;
       if (forward)
       {
         /// @todo careful: with this "return" here and below in the Backward case
         /// the heuristic becomes inconsistent but still seems to work.
         /// return HeuristicCostEstimate(v, finalVertex);
-        return 0.5 * (piF - piR + m_piRT);
+        p = 0.5 * (piF - piR + m_piRT);
       }
       else
       {
         // return HeuristicCostEstimate(v, startVertex);
-        return 0.5 * (piR - piF + m_piFS);
+        p = 0.5 * (piR - piF + m_piFS);
       }
+      m_pi.emplace(v, p);
+      return p;
     }
 
     void GetAdjacencyList(Vertex const & v, std::vector<Edge> & adj)
@@ -267,22 +293,32 @@ private:
     Weight const m_piRT;
     Weight const m_piFS;
 
+    // The arena must outlive the maps below.
+    base::MemoryArena m_arena;
+
     std::priority_queue<State, std::vector<State>, std::greater<State>> queue;
-    std::map<Vertex, Weight> bestDistance;
-    std::map<Vertex, Vertex> parent;
+    ArenaMap<Weight> bestDistance;
+    ArenaMap<Vertex> parent;
     Vertex bestVertex;
 
     Weight pS;
+
+  private:
+    // Memoized values of ConsistentHeuristic().
+    ArenaMap<Weight> m_pi;
   };
 
-  static void ReconstructPath(Vertex const & v, std::map<Vertex, Vertex> const & parent,
+  template <typename ParentMap>
+  static void ReconstructPath(Vertex const & v, ParentMap const & parent,
                               std::vector<Vertex> & path);
+  template <typename ParentMapV, typename ParentMapW>
   static void ReconstructPathBidirectional(Vertex const & v, Vertex const & w,
-                                           std::map<Vertex, Vertex> const & parentV,
-                                           std::map<Vertex, Vertex> const & parentW,
+                                           ParentMapV const & parentV, ParentMapW const & parentW,
                                            std::vector<Vertex> & path);
 };
 
+template <typename Graph>
+constexpr size_t AStarAlgorithm<Graph>::kExpansionBatchSize;
 template <typename Graph>
 constexpr typename Graph::Weight AStarAlgorithm<Graph>::kEpsilon;
 template <typename Graph>
@@ -472,7 +508,10 @@ typename AStarAlgorithm<Graph>::Result AStarAlgorithm<Graph>::FindPathBidirectio
   BidirectionalStepContext * cur = &forward;
   BidirectionalStepContext * nxt = &backward;
 
-  std::vector<Edge> adj;
+  std::vector<State> batch;
+  std::vector<std::vector<Edge>> batchAdj;
+  batch.reserve(kExpansionBatchSize);
+  batchAdj.resize(kExpansionBatchSize);
 
   // It is not necessary to check emptiness for both queues here
   // because if we have not found a path by the time one of the
@@ -521,64 +560,81 @@ typename AStarAlgorithm<Graph>::Result AStarAlgorithm<Graph>::FindPathBidirectio
       }
     }
 
-    State const stateV = cur->queue.top();
-    cur->queue.pop();
+    // Drain several best states at once and fetch all their adjacency lists before
+    // relaxing any edge. Relaxations inside the batch may improve a distance of an
+    // already drained state; such a state is pushed back to the queue with the better
+    // distance and is expanded again, so the search stays correct.
+    batch.clear();
+    while (batch.size() < kExpansionBatchSize && !cur->queue.empty())
+    {
+      State const stateV = cur->queue.top();
+      cur->queue.pop();
 
-    if (stateV.distance > cur->bestDistance[stateV.vertex])
-      continue;
+      if (stateV.distance > cur->bestDistance[stateV.vertex])
+        continue;
 
-    params.m_onVisitedVertexCallback(stateV.vertex,
-                                     cur->forward ? cur->finalVertex : cur->startVertex);
+      batch.push_back(stateV);
+    }
 
-    cur->GetAdjacencyList(stateV.vertex, adj);
-    for (auto const & edge : adj)
+    for (size_t i = 0; i < batch.size(); ++i)
+      cur->GetAdjacencyList(batch[i].vertex, batchAdj[i]);
+
+    for (size_t i = 0; i < batch.size(); ++i)
     {
-      State stateW(edge.GetTarget(), kZeroDistance);
-      if (stateV.vertex == stateW.vertex)
-        continue;
+      State const & stateV = batch[i];
 
-      auto const weight = edge.GetWeight();
-      auto const pV = cur->ConsistentHeuristic(stateV.vertex);
-      auto const pW = cur->ConsistentHeuristic(stateW.vertex);
-      auto const reducedWeight = weight + pW - pV;
+      params.m_onVisitedVertexCallback(stateV.vertex,
+                                       cur->forward ? cur->finalVertex : cur->startVertex);
 
-      CHECK_GREATER_OR_EQUAL(reducedWeight, -kEpsilon, ("Invariant violated."));
-      auto const newReducedDist = stateV.distance + std::max(reducedWeight, kZeroDistance);
+      auto const pV = cur->ConsistentHeuristic(stateV.vertex);
+      for (auto const & edge : batchAdj[i])
+      {
+        State stateW(edge.GetTarget(), kZeroDistance);
+        if (stateV.vertex == stateW.vertex)
+          continue;
 
-      auto const fullLength = weight + stateV.distance + cur->pS - pV;
-      if (!params.m_checkLengthCallback(fullLength))
-        continue;
+        auto const weight = edge.GetWeight();
+        auto const pW = cur->ConsistentHeuristic(stateW.vertex);
+        auto const reducedWeight = weight + pW - pV;
 
-      auto const itCur = cur->bestDistance.find(stateW.vertex);
-      if (itCur != cur->bestDistance.end() && newReducedDist >= itCur->second - kEpsilon)
-        continue;
+        CHECK_GREATER_OR_EQUAL(reducedWeight, -kEpsilon, ("Invariant violated."));
+        auto const newReducedDist = stateV.distance + std::max(reducedWeight, kZeroDistance);
 
-      auto const itNxt = nxt->bestDistance.find(stateW.vertex);
-      if (itNxt != nxt->bestDistance.end())
-      {
-        auto const distW = itNxt->second;
-        // Reduced length that the path we've just found has in the original graph:
-        // find the reduced length of the path's parts in the reduced forward and backward graphs.
-        auto const curPathReducedLength = newReducedDist + distW;
-        // No epsilon here: it is ok to overshoot slightly.
-        if (!foundAnyPath || bestPathReducedLength > curPathReducedLength)
-        {
-          bestPathReducedLength = curPathReducedLength;
+        auto const fullLength = weight + stateV.distance + cur->pS - pV;
+        if (!params.m_checkLengthCallback(fullLength))
+          continue;
 
-          bestPathRealLength = stateV.distance + weight + distW;
-          bestPathRealLength += cur->pS - pV;
-          bestPathRealLength += nxt->pS - nxt->ConsistentHeuristic(stateW.vertex);
+        auto const itCur = cur->bestDistance.find(stateW.vertex);
+        if (itCur != cur->bestDistance.end() && newReducedDist >= itCur->second - kEpsilon)
+          continue;
 
-          foundAnyPath = true;
-          cur->bestVertex = stateV.vertex;
-          nxt->bestVertex = stateW.vertex;
+        auto const itNxt = nxt->bestDistance.find(stateW.vertex);
+        if (itNxt != nxt->bestDistance.end())
+        {
+          auto const distW = itNxt->second;
+          // Reduced length that the path we've just found has in the original graph:
+          // find the reduced length of the path's parts in the reduced forward and backward graphs.
+          auto const curPathReducedLength = newReducedDist + distW;
+          // No epsilon here: it is ok to overshoot slightly.
+          if (!foundAnyPath || bestPathReducedLength > curPathReducedLength)
+          {
+            bestPathReducedLength = curPathReducedLength;
+
+            bestPathRealLength = stateV.distance + weight + distW;
+            bestPathRealLength += cur->pS - pV;
+            bestPathRealLength += nxt->pS - nxt->ConsistentHeuristic(stateW.vertex);
+
+            foundAnyPath = true;
+            cur->bestVertex = stateV.vertex;
+            nxt->bestVertex = stateW.vertex;
+          }
         }
-      }
 
-      stateW.distance = newReducedDist;
-      cur->bestDistance[stateW.vertex] = newReducedDist;
-      cur->parent[stateW.vertex] = stateV.vertex;
-      cur->queue.push(stateW);
+        stateW.distance = newReducedDist;
+        cur->bestDistance[stateW.vertex] = newReducedDist;
+        cur->parent[stateW.vertex] = stateV.vertex;
+        cur->queue.push(stateW);
+      }
     }
   }
 
@@ -684,8 +740,8 @@ typename AStarAlgorithm<Graph>::Result AStarAlgorithm<Graph>::AdjustRoute(
 
 // static
 template <typename Graph>
-void AStarAlgorithm<Graph>::ReconstructPath(Vertex const & v,
-                                            std::map<Vertex, Vertex> const & parent,
+template <typename ParentMap>
+void AStarAlgorithm<Graph>::ReconstructPath(Vertex const & v, ParentMap const & parent,
                                             std::vector<Vertex> & path)
 {
   path.clear();
@@ -703,9 +759,10 @@ void AStarAlgorithm<Graph>::ReconstructPath(Vertex const & v,
 
 // static
 template <typename Graph>
+template <typename ParentMapV, typename ParentMapW>
 void AStarAlgorithm<Graph>::ReconstructPathBidirectional(Vertex const & v, Vertex const & w,
-                                                         std::map<Vertex, Vertex> const & parentV,
-                                                         std::map<Vertex, Vertex> const & parentW,
+                                                         ParentMapV const & parentV,
+                                                         ParentMapW const & parentW,
                                                          std::vector<Vertex> & path)
 {
   std::vector<Vertex> pathV;
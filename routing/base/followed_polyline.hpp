@@ -5,6 +5,7 @@
 #include "geometry/point2d.hpp"
 #include "geometry/polyline2d.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -98,6 +99,19 @@ public:
 
     for (size_t i = startIdx; i < endIdx; ++i)
     {
+      // The projection of a segment lies inside the segment bounding box. If the box
+      // does not intersect |posRect|, IsPointInside() below is known to fail, so the
+      // segment is rejected with a few comparisons instead of the projection math.
+      // It keeps the cost of scanning a long polyline low: only segments near
+      // |posRect| pay for ClosestPointTo() and the distance function.
+      m2::PointD const & p0 = m_poly.GetPoint(i);
+      m2::PointD const & p1 = m_poly.GetPoint(i + 1);
+      if (std::max(p0.x, p1.x) < posRect.minX() || std::min(p0.x, p1.x) > posRect.maxX() ||
+          std::max(p0.y, p1.y) < posRect.minY() || std::min(p0.y, p1.y) > posRect.maxY())
+      {
+        continue;
+      }
+
       m2::PointD const & pt = m_segProj[i].ClosestPointTo(currPos);
 
       if (!posRect.IsPointInside(pt))
@@ -175,6 +175,7 @@ bool BicycleDirectionsEngine::Generate(IndexRoadGraph const & graph, vector<Junc
   CHECK(m_numMwmIds, ());
 
   m_adjacentEdges.clear();
+  m_featureTurnAttrs.clear();
   m_pathSegments.clear();
   turns.clear();
   streetNames.clear();
@@ -220,6 +221,26 @@ FeaturesLoaderGuard & BicycleDirectionsEngine::GetLoader(MwmSet::MwmId const & i
   return *m_loader;
 }
 
+bool BicycleDirectionsEngine::GetFeatureTurnAttrs(FeatureID const & featureId,
+                                                  FeatureTurnAttrs & attrs)
+{
+  auto const it = m_featureTurnAttrs.find(featureId);
+  if (it != m_featureTurnAttrs.cend())
+  {
+    attrs = it->second;
+    return true;
+  }
+
+  FeatureType ft;
+  if (!GetLoader(featureId.m_mwmId).GetFeatureByIndex(featureId.m_index, ft))
+    return false;
+
+  attrs.m_highwayClass = ftypes::GetHighwayClass(feature::TypesHolder(ft));
+  attrs.m_isLink = ftypes::IsLinkChecker::Instance()(ft);
+  m_featureTurnAttrs.emplace(featureId, attrs);
+  return true;
+}
+
 void BicycleDirectionsEngine::LoadPathAttributes(FeatureID const & featureId, LoadedPathSegment & pathSegment)
 {
   if (!featureId.IsValid())
@@ -256,16 +277,12 @@ void BicycleDirectionsEngine::GetSegmentRangeAndAdjacentEdges(
     if (edge.IsFake())
       continue;
 
-    auto const & outFeatureId = edge.GetFeatureId();
-    FeatureType ft;
-    if (!GetLoader(outFeatureId.m_mwmId).GetFeatureByIndex(outFeatureId.m_index, ft))
+    FeatureTurnAttrs attrs;
+    if (!GetFeatureTurnAttrs(edge.GetFeatureId(), attrs))
       continue;
 
-    auto const highwayClass = ftypes::GetHighwayClass(feature::TypesHolder(ft));
-    ASSERT_NOT_EQUAL(highwayClass, ftypes::HighwayClass::Error, ());
-    ASSERT_NOT_EQUAL(highwayClass, ftypes::HighwayClass::Undefined, ());
-
-    bool const isLink = ftypes::IsLinkChecker::Instance()(ft);
+    ASSERT_NOT_EQUAL(attrs.m_highwayClass, ftypes::HighwayClass::Error, ());
+    ASSERT_NOT_EQUAL(attrs.m_highwayClass, ftypes::HighwayClass::Undefined, ());
 
     double angle = 0;
 
@@ -286,7 +303,7 @@ void BicycleDirectionsEngine::GetSegmentRangeAndAdjacentEdges(
       outgoingTurns.isCandidatesAngleValid = false;
     }
     outgoingTurns.candidates.emplace_back(angle, ConvertEdgeToSegment(*m_numMwmIds, edge),
-                                          highwayClass, isLink);
+                                          attrs.m_highwayClass, attrs.m_isLink);
   }
 
   if (outgoingTurns.isCandidatesAngleValid)
@@ -317,6 +334,10 @@ void BicycleDirectionsEngine::FillPathSegmentsAndAdjacentEdgesMap(
   uint32_t startSegId = kInvalidSegId;
   vector<Junction> prevJunctions;
   vector<Segment> prevSegments;
+  // Edge buffers are reused between the iterations to keep their capacity:
+  // the loop runs once per route point and used to allocate them anew each time.
+  IRoadGraph::TEdgeVector outgoingEdges;
+  IRoadGraph::TEdgeVector ingoingEdges;
   for (size_t i = 1; i < pathSize; ++i)
   {
     if (cancellable.IsCancelled())
@@ -325,8 +346,8 @@ void BicycleDirectionsEngine::FillPathSegmentsAndAdjacentEdgesMap(
     Junction const & prevJunction = path[i - 1];
     Junction const & currJunction = path[i];
 
-    IRoadGraph::TEdgeVector outgoingEdges;
-    IRoadGraph::TEdgeVector ingoingEdges;
+    outgoingEdges.clear();
+    ingoingEdges.clear();
     bool const isCurrJunctionFinish = (i + 1 == pathSize);
     GetEdges(graph, currJunction, isCurrJunctionFinish, outgoingEdges, ingoingEdges);
 
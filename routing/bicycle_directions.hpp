@@ -10,6 +10,7 @@
 #include "editor/editable_data_source.hpp"
 
 #include "indexer/data_source.hpp"
+#include "indexer/ftypes_matcher.hpp"
 
 #include <map>
 #include <memory>
@@ -39,7 +40,17 @@ public:
                 vector<Segment> & segments) override;
 
 private:
+  // Turn candidate attributes of a feature. Getting them requires loading and parsing
+  // the whole feature, so they are memoized for the duration of one Generate() call:
+  // the same features show up as turn candidates at many consecutive route junctions.
+  struct FeatureTurnAttrs
+  {
+    ftypes::HighwayClass m_highwayClass = ftypes::HighwayClass::Undefined;
+    bool m_isLink = false;
+  };
+
   FeaturesLoaderGuard & GetLoader(MwmSet::MwmId const & id);
+  bool GetFeatureTurnAttrs(FeatureID const & featureId, FeatureTurnAttrs & attrs);
   void LoadPathAttributes(FeatureID const & featureId, LoadedPathSegment & pathSegment);
   void GetSegmentRangeAndAdjacentEdges(IRoadGraph::TEdgeVector const & outgoingEdges,
                                        Edge const & inEdge, uint32_t startSegId, uint32_t endSegId,
@@ -57,6 +68,7 @@ private:
                 IRoadGraph::TEdgeVector & ingoing);
 
   AdjacentEdgesMap m_adjacentEdges;
+  std::map<FeatureID, FeatureTurnAttrs> m_featureTurnAttrs;
   TUnpackedPathSegments m_pathSegments;
   DataSource const & m_dataSource;
   std::shared_ptr<NumMwmIds> m_numMwmIds;
@@ -262,6 +262,16 @@ private:
 
   friend class CrossMwmConnectorSerializer;
 
+  // Preallocates the containers before the streamed deserialization of |numTransitions|
+  // transitions, so the load does not rehash or reallocate while reading the section.
+  void Reserve(size_t numTransitions, size_t numEnters, size_t numExits)
+  {
+    m_transitions.reserve(numTransitions);
+    m_crossMwmIdToFeatureId.reserve(numTransitions);
+    m_enters.reserve(numEnters);
+    m_exits.reserve(numExits);
+  }
+
   void AddEdge(Segment const & segment, connector::Weight weight,
                std::vector<SegmentEdge> & edges) const
   {
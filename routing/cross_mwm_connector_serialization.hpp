@@ -212,6 +212,23 @@ public:
     VehicleMask const requiredMask = GetVehicleMask(requiredVehicle);
     auto const numTransitions = base::checked_cast<size_t>(header.GetNumTransitions());
 
+    {
+      // The header knows the exact number of enters and exits for the required vehicle,
+      // so all containers are preallocated before the streamed read.
+      size_t numEnters = 0;
+      size_t numExits = 0;
+      for (Section const & section : header.GetSections())
+      {
+        if (section.GetVehicleType() == requiredVehicle)
+        {
+          numEnters = base::checked_cast<size_t>(section.GetNumEnters());
+          numExits = base::checked_cast<size_t>(section.GetNumExits());
+          break;
+        }
+      }
+      connector.Reserve(numTransitions, numEnters, numExits);
+    }
+
     for (size_t i = 0; i < numTransitions; ++i)
     {
       Transition<CrossMwmId> transition;
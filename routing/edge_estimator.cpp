@@ -205,28 +205,35 @@ bool CarEstimator::LeapIsAllowed(NumMwmId mwmId) const { return !m_trafficStash-
 
 double CarEstimator::CalcSegment(Purpose purpose, Segment const & segment, RoadGeometry const & road) const
 {
-  // Current time estimation are too optimistic.
-  // Need more accurate tuning: traffic lights, traffic jams, road models and so on.
-  // Add some penalty to make estimation of a more realistic.
-  // TODO: make accurate tuning, remove penalty.
-  double constexpr kTimePenalty = 1.8;
-
   double result = CalcClimbSegment(purpose, segment, road, GetCarClimbPenalty);
 
   if (m_trafficStash)
   {
     SpeedGroup const speedGroup = m_trafficStash->GetSpeedGroup(segment);
     ASSERT_LESS(speedGroup, SpeedGroup::Count, ());
-    double const trafficFactor = CalcTrafficFactor(speedGroup);
-    result *= trafficFactor;
-    if (speedGroup != SpeedGroup::Unknown && speedGroup != SpeedGroup::G5)
-      result *= kTimePenalty;
+    result *= EdgeEstimator::CalcCarTrafficFactor(speedGroup);
   }
 
   return result;
 }
 
 // EdgeEstimator -----------------------------------------------------------------------------------
+// static
+double EdgeEstimator::CalcCarTrafficFactor(SpeedGroup speedGroup)
+{
+  // Current time estimation are too optimistic.
+  // Need more accurate tuning: traffic lights, traffic jams, road models and so on.
+  // Add some penalty to make estimation of a more realistic.
+  // TODO: make accurate tuning, remove penalty.
+  double constexpr kTimePenalty = 1.8;
+
+  double result = CalcTrafficFactor(speedGroup);
+  if (speedGroup != SpeedGroup::Unknown && speedGroup != SpeedGroup::G5)
+    result *= kTimePenalty;
+
+  return result;
+}
+
 // static
 shared_ptr<EdgeEstimator> EdgeEstimator::Create(VehicleType vehicleType, double maxWeighSpeedKMpH,
                                                 double offroadSpeedKMpH,
@@ -53,6 +53,12 @@ public:
                                                VehicleModelInterface const & vehicleModel,
                                                std::shared_ptr<TrafficStash>);
 
+  // Returns the multiplier the car estimator applies to a segment time for
+  // |speedGroup|. Exposed to let an already built route be re-estimated in
+  // place when traffic changes: the new segment time is the old one rescaled
+  // by the ratio of the new and the old factors.
+  static double CalcCarTrafficFactor(traffic::SpeedGroup speedGroup);
+
 private:
   double const m_maxWeightSpeedMpS;
   double const m_offroadSpeedMpS;
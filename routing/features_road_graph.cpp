@@ -107,6 +107,14 @@ IRoadGraph::RoadInfo & FeaturesRoadGraph::RoadInfoCache::Find(FeatureID const &
 
 void FeaturesRoadGraph::RoadInfoCache::Clear()
 {
+  for (auto const & cache : m_cache)
+  {
+    auto const accesses = cache.second.GetAccessesCount();
+    if (accesses == 0)
+      continue;
+    LOG(LINFO, ("Road info cache for", cache.first, ": accesses:", accesses,
+                "miss ratio:", cache.second.GetCacheMiss()));
+  }
   m_cache.clear();
 }
 FeaturesRoadGraph::FeaturesRoadGraph(DataSource const & dataSource, IRoadGraph::Mode mode,
@@ -19,10 +19,13 @@ using namespace std;
 
 namespace
 {
-// @TODO(bykoianko) Consider setting cache size based on available memory.
 // Maximum road geometry cache size in items.
 size_t constexpr kRoadsCacheSize = 5000;
 
+// Maximum approximate size of cached road geometry in bytes. Long roads spill
+// their points to the heap, so the item count alone does not bound the memory.
+size_t constexpr kRoadsCacheMemoryBudget = 8 * 1024 * 1024;
+
 // GeometryLoaderImpl ------------------------------------------------------------------------------
 class GeometryLoaderImpl final : public GeometryLoader
 {
@@ -72,8 +75,15 @@ void GeometryLoaderImpl::Load(uint32_t featureId, RoadGeometry & road)
   if (m_loadAltitudes)
     altitudes = &(m_altitudeLoader.GetAltitudes(featureId, feature.GetPointsCount()));
 
+  // The loader bounds its own cache, so the altitudes of recently
+  // loaded features stay decoded for the next time the road geometry
+  // is evicted and reloaded.
+  //
+  // Per-feature road attributes are resolved here, once per feature load:
+  // the city road flag is folded into the speed stored in RoadGeometry, so
+  // edge estimation reads a single cached structure and never touches the
+  // mwm sections on the segment-by-segment path.
   road.Load(*m_vehicleModel, feature, altitudes, m_cityRoads->IsCityRoad(featureId));
-  m_altitudeLoader.ClearCache();
 }
 
 // FileGeometryLoader ------------------------------------------------------------------------------
@@ -141,11 +151,15 @@ void RoadGeometry::Load(VehicleModelInterface const & vehicleModel, FeatureType
 
   m_junctions.clear();
   m_junctions.reserve(feature.GetPointsCount());
-  for (size_t i = 0; i < feature.GetPointsCount(); ++i)
-  {
-    m_junctions.emplace_back(feature.GetPoint(i),
-                             altitudes ? (*altitudes)[i] : feature::kDefaultAltitudeMeters);
-  }
+  // ForEachPoint iterates the parsed points in one pass instead of an out-of-line
+  // GetPointsCount()/GetPoint() pair per point.
+  size_t pointIdx = 0;
+  feature.ForEachPoint(
+      [&](m2::PointD const & point) {
+        m_junctions.emplace_back(
+            point, altitudes ? (*altitudes)[pointIdx++] : feature::kDefaultAltitudeMeters);
+      },
+      FeatureType::BEST_GEOMETRY);
 
   if (m_valid && m_speed.m_weight <= 0.0)
   {
@@ -163,7 +177,8 @@ void RoadGeometry::Load(VehicleModelInterface const & vehicleModel, FeatureType
 Geometry::Geometry(unique_ptr<GeometryLoader> loader)
     : m_loader(move(loader))
     , m_featureIdToRoad(make_unique<FifoCache<uint32_t, RoadGeometry>>(
-        kRoadsCacheSize,
+        kRoadsCacheSize, kRoadsCacheMemoryBudget,
+        [](RoadGeometry const & road) { return road.GetMemorySize(); },
         [this](uint32_t featureId, RoadGeometry & road) { m_loader->Load(featureId, road); }))
 {
   CHECK(m_loader, ());
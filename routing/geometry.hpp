@@ -63,6 +63,10 @@ public:
     m_isPassThroughAllowed = passThroughAllowed;
   }
 
+  /// \returns an approximate upper estimate of the structure size in bytes
+  /// including points which long roads keep on the heap.
+  size_t GetMemorySize() const { return sizeof(*this) + m_junctions.size() * sizeof(Junction); }
+
 private:
   buffer_vector<Junction, 32> m_junctions;
   VehicleModelInterface::SpeedKMpH m_speed;
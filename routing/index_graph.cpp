@@ -21,14 +21,14 @@ bool IsUTurn(Segment const & u, Segment const & v)
          u.IsForward() != v.IsForward();
 }
 
-bool IsRestricted(RestrictionVec const & restrictions, Segment const & u, Segment const & v,
-                  bool isOutgoing)
+bool IsRestricted(vector<pair<uint32_t, uint32_t>> const & restrictions, Segment const & u,
+                  Segment const & v, bool isOutgoing)
 {
   uint32_t const featureIdFrom = isOutgoing ? u.GetFeatureId() : v.GetFeatureId();
   uint32_t const featureIdTo = isOutgoing ? v.GetFeatureId() : u.GetFeatureId();
 
   if (!binary_search(restrictions.cbegin(), restrictions.cend(),
-                     Restriction(Restriction::Type::No, {featureIdFrom, featureIdTo})))
+                     make_pair(featureIdFrom, featureIdTo)))
   {
     return false;
   }
@@ -96,7 +96,20 @@ void IndexGraph::Import(vector<Joint> const & joints)
 void IndexGraph::SetRestrictions(RestrictionVec && restrictions)
 {
   ASSERT(is_sorted(restrictions.cbegin(), restrictions.cend()), ());
-  m_restrictions = move(restrictions);
+
+  // Only two link restrictions of type No can match the (from, to) probe in IsRestricted(),
+  // the rest are dead weight for GetEdgeList(). Flattening them into sorted pairs once here
+  // makes the per-expansion check a binary search over contiguous 8 byte entries instead of
+  // constructing a probe Restriction with a heap allocated links vector for every candidate
+  // edge.
+  m_restrictions.clear();
+  m_restrictions.reserve(restrictions.size());
+  for (Restriction const & restriction : restrictions)
+  {
+    if (restriction.m_type == Restriction::Type::No && restriction.m_featureIds.size() == 2)
+      m_restrictions.emplace_back(restriction.m_featureIds[0], restriction.m_featureIds[1]);
+  }
+  sort(m_restrictions.begin(), m_restrictions.end());
 }
 
 void IndexGraph::SetRoadAccess(RoadAccess && roadAccess) { m_roadAccess = move(roadAccess); }
@@ -60,6 +60,8 @@ public:
   void GetIngoingEdgesList(Segment const & segment, vector<SegmentEdge> & edges);
   RouteWeight HeuristicCostEstimate(Segment const & from, Segment const & to);
 
+  void ReserveRoads(uint32_t numRoads) { m_roadIndex.Reserve(numRoads); }
+
   void PushFromSerializer(Joint::Id jointId, RoadPoint const & rp)
   {
     m_roadIndex.PushFromSerializer(jointId, rp);
@@ -93,7 +95,9 @@ private:
   shared_ptr<EdgeEstimator> m_estimator;
   RoadIndex m_roadIndex;
   JointIndex m_jointIndex;
-  RestrictionVec m_restrictions;
+  // Restrictions of type No flattened to sorted (from, to) feature id pairs,
+  // see SetRestrictions().
+  vector<pair<uint32_t, uint32_t>> m_restrictions;
   RoadAccess m_roadAccess;
 };
 }  // namespace routing
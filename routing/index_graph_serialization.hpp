@@ -60,6 +60,15 @@ public:
 
     JointsFilter jointsFilter(graph, header.GetNumJoints());
 
+    // Each road belongs to exactly one section, so the road index size is known upfront.
+    uint32_t numRoads = 0;
+    for (uint32_t i = 0; i < header.GetNumSections(); ++i)
+    {
+      if (header.GetSection(i).GetMask() & requiredMask)
+        numRoads += header.GetSection(i).GetNumRoads();
+    }
+    graph.ReserveRoads(numRoads);
+
     for (uint32_t i = 0; i < header.GetNumSections(); ++i)
     {
       Section const & section = header.GetSection(i);
@@ -146,14 +146,16 @@ set<NumMwmId> IndexGraphStarter::GetFinishMwms() const
   return mwms;
 }
 
-bool IndexGraphStarter::CheckLength(RouteWeight const & weight)
+int8_t IndexGraphStarter::GetNumPassThroughChangesAllowed()
 {
   // We allow 1 pass-through/non-pass-through zone changes per ending located in
   // non-pass-through zone to allow user to leave this zone.
-  int8_t const numPassThroughChangesAllowed =
-      (StartPassThroughAllowed() ? 0 : 1) + (FinishPassThroughAllowed() ? 0 : 1);
+  return (StartPassThroughAllowed() ? 0 : 1) + (FinishPassThroughAllowed() ? 0 : 1);
+}
 
-  return weight.GetNumPassThroughChanges() <= numPassThroughChangesAllowed &&
+bool IndexGraphStarter::CheckLength(RouteWeight const & weight)
+{
+  return weight.GetNumPassThroughChanges() <= GetNumPassThroughChangesAllowed() &&
          m_graph.CheckLength(weight, m_startToFinishDistanceM);
 }
 
@@ -81,6 +81,11 @@ public:
   // start and finish in pass-through/non-pass-through area and number of non-pass-through crosses.
   bool CheckLength(RouteWeight const & weight);
 
+  // The inputs of CheckLength() below. They let a caller evaluate the same check against
+  // another world graph without touching |m_graph|, e.g. from a worker thread.
+  int8_t GetNumPassThroughChangesAllowed();
+  double GetStartToFinishDistanceM() const { return m_startToFinishDistanceM; }
+
   void GetEdgesList(Segment const & segment, bool isOutgoing,
                     std::vector<SegmentEdge> & edges) const;
 
@@ -29,6 +29,8 @@
 #include "indexer/data_source.hpp"
 #include "indexer/feature_altitude.hpp"
 
+#include "coding/file_container.hpp"
+
 #include "geometry/mercator.hpp"
 #include "geometry/parametrized_segment.hpp"
 #include "geometry/point2d.hpp"
@@ -36,11 +38,15 @@
 #include "platform/country_file.hpp"
 #include "platform/mwm_traits.hpp"
 
+#include "base/alloc_tracker.hpp"
 #include "base/exception.hpp"
 #include "base/stl_helpers.hpp"
+#include "base/thread.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <thread>
 #include <utility>
 
 #include "defines.hpp"
@@ -60,6 +66,21 @@ double constexpr kAdjustRangeM = 5000.0;
 double constexpr kMinDistanceToFinishM = 10000;
 // Limit of adjust in seconds.
 double constexpr kAdjustLimitSec = 5 * 60;
+// Lower bound of the adjust limit and its growth per meter of deviation from the route.
+// A small detour does not need a five minute wave over the whole neighbourhood.
+double constexpr kMinAdjustLimitSec = 60;
+double constexpr kAdjustLimitSecPerM = 1.0;
+
+// Maximal number of threads (including the calling one) processing middle leaps
+// of a long route in parallel. Each worker owns a world graph with its caches,
+// so the number is bounded to keep the memory usage sane.
+size_t constexpr kMaxLeapsWorkers = 4;
+
+// Leaps is a precomputed shortcut overlay: cross-mwm connectors keep ready-made
+// enter-to-exit weights, so a leap-based query expands orders of magnitude fewer
+// vertices than a plain wave. For car routes longer than this threshold leaps
+// are preferred even when all mwms of the route are near each other.
+double constexpr kLeapsPreferredDistanceM = 500000.0;
 
 double CalcMaxSpeed(NumMwmIds const & numMwmIds,
                     VehicleModelFactoryInterface const & vehicleModelFactory,
@@ -213,6 +234,22 @@ void PushPassedSubroutes(Checkpoints const & checkpoints, vector<Route::Subroute
   }
 }
 
+// Pulls the bytes of section |tag| into the OS page cache. The read contents are
+// discarded: a following deserialization of the section reads the same pages
+// without disk seeks.
+void WarmSection(FilesContainerR const & cont, string const & tag)
+{
+  if (!cont.IsExist(tag))
+    return;
+
+  FilesContainerR::TReader const reader = cont.GetReader(tag);
+  uint64_t const size = reader.Size();
+  uint64_t constexpr kChunkSize = 1 << 16;
+  vector<uint8_t> buffer(kChunkSize);
+  for (uint64_t pos = 0; pos < size; pos += kChunkSize)
+    reader.Read(pos, buffer.data(), static_cast<size_t>(min(kChunkSize, size - pos)));
+}
+
 bool GetLastRealOrPart(IndexGraphStarter const & starter, vector<Segment> const & route,
                        Segment & real)
 {
@@ -327,6 +364,8 @@ RouterResultCode IndexRouter::CalculateRoute(Checkpoints const & checkpoints,
                                              bool adjustToPrevRoute,
                                              RouterDelegate const & delegate, Route & route)
 {
+  SCOPED_ALLOC_TAG("routing:index_router");
+
   vector<string> outdatedMwms;
   GetOutdatedMwms(m_dataSource, outdatedMwms);
 
@@ -350,7 +389,7 @@ RouterResultCode IndexRouter::CalculateRoute(Checkpoints const & checkpoints,
       double const distanceToFinish = MercatorBounds::DistanceOnEarth(startPoint, finalPoint);
       if (distanceToRoute <= kAdjustRangeM && distanceToFinish >= kMinDistanceToFinishM)
       {
-        auto const code = AdjustRoute(checkpoints, startDirection, delegate, route);
+        auto const code = AdjustRoute(checkpoints, startDirection, distanceToRoute, delegate, route);
         if (code != RouterResultCode::RouteNotFound)
           return code;
 
@@ -370,6 +409,109 @@ RouterResultCode IndexRouter::CalculateRoute(Checkpoints const & checkpoints,
   }
 }
 
+RouterResultCode IndexRouter::CalculateWeightMatrix(vector<m2::PointD> const & sources,
+                                                    vector<m2::PointD> const & targets,
+                                                    RouterDelegate const & delegate,
+                                                    vector<vector<RouteWeight>> & weights)
+{
+  weights.clear();
+  if (sources.empty() || targets.empty())
+    return RouterResultCode::NoError;
+
+  TrafficStash::Guard guard(m_trafficStash);
+  auto graph = MakeWorldGraph();
+  graph->SetMode(WorldGraph::Mode::NoLeaps);
+
+  vector<Segment> sourceSegments(sources.size());
+  for (size_t i = 0; i < sources.size(); ++i)
+  {
+    if (!FindBestSegment(sources[i], m2::PointD::Zero() /* direction */, true /* isOutgoing */,
+                         *graph, sourceSegments[i]))
+    {
+      return RouterResultCode::StartPointNotFound;
+    }
+  }
+
+  // Several targets may snap to one segment.
+  map<Segment, vector<size_t>> targetIndices;
+  for (size_t j = 0; j < targets.size(); ++j)
+  {
+    Segment segment;
+    if (!FindBestSegment(targets[j], m2::PointD::Zero() /* direction */, false /* isOutgoing */,
+                         *graph, segment))
+    {
+      return RouterResultCode::EndPointNotFound;
+    }
+    targetIndices[segment].push_back(j);
+  }
+
+  weights.assign(sources.size(), vector<RouteWeight>(targets.size(), GetAStarWeightMax<RouteWeight>()));
+
+  AStarAlgorithm<WorldGraph> algorithm;
+  for (size_t i = 0; i < sources.size(); ++i)
+  {
+    size_t remaining = targets.size();
+    AStarAlgorithm<WorldGraph>::Context context;
+    algorithm.PropagateWave(*graph, sourceSegments[i],
+                            [&](Segment const & vertex) {
+                              if (delegate.IsCancelled())
+                                return false;
+
+                              auto const it = targetIndices.find(vertex);
+                              if (it != targetIndices.cend())
+                              {
+                                for (size_t const j : it->second)
+                                {
+                                  if (weights[i][j] == GetAStarWeightMax<RouteWeight>())
+                                  {
+                                    weights[i][j] = context.GetDistance(vertex);
+                                    --remaining;
+                                  }
+                                }
+                              }
+                              return remaining > 0;
+                            },
+                            context);
+
+    if (delegate.IsCancelled())
+      return RouterResultCode::Cancelled;
+  }
+
+  return RouterResultCode::NoError;
+}
+
+void IndexRouter::PrefetchRouteCorridor(vector<m2::PointD> const & points)
+{
+  set<string> countries;
+  for (auto const & point : points)
+    countries.insert(m_countryFileFn(point));
+
+  for (auto const & country : countries)
+  {
+    if (country.empty())
+      continue;
+
+    MwmSet::MwmHandle handle =
+        m_dataSource.GetMwmHandleByCountryFile(platform::CountryFile(country));
+    if (!handle.IsAlive())
+      continue;
+
+    try
+    {
+      auto const & cont = handle.GetValue<MwmValue>()->m_cont;
+      WarmSection(cont, ROUTING_FILE_TAG);
+      WarmSection(cont, RESTRICTIONS_FILE_TAG);
+      WarmSection(cont, ROAD_ACCESS_FILE_TAG);
+      WarmSection(cont, CITY_ROADS_FILE_TAG);
+    }
+    catch (RootException const & e)
+    {
+      // Prefetch is best effort, the rebuild reads the sections for real anyway.
+      LOG(LWARNING, ("Can't prefetch routing sections of", country, ":", e.Msg()));
+    }
+  }
+}
+
 RouterResultCode IndexRouter::DoCalculateRoute(Checkpoints const & checkpoints,
                                                m2::PointD const & startDirection,
                                                RouterDelegate const & delegate, Route & route)
@@ -497,9 +639,17 @@ RouterResultCode IndexRouter::CalculateSubroute(Checkpoints const & checkpoints,
       starter.GetGraph().SetMode(WorldGraph::Mode::NoLeaps);
       break;
     case VehicleType::Car:
-      starter.GetGraph().SetMode(AreMwmsNear(starter.GetMwms()) ? WorldGraph::Mode::NoLeaps
-                                                                : WorldGraph::Mode::LeapsOnly);
+    {
+      set<NumMwmId> const mwms = starter.GetMwms();
+      double const startToFinishDistanceM = MercatorBounds::DistanceOnEarth(
+          checkpoints.GetPoint(subrouteIdx), checkpoints.GetPoint(subrouteIdx + 1));
+      bool const useLeaps =
+          mwms.size() > 1 &&
+          (!AreMwmsNear(mwms) || startToFinishDistanceM >= kLeapsPreferredDistanceM);
+      starter.GetGraph().SetMode(useLeaps ? WorldGraph::Mode::LeapsOnly
+                                          : WorldGraph::Mode::NoLeaps);
       break;
+    }
     case VehicleType::Count:
       CHECK(false, ("Unknown vehicle type:", m_vehicleType));
       break;
@@ -554,6 +704,7 @@ RouterResultCode IndexRouter::CalculateSubroute(Checkpoints const & checkpoints,
 
 RouterResultCode IndexRouter::AdjustRoute(Checkpoints const & checkpoints,
                                           m2::PointD const & startDirection,
+                                          double distanceToRouteM,
                                           RouterDelegate const & delegate, Route & route)
 {
   base::Timer timer;
@@ -611,8 +762,10 @@ RouterResultCode IndexRouter::AdjustRoute(Checkpoints const & checkpoints,
     delegate.OnPointCheck(point);
   };
 
-  auto const checkLength = [&starter](RouteWeight const & weight) {
-    return weight <= RouteWeight(kAdjustLimitSec) && starter.CheckLength(weight);
+  double const adjustLimitSec =
+      min(kAdjustLimitSec, max(kMinAdjustLimitSec, distanceToRouteM * kAdjustLimitSecPerM));
+  auto const checkLength = [&starter, adjustLimitSec](RouteWeight const & weight) {
+    return weight <= RouteWeight(adjustLimitSec) && starter.CheckLength(weight);
   };
 
   AStarAlgorithm<IndexGraphStarter> algorithm;
@@ -700,29 +853,36 @@ bool IndexRouter::FindBestSegment(m2::PointD const & point, m2::PointD const & d
     return Segment(numMwmId, edge.GetFeatureId().m_index, edge.GetSegId(), edge.IsForward());
   };
 
-  // Getting rid of knowingly bad candidates.
   base::EraseIf(candidates, [&](pair<Edge, Junction> const & p) {
-    Edge const & edge = p.first;
-    return edge.GetFeatureId().m_mwmId != mwmId ||
-           IsDeadEnd(getSegmentByEdge(edge), isOutgoing, worldGraph);
+    return p.first.GetFeatureId().m_mwmId != mwmId;
   });
 
   if (candidates.empty())
     return false;
 
+  // The dead end check walks the graph and is by far the most expensive part
+  // of snapping, so it is run lazily: candidates are ordered by preference
+  // first and the walk stops at the first candidate which is not a dead end.
+  // Usually that is the very first one.
   BestEdgeComparator bestEdgeComparator(point, direction);
-  Edge bestEdge = candidates[0].first;
-  for (size_t i = 1; i < candidates.size(); ++i)
+  sort(candidates.begin(), candidates.end(),
+       [&bestEdgeComparator](pair<Edge, Junction> const & p1, pair<Edge, Junction> const & p2) {
+         return bestEdgeComparator.Compare(p1.first, p2.first) < 0;
+       });
+
+  for (auto const & candidate : candidates)
   {
-    Edge const & edge = candidates[i].first;
-    if (bestEdgeComparator.Compare(edge, bestEdge) < 0)
-      bestEdge = edge;
+    Edge const & edge = candidate.first;
+    if (IsDeadEnd(getSegmentByEdge(edge), isOutgoing, worldGraph))
+      continue;
+
+    bestSegmentIsAlmostCodirectional =
+        bestEdgeComparator.IsDirectionValid() && bestEdgeComparator.IsAlmostCodirectional(edge);
+    bestSegment = getSegmentByEdge(edge);
+    return true;
   }
 
-  bestSegmentIsAlmostCodirectional =
-      bestEdgeComparator.IsDirectionValid() && bestEdgeComparator.IsAlmostCodirectional(bestEdge);
-  bestSegment = getSegmentByEdge(bestEdge);
-  return true;
+  return false;
 }
 
 RouterResultCode IndexRouter::ProcessLeaps(vector<Segment> const & input,
@@ -742,10 +902,6 @@ RouterResultCode IndexRouter::ProcessLeaps(vector<Segment> const & input,
 
   WorldGraph & worldGraph = starter.GetGraph();
 
-  // For all leaps except the first leap which connects start to mwm exit in LeapsOnly mode we need
-  // to drop first segment of the leap because we already have its twin from the previous mwm.
-  bool dropFirstSegment = false;
-
   // While route building in LeapOnly mode we estimate start to mwm exit distance. This estimation may
   // be incorrect and it causes appearance of unneeded loops: route goes from start to wrongly selected mwm exit,
   // then we have small unneeded leap in other mwm which returns us to start mwm, then we have leap in start mwm
@@ -767,81 +923,141 @@ RouterResultCode IndexRouter::ProcessLeaps(vector<Segment> const & input,
                                          [lastMwmId](Segment const & s) { return s.GetMwmId() == lastMwmId; });
   auto const finishLeapStart = static_cast<size_t>(distance(input.begin(), finishLeapStartIt));
 
-  for (size_t i = 0; i <= finishLeapStart; ++i)
+  // The inputs of IndexGraphStarter::CheckLength() are precomputed here so the per-mwm
+  // leap searches below can evaluate the same check against their own world graphs
+  // without touching the shared one.
+  int8_t const numPassThroughChangesAllowed = starter.GetNumPassThroughChangesAllowed();
+  double const startToFinishDistanceM = starter.GetStartToFinishDistanceM();
+
+  // Calculates the route of one middle leap (a pair of neighbouring enter and exit
+  // transition segments of one mwm) on |graph|. Safe to call from a worker thread as
+  // soon as |graph| is not shared between threads.
+  auto const calcMiddleLeap = [&](WorldGraph & graph, Segment const & current,
+                                  Segment const & next,
+                                  RoutingResult<Segment, RouteWeight> & routingResult) {
+    CHECK(!IndexGraphStarter::IsFakeSegment(current), ());
+    CHECK(!IndexGraphStarter::IsFakeSegment(next), ());
+    CHECK_EQUAL(current.GetMwmId(), next.GetMwmId(),
+                ("Different mwm ids for leap enter and exit, size of input:", input.size()));
+
+    // Clear previous loaded graphs to not spend too much memory at one time.
+    graph.ClearCachedGraphs();
+    // Single mwm route.
+    graph.SetMode(WorldGraph::Mode::SingleMwm);
+
+    auto checkLength = [&](RouteWeight const & weight) {
+      return weight.GetNumPassThroughChanges() <= numPassThroughChangesAllowed &&
+             graph.CheckLength(weight, startToFinishDistanceM);
+    };
+    AStarAlgorithm<WorldGraph>::Params params(graph, current, next, nullptr /* prevRoute */,
+                                              delegate, {} /* onVisitedVertexCallback */,
+                                              checkLength);
+    set<NumMwmId> const mwmIds = {current.GetMwmId(), next.GetMwmId()};
+    return FindPath<WorldGraph>(params, mwmIds, routingResult);
+  };
+
+  // Middle leaps are independent searches in distinct mwms, so they are distributed
+  // between worker threads, each owning a separate world graph over the same data source.
+  vector<size_t> jobs;
+  for (size_t i = startLeapEnd + 1; i < finishLeapStart; i += 2)
+    jobs.push_back(i);
+
+  vector<RoutingResult<Segment, RouteWeight>> leapResults(jobs.size());
+  vector<RouterResultCode> leapCodes(jobs.size(), RouterResultCode::InternalError);
+
+  atomic<size_t> nextJob(0);
+  atomic<bool> failed(false);
+  auto const processJobs = [&](WorldGraph & graph) {
+    while (!failed && !delegate.IsCancelled())
+    {
+      size_t const jobIdx = nextJob.fetch_add(1);
+      if (jobIdx >= jobs.size())
+        return;
+
+      size_t const i = jobs[jobIdx];
+      leapCodes[jobIdx] = calcMiddleLeap(graph, input[i], input[i + 1], leapResults[jobIdx]);
+      if (leapCodes[jobIdx] != RouterResultCode::NoError)
+        failed = true;
+    }
+  };
+
+  size_t const numWorkers = min({jobs.size(), kMaxLeapsWorkers,
+                                 static_cast<size_t>(max(1u, thread::hardware_concurrency()))});
+  if (numWorkers > 1)
+  {
+    vector<threads::SimpleThread> workers;
+    workers.reserve(numWorkers - 1);
+    for (size_t w = 0; w + 1 < numWorkers; ++w)
+    {
+      workers.emplace_back([this, &processJobs]() {
+        auto const graph = MakeWorldGraph();
+        processJobs(*graph);
+      });
+    }
+    // The calling thread processes its share of the leaps on the shared graph.
+    processJobs(worldGraph);
+    for (auto & worker : workers)
+      worker.join();
+  }
+  else
   {
-    auto const & current = input[i];
+    processJobs(worldGraph);
+  }
 
+  if (delegate.IsCancelled())
+    return RouterResultCode::Cancelled;
+
+  // First start-to-mwm-exit and last mwm-enter-to-finish leaps need special processing.
+  // In case of leaps from the start to its mwm transition and from finish to mwm transition
+  // route calculation should be made on the world graph (WorldGraph::Mode::NoLeaps).
+  auto const calcEndingLeap = [&](Segment const & current, Segment const & next, bool isStartLeap,
+                                  RoutingResult<Segment, RouteWeight> & routingResult) {
     // Clear previous loaded graphs to not spend too much memory at one time.
     worldGraph.ClearCachedGraphs();
+    worldGraph.SetMode(WorldGraph::Mode::NoLeaps);
 
     auto checkLength = [&starter](RouteWeight const & weight) {
       return starter.CheckLength(weight);
     };
+    AStarAlgorithm<IndexGraphStarter>::Params params(
+        starter, current, next, nullptr /* prevRoute */, delegate,
+        {} /* onVisitedVertexCallback */, checkLength);
+    set<NumMwmId> mwmIds = isStartLeap ? starter.GetStartMwms() : starter.GetFinishMwms();
+    mwmIds.insert(isStartLeap ? next.GetMwmId() : current.GetMwmId());
+    return FindPath<IndexGraphStarter>(params, mwmIds, routingResult);
+  };
 
-    RouterResultCode result = RouterResultCode::InternalError;
-    RoutingResult<Segment, RouteWeight> routingResult;
-    if (i == 0 || i == finishLeapStart)
-    {
-      bool const isStartLeap = i == 0;
-      i = isStartLeap ? startLeapEnd : input.size() - 1;
-      CHECK_LESS(static_cast<size_t>(i), input.size(), ());
-      auto const & next = input[i];
-
-      // First start-to-mwm-exit and last mwm-enter-to-finish leaps need special processing.
-      // In case of leaps from the start to its mwm transition and from finish to mwm transition
-      // route calculation should be made on the world graph (WorldGraph::Mode::NoLeaps).
-      worldGraph.SetMode(WorldGraph::Mode::NoLeaps);
-      AStarAlgorithm<IndexGraphStarter>::Params params(
-          starter, current, next, nullptr /* prevRoute */, delegate,
-          {} /* onVisitedVertexCallback */, checkLength);
-      set<NumMwmId> mwmIds;
-      if (isStartLeap)
-      {
-        mwmIds = starter.GetStartMwms();
-        mwmIds.insert(next.GetMwmId());
-      }
-      else
-      {
-        mwmIds = starter.GetFinishMwms();
-        mwmIds.insert(current.GetMwmId());
-      }
+  // For all leaps except the first leap which connects start to mwm exit in LeapsOnly mode we need
+  // to drop first segment of the leap because we already have its twin from the previous mwm.
+  auto const appendLeap = [&output](vector<Segment> const & path, bool dropFirstSegment) {
+    CHECK(!path.empty(), ());
+    output.insert(output.end(), dropFirstSegment ? path.cbegin() + 1 : path.cbegin(),
+                  path.cend());
+  };
 
-      result = FindPath<IndexGraphStarter>(params, mwmIds, routingResult);
-    }
-    else
-    {
-      ++i;
-      CHECK_LESS(static_cast<size_t>(i), input.size(), ());
-      auto const & next = input[i];
-
-      CHECK(!IndexGraphStarter::IsFakeSegment(current), ());
-      CHECK(!IndexGraphStarter::IsFakeSegment(next), ());
-      CHECK_EQUAL(
-        current.GetMwmId(), next.GetMwmId(),
-        ("Different mwm ids for leap enter and exit, i:", i, "size of input:", input.size()));
-
-      // Single mwm route.
-      worldGraph.SetMode(WorldGraph::Mode::SingleMwm);
-      // It's not start-to-mwm-exit leap, we already have its first segment in previous mwm.
-      dropFirstSegment = true;
-      AStarAlgorithm<WorldGraph>::Params params(worldGraph, current, next, nullptr /* prevRoute */,
-                                                delegate, {} /* onVisitedVertexCallback */,
-                                                checkLength);
-      set<NumMwmId> const mwmIds = {current.GetMwmId(), next.GetMwmId()};
-      result = FindPath<WorldGraph>(params, mwmIds, routingResult);
-    }
+  RoutingResult<Segment, RouteWeight> startLeapResult;
+  auto result =
+      calcEndingLeap(input[0], input[startLeapEnd], true /* isStartLeap */, startLeapResult);
+  if (result != RouterResultCode::NoError)
+    return result;
 
-    if (result != RouterResultCode::NoError)
-      return result;
+  appendLeap(startLeapResult.m_path, false /* dropFirstSegment */);
 
-    CHECK(!routingResult.m_path.empty(), ());
-    output.insert(
-        output.end(),
-        dropFirstSegment ? routingResult.m_path.cbegin() + 1 : routingResult.m_path.cbegin(),
-        routingResult.m_path.cend());
-    dropFirstSegment = true;
+  for (size_t jobIdx = 0; jobIdx < jobs.size(); ++jobIdx)
+  {
+    if (leapCodes[jobIdx] != RouterResultCode::NoError)
+      return leapCodes[jobIdx];
+
+    appendLeap(leapResults[jobIdx].m_path, true /* dropFirstSegment */);
   }
 
+  RoutingResult<Segment, RouteWeight> finishLeapResult;
+  result = calcEndingLeap(input[finishLeapStart], input.back(), false /* isStartLeap */,
+                          finishLeapResult);
+  if (result != RouterResultCode::NoError)
+    return result;
+
+  appendLeap(finishLeapResult.m_path, true /* dropFirstSegment */);
   return RouterResultCode::NoError;
 }
 
@@ -72,8 +72,21 @@ public:
   bool FindBestSegment(m2::PointD const & point, m2::PointD const & direction,
                        bool isOutgoing, WorldGraph & worldGraph, Segment & bestSegment);
 
+  /// \brief Calculates the weight matrix between |sources| and |targets| without building
+  /// routes. One world graph together with its geometry caches serves the whole matrix and
+  /// one wave per source settles all targets.
+  /// \note Unreachable pairs are filled with GetAStarWeightMax<RouteWeight>().
+  RouterResultCode CalculateWeightMatrix(std::vector<m2::PointD> const & sources,
+                                         std::vector<m2::PointD> const & targets,
+                                         RouterDelegate const & delegate,
+                                         std::vector<std::vector<RouteWeight>> & weights);
+
   // IRouter overrides:
   std::string GetName() const override { return m_name; }
+  /// Reads the routing sections of the mwms along |points| to pull them into the page
+  /// cache, so a deviation rebuild deserializes them without cold disk reads.
+  /// Touches only DataSource which is thread-safe, see IRouter::PrefetchRouteCorridor().
+  void PrefetchRouteCorridor(std::vector<m2::PointD> const & points) override;
   RouterResultCode CalculateRoute(Checkpoints const & checkpoints, m2::PointD const & startDirection,
                                   bool adjustToPrevRoute, RouterDelegate const & delegate,
                                   Route & route) override;
@@ -86,8 +99,10 @@ private:
                                      RouterDelegate const & delegate, IndexGraphStarter & graph,
                                      std::vector<Segment> & subroute);
 
+  /// \param distanceToRouteM distance in meters from the current position to the previous route.
+  /// It bounds the propagation limit of the adjust wave.
   RouterResultCode AdjustRoute(Checkpoints const & checkpoints,
-                               m2::PointD const & startDirection,
+                               m2::PointD const & startDirection, double distanceToRouteM,
                                RouterDelegate const & delegate, Route & route);
 
   std::unique_ptr<WorldGraph> MakeWorldGraph();
@@ -9,8 +9,22 @@ using namespace std;
 
 namespace
 {
+using namespace routing;
+
 string const kNames[] = {"No", "Private", "Destination", "Yes", "Count"};
 
+template <typename Key>
+RoadAccess::Type FindType(RoadAccess::Types<Key> const & types, Key const & key)
+{
+  auto const it = lower_bound(
+      types.cbegin(), types.cend(), key,
+      [](pair<Key, RoadAccess::Type> const & kv, Key const & k) { return kv.first < k; });
+  if (it != types.cend() && it->first == key)
+    return it->second;
+
+  return RoadAccess::Type::Yes;
+}
+
 template <typename KV>
 void PrintKV(ostringstream & oss, KV const & kvs, size_t maxKVToShow)
 {
@@ -34,22 +48,12 @@ namespace routing
 // RoadAccess --------------------------------------------------------------------------------------
 RoadAccess::Type RoadAccess::GetFeatureType(uint32_t featureId) const
 {
-// todo(@m) This may or may not be too slow. Consider profiling this and using
-// a Bloom filter or anything else that is faster than std::map.
-  auto const it = m_featureTypes.find(featureId);
-  if (it != m_featureTypes.cend())
-    return it->second;
-
-  return RoadAccess::Type::Yes;
+  return FindType(m_featureTypes, featureId);
 }
 
 RoadAccess::Type RoadAccess::GetPointType(RoadPoint const & point) const
 {
-  auto const it = m_pointTypes.find(point);
-  if (it != m_pointTypes.cend())
-    return it->second;
-
-  return RoadAccess::Type::Yes;
+  return FindType(m_pointTypes, point);
 }
 
 bool RoadAccess::operator==(RoadAccess const & rhs) const
@@ -105,8 +105,8 @@ public:
 
 private:
   template <typename Sink>
-  static void SerializeOneVehicleType(Sink & sink, RoadAccessTypesFeatureMap const & mf,
-                                      RoadAccessTypesPointMap const & mp)
+  static void SerializeOneVehicleType(Sink & sink, RoadAccess::Types<uint32_t> const & mf,
+                                      RoadAccess::Types<RoadPoint> const & mp)
   {
     std::array<std::vector<Segment>, static_cast<size_t>(RoadAccess::Type::Count)>
         segmentsByRoadAccessType;
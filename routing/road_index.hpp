@@ -117,6 +117,11 @@ class RoadIndex final
 public:
   void Import(vector<Joint> const & joints);
 
+  // Preallocates the buckets for |numRoads| roads. The number of roads is known from
+  // the section header before deserialization, so reserving here avoids rehashing
+  // while PushFromSerializer fills the index.
+  void Reserve(uint32_t numRoads) { m_roads.reserve(numRoads); }
+
   void AddJoint(RoadPoint const & rp, Joint::Id jointId)
   {
     m_roads[rp.GetFeatureId()].AddJoint(rp.GetPointId(), jointId);
@@ -133,7 +138,17 @@ public:
 
   void PushFromSerializer(Joint::Id jointId, RoadPoint const & rp)
   {
-    m_roads[rp.GetFeatureId()].AddJoint(rp.GetPointId(), jointId);
+    // The serializer decodes the section road by road, so consecutive pushes mostly hit
+    // the same road; memoizing it skips the hash lookup on those pushes. The pointer
+    // stays valid because unordered_map never invalidates references on insert.
+    uint32_t const featureId = rp.GetFeatureId();
+    if (m_pushedRoad == nullptr || m_pushedFeatureId != featureId)
+    {
+      m_pushedRoad = &m_roads[featureId];
+      m_pushedFeatureId = featureId;
+    }
+
+    m_pushedRoad->AddJoint(rp.GetPointId(), jointId);
   }
 
   // Find nearest point with normal joint id.
@@ -164,5 +179,8 @@ public:
 private:
   // Map from feature id to RoadJointIds.
   unordered_map<uint32_t, RoadJointIds> m_roads;
+  // The road of the last PushFromSerializer call, see the comment there.
+  RoadJointIds * m_pushedRoad = nullptr;
+  uint32_t m_pushedFeatureId = 0;
 };
 }  // namespace routing
@@ -1,5 +1,6 @@
 #include "routing/route.hpp"
 
+#include "routing/edge_estimator.hpp"
 #include "routing/turns_generator.hpp"
 
 #include "traffic/speed_groups.hpp"
@@ -344,6 +345,38 @@ traffic::SpeedGroup Route::GetTraffic(size_t segmentIdx) const
   return m_routeSegments[segmentIdx].GetTraffic();
 }
 
+void Route::UpdateTraffic(function<traffic::SpeedGroup(Segment const &)> const & getSpeedGroup)
+{
+  CHECK(getSpeedGroup, ());
+
+  double timeFromBeginningS = 0.0;
+  double prevTimeFromBeginningS = 0.0;
+  for (auto & routeSegment : m_routeSegments)
+  {
+    double const oldDurationS = routeSegment.GetTimeFromBeginningSec() - prevTimeFromBeginningS;
+    prevTimeFromBeginningS = routeSegment.GetTimeFromBeginningSec();
+
+    double durationS = oldDurationS;
+    // Fake segments (start and finish projections) do not have traffic.
+    if (routeSegment.IsRealSegment())
+    {
+      auto const group = getSpeedGroup(routeSegment.GetSegment());
+      auto const oldGroup = routeSegment.GetTraffic();
+      if (group != oldGroup)
+      {
+        // The estimator applies traffic as a multiplier to the segment time,
+        // so the stored time is rescaled exactly without road geometry.
+        durationS = oldDurationS * EdgeEstimator::CalcCarTrafficFactor(group) /
+                    EdgeEstimator::CalcCarTrafficFactor(oldGroup);
+        routeSegment.SetTraffic(group);
+      }
+    }
+
+    timeFromBeginningS += durationS;
+    routeSegment.SetTimeFromBeginningSec(timeFromBeginningS);
+  }
+}
+
 void Route::GetTurnsForTesting(vector<TurnItem> & turns) const
 {
   turns.clear();
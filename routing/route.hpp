@@ -17,6 +17,7 @@
 #include "base/assert.hpp"
 #include "base/math.hpp"
 
+#include <functional>
 #include <limits>
 #include <memory>
 #include <set>
@@ -83,6 +84,9 @@ public:
     m_transitInfo.Set(move(transitInfo));
   }
 
+  void SetTraffic(traffic::SpeedGroup traffic) { m_traffic = traffic; }
+  void SetTimeFromBeginningSec(double timeS) { m_timeFromBeginningS = timeS; }
+
   Segment const & GetSegment() const { return m_segment; }
   Junction const & GetJunction() const { return m_junction; }
   std::string const & GetStreet() const { return m_street; }
@@ -366,6 +370,12 @@ public:
   bool HaveAltitudes() const { return m_haveAltitudes; }
   traffic::SpeedGroup GetTraffic(size_t segmentIdx) const;
 
+  /// \brief Re-applies traffic data to the built route without rebuilding it.
+  /// Per-segment speed groups are taken from |getSpeedGroup| and cumulative
+  /// times are rescaled by the ratio of the new and the old car traffic
+  /// factors, so ETA and coloring stay consistent with the fresh traffic.
+  void UpdateTraffic(std::function<traffic::SpeedGroup(Segment const &)> const & getSpeedGroup);
+
   void GetTurnsForTesting(std::vector<turns::TurnItem> & turns) const;
   bool IsRouteId(uint64_t routeId) const { return routeId == m_routeId; }
 
@@ -12,6 +12,7 @@
 
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace routing
 {
@@ -49,6 +50,11 @@ public:
   /// Clear all temporary buffers.
   virtual void ClearState() {}
 
+  /// Warm up the data needed to rebuild a route along |points| (the polyline of the
+  /// route being followed). Called on a low priority thread while a route calculation
+  /// may be running, so an implementation must touch only thread-safe data.
+  virtual void PrefetchRouteCorridor(std::vector<m2::PointD> const & /* points */) {}
+
   /// Override this function with routing implementation.
   /// It will be called in separate thread and only one function will processed in same time.
   /// @warning please support Cancellable interface calls. You must stop processing when it is true.
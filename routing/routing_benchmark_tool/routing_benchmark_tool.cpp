@@ -0,0 +1,245 @@
+#include "testing/testing.hpp"
+#include "routing/routing_integration_tests/routing_test_tools.hpp"
+
+#include "routing/checkpoints.hpp"
+#include "routing/router_delegate.hpp"
+#include "routing/routing_callbacks.hpp"
+
+#include "geometry/mercator.hpp"
+#include "geometry/point2d.hpp"
+
+#include "base/logging.hpp"
+#include "base/string_utils.hpp"
+#include "base/timer.hpp"
+
+#include "std/target_os.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "3party/jansson/myjansson.hpp"
+
+#include "3party/gflags/src/gflags/gflags.h"
+
+#if !defined(OMIM_OS_WINDOWS)
+#include <sys/resource.h>
+#endif
+
+using namespace routing;
+using namespace std;
+
+// Testing stub to make routing test tools linkable.
+static CommandLineOptions g_options;
+CommandLineOptions const & GetTestingOptions() { return g_options; }
+
+DEFINE_string(input_file, "", "File with recorded routing scenarios. Each line is a checkpoint "
+                              "set: two or more points listed as latitude and longitude separated "
+                              "by comma, points separated by semicolon. Empty lines and lines "
+                              "starting with # are skipped.");
+DEFINE_string(output_file, "", "File for the JSON report. The report is written to log if empty.");
+DEFINE_string(data_path, "../../data/", "Working directory, 'path_to_exe/../../data' if empty.");
+DEFINE_string(user_resource_path, "", "User defined resource path for classificator.txt and etc.");
+DEFINE_int32(vehicle_type, 2, "Numeric value of routing::VehicleType enum: 0 - pedestrian, "
+                              "1 - bicycle, 2 - car, 3 - transit.");
+DEFINE_uint64(timeout, 0, "Timeout for a single route calculation in seconds, 0 means no timeout.");
+
+namespace
+{
+struct ScenarioResult
+{
+  size_t m_lineNumber = 0;
+  RouterResultCode m_code = RouterResultCode::InternalError;
+  double m_wallTimeSec = 0.0;
+  double m_lengthMeters = 0.0;
+  double m_etaSec = 0.0;
+  // Number of RouterDelegate::OnPointCheck calls. The router reports every
+  // kVisitPeriod-th settled vertex, so the value is proportional to the
+  // search space size and can be trended across releases.
+  uint64_t m_visitedCount = 0;
+};
+
+bool ParseCheckpoints(string const & line, vector<m2::PointD> & points)
+{
+  auto const pointTokens = strings::Tokenize(line, ";");
+  if (pointTokens.size() < 2)
+    return false;
+
+  for (auto const & pointToken : pointTokens)
+  {
+    auto const coords = strings::Tokenize(pointToken, ",");
+    double lat = 0.0;
+    double lon = 0.0;
+    if (coords.size() != 2 || !strings::to_double(coords[0], lat) ||
+        !strings::to_double(coords[1], lon))
+    {
+      return false;
+    }
+    if (!MercatorBounds::ValidLat(lat) || !MercatorBounds::ValidLon(lon))
+      return false;
+
+    points.push_back(MercatorBounds::FromLatLon(lat, lon));
+  }
+  return true;
+}
+
+uint64_t GetPeakRSSInBytes()
+{
+#if defined(OMIM_OS_WINDOWS)
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#if defined(OMIM_OS_MAC)
+  // ru_maxrss is in bytes on macOS.
+  return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+  // ru_maxrss is in kilobytes on Linux.
+  return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+// Nearest-rank percentile of an ascending-sorted sample.
+double Percentile(vector<double> const & sorted, double p)
+{
+  CHECK(!sorted.empty(), ());
+  auto const rank = static_cast<size_t>(ceil(p * sorted.size()));
+  return sorted[min(sorted.size() - 1, rank == 0 ? 0 : rank - 1)];
+}
+
+base::JSONPtr MakeReport(vector<ScenarioResult> const & results)
+{
+  auto report = base::NewJSONObject();
+  ToJSONObject(*report, "vehicleType", FLAGS_vehicle_type);
+
+  auto scenarios = base::NewJSONArray();
+  vector<double> successTimes;
+  size_t errors = 0;
+  for (auto const & result : results)
+  {
+    auto scenario = base::NewJSONObject();
+    ToJSONObject(*scenario, "line", result.m_lineNumber);
+    ToJSONObject(*scenario, "result", DebugPrint(result.m_code));
+    ToJSONObject(*scenario, "timeSec", result.m_wallTimeSec);
+    ToJSONObject(*scenario, "visitedCount", result.m_visitedCount);
+    if (result.m_code == RouterResultCode::NoError)
+    {
+      ToJSONObject(*scenario, "lengthMeters", result.m_lengthMeters);
+      ToJSONObject(*scenario, "etaSec", result.m_etaSec);
+      successTimes.push_back(result.m_wallTimeSec);
+    }
+    else
+    {
+      ++errors;
+    }
+    json_array_append_new(scenarios.get(), scenario.release());
+  }
+  ToJSONObject(*report, "scenarios", scenarios);
+
+  auto summary = base::NewJSONObject();
+  ToJSONObject(*summary, "scenarios", results.size());
+  ToJSONObject(*summary, "errors", errors);
+  if (!successTimes.empty())
+  {
+    sort(successTimes.begin(), successTimes.end());
+    auto percentiles = base::NewJSONObject();
+    ToJSONObject(*percentiles, "p50", Percentile(successTimes, 0.5));
+    ToJSONObject(*percentiles, "p90", Percentile(successTimes, 0.9));
+    ToJSONObject(*percentiles, "p95", Percentile(successTimes, 0.95));
+    ToJSONObject(*percentiles, "p99", Percentile(successTimes, 0.99));
+    ToJSONObject(*summary, "timeSecPercentiles", percentiles);
+  }
+  ToJSONObject(*summary, "peakRSSBytes", GetPeakRSSInBytes());
+  ToJSONObject(*report, "summary", summary);
+  return report;
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  google::SetUsageMessage("Calculates routes for recorded checkpoint sets on local mwms and "
+                          "reports per-scenario wall time, result code and search space size "
+                          "as JSON which can be trended across releases.");
+  google::ParseCommandLineFlags(&argc, &argv, true);
+
+  g_options.m_dataPath = FLAGS_data_path.c_str();
+  g_options.m_resourcePath = FLAGS_user_resource_path.c_str();
+  if (FLAGS_input_file.empty())
+  {
+    google::ShowUsageWithFlags(argv[0]);
+    return 1;
+  }
+
+  CHECK_GREATER_OR_EQUAL(FLAGS_vehicle_type, 0, ());
+  CHECK_LESS(FLAGS_vehicle_type, static_cast<int>(VehicleType::Count), ());
+
+  auto const components =
+      integration::CreateAllMapsComponents(static_cast<VehicleType>(FLAGS_vehicle_type));
+  CHECK(components, ());
+
+  vector<ScenarioResult> results;
+  ifstream stream(FLAGS_input_file);
+  string line;
+  for (size_t lineNumber = 1; getline(stream, line); ++lineNumber)
+  {
+    strings::Trim(line);
+    if (line.empty() || line.front() == '#')
+      continue;
+
+    vector<m2::PointD> points;
+    if (!ParseCheckpoints(line, points))
+    {
+      LOG(LWARNING, ("Can't parse checkpoints on line", lineNumber, ":", line));
+      continue;
+    }
+
+    ScenarioResult result;
+    result.m_lineNumber = lineNumber;
+
+    RouterDelegate delegate;
+    if (FLAGS_timeout != 0)
+      delegate.SetTimeout(static_cast<uint32_t>(FLAGS_timeout));
+    delegate.SetPointCheckCallback([&result](m2::PointD const &) { ++result.m_visitedCount; });
+
+    // Each scenario starts from a cold router the same way the first request
+    // of a user session does.
+    components->GetRouter().ClearState();
+
+    Route route("routing_benchmark_tool", 0 /* route id */);
+    base::Timer timer;
+    result.m_code = components->GetRouter().CalculateRoute(Checkpoints(move(points)),
+                                                           m2::PointD::Zero(), false /* adjust */,
+                                                           delegate, route);
+    result.m_wallTimeSec = timer.ElapsedSeconds();
+    if (result.m_code == RouterResultCode::NoError)
+    {
+      result.m_lengthMeters = route.GetTotalDistanceMeters();
+      result.m_etaSec = route.GetTotalTimeSec();
+    }
+
+    LOG(LINFO, ("Line", lineNumber, ":", DebugPrint(result.m_code), "in", result.m_wallTimeSec,
+                "seconds"));
+    results.push_back(result);
+  }
+
+  auto const report = MakeReport(results);
+  unique_ptr<char, JSONFreeDeleter> buffer(
+      json_dumps(report.get(), JSON_INDENT(2) | JSON_ENSURE_ASCII));
+  if (FLAGS_output_file.empty())
+  {
+    LOG(LINFO, (buffer.get()));
+  }
+  else
+  {
+    ofstream output(FLAGS_output_file);
+    output << buffer.get() << endl;
+  }
+
+  return 0;
+}
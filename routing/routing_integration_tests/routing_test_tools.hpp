@@ -94,10 +94,6 @@ private:
 };
 
 void GetAllLocalFiles(vector<LocalCountryFile> & localFiles);
-void TestOnlineCrosses(ms::LatLon const & startPoint, ms::LatLon const & finalPoint,
-                       vector<string> const & expected, IRouterComponents & routerComponents);
-void TestOnlineFetcher(ms::LatLon const & startPoint, ms::LatLon const & finalPoint,
-                       vector<string> const & expected, IRouterComponents & routerComponents);
 
 shared_ptr<VehicleRouterComponents> CreateAllMapsComponents(VehicleType vehicleType);
 
@@ -50,6 +50,60 @@ void FormatDistance(double dist, string & value, string & suffix)
   value.erase(delim);
 };
 
+// RoutingSession::RouteCache ---------------------------------------------------------------------
+// static
+RoutingSession::RouteCache::Key RoutingSession::RouteCache::MakeKey(
+    Checkpoints const & checkpoints)
+{
+  // About ten meters in mercator near the equator.
+  double constexpr kQuantizeScale = 1.0e4;
+
+  Key key;
+  key.reserve(checkpoints.GetPoints().size());
+  for (auto const & point : checkpoints.GetPoints())
+  {
+    key.emplace_back(static_cast<int32_t>(point.x * kQuantizeScale),
+                     static_cast<int32_t>(point.y * kQuantizeScale));
+  }
+  return key;
+}
+
+void RoutingSession::RouteCache::Put(Checkpoints const & checkpoints, Route const & route)
+{
+  Key key = MakeKey(checkpoints);
+  for (auto it = m_routes.begin(); it != m_routes.end(); ++it)
+  {
+    if (it->first == key)
+    {
+      it->second = make_shared<Route>(route);
+      m_routes.splice(m_routes.begin(), m_routes, it);
+      return;
+    }
+  }
+
+  m_routes.emplace_front(move(key), make_shared<Route>(route));
+  if (m_routes.size() > kMaxRoutes)
+    m_routes.pop_back();
+}
+
+shared_ptr<Route> RoutingSession::RouteCache::Get(Checkpoints const & checkpoints)
+{
+  Key const key = MakeKey(checkpoints);
+  for (auto it = m_routes.begin(); it != m_routes.end(); ++it)
+  {
+    if (it->first == key)
+    {
+      m_routes.splice(m_routes.begin(), m_routes, it);
+      // A copy is returned because the session mutates the route while following it.
+      return make_shared<Route>(*it->second);
+    }
+  }
+  return nullptr;
+}
+
+void RoutingSession::RouteCache::Clear() { m_routes.clear(); }
+
+// RoutingSession ---------------------------------------------------------------------------------
 RoutingSession::RoutingSession()
   : m_router(nullptr)
   , m_route(make_unique<Route>(string() /* router */, 0 /* route id */))
@@ -80,6 +134,16 @@ void RoutingSession::BuildRoute(Checkpoints const & checkpoints,
   m_isFollowing = false;
   m_routingRebuildCount = -1; // -1 for the first rebuild.
 
+  if (auto route = m_routeCache.Get(m_checkpoints))
+  {
+    RemoveRoute();
+    SetState(RouteBuilding);
+    ++m_routingRebuildCount;
+    m_lastCompletionPercent = 0;
+    DoReadyCallback(*this, m_buildReadyCallback)(move(route), RouterResultCode::NoError);
+    return;
+  }
+
   RebuildRoute(checkpoints.GetStart(), m_buildReadyCallback, m_needMoreMapsCallback,
                m_removeRouteCallback, timeoutSec, RouteBuilding, false /* adjust */);
 }
@@ -122,6 +186,8 @@ m2::PointD RoutingSession::GetEndPoint() const
 void RoutingSession::DoReadyCallback::operator()(shared_ptr<Route> route, RouterResultCode e)
 {
   ASSERT(m_rs.m_route, ());
+  if (e == RouterResultCode::NoError && route && route->IsValid())
+    m_rs.m_routeCache.Put(m_rs.m_checkpoints, *route);
   m_rs.AssignRoute(route, e);
   m_callback(*m_rs.m_route, e);
 }
@@ -140,35 +206,87 @@ void RoutingSession::RemoveRoute()
 void RoutingSession::RebuildRouteOnTrafficUpdate()
 {
   CHECK_THREAD_CHECKER(m_threadChecker, ());
-  m2::PointD startPoint;
 
-  {
-    startPoint = m_lastGoodPosition;
-
-    switch (m_state)
-    {
-    case RoutingNotActive:
-    case RouteNotReady:
-    case RouteFinished: return;
+  // Traffic does not influence the weights of the other vehicle types,
+  // their routes and route cache stay valid.
+  if (!m_routingSettings.m_useTraffic)
+    return;
 
-    case RouteBuilding:
-    case RouteNotStarted:
-    case RouteNoFollowing:
-    case RouteRebuilding: startPoint = m_checkpoints.GetPointFrom();
+  // Traffic changes route weights, cached routes are not valid anymore.
+  m_routeCache.Clear();
+  m2::PointD startPoint = m_lastGoodPosition;
 
-    case OnRoute:
-    case RouteNeedRebuild: break;
+  switch (m_state)
+  {
+  case RoutingNotActive:
+  case RouteNotReady:
+  case RouteFinished: return;
+
+  case RouteNotStarted:
+  case RouteNoFollowing:
+    startPoint = m_checkpoints.GetPointFrom();
+    // fallthrough
+  case OnRoute:
+    // The built route is re-estimated in place: per-segment speed groups and
+    // cumulative times are updated from the fresh traffic data without a full
+    // rebuild. The geometry keeps the shape it was built with; the next
+    // regular rebuild picks the better route under the new traffic.
+    if (m_route->IsValid() && ApplyTrafficToRoute())
+    {
+      if (m_rebuildReadyCallback)
+        m_rebuildReadyCallback(*m_route, RouterResultCode::NoError);
+      return;
     }
+    break;
 
-    // Cancel current route building.
-    m_router->ClearState();
+  case RouteBuilding:
+  case RouteRebuilding:
+    startPoint = m_checkpoints.GetPointFrom();
+    // fallthrough
+  case RouteNeedRebuild: break;
   }
 
+  // Cancel current route building.
+  m_router->ClearState();
+
   RebuildRoute(startPoint, m_rebuildReadyCallback, nullptr /* needMoreMapsCallback */,
                nullptr /* removeRouteCallback */, 0 /* timeoutSec */,
                routing::RoutingSession::State::RouteRebuilding, false /* adjustToPrevRoute */);
 }
 
+bool RoutingSession::ApplyTrafficToRoute()
+{
+  if (!m_numMwmIds)
+    return false;
+
+  AllMwmTrafficInfo trafficColoring;
+  TrafficCache::CopyTraffic(trafficColoring);
+
+  // The route keeps segments with mwm numeric ids while the traffic cache is
+  // keyed by MwmId, so the colorings are rekeyed by country name.
+  map<string, shared_ptr<TrafficInfo::Coloring const>> coloringByCountry;
+  for (auto const & kv : trafficColoring)
+  {
+    auto const & info = kv.first.GetInfo();
+    if (info)
+      coloringByCountry[info->GetCountryName()] = kv.second;
+  }
+
+  m_route->UpdateTraffic([this, &coloringByCountry](Segment const & segment) {
+    auto const it = coloringByCountry.find(m_numMwmIds->GetFile(segment.GetMwmId()).GetName());
+    if (it == coloringByCountry.end())
+      return SpeedGroup::Unknown;
+
+    auto const itSeg = it->second->find(TrafficInfo::RoadSegmentId(
+        segment.GetFeatureId(), static_cast<uint16_t>(segment.GetSegmentIdx()),
+        segment.IsForward() ? TrafficInfo::RoadSegmentId::kForwardDirection
+                            : TrafficInfo::RoadSegmentId::kReverseDirection));
+    return itSeg == it->second->cend() ? SpeedGroup::Unknown : itSeg->second;
+  });
+
+  return true;
+}
+
 bool RoutingSession::IsActive() const
 {
   CHECK_THREAD_CHECKER(m_threadChecker, ());
@@ -491,14 +609,24 @@ void RoutingSession::AssignRoute(shared_ptr<Route> route, RouterResultCode e)
   m_firstNotCheckedSpeedCameraIndex = 0;
   m_cachedSpeedCameras = {};
   m_warnedSpeedCameras = {};
+
+  // Warm up the data along the route right away: if the user deviates, the rebuild
+  // runs over already prefetched mwm sections instead of paying cold I/O.
+  if (e == RouterResultCode::NoError && m_route->IsValid())
+  {
+    auto points = m_route->GetPoly().GetPoints();
+    m_router->PrefetchRouteCorridor(move(points));
+  }
 }
 
 void RoutingSession::SetRouter(unique_ptr<IRouter> && router,
-                               unique_ptr<OnlineAbsentCountriesFetcher> && fetcher)
+                               unique_ptr<AbsentCountriesFetcher> && fetcher)
 {
   CHECK_THREAD_CHECKER(m_threadChecker, ());
   ASSERT(m_router != nullptr, ());
   Reset();
+  // Another router means another vehicle type, cached routes do not fit it.
+  m_routeCache.Clear();
   m_router->SetRouter(move(router), move(fetcher));
 }
 
@@ -734,7 +862,10 @@ void RoutingSession::FindCamerasOnRouteAndCache(double passedDistanceMeters)
 
   CHECK_LESS(firstNotChecked, segments.size(), ());
 
-  double distToPrevSegment = segments[firstNotChecked].GetDistFromBeginningMeters();
+  // |distToPrevSegment| is the distance from the route beginning to the start
+  // of the segment |firstNotChecked|, i.e. to the end of the previous one.
+  double distToPrevSegment =
+      firstNotChecked == 0 ? 0.0 : segments[firstNotChecked - 1].GetDistFromBeginningMeters();
   double distFromCurPosToLatestCheckedSegmentM = distToPrevSegment - passedDistanceMeters;
 
   while (firstNotChecked < segments.size() &&
@@ -742,12 +873,15 @@ void RoutingSession::FindCamerasOnRouteAndCache(double passedDistanceMeters)
   {
     auto const & lastSegment = segments[firstNotChecked];
     auto const & speedCamsVector = lastSegment.GetSpeedCams();
-    double segmentLength = m_route->GetSegLenMeters(firstNotChecked);
+    double const segmentLength = m_route->GetSegLenMeters(firstNotChecked);
 
+    // Cameras of a segment are sorted by |m_coef|, so the cache stays sorted
+    // by the distance from the route beginning and the closest camera is
+    // always at the front.
     for (auto const & speedCam : speedCamsVector)
     {
-      segmentLength *= speedCam.m_coef;
-      m_cachedSpeedCameras.emplace(distToPrevSegment + segmentLength, speedCam.m_maxSpeedKmPH);
+      m_cachedSpeedCameras.emplace(distToPrevSegment + segmentLength * speedCam.m_coef,
+                                   speedCam.m_maxSpeedKmPH);
     }
 
     distToPrevSegment = lastSegment.GetDistFromBeginningMeters();
@@ -9,6 +9,8 @@
 #include "routing/turns.hpp"
 #include "routing/turns_notification_manager.hpp"
 
+#include "routing_common/num_mwm_id.hpp"
+
 #include "traffic/speed_groups.hpp"
 #include "traffic/traffic_cache.hpp"
 #include "traffic/traffic_info.hpp"
@@ -24,10 +26,12 @@
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
 #include <queue>
 #include <string>
+#include <utility>
 
 namespace location
 {
@@ -78,7 +82,7 @@ public:
             PointCheckCallback const & pointCheckCallback);
 
   void SetRouter(std::unique_ptr<IRouter> && router,
-                 std::unique_ptr<OnlineAbsentCountriesFetcher> && fetcher);
+                 std::unique_ptr<AbsentCountriesFetcher> && fetcher);
 
   /// @param[in] checkpoints in mercator
   /// @param[in] timeoutSec timeout in seconds, if zero then there is no timeout
@@ -147,6 +151,9 @@ public:
   void ToggleSpeedCameras(bool enable);
 
   void SetRoutingSettings(RoutingSettings const & routingSettings);
+  /// \brief Sets the mapping between mwm numeric ids of the current router and
+  /// country files. It is used to re-apply traffic data to a built route.
+  void SetNumMwmIds(std::shared_ptr<NumMwmIds> numMwmIds) { m_numMwmIds = std::move(numMwmIds); }
   void SetRoutingCallbacks(ReadyCallback const & buildReadyCallback,
                            ReadyCallback const & rebuildReadyCallback,
                            NeedMoreMapsCallback const & needMoreMapsCallback,
@@ -188,6 +195,29 @@ public:
   void FindCamerasOnRouteAndCache(double passedDistanceMeters);
 
 private:
+  /// \brief LRU cache of recently built routes. Repeated BuildRoute() calls with almost
+  /// the same checkpoints are served from the cache in milliseconds without AsyncRouter.
+  /// The cache is dropped on router change and on every traffic update because both
+  /// change route weights.
+  class RouteCache final
+  {
+  public:
+    void Put(Checkpoints const & checkpoints, Route const & route);
+    /// \returns a fresh copy of the cached route or nullptr in case of cache miss.
+    std::shared_ptr<Route> Get(Checkpoints const & checkpoints);
+    void Clear();
+
+  private:
+    // Checkpoints quantized to mercator cells of about ten meters.
+    using Key = std::vector<m2::PointI>;
+    static Key MakeKey(Checkpoints const & checkpoints);
+
+    static size_t constexpr kMaxRoutes = 8;
+
+    // The most recently used route is kept in the front.
+    std::list<std::pair<Key, std::shared_ptr<Route>>> m_routes;
+  };
+
   struct DoReadyCallback
   {
     RoutingSession & m_rs;
@@ -212,8 +242,15 @@ private:
   void PassCameraToWarned();
 
 private:
+  /// \brief Re-applies the cached traffic data to the built route in place.
+  /// \returns false if the session has no means to resolve route segments to
+  /// traffic data; a rebuild is needed in that case.
+  bool ApplyTrafficToRoute();
+
   std::unique_ptr<AsyncRouter> m_router;
   std::shared_ptr<Route> m_route;
+  RouteCache m_routeCache;
+  std::shared_ptr<NumMwmIds> m_numMwmIds;
   State m_state;
   bool m_isFollowing;
   Checkpoints m_checkpoints;
@@ -15,10 +15,15 @@ struct RoutingSettings
   friend RoutingSettings GetRoutingSettings(VehicleType vehicleType);
 
 private:
-  RoutingSettings(bool matchRoute, bool soundDirection, double matchingThresholdM,
+  RoutingSettings(bool useTraffic, bool matchRoute, bool soundDirection, double matchingThresholdM,
                   bool keepPedestrianInfo, bool showTurnAfterNext, bool speedCameraWarning);
 
 public:
+  /// \brief if m_useTraffic is equal to true the weights of the route of this
+  /// vehicle type depend on traffic data, so traffic updates have to be
+  /// re-applied to a built route.
+  bool    m_useTraffic;
+
   /// \brief if m_matchRoute is equal to true the bearing follows the
   /// route direction if the current position is matched to the route.
   /// If m_matchRoute is equal to false GPS bearing is used while
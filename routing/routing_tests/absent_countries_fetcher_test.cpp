@@ -0,0 +1,68 @@
+#include "testing/testing.hpp"
+
+#include "routing/absent_countries_fetcher.hpp"
+
+#include "geometry/point2d.hpp"
+
+#include "std/string.hpp"
+#include "std/vector.hpp"
+
+using namespace routing;
+
+namespace
+{
+vector<string> FetchAbsent(TCountryFileFn const & countryFileFn,
+                           TCountryLocalFileFn const & countryLocalFileFn,
+                           Checkpoints const & checkpoints)
+{
+  AbsentCountriesFetcher fetcher(countryFileFn, countryLocalFileFn);
+  fetcher.GenerateRequest(checkpoints);
+  vector<string> countries;
+  fetcher.GetAbsentCountries(countries);
+  return countries;
+}
+
+UNIT_TEST(AbsentCountriesFetcher_SingleMwm)
+{
+  auto const countries = FetchAbsent([](m2::PointD const &) { return "A"; },
+                                     [](string const &) { return false; },
+                                     Checkpoints({1, 1}, {2, 2}));
+  TEST(countries.empty(), ());
+}
+
+UNIT_TEST(AbsentCountriesFetcher_CrossedCountries)
+{
+  // The fake world is split into "A" (x < 1.5) and "B". The checkpoints lie
+  // in different countries, so the segment between them must be sampled and
+  // both countries reported as absent.
+  auto const countryFileFn = [](m2::PointD const & p) { return p.x < 1.5 ? "A" : "B"; };
+  auto const countries = FetchAbsent(countryFileFn, [](string const &) { return false; },
+                                     Checkpoints({1, 1}, {2, 2}));
+  TEST_EQUAL(countries, vector<string>({"A", "B"}), ());
+}
+
+UNIT_TEST(AbsentCountriesFetcher_DownloadedCountriesFiltered)
+{
+  auto const countryFileFn = [](m2::PointD const & p) { return p.x < 1.5 ? "A" : "B"; };
+  auto const countries = FetchAbsent(countryFileFn,
+                                     [](string const & name) { return name == "A"; },
+                                     Checkpoints({1, 1}, {2, 2}));
+  TEST_EQUAL(countries, vector<string>({"B"}), ());
+}
+
+UNIT_TEST(AbsentCountriesFetcher_UncoveredTerritorySkipped)
+{
+  // Samples between the countries resolve to an empty name (sea or a not
+  // covered territory) and must not be reported.
+  auto const countryFileFn = [](m2::PointD const & p) -> string {
+    if (p.x < 1.2)
+      return "A";
+    if (p.x > 1.8)
+      return "B";
+    return {};
+  };
+  auto const countries = FetchAbsent(countryFileFn, [](string const &) { return false; },
+                                     Checkpoints({1, 1}, {2, 2}));
+  TEST_EQUAL(countries, vector<string>({"A", "B"}), ());
+}
+}  // namespace
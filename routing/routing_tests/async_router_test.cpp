@@ -5,7 +5,7 @@
 #include "routing/async_router.hpp"
 #include "routing/router.hpp"
 #include "routing/routing_callbacks.hpp"
-#include "routing/online_absent_fetcher.hpp"
+#include "routing/absent_countries_fetcher.hpp"
 
 #include "geometry/point2d.hpp"
 
@@ -50,14 +50,14 @@ public:
   }
 };
 
-class DummyFetcher : public IOnlineFetcher
+class DummyFetcher : public IAbsentFetcher
 {
   vector<string> m_absent;
 
 public:
   DummyFetcher(vector<string> const & absent) : m_absent(absent) {}
 
-  // IOnlineFetcher overrides:
+  // IAbsentFetcher overrides:
   void GenerateRequest(Checkpoints const &) override {}
   void GetAbsentCountries(vector<string> & countries) override { countries = m_absent; }
 };
@@ -114,7 +114,7 @@ struct DummyRoutingCallbacks
 UNIT_CLASS_TEST(AsyncGuiThreadTest, NeedMoreMapsSignalTest)
 {
   vector<string> const absentData({"test1", "test2"});
-  unique_ptr<IOnlineFetcher> fetcher(new DummyFetcher(absentData));
+  unique_ptr<IAbsentFetcher> fetcher(new DummyFetcher(absentData));
   unique_ptr<IRouter> router(new DummyRouter(RouterResultCode::NoError, {}));
   DummyRoutingCallbacks resultCallback(2 /* expectedCalls */);
   AsyncRouter async(DummyStatisticsCallback, nullptr /* pointCheckCallback */);
@@ -137,7 +137,7 @@ UNIT_CLASS_TEST(AsyncGuiThreadTest, NeedMoreMapsSignalTest)
 
 UNIT_CLASS_TEST(AsyncGuiThreadTest, StandardAsyncFogTest)
 {
-  unique_ptr<IOnlineFetcher> fetcher(new DummyFetcher({}));
+  unique_ptr<IAbsentFetcher> fetcher(new DummyFetcher({}));
   unique_ptr<IRouter> router(new DummyRouter(RouterResultCode::NoError, {}));
   DummyRoutingCallbacks resultCallback(1 /* expectedCalls */);
   AsyncRouter async(DummyStatisticsCallback, nullptr /* pointCheckCallback */);
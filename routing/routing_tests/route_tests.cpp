@@ -1,5 +1,6 @@
 #include "testing/testing.hpp"
 
+#include "routing/edge_estimator.hpp"
 #include "routing/route.hpp"
 #include "routing/routing_helpers.hpp"
 #include "routing/turns.hpp"
@@ -310,3 +311,28 @@ UNIT_TEST(RouteNameTest)
   route.GetCurrentStreetName(name);
   TEST_EQUAL(name, "Street3", ());
 }
+
+UNIT_TEST(RouteUpdateTrafficTest)
+{
+  Route route("TestRouter", 0 /* route id */);
+  route.SetGeometry(kTestGeometry.begin(), kTestGeometry.end());
+  vector<RouteSegment> routeSegments;
+  GetTestRouteSegments(kTestGeometry, kTestTurns2, kTestNames2, kTestTimes2, routeSegments);
+  route.SetRouteSegments(routeSegments);
+
+  double const totalTimeS = route.GetTotalTimeSec();
+  TEST(base::AlmostEqualAbs(totalTimeS, kTestTimes2.back(), 1e-5), ());
+
+  // Jam on every segment: all times are rescaled by the ratio of traffic factors.
+  route.UpdateTraffic([](Segment const &) { return traffic::SpeedGroup::G3; });
+
+  double const expectedScale = EdgeEstimator::CalcCarTrafficFactor(traffic::SpeedGroup::G3) /
+                               EdgeEstimator::CalcCarTrafficFactor(traffic::SpeedGroup::Unknown);
+  TEST(base::AlmostEqualAbs(route.GetTotalTimeSec(), totalTimeS * expectedScale, 1e-5), ());
+  for (size_t i = 0; i < kTestGeometry.size() - 1; ++i)
+    TEST_EQUAL(route.GetTraffic(i), traffic::SpeedGroup::G3, ());
+
+  // The jam is gone: the original times are restored.
+  route.UpdateTraffic([](Segment const &) { return traffic::SpeedGroup::Unknown; });
+  TEST(base::AlmostEqualAbs(route.GetTotalTimeSec(), totalTimeS, 1e-5), ());
+}
@@ -16,11 +16,27 @@ TrafficStash::TrafficStash(traffic::TrafficCache const & source, shared_ptr<NumM
 
 traffic::SpeedGroup TrafficStash::GetSpeedGroup(Segment const & segment) const
 {
-  auto itMwm = m_mwmToTraffic.find(segment.GetMwmId());
-  if (itMwm == m_mwmToTraffic.cend())
-    return traffic::SpeedGroup::Unknown;
+  struct ColoringMemo
+  {
+    TrafficStash const * m_stash = nullptr;
+    uint64_t m_generation = 0;
+    NumMwmId m_mwmId = kFakeNumMwmId;
+    traffic::TrafficInfo::Coloring const * m_coloring = nullptr;
+  };
+  static thread_local ColoringMemo memo;
+
+  auto const generation = m_generation.load(memory_order_relaxed);
+  if (memo.m_stash != this || memo.m_generation != generation ||
+      memo.m_mwmId != segment.GetMwmId())
+  {
+    auto itMwm = m_mwmToTraffic.find(segment.GetMwmId());
+    if (itMwm == m_mwmToTraffic.cend())
+      return traffic::SpeedGroup::Unknown;
+
+    memo = {this, generation, segment.GetMwmId(), itMwm->second.get()};
+  }
 
-  auto const & coloring = itMwm->second;
+  auto const * coloring = memo.m_coloring;
   auto const itSeg = coloring->find(traffic::TrafficInfo::RoadSegmentId(
       segment.GetFeatureId(), base::asserted_cast<uint16_t>(segment.GetSegmentIdx()),
       segment.IsForward() ? traffic::TrafficInfo::RoadSegmentId::kForwardDirection
@@ -36,6 +52,7 @@ void TrafficStash::SetColoring(NumMwmId numMwmId,
                                shared_ptr<const traffic::TrafficInfo::Coloring> coloring)
 {
   m_mwmToTraffic[numMwmId] = coloring;
+  ++m_generation;
 }
 
 bool TrafficStash::Has(NumMwmId numMwmId) const
@@ -11,6 +11,8 @@
 
 #include "base/assert.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -48,10 +50,21 @@ public:
 private:
   void CopyTraffic();
 
-  void Clear() { m_mwmToTraffic.clear(); }
+  void Clear()
+  {
+    m_mwmToTraffic.clear();
+    ++m_generation;
+  }
 
   traffic::TrafficCache const & m_source;
   std::shared_ptr<NumMwmIds> m_numMwmIds;
   std::unordered_map<NumMwmId, std::shared_ptr<const traffic::TrafficInfo::Coloring>> m_mwmToTraffic;
+
+  // Incremented on every change of |m_mwmToTraffic| to invalidate the thread local
+  // coloring memos in GetSpeedGroup(). The router expands segments of one mwm in long
+  // runs, so the coloring of the last queried mwm is memoized to skip the hash lookup
+  // on the hot path; the memo is thread local because route calculation may query the
+  // stash from several worker threads at once.
+  std::atomic<uint64_t> m_generation{0};
 };
 }  // namespace routing
@@ -59,9 +59,13 @@ VehicleModel::VehicleModel(Classificator const & c, LimitsInitList const & featu
   for (auto const & v : featureTypeLimits)
   {
     m_maxSpeed = Max(m_maxSpeed, v.m_speed);
-    m_highwayTypes.emplace(c.GetTypeByPath(v.m_types),
-                           RoadLimits(v.m_speed, v.m_isPassThroughAllowed));
+    m_highwayTypes.emplace_back(c.GetTypeByPath(v.m_types),
+                                RoadLimits(v.m_speed, v.m_isPassThroughAllowed));
   }
+  sort(m_highwayTypes.begin(), m_highwayTypes.end(),
+       [](pair<uint32_t, RoadLimits> const & lhs, pair<uint32_t, RoadLimits> const & rhs) {
+         return lhs.first < rhs.first;
+       });
 
   size_t i = 0;
   for (auto const & v : featureTypeSurface)
@@ -118,9 +122,9 @@ VehicleModel::SpeedKMpH VehicleModel::GetMinTypeSpeed(feature::TypesHolder const
   for (uint32_t t : types)
   {
     uint32_t const type = ftypes::BaseChecker::PrepareToMatch(t, 2);
-    auto const itHighway = m_highwayTypes.find(type);
-    if (itHighway != m_highwayTypes.cend())
-      speed = Pick<min>(speed, itHighway->second.GetSpeed(inCity));
+    RoadLimits const * const limits = FindHighwayType(type);
+    if (limits)
+      speed = Pick<min>(speed, limits->GetSpeed(inCity));
 
     auto const addRoadInfoIter = FindRoadType(t);
     if (addRoadInfoIter != m_addRoadTypes.cend())
@@ -199,9 +203,8 @@ bool VehicleModel::HasPassThroughType(feature::TypesHolder const & types) const
 {
   for (uint32_t t : types)
   {
-    uint32_t const type = ftypes::BaseChecker::PrepareToMatch(t, 2);
-    auto it = m_highwayTypes.find(type);
-    if (it != m_highwayTypes.end() && it->second.IsPassThroughAllowed())
+    RoadLimits const * const limits = FindHighwayType(ftypes::BaseChecker::PrepareToMatch(t, 2));
+    if (limits && limits->IsPassThroughAllowed())
       return true;
   }
 
@@ -211,7 +214,7 @@ bool VehicleModel::HasPassThroughType(feature::TypesHolder const & types) const
 bool VehicleModel::IsRoadType(uint32_t type) const
 {
   return FindRoadType(type) != m_addRoadTypes.cend() ||
-         m_highwayTypes.find(ftypes::BaseChecker::PrepareToMatch(type, 2)) != m_highwayTypes.end();
+         FindHighwayType(ftypes::BaseChecker::PrepareToMatch(type, 2)) != nullptr;
 }
 
 VehicleModelInterface::RoadAvailability VehicleModel::GetRoadAvailability(feature::TypesHolder const & /* types */) const
@@ -226,6 +229,18 @@ vector<VehicleModel::AdditionalRoadType>::const_iterator VehicleModel::FindRoadT
                  [&type](AdditionalRoadType const & t) { return t.m_type == type; });
 }
 
+VehicleModel::RoadLimits const * VehicleModel::FindHighwayType(uint32_t type) const
+{
+  auto const it = lower_bound(m_highwayTypes.cbegin(), m_highwayTypes.cend(), type,
+                              [](pair<uint32_t, RoadLimits> const & lhs, uint32_t rhs) {
+                                return lhs.first < rhs;
+                              });
+  if (it == m_highwayTypes.cend() || it->first != type)
+    return nullptr;
+
+  return &it->second;
+}
+
 VehicleModelFactory::VehicleModelFactory(
     CountryParentNameGetterFn const & countryParentNameGetterFn)
   : m_countryParentNameGetterFn(countryParentNameGetterFn)
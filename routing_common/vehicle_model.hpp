@@ -7,6 +7,7 @@
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 class Classificator;
@@ -230,8 +231,8 @@ private:
     }
 
   private:
-    InOutCitySpeedKMpH const m_speed;
-    bool const m_isPassThroughAllowed;
+    InOutCitySpeedKMpH m_speed;
+    bool m_isPassThroughAllowed;
   };
 
   struct TypeFactor
@@ -241,8 +242,15 @@ private:
   };
 
   std::vector<AdditionalRoadType>::const_iterator FindRoadType(uint32_t type) const;
-
-  std::unordered_map<uint32_t, RoadLimits> m_highwayTypes;
+  /// \returns limits of 2-arity type |type| or nullptr if |type| is not a highway type
+  /// of the model. |type| should be prepared with ftypes::BaseChecker::PrepareToMatch().
+  RoadLimits const * FindHighwayType(uint32_t type) const;
+
+  // Pairs of 2-arity road type and its limits sorted by type. There are few dozen
+  // highway types at most, so a sorted flat vector is looked up with binary search:
+  // it is touched for every type of every road feature during mwm graph loading and
+  // a contiguous table behaves better than a hash map of the same size.
+  std::vector<std::pair<uint32_t, RoadLimits>> m_highwayTypes;
   // Mapping surface types (psurface|paved_good, psurface|paved_bad, psurface|unpaved_good,
   // psurface|unpaved_bad) to surface speed factors.
   // Note. It's a vector (not map or unordered_map) because of perfomance reasons.
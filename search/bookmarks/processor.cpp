@@ -70,6 +70,27 @@ void FillRankingInfo(QueryVec & qv, IdfMap & idfs, DocVec const & dv, RankingInf
 {
   info.m_cosineSimilarity = qv.Similarity(idfs, dv);
 }
+
+DocVec MakeDocVec(Doc const & doc)
+{
+  DocVec::Builder builder;
+  doc.ForEachToken(
+      [&](int8_t /* lang */, strings::UniString const & token) { builder.Add(token); });
+  return DocVec(builder);
+}
+
+bool SameTokens(DocVec const & lhs, DocVec const & rhs)
+{
+  size_t const n = lhs.GetNumTokens();
+  if (rhs.GetNumTokens() != n)
+    return false;
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (lhs.GetToken(i) != rhs.GetToken(i))
+      return false;
+  }
+  return true;
+}
 }  // namespace
 
 Processor::Processor(Emitter & emitter, base::Cancellable const & cancellable)
@@ -81,16 +102,31 @@ void Processor::Add(Id const & id, Doc const & doc)
 {
   ASSERT_EQUAL(m_docs.count(id), 0, ());
 
-  DocVec::Builder builder;
-  doc.ForEachToken(
-      [&](int8_t /* lang */, strings::UniString const & token) { builder.Add(token); });
-
-  DocVec const docVec(builder);
+  DocVec const docVec = MakeDocVec(doc);
 
   m_index.Add(id, DocVecWrapper(docVec));
   m_docs[id] = docVec;
 }
 
+void Processor::Update(Id const & id, Doc const & doc)
+{
+  auto const it = m_docs.find(id);
+  ASSERT(it != m_docs.end(), (id));
+
+  DocVec docVec = MakeDocVec(doc);
+
+  // Most bookmark edits (color, icon, position) do not touch the name
+  // or the description, so the set of indexed tokens stays the same and
+  // the trie does not need to be modified.
+  if (!SameTokens(it->second, docVec))
+  {
+    m_index.Erase(id, DocVecWrapper(it->second));
+    m_index.Add(id, DocVecWrapper(docVec));
+  }
+
+  it->second = move(docVec);
+}
+
 void Processor::Erase(Id const & id)
 {
   ASSERT_EQUAL(m_docs.count(id), 1, ());
@@ -35,6 +35,7 @@ public:
   ~Processor() override = default;
 
   void Add(Id const & id, Doc const & doc);
+  void Update(Id const & id, Doc const & doc);
   void Erase(Id const & id);
 
   void Search(QueryParams const & params) const;
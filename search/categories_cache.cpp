@@ -8,13 +8,38 @@
 #include "indexer/ftypes_matcher.hpp"
 #include "indexer/search_string_utils.hpp"
 
+#include "platform/platform.hpp"
+
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
+#include "coding/internal/file_data.hpp"
+#include "coding/write_to_sink.hpp"
+
 #include "base/assert.hpp"
 #include "base/levenshtein_dfa.hpp"
+#include "base/string_utils.hpp"
 
 using namespace std;
 
 namespace search
 {
+namespace
+{
+// Bump on any change of the on-disk cache layout.
+uint32_t constexpr kCacheFormatVersion = 1;
+
+// FNV-1a. The hash must be stable across app launches, so std::hash does not fit.
+uint64_t Fnv1a(uint64_t hash, string const & s)
+{
+  for (char const c : s)
+  {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+}  // namespace
+
 // CategoriesCache ---------------------------------------------------------------------------------
 CBV CategoriesCache::Get(MwmContext const & context)
 {
@@ -26,12 +51,26 @@ CBV CategoriesCache::Get(MwmContext const & context)
   if (it != m_cache.cend())
     return it->second;
 
-  auto const cbv = Load(context);
+  // Version 0 marks test and dev maps without a timestamp: they may be
+  // rebuilt under the same name, so the sidecar cache is skipped for them.
+  bool const persistent = !m_kind.empty() && context.GetInfo()->GetVersion() != 0;
+
+  unique_ptr<coding::CompressedBitVector> p;
+  if (persistent)
+    p = LoadFromDisk(context);
+  if (!p)
+  {
+    p = Load(context);
+    if (persistent && p)
+      SaveToDisk(context, *p);
+  }
+
+  CBV const cbv(move(p));
   m_cache[id] = cbv;
   return cbv;
 }
 
-CBV CategoriesCache::Load(MwmContext const & context) const
+unique_ptr<coding::CompressedBitVector> CategoriesCache::Load(MwmContext const & context) const
 {
   ASSERT(context.m_handle.IsAlive(), ());
   ASSERT(context.m_value.HasSearchIndex(), ());
@@ -47,24 +86,88 @@ CBV CategoriesCache::Load(MwmContext const & context) const
   });
 
   Retrieval retrieval(context, m_cancellable);
-  return CBV(retrieval.RetrieveAddressFeatures(request));
+  return retrieval.RetrieveAddressFeatures(request);
+}
+
+string CategoriesCache::CacheFilePath(MwmContext const & context) const
+{
+  ASSERT(!m_kind.empty(), ());
+  return GetPlatform().WritablePathForFile(context.GetName() + "." + m_kind + ".catcache");
+}
+
+uint64_t CategoriesCache::CategoriesHash() const
+{
+  auto const & c = classif();
+
+  uint64_t hash = 0xcbf29ce484222325;
+  m_categories.ForEach([&hash, &c](uint32_t const type) {
+    hash = Fnv1a(hash, strings::ToUtf8(FeatureTypeToString(c.GetIndexForType(type))));
+  });
+  return hash;
+}
+
+unique_ptr<coding::CompressedBitVector> CategoriesCache::LoadFromDisk(
+    MwmContext const & context) const
+{
+  try
+  {
+    FileReader reader(CacheFilePath(context));
+    ReaderSource<FileReader> source(reader);
+    if (ReadPrimitiveFromSource<uint32_t>(source) != kCacheFormatVersion)
+      return nullptr;
+    if (ReadPrimitiveFromSource<int64_t>(source) != context.GetInfo()->GetVersion())
+      return nullptr;
+    if (ReadPrimitiveFromSource<uint64_t>(source) != CategoriesHash())
+      return nullptr;
+    return coding::CompressedBitVectorBuilder::DeserializeFromSource(source);
+  }
+  catch (Reader::Exception const &)
+  {
+    // Either there is no cache yet or it is corrupted; SaveToDisk() will rewrite it.
+    return nullptr;
+  }
+}
+
+void CategoriesCache::SaveToDisk(MwmContext const & context,
+                                 coding::CompressedBitVector const & cbv) const
+{
+  // WriteToTempAndRenameToFile logs on failure; a cache that could not be
+  // written is simply rebuilt during the next session.
+  base::WriteToTempAndRenameToFile(CacheFilePath(context), [&](string const & tmpPath) {
+    try
+    {
+      FileWriter writer(tmpPath);
+      WriteToSink(writer, kCacheFormatVersion);
+      WriteToSink(writer, context.GetInfo()->GetVersion());
+      WriteToSink(writer, CategoriesHash());
+      cbv.Serialize(writer);
+    }
+    catch (Writer::Exception const &)
+    {
+      return false;
+    }
+    return true;
+  });
 }
 
 // StreetsCache ------------------------------------------------------------------------------------
 StreetsCache::StreetsCache(base::Cancellable const & cancellable)
   : CategoriesCache(ftypes::IsStreetChecker::Instance(), cancellable)
 {
+  SetPersistentKind("streets");
 }
 
 // VillagesCache -----------------------------------------------------------------------------------
 VillagesCache::VillagesCache(base::Cancellable const & cancellable)
   : CategoriesCache(ftypes::IsVillageChecker::Instance(), cancellable)
 {
+  SetPersistentKind("villages");
 }
 
 // HotelsCache -------------------------------------------------------------------------------------
 HotelsCache::HotelsCache(base::Cancellable const & cancellable)
   : CategoriesCache(ftypes::IsHotelChecker::Instance(), cancellable)
 {
+  SetPersistentKind("hotels");
 }
 }  // namespace search
@@ -9,6 +9,8 @@
 
 #include <cstdint>
 #include <map>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace search
@@ -38,11 +40,31 @@ public:
 
   inline void Clear() { m_cache.clear(); }
 
+protected:
+  // Turns on the on-disk cache: bit vectors loaded for mwms with a
+  // non-zero version are saved to sidecar files in the writable
+  // directory, so that the first search after an app restart does not
+  // have to scan the search index again. |kind| is used in the file
+  // names and must be unique among persistent caches.
+  void SetPersistentKind(std::string const & kind) { m_kind = kind; }
+
 private:
-  CBV Load(MwmContext const & context) const;
+  std::unique_ptr<coding::CompressedBitVector> Load(MwmContext const & context) const;
+
+  // On-disk cache for a single mwm. A cache file is invalidated by a
+  // change of its format, of the mwm version or of the categories list
+  // and is rewritten in place, so stale entries do not accumulate.
+  std::string CacheFilePath(MwmContext const & context) const;
+  uint64_t CategoriesHash() const;
+  std::unique_ptr<coding::CompressedBitVector> LoadFromDisk(MwmContext const & context) const;
+  void SaveToDisk(MwmContext const & context, coding::CompressedBitVector const & cbv) const;
 
   CategoriesSet m_categories;
   base::Cancellable const & m_cancellable;
+
+  // Non-empty for persistent caches, see SetPersistentKind().
+  std::string m_kind;
+
   std::map<MwmSet::MwmId, CBV> m_cache;
 };
 
@@ -12,6 +12,7 @@
 #include "base/logging.hpp"
 #include "base/string_utils.hpp"
 
+#include <memory>
 #include <set>
 #include <string>
 
@@ -55,6 +56,11 @@ void DownloaderSearchCallback::operator()(search::Results const & results)
   storage::DownloaderSearchResults downloaderSearchResults;
   std::set<storage::DownloaderSearchResult> uniqueResults;
 
+  // Group features come mostly from the World mwm, reuse the loader
+  // between results instead of recreating it per result.
+  MwmSet::MwmId loaderMwmId;
+  std::unique_ptr<FeaturesLoaderGuard> loader;
+
   for (auto const & result : results)
   {
     if (!result.HasPoint())
@@ -63,9 +69,13 @@ void DownloaderSearchCallback::operator()(search::Results const & results)
     if (result.GetResultType() != search::Result::Type::LatLon)
     {
       FeatureID const & fid = result.GetFeatureID();
-      FeaturesLoaderGuard loader(m_dataSource, fid.m_mwmId);
+      if (!loader || loaderMwmId != fid.m_mwmId)
+      {
+        loader = std::make_unique<FeaturesLoaderGuard>(m_dataSource, fid.m_mwmId);
+        loaderMwmId = fid.m_mwmId;
+      }
       FeatureType ft;
-      if (!loader.GetFeatureByIndex(fid.m_index, ft))
+      if (!loader->GetFeatureByIndex(fid.m_index, ft))
       {
         LOG(LERROR, ("Feature can't be loaded:", fid));
         continue;
@@ -89,8 +99,19 @@ void DownloaderSearchCallback::operator()(search::Results const & results)
         }
       }
     }
-    auto const & mercator = result.GetFeatureCenter();
-    storage::TCountryId const & countryId = m_infoGetter.GetRegionCountryId(mercator);
+    storage::TCountryId countryId = storage::kInvalidCountryId;
+    if (result.GetResultType() != search::Result::Type::LatLon)
+    {
+      // The mwm name of a country leaf equals its country id, so for
+      // results from a registered mwm the country is known without a
+      // point-in-region lookup.
+      auto const & mwmId = result.GetFeatureID().m_mwmId;
+      if (mwmId.IsAlive() && m_storage.IsLeaf(mwmId.GetInfo()->GetCountryName()))
+        countryId = mwmId.GetInfo()->GetCountryName();
+    }
+
+    if (countryId == storage::kInvalidCountryId)
+      countryId = m_infoGetter.GetRegionCountryId(result.GetFeatureCenter());
     if (countryId == storage::kInvalidCountryId)
       continue;
 
@@ -54,6 +54,15 @@ public:
     suggests.reserve(suggests.size() + m_suggests.size());
     for (auto const & s : m_suggests)
       suggests.emplace_back(s.first.first, s.second, s.first.second);
+
+    // Ranker::MatchForSuggestions binary searches this order: all
+    // suggestions of one locale starting with a given prefix form a
+    // contiguous range.
+    sort(suggests.begin(), suggests.end(), [](Suggest const & lhs, Suggest const & rhs) {
+      if (lhs.m_locale != rhs.m_locale)
+        return lhs.m_locale < rhs.m_locale;
+      return lhs.m_name < rhs.m_name;
+    });
   }
 };
 }  // namespace
@@ -72,7 +72,7 @@ bool MatchInTrie(trie::Iterator<ValueList> const & trieRoot, strings::UniChar co
 
   while (!q.empty())
   {
-    auto const p = q.front();
+    auto const p = std::move(q.front());
     q.pop();
 
     auto const & trieIt = p.first;
@@ -157,7 +157,7 @@ private:
     // |buildings| doesn't contain buildings matching by house number,
     // so following code reads buildings in POIs vicinities and checks
     // house numbers.
-    vector<house_numbers::Token> queryParse;
+    house_numbers::Tokens queryParse;
     ParseQuery(parent.m_subQuery, parent.m_lastTokenIsPrefix, queryParse);
     if (queryParse.empty())
       return;
@@ -279,7 +279,7 @@ private:
       return;
     }
 
-    vector<house_numbers::Token> queryParse;
+    house_numbers::Tokens queryParse;
     ParseQuery(child.m_subQuery, child.m_lastTokenIsPrefix, queryParse);
 
     uint32_t numFilterInvocations = 0;
@@ -317,6 +317,11 @@ private:
       return result;
     };
 
+    // A house often lies in the vicinity of several street candidates
+    // (e.g. of all segments of the same street), and its center is the
+    // same for all of them, so it is computed once per call.
+    unordered_map<uint32_t, m2::PointD> centers;
+
     ProjectionOnStreet proj;
     for (uint32_t streetId : streets)
     {
@@ -334,20 +339,29 @@ private:
         if (!cachingHouseNumberFilter(houseId, feature, loaded))
           continue;
 
-        if (!loaded)
-          GetByIndex(houseId, feature);
-
-        // Best geometry is used here as feature::GetCenter(feature)
-        // actually modifies internal state of a |feature| by caching
-        // it's geometry. So, when GetMatchingStreet(houseId, feature)
-        // is called, high precision geometry is used again to compute
-        // |feature|'s center, and this is a right behavior as
-        // house-to-street table was generated by using high-precision
-        // centers of features.
-        m2::PointD const center = feature::GetCenter(feature);
+        auto it = centers.find(houseId);
+        if (it == centers.cend())
+        {
+          if (!loaded)
+          {
+            GetByIndex(houseId, feature);
+            loaded = true;
+          }
+
+          // Best geometry is used here as feature::GetCenter(feature)
+          // actually modifies internal state of a |feature| by caching
+          // it's geometry. So, when GetMatchingStreet(houseId, feature)
+          // is called, high precision geometry is used again to compute
+          // |feature|'s center, and this is a right behavior as
+          // house-to-street table was generated by using high-precision
+          // centers of features.
+          it = centers.emplace(houseId, feature::GetCenter(feature)).first;
+        }
+
+        m2::PointD const & center = it->second;
         if (calculator.GetProjection(center, proj) &&
             proj.m_distMeters <= ReverseGeocoder::kLookupRadiusM &&
-            GetMatchingStreet(houseId, feature) == streetId)
+            (loaded ? GetMatchingStreet(houseId, feature) : GetMatchingStreet(houseId)) == streetId)
         {
           fn(houseId, streetId);
         }
@@ -76,8 +76,53 @@ size_t const kMaxNumLocalities = LocalityScorer::kDefaultReadLimit;
 size_t constexpr kPivotRectsCacheSize = 10;
 size_t constexpr kLocalityRectsCacheSize = 10;
 
+// Maximum number of entries in the (mwm, token) address features cache.
+// When the limit is reached the cache is dropped as a whole: it refills
+// with the tokens of the current query on the next keystroke anyway.
+size_t constexpr kMaxTokenFeaturesCacheSize = 128;
+
 UniString const kUniSpace(MakeUniString(" "));
 
+// Builds a string that identifies the address features retrieved for the full
+// (non-prefix) token |i|: the names, categories and langs of the corresponding
+// SearchTrieRequest define the retrieval result for a fixed mwm.
+string MakeTokenKey(QueryParams const & params, size_t i)
+{
+  string key;
+  params.GetToken(i).ForEach([&key](UniString const & name) {
+    key.append(ToUtf8(name));
+    key.push_back('\0');
+  });
+  key.push_back('\1');
+  for (auto const & index : params.GetTypeIndices(i))
+  {
+    key.append(strings::to_string(index));
+    key.push_back('\0');
+  }
+  key.push_back('\1');
+  for (auto const lang : params.GetLangs())
+  {
+    key.append(strings::to_string(lang));
+    key.push_back('\0');
+  }
+  return key;
+}
+
+// Builds a string that identifies the exact-match address features
+// retrieved for a single |token| when idfs of locality candidates are
+// computed, see MakeTokenKey().
+string MakeExactTokenKey(QueryParams const & params, UniString const & token, bool isPrefix)
+{
+  string key = ToUtf8(token);
+  key.push_back(isPrefix ? '\2' : '\1');
+  for (auto const lang : params.GetLangs())
+  {
+    key.append(strings::to_string(lang));
+    key.push_back('\0');
+  }
+  return key;
+}
+
 struct ScopedMarkTokens
 {
   static BaseContext::TokenType constexpr kUnused = BaseContext::TOKEN_TYPE_COUNT;
@@ -159,9 +204,11 @@ class LocalityScorerDelegate : public LocalityScorer::Delegate
 {
 public:
   LocalityScorerDelegate(MwmContext const & context, Geocoder::Params const & params,
+                         map<pair<MwmSet::MwmId, string>, CBV> & matchedFeaturesCache,
                          base::Cancellable const & cancellable)
     : m_context(context)
     , m_params(params)
+    , m_matchedFeaturesCache(matchedFeaturesCache)
     , m_cancellable(cancellable)
     , m_retrieval(m_context, m_cancellable)
     , m_ranks(m_context.m_value)
@@ -186,25 +233,41 @@ public:
 
   CBV GetMatchedFeatures(strings::UniString const & token, bool isPrefix) const override
   {
+    // The retrieval result depends only on the mwm, the token and the
+    // langs, so it is cached across queries: when the user extends the
+    // query by a keystroke, idfs of all completed tokens are computed
+    // from the cache without trie walks.
+    auto key = make_pair(m_context.GetId(), MakeExactTokenKey(m_params, token, isPrefix));
+    auto const it = m_matchedFeaturesCache.find(key);
+    if (it != m_matchedFeaturesCache.cend())
+      return it->second;
+
+    if (m_matchedFeaturesCache.size() >= kMaxTokenFeaturesCacheSize)
+      m_matchedFeaturesCache.clear();
+
+    CBV features;
     if (isPrefix)
     {
       SearchTrieRequest<strings::PrefixDFAModifier<strings::UniStringDFA>> request;
       request.m_names.emplace_back(strings::UniStringDFA(token));
       request.SetLangs(m_params.GetLangs());
-      return CBV{m_retrieval.RetrieveAddressFeatures(request)};
+      features = CBV{m_retrieval.RetrieveAddressFeatures(request)};
     }
     else
     {
       SearchTrieRequest<strings::UniStringDFA> request;
       request.m_names.emplace_back(token);
       request.SetLangs(m_params.GetLangs());
-      return CBV{m_retrieval.RetrieveAddressFeatures(request)};
+      features = CBV{m_retrieval.RetrieveAddressFeatures(request)};
     }
+    m_matchedFeaturesCache.emplace(move(key), features);
+    return features;
   }
 
 private:
   MwmContext const & m_context;
   Geocoder::Params const & m_params;
+  map<pair<MwmSet::MwmId, string>, CBV> & m_matchedFeaturesCache;
   base::Cancellable const & m_cancellable;
 
   Retrieval m_retrieval;
@@ -370,12 +433,14 @@ void Geocoder::SetParams(Params const & params)
   m_params = params;
 
   m_tokenRequests.clear();
+  m_tokenRequestKeys.clear();
   m_prefixTokenRequest.Clear();
   for (size_t i = 0; i < m_params.GetNumTokens(); ++i)
   {
     if (!m_params.IsPrefixToken(i))
     {
       m_tokenRequests.emplace_back();
+      m_tokenRequestKeys.push_back(MakeTokenKey(m_params, i));
       auto & request = m_tokenRequests.back();
       m_params.GetToken(i).ForEach([&request](UniString const & s) {
         request.m_names.emplace_back(BuildLevenshteinDFA(s));
@@ -449,6 +514,8 @@ void Geocoder::ClearCaches()
   m_hotelsCache.Clear();
   m_hotelsFilter.ClearCaches();
   m_postcodes.Clear();
+  m_tokenFeaturesCache.clear();
+  m_matchedFeaturesCache.clear();
 }
 
 void Geocoder::SetParamsForCategorialSearch(Params const & params)
@@ -456,6 +523,7 @@ void Geocoder::SetParamsForCategorialSearch(Params const & params)
   m_params = params;
 
   m_tokenRequests.clear();
+  m_tokenRequestKeys.clear();
   m_prefixTokenRequest.Clear();
 
   ASSERT(!m_params.LastTokenIsPrefix(), ());
@@ -591,13 +659,30 @@ void Geocoder::InitBaseContext(BaseContext & ctx)
     }
     else
     {
-      ctx.m_features[i] = retrieval.RetrieveAddressFeatures(m_tokenRequests[i]);
+      ctx.m_features[i] = RetrieveAddressFeaturesWithCache(retrieval, i);
     }
   }
 
   ctx.m_hotelsFilter = m_hotelsFilter.MakeScopedFilter(*m_context, m_params.m_hotelsFilter);
 }
 
+CBV Geocoder::RetrieveAddressFeaturesWithCache(Retrieval & retrieval, size_t i)
+{
+  ASSERT_LESS(i, m_tokenRequestKeys.size(), ());
+  auto key = make_pair(m_context->GetId(), m_tokenRequestKeys[i]);
+
+  auto const it = m_tokenFeaturesCache.find(key);
+  if (it != m_tokenFeaturesCache.cend())
+    return it->second;
+
+  if (m_tokenFeaturesCache.size() >= kMaxTokenFeaturesCacheSize)
+    m_tokenFeaturesCache.clear();
+
+  CBV features(retrieval.RetrieveAddressFeatures(m_tokenRequests[i]));
+  m_tokenFeaturesCache.emplace(move(key), features);
+  return features;
+}
+
 void Geocoder::InitLayer(Model::Type type, TokenRange const & tokenRange, FeaturesLayer & layer)
 {
   layer.Clear();
@@ -620,7 +705,7 @@ void Geocoder::FillLocalityCandidates(BaseContext const & ctx, CBV const & filte
     return;
   }
 
-  LocalityScorerDelegate delegate(*m_context, m_params, m_cancellable);
+  LocalityScorerDelegate delegate(*m_context, m_params, m_matchedFeaturesCache, m_cancellable);
   LocalityScorer scorer(m_params, delegate);
   scorer.GetTopLocalities(m_context->GetId(), ctx, filter, maxNumLocalities, preLocalities);
 }
@@ -41,6 +41,7 @@
 #include "std/string.hpp"
 #include "std/unique_ptr.hpp"
 #include "std/unordered_map.hpp"
+#include "std/utility.hpp"
 #include "std/vector.hpp"
 
 class CategoriesHolder;
@@ -57,6 +58,7 @@ namespace search
 class FeaturesFilter;
 class FeaturesLayerMatcher;
 class PreRanker;
+class Retrieval;
 class TokenSlice;
 class Tracer;
 
@@ -75,6 +77,14 @@ class Tracer;
 // part is to find all paths through this layered graph and report all
 // features from the lowest layer, that are reachable from the
 // highest layer.
+//
+// *NOTE* Geocoding of a single query is deliberately single-threaded:
+// mwms are processed one by one in the order of their distance to the
+// pivot, and results are emitted to PreRanker progressively after each
+// mwm, so that the closest results reach the user first. Fields below
+// that describe the currently processed mwm (m_context, m_matcher,
+// m_postcodes etc.) rely on this ordering. Parallelism belongs to the
+// level of Engine, which runs independent queries on separate threads.
 class Geocoder
 {
 public:
@@ -231,6 +241,10 @@ private:
   // UNCLASSIFIED objects that match to all currently unused tokens.
   void MatchUnclassified(BaseContext & ctx, size_t curToken);
 
+  // A caching wrapper around Retrieval::RetrieveAddressFeatures for the
+  // completed (non-prefix) token |i|, see |m_tokenFeaturesCache|.
+  CBV RetrieveAddressFeaturesWithCache(Retrieval & retrieval, size_t i);
+
   // A wrapper around RetrievePostcodeFeatures.
   CBV RetrievePostcodeFeatures(MwmContext const & context, TokenSlice const & slice);
 
@@ -297,6 +311,22 @@ private:
   vector<SearchTrieRequest<strings::LevenshteinDFA>> m_tokenRequests;
   SearchTrieRequest<strings::PrefixDFAModifier<strings::LevenshteinDFA>> m_prefixTokenRequest;
 
+  // Cache keys of |m_tokenRequests|, see MakeTokenKey().
+  vector<string> m_tokenRequestKeys;
+
+  // Address features of completed (non-prefix) tokens, keyed by mwm and token
+  // request. During an interactive search session every keystroke extends the
+  // previous query by one character, so all tokens except the prefix one are
+  // retrieved again with the same result; this cache turns those retrievals
+  // into lookups, and only the prefix token is matched against the trie anew.
+  map<pair<MwmSet::MwmId, string>, CBV> m_tokenFeaturesCache;
+
+  // Exact-match address features per (mwm, token), used to compute idfs
+  // of locality candidates. Kept separately from |m_tokenFeaturesCache|
+  // because the locality scorer matches single tokens exactly, while the
+  // cache above holds fuzzy matches of whole token requests.
+  map<pair<MwmSet::MwmId, string>, CBV> m_matchedFeaturesCache;
+
   PreRanker & m_preRanker;
 };
 }  // namespace search
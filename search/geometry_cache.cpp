@@ -11,6 +11,11 @@ namespace search
 namespace
 {
 double constexpr kCellEps = MercatorBounds::GetCellID2PointAbsEpsilon();
+
+// Maximum number of rect coverings memoized by a GeometryCache. A query
+// uses only a handful of distinct rects (pivot and localities), so the
+// list is kept short.
+size_t constexpr kMaxNumCoverings = 8;
 }  // namespace
 
 // GeometryCache -----------------------------------------------------------------------------------
@@ -26,10 +31,33 @@ void GeometryCache::InitEntry(MwmContext const & context, m2::RectD const & rect
   Retrieval retrieval(context, m_cancellable);
 
   entry.m_rect = rect;
-  entry.m_cbv = retrieval.RetrieveGeometryFeatures(rect, scale);
+  entry.m_cbv = retrieval.RetrieveGeometryFeatures(GetCovering(rect, scale), rect, scale);
   entry.m_scale = scale;
 }
 
+covering::Intervals const & GeometryCache::GetCovering(m2::RectD const & rect, int scale)
+{
+  auto it = find_if(m_coverings.begin(), m_coverings.end(), [&rect, &scale](Covering const & c) {
+    return scale == c.m_scale && IsEqualMercator(rect, c.m_rect, kCellEps);
+  });
+  if (it != m_coverings.end())
+  {
+    if (it != m_coverings.begin())
+      iter_swap(m_coverings.begin(), it);
+    return m_coverings.front().m_intervals;
+  }
+
+  m_coverings.emplace_front();
+  if (m_coverings.size() == kMaxNumCoverings + 1)
+    m_coverings.pop_back();
+
+  auto & covering = m_coverings.front();
+  covering.m_rect = rect;
+  covering.m_scale = scale;
+  CoverRect(rect, scale, covering.m_intervals);
+  return covering.m_intervals;
+}
+
 // PivotRectsCache ---------------------------------------------------------------------------------
 PivotRectsCache::PivotRectsCache(size_t maxNumEntries, base::Cancellable const & cancellable,
                                  double maxRadiusMeters)
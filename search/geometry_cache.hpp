@@ -2,6 +2,7 @@
 
 #include "search/cbv.hpp"
 
+#include "indexer/feature_covering.hpp"
 #include "indexer/mwm_set.hpp"
 
 #include "geometry/rect2d.hpp"
@@ -37,7 +38,11 @@ public:
   // this method.
   virtual CBV Get(MwmContext const & context, m2::RectD const & rect, int scale) = 0;
 
-  inline void Clear() { m_entries.clear(); }
+  inline void Clear()
+  {
+    m_entries.clear();
+    m_coverings.clear();
+  }
 
 protected:
   struct Entry
@@ -77,6 +82,23 @@ protected:
   map<MwmSet::MwmId, deque<Entry>> m_entries;
   size_t const m_maxNumEntries;
   base::Cancellable const & m_cancellable;
+
+private:
+  struct Covering
+  {
+    m2::RectD m_rect;
+    covering::Intervals m_intervals;
+    int m_scale = 0;
+  };
+
+  // Returns the covered intervals for |rect| at |scale|. The covering
+  // does not depend on the mwm, so it's memoized separately from
+  // |m_entries|: a query is retrieved from all mwms with the same pivot
+  // rect, and without the memo CoverRect would be recomputed for every
+  // mwm whose entry is not cached yet.
+  covering::Intervals const & GetCovering(m2::RectD const & rect, int scale);
+
+  deque<Covering> m_coverings;
 };
 
 class PivotRectsCache : public GeometryCache
@@ -192,7 +192,7 @@ public:
   // true).
   bool LooksGood(UniString const & s, bool isPrefix) const
   {
-    vector<Token> parse;
+    Tokens parse;
     Tokenize(s, isPrefix, parse);
 
     size_t i = 0;
@@ -291,7 +291,7 @@ bool IsLiteralType(Token::Type type)
 // * when there is at least one number, drops all tokens until the
 //   number and sorts the rest
 // * when there are no numbers at all, sorts tokens
-void SimplifyParse(vector<Token> & tokens)
+void SimplifyParse(Tokens & tokens)
 {
   if (!tokens.empty() && tokens.back().m_prefix)
     tokens.pop_back();
@@ -351,7 +351,7 @@ bool IsShortBuildingSynonym(UniString const & t)
 }
 
 template <typename TFn>
-void ForEachGroup(vector<Token> const & ts, TFn && fn)
+void ForEachGroup(Tokens const & ts, TFn && fn)
 {
   size_t i = 0;
   while (i < ts.size())
@@ -413,7 +413,7 @@ void TransformString(UniString && token, TFn && fn)
 }
 }  // namespace
 
-void Tokenize(UniString s, bool isPrefix, vector<Token> & ts)
+void Tokenize(UniString s, bool isPrefix, Tokens & ts)
 {
   MakeLowerCaseInplace(s);
   auto addToken = [&ts](UniString && value, Token::Type type)
@@ -470,9 +470,9 @@ void Tokenize(UniString s, bool isPrefix, vector<Token> & ts)
   }
 }
 
-void ParseHouseNumber(strings::UniString const & s, vector<vector<Token>> & parses)
+void ParseHouseNumber(strings::UniString const & s, vector<Tokens> & parses)
 {
-  vector<Token> tokens;
+  Tokens tokens;
   Tokenize(s, false /* isPrefix */, tokens);
 
   bool numbersSequence = true;
@@ -512,7 +512,7 @@ void ParseHouseNumber(strings::UniString const & s, vector<vector<Token>> & pars
     SimplifyParse(parses[i]);
 }
 
-void ParseQuery(strings::UniString const & query, bool queryIsPrefix, vector<Token> & parse)
+void ParseQuery(strings::UniString const & query, bool queryIsPrefix, Tokens & parse)
 {
   Tokenize(query, queryIsPrefix, parse);
   SimplifyParse(parse);
@@ -524,13 +524,13 @@ bool HouseNumbersMatch(strings::UniString const & houseNumber, strings::UniStrin
   if (houseNumber == query)
     return true;
 
-  vector<Token> queryParse;
+  Tokens queryParse;
   ParseQuery(query, queryIsPrefix, queryParse);
 
   return HouseNumbersMatch(houseNumber, queryParse);
 }
 
-bool HouseNumbersMatch(strings::UniString const & houseNumber, vector<Token> const & queryParse)
+bool HouseNumbersMatch(strings::UniString const & houseNumber, Tokens const & queryParse)
 {
   if (houseNumber.empty() || queryParse.empty())
     return false;
@@ -543,7 +543,7 @@ bool HouseNumbersMatch(strings::UniString const & houseNumber, vector<Token> con
     return false;
   }
 
-  vector<vector<Token>> houseNumberParses;
+  vector<Tokens> houseNumberParses;
   ParseHouseNumber(houseNumber, houseNumberParses);
 
   for (auto & parse : houseNumberParses)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "base/buffer_vector.hpp"
 #include "base/string_utils.hpp"
 
 #include "std/string.hpp"
@@ -28,6 +29,7 @@ struct Token
   Token() = default;
   Token(strings::UniString const & value, Type type) : m_value(value), m_type(type) {}
   Token(strings::UniString && value, Type type) : m_value(move(value)), m_type(type) {}
+  Token(Token const &) = default;
   Token(Token &&) = default;
 
   Token & operator=(Token &&) = default;
@@ -52,22 +54,27 @@ struct Token
   bool m_prefix = false;
 };
 
+// Almost all house numbers consist of only a few tokens, so heap
+// allocations are avoided during matching, which runs for every
+// candidate feature of an address query.
+using Tokens = buffer_vector<Token, 8>;
+
 // Tokenizes |s| that may be a house number.
-void Tokenize(strings::UniString s, bool isPrefix, vector<Token> & ts);
+void Tokenize(strings::UniString s, bool isPrefix, Tokens & ts);
 
 // Parses a string that can be one or more house numbers. This method
 // can be used to parse addr:housenumber fields.
-void ParseHouseNumber(strings::UniString const & s, vector<vector<Token>> & parses);
+void ParseHouseNumber(strings::UniString const & s, vector<Tokens> & parses);
 
 // Parses a part of search query that can be a house number.
-void ParseQuery(strings::UniString const & query, bool queryIsPrefix, vector<Token> & parse);
+void ParseQuery(strings::UniString const & query, bool queryIsPrefix, Tokens & parse);
 
 // Returns true if house number matches to a given query.
 bool HouseNumbersMatch(strings::UniString const & houseNumber, strings::UniString const & query,
                        bool queryIsPrefix);
 
 // Returns true if house number matches to a given parsed query.
-bool HouseNumbersMatch(strings::UniString const & houseNumber, vector<Token> const & queryParse);
+bool HouseNumbersMatch(strings::UniString const & houseNumber, Tokens const & queryParse);
 
 // Returns true if |s| looks like a house number.
 bool LooksLikeHouseNumber(strings::UniString const & s, bool isPrefix);
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "std/algorithm.hpp"
-#include "std/set.hpp"
 #include "std/utility.hpp"
 #include "std/vector.hpp"
 
@@ -12,16 +11,19 @@ namespace search
 // [begin, end).  Note that neighbour intervals are always coalesced,
 // so while [0, 1), [1, 2) and [2, 3) are disjoint, after addition to
 // the set they will be stored as a single [0, 3).
+//
+// The intervals are stored in a sorted vector: sets are small, and flat
+// storage avoids a node allocation per interval.
 template <typename Elem>
 class IntervalSet
 {
 public:
   using Interval = pair<Elem, Elem>;
+  using Intervals = vector<Interval>;
 
   // Adds an |interval| to the set, coalescing adjacent intervals if needed.
   //
-  // Complexity: O(num of intervals intersecting with |interval| +
-  // log(total number of intervals)).
+  // Complexity: O(total number of intervals).
   void Add(Interval const & interval);
 
   // Subtracts set from an |interval| and appends result to
@@ -31,19 +33,19 @@ public:
   // log(total number of intervals)).
   void SubtractFrom(Interval const & interval, vector<Interval> & difference) const;
 
-  // Returns all elements of the set as a set of intervals.
+  // Returns all elements of the set as a sorted list of disjoint intervals.
   //
   // Complexity: O(1).
-  inline set<Interval> const & Elems() const { return m_intervals; }
+  inline Intervals const & Elems() const { return m_intervals; }
 
 private:
-  using Iterator = typename set<Interval>::iterator;
+  using Iterator = typename Intervals::const_iterator;
 
   // Calculates range of intervals that have non-empty intersection with a given |interval|.
   void Cover(Interval const & interval, Iterator & begin, Iterator & end) const;
 
-  // This is a set of disjoint intervals.
-  set<Interval> m_intervals;
+  // This is a sorted list of disjoint intervals.
+  Intervals m_intervals;
 };
 
 template <typename Elem>
@@ -66,8 +68,7 @@ void IntervalSet<Elem>::Add(Interval const & interval)
     if (begin->first < from)
       from = begin->first;
 
-    auto last = end;
-    --last;
+    auto const last = end - 1;
     if (last->second > to)
       to = last->second;
   }
@@ -76,24 +77,23 @@ void IntervalSet<Elem>::Add(Interval const & interval)
   // interval which will replace all intervals in [begin, end). But
   // note that it can be possible to merge new interval with its
   // neighbors, so following code checks it.
-  if (begin != m_intervals.begin())
+  if (begin != m_intervals.cbegin())
   {
-    auto prevBegin = begin;
-    --prevBegin;
+    auto const prevBegin = begin - 1;
     if (prevBegin->second == from)
     {
       begin = prevBegin;
       from = prevBegin->first;
     }
   }
-  if (end != m_intervals.end() && end->first == to)
+  if (end != m_intervals.cend() && end->first == to)
   {
     to = end->second;
     ++end;
   }
 
-  m_intervals.erase(begin, end);
-  m_intervals.emplace(from, to);
+  auto const it = m_intervals.erase(begin, end);
+  m_intervals.emplace(it, from, to);
 }
 
 template <typename Elem>
@@ -131,15 +131,14 @@ void IntervalSet<Elem>::Cover(Interval const & interval, Iterator & begin, Itera
   Elem const & from = interval.first;
   Elem const & to = interval.second;
 
-  begin = m_intervals.lower_bound(make_pair(from, from));
-  if (begin != m_intervals.begin())
+  begin = lower_bound(m_intervals.cbegin(), m_intervals.cend(), make_pair(from, from));
+  if (begin != m_intervals.cbegin())
   {
-    auto prev = begin;
-    --prev;
+    auto const prev = begin - 1;
     if (prev->second > from)
       begin = prev;
   }
 
-  end = m_intervals.lower_bound(make_pair(to, to));
+  end = lower_bound(m_intervals.cbegin(), m_intervals.cend(), make_pair(to, to));
 }
 }  // namespace search
@@ -23,6 +23,12 @@ namespace
 double const kMaxCityRadiusMeters = 30000.0;
 double const kMaxVillageRadiusMeters = 2000.0;
 
+// The localities caches grow while the user pans around; dropping them
+// entirely once they hold too many items bounds the finder to a few
+// megabytes. The vicinity of the current point is reloaded right after
+// the cleanup, so only cold areas are evicted.
+size_t constexpr kMaxCachedLocalities = 10000;
+
 struct Filter
 {
 public:
@@ -233,6 +239,15 @@ void LocalityFinder::ClearCache()
 
 void LocalityFinder::LoadVicinity(m2::PointD const & p, bool loadCities, bool loadVillages)
 {
+  if (loadCities || loadVillages)
+  {
+    size_t numLoaded = 0;
+    for (auto const & ids : m_loadedIds)
+      numLoaded += ids.second.size();
+    if (numLoaded >= kMaxCachedLocalities)
+      ClearCache();
+  }
+
   UpdateMaps();
 
   if (loadCities)
@@ -1,6 +1,7 @@
 #include "search/locality_scorer.hpp"
 
 #include "search/cbv.hpp"
+#include "search/common.hpp"
 #include "search/geocoder_context.hpp"
 #include "search/idf_map.hpp"
 #include "search/token_slice.hpp"
@@ -213,7 +214,7 @@ void LocalityScorer::GetDocVecs(uint32_t localityId, vector<DocVec> & dvs) const
 
   for (auto const & name : names)
   {
-    vector<strings::UniString> tokens;
+    QueryTokens tokens;
     NormalizeAndTokenizeString(name, tokens);
 
     DocVec::Builder builder;
@@ -113,13 +113,12 @@ private:
   void ForEachIndexImpl(covering::Intervals const & intervals, uint32_t scale, TFn && fn) const
   {
     CheckUniqueIndexes checkUnique(m_value.GetHeader().GetFormat() >= version::Format::v5);
-    for (auto const & i : intervals)
-      m_index.ForEachInIntervalAndScale(i.first, i.second, scale,
-          [&](uint32_t index)
-          {
-            if (checkUnique(index))
-              fn(index);
-          });
+    m_index.ForEachInIntervalsAndScale(intervals, scale,
+        [&](uint32_t index)
+        {
+          if (checkUnique(index))
+            fn(index);
+        });
   }
 
   FeaturesVector m_vector;
@@ -70,6 +70,13 @@ void PreRanker::Finish(bool cancelled)
 
 void PreRanker::FillMissingFieldsInPreResults()
 {
+  // Order results by mwm and feature offset: ranks, popularity and
+  // centers are read from mapped mwm sections, and an ascending sweep
+  // opens every mwm handle once and replaces scattered page reads with
+  // sequential ones. Filter() sorts by feature id anyway, so the order
+  // of duplicate selection is not affected.
+  sort(m_results.begin(), m_results.end(), base::LessBy(&PreRankerResult::GetId));
+
   MwmSet::MwmId mwmId;
   MwmSet::MwmHandle mwmHandle;
   unique_ptr<RankTable> ranks = make_unique<DummyRankTable>();
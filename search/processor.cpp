@@ -40,6 +40,7 @@
 #include "coding/multilang_utf8_string.hpp"
 #include "coding/reader_wrapper.hpp"
 
+#include "base/alloc_tracker.hpp"
 #include "base/assert.hpp"
 #include "base/logging.hpp"
 #include "base/macros.hpp"
@@ -219,7 +220,10 @@ void Processor::SetQuery(string const & query)
   // retrieve all tokens that start with a single hashtag and leave
   // them as is.
 
-  vector<strings::UniString> tokens;
+  // QueryTokens is a buffer_vector, so the whole tokenization path below
+  // stays heap-free for queries of sane length: UniString keeps short
+  // tokens in its inline buffer and the containers are on the stack.
+  QueryTokens tokens;
   {
     search::DelimitersWithExceptions delims(vector<strings::UniChar>{'#'});
     SplitUniString(NormalizeAndSimplifyString(query), base::MakeBackInsertFunctor(tokens), delims);
@@ -329,10 +333,7 @@ void Processor::OnBookmarksCreated(vector<pair<bookmarks::Id, bookmarks::Doc>> c
 void Processor::OnBookmarksUpdated(vector<pair<bookmarks::Id, bookmarks::Doc>> const & marks)
 {
   for (auto const & idDoc : marks)
-  {
-    m_bookmarksProcessor.Erase(idDoc.first /* id */);
-    m_bookmarksProcessor.Add(idDoc.first /* id */, idDoc.second /* doc */);
-  }
+    m_bookmarksProcessor.Update(idDoc.first /* id */, idDoc.second /* doc */);
 }
 
 void Processor::OnBookmarksDeleted(vector<bookmarks::Id> const & marks)
@@ -369,8 +370,20 @@ void Processor::ForEachCategoryTypeFuzzy(StringSliceBase const & slice, ToDo &&
                                      forward<ToDo>(toDo));
 }
 
+bool Processor::IsCancelled() const
+{
+  if (base::Cancellable::IsCancelled())
+    return true;
+  return m_timeoutSec > 0.0 && m_timer.ElapsedSeconds() >= m_timeoutSec;
+}
+
 void Processor::Search(SearchParams const & params)
 {
+  SCOPED_ALLOC_TAG("search:processor");
+
+  m_timer.Reset();
+  m_timeoutSec = params.m_timeoutSec;
+
   if (params.m_onStarted)
     params.m_onStarted();
 
@@ -436,11 +449,18 @@ void Processor::Search(SearchParams const & params)
     LOG(LDEBUG, ("Search has been cancelled."));
   }
 
-  if (!viewportSearch && !IsCancelled())
+  // A query that ran out of its time budget is reported as completed:
+  // everything found so far is flushed to the client and only a real
+  // cancellation invalidates the results.
+  bool const cancelled = base::Cancellable::IsCancelled();
+  if (!cancelled && IsCancelled())
+    LOG(LWARNING, ("Search timed out after", m_timer.ElapsedSeconds(), "seconds."));
+
+  if (!viewportSearch && !cancelled)
     SendStatistics(params, viewport, m_emitter.GetResults());
 
   // Emit finish marker to client.
-  m_geocoder.Finish(IsCancelled());
+  m_geocoder.Finish(cancelled);
 }
 
 void Processor::SearchCoordinates()
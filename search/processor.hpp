@@ -25,6 +25,7 @@
 
 #include "base/cancellable.hpp"
 #include "base/string_utils.hpp"
+#include "base/timer.hpp"
 
 #include <cstddef>
 #include <cstdint>
@@ -77,6 +78,13 @@ public:
 
   void Search(SearchParams const & params);
 
+  // base::Cancellable overrides:
+  //
+  // Also reports cancellation when the time budget of the current query
+  // is exhausted, so every existing cancellation checkpoint doubles as a
+  // deadline checkpoint, see SearchParams::m_timeoutSec.
+  bool IsCancelled() const override;
+
   // Tries to generate a (lat, lon) result from |m_query|.
   void SearchCoordinates();
   // Tries to parse a plus code from |m_query| and generate a (lat, lon) result.
@@ -128,6 +136,11 @@ protected:
   m2::RectD m_viewport;
   m2::PointD m_position;
 
+  // Time budget of the currently processed query, see
+  // SearchParams::m_timeoutSec. |m_timer| is restarted by Search().
+  base::Timer m_timer;
+  double m_timeoutSec = 0.0;
+
   // Suggestions language code, not the same as we use in mwm data
   int8_t m_inputLocaleCode = StringUtf8Multilang::kUnsupportedLanguageCode;
   int8_t m_currentLocaleCode = StringUtf8Multilang::kUnsupportedLanguageCode;
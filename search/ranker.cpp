@@ -23,7 +23,9 @@
 #include "base/string_utils.hpp"
 
 #include <algorithm>
+#include <map>
 #include <memory>
+#include <utility>
 
 #include <boost/optional.hpp>
 
@@ -47,8 +49,7 @@ void UpdateNameScores(string const & name, TSlice const & slice, NameScores & be
 }
 
 template <typename TSlice>
-void UpdateNameScores(vector<strings::UniString> const & tokens, TSlice const & slice,
-                      NameScores & bestScores)
+void UpdateNameScores(QueryTokens const & tokens, TSlice const & slice, NameScores & bestScores)
 {
   bestScores.m_nameScore = max(bestScores.m_nameScore, GetNameScore(tokens, slice));
   bestScores.m_errorsMade = ErrorsMade::Min(bestScores.m_errorsMade, GetErrorsMade(tokens, slice));
@@ -67,7 +68,7 @@ NameScores GetNameScores(FeatureType & ft, Geocoder::Params const & params,
     string name;
     if (!ft.GetName(lang, name))
       continue;
-    vector<strings::UniString> tokens;
+    QueryTokens tokens;
     PrepareStringForMatching(name, tokens);
 
     UpdateNameScores(tokens, slice, bestScores);
@@ -218,6 +219,13 @@ class RankerResultMaker
 
   unique_ptr<FeaturesLoaderGuard> m_loader;
 
+  // An update batch typically contains many results on the same street or
+  // in the same city, and the auxiliary street/city feature used to refine
+  // the scores is the same for all of them. Memoizing the scores saves the
+  // repeated deserialization of that feature for every result.
+  map<pair<FeatureID, TokenRange>, pair<bool, NameScores>> m_streetScoresCache;
+  map<pair<FeatureID, TokenRange>, pair<bool, ErrorsMade>> m_cityErrorsCache;
+
   bool LoadFeature(FeatureID const & id, FeatureType & ft)
   {
     if (!m_loader || m_loader->GetId() != id.m_mwmId)
@@ -250,6 +258,46 @@ class RankerResultMaker
     return true;
   }
 
+  bool GetStreetNameScores(FeatureID const & id, TokenRange const & range, NameScores & scores)
+  {
+    auto const res = m_streetScoresCache.emplace(make_pair(id, range), make_pair(false, NameScores{}));
+    auto & entry = res.first->second;
+    if (res.second)
+    {
+      FeatureType street;
+      if (LoadFeature(id, street))
+      {
+        entry.first = true;
+        entry.second = GetNameScores(street, m_params, range, Model::TYPE_STREET);
+      }
+    }
+
+    if (!entry.first)
+      return false;
+    scores = entry.second;
+    return true;
+  }
+
+  bool GetCityErrorsMade(FeatureID const & id, TokenRange const & range, ErrorsMade & errorsMade)
+  {
+    auto const res = m_cityErrorsCache.emplace(make_pair(id, range), make_pair(false, ErrorsMade{}));
+    auto & entry = res.first->second;
+    if (res.second)
+    {
+      FeatureType city;
+      if (LoadFeature(id, city))
+      {
+        entry.first = true;
+        entry.second = GetErrorsMade(city, m_params, range, Model::TYPE_CITY);
+      }
+    }
+
+    if (!entry.first)
+      return false;
+    errorsMade = entry.second;
+    return true;
+  }
+
   void InitRankingInfo(FeatureType & ft, m2::PointD const & center, PreRankerResult const & res,
                        search::RankingInfo & info)
   {
@@ -272,27 +320,20 @@ class RankerResultMaker
         preInfo.m_geoParts.m_street != IntersectionResult::kInvalidId)
     {
       auto const & mwmId = ft.GetID().m_mwmId;
-      FeatureType street;
-      if (LoadFeature(FeatureID(mwmId, preInfo.m_geoParts.m_street), street))
+      NameScores streetScores;
+      if (GetStreetNameScores(FeatureID(mwmId, preInfo.m_geoParts.m_street),
+                              preInfo.m_tokenRange[Model::TYPE_STREET], streetScores))
       {
-        auto const type = Model::TYPE_STREET;
-        auto const & range = preInfo.m_tokenRange[type];
-        auto const nameScores = GetNameScores(street, m_params, range, type);
-
-        nameScore = min(nameScore, nameScores.m_nameScore);
-        errorsMade += nameScores.m_errorsMade;
+        nameScore = min(nameScore, streetScores.m_nameScore);
+        errorsMade += streetScores.m_errorsMade;
       }
     }
 
     if (!Model::IsLocalityType(info.m_type) && preInfo.m_cityId.IsValid())
     {
-      FeatureType city;
-      if (LoadFeature(preInfo.m_cityId, city))
-      {
-        auto const type = Model::TYPE_CITY;
-        auto const & range = preInfo.m_tokenRange[type];
-        errorsMade += GetErrorsMade(city, m_params, range, type);
-      }
+      ErrorsMade cityErrors;
+      if (GetCityErrorsMade(preInfo.m_cityId, preInfo.m_tokenRange[Model::TYPE_CITY], cityErrors))
+        errorsMade += cityErrors;
     }
 
     info.m_nameScore = nameScore;
@@ -490,6 +531,7 @@ void Ranker::UpdateResults(bool lastUpdate)
 
   // Emit feature results.
   size_t count = m_emitter.GetResults().GetCount();
+  bool hasNewResults = false;
   size_t i = 0;
   for (; i < m_tentativeResults.size(); ++i)
   {
@@ -510,20 +552,27 @@ void Ranker::UpdateResults(bool lastUpdate)
     {
       m_emitter.AddResultNoChecks(move(result));
       ++count;
+      hasNewResults = true;
     }
     else
     {
       LOG(LDEBUG, (rankerResult));
       if (m_emitter.AddResult(move(result)))
+      {
         ++count;
+        hasNewResults = true;
+      }
     }
   }
   m_tentativeResults.erase(m_tentativeResults.begin(), m_tentativeResults.begin() + i);
 
   m_preRankerResults.clear();
 
-  // The last update must be handled by a call to Finish().
-  if (!lastUpdate)
+  // The last update must be handled by a call to Finish(). Intermediate
+  // updates are reported only when something was actually added: when
+  // the whole batch was filtered out as duplicates, a callback would
+  // just make the UI re-render an unchanged list of results.
+  if (!lastUpdate && hasNewResults)
   {
     BailIfCancelled();
     m_emitter.Emit();
@@ -591,13 +640,24 @@ void Ranker::GetBestMatchName(FeatureType & f, string & name) const
 void Ranker::MatchForSuggestions(strings::UniString const & token, int8_t locale,
                                  string const & prologue)
 {
-  for (auto const & suggest : m_suggests)
+  // |m_suggests| is sorted by (locale, name), see InitSuggestions, so all
+  // suggestions for |locale| whose names start with |token| form a
+  // contiguous range beginning at the lower bound of (locale, token).
+  auto const less = [](Suggest const & lhs, Suggest const & rhs) {
+    if (lhs.m_locale != rhs.m_locale)
+      return lhs.m_locale < rhs.m_locale;
+    return lhs.m_name < rhs.m_name;
+  };
+
+  auto it = lower_bound(m_suggests.begin(), m_suggests.end(),
+                        Suggest(token, 0 /* len */, locale), less);
+  for (; it != m_suggests.end() && it->m_locale == locale && strings::StartsWith(it->m_name, token);
+       ++it)
   {
+    auto const & suggest = *it;
     strings::UniString const & s = suggest.m_name;
-    if (suggest.m_prefixLength <= token.size()
-        && token != s                  // do not push suggestion if it already equals to token
-        && suggest.m_locale == locale  // push suggestions only for needed language
-        && strings::StartsWith(s, token))
+    if (suggest.m_prefixLength <= token.size() &&
+        token != s)  // do not push suggestion if it already equals to token
     {
       string const utf8Str = strings::ToUtf8(s);
       Result r(utf8Str, prologue + utf8Str + " ");
@@ -10,6 +10,7 @@
 #include "std/transform_iterator.hpp"
 
 #include <algorithm>
+#include <map>
 #include <sstream>
 
 using namespace std;
@@ -91,10 +92,24 @@ bool PrefixMatch(QueryParams::Token const & token, UniString const & text)
   return false;
 }
 
-ErrorsMade GetMinErrorsMade(vector<strings::UniString> const & tokens,
-                            strings::UniString const & text)
+ErrorsMade GetMinErrorsMade(QueryTokens const & tokens, strings::UniString const & text)
 {
-  auto const dfa = BuildLevenshteinDFA(text);
+  // |text| is a query token while |tokens| come from a feature name, and
+  // this function runs for every name of every candidate feature. The
+  // automaton depends only on |text|, so it is memoized: there are a few
+  // dozen distinct query tokens at most, but thousands of candidates.
+  size_t constexpr kMaxCachedDFAs = 128;
+  static thread_local map<strings::UniString, strings::LevenshteinDFA> dfas;
+
+  auto it = dfas.find(text);
+  if (it == dfas.end())
+  {
+    if (dfas.size() >= kMaxCachedDFAs)
+      dfas.clear();
+    it = dfas.emplace(text, BuildLevenshteinDFA(text)).first;
+  }
+
+  auto const & dfa = it->second;
 
   ErrorsMade errorsMade;
 
@@ -123,7 +138,7 @@ bool IsStopWord(UniString const & s)
   return kStopWords.count(s) > 0;
 }
 
-void PrepareStringForMatching(string const & name, vector<strings::UniString> & tokens)
+void PrepareStringForMatching(string const & name, QueryTokens & tokens)
 {
   auto filter = [&tokens](strings::UniString const & token)
   {
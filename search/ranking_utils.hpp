@@ -104,8 +104,7 @@ bool PrefixMatch(QueryParams::Token const & token, strings::UniString const & te
 // Returns the minimum number of errors needed to match |text| with
 // any of the |tokens|.  If it's not possible in accordance with
 // GetMaxErrorsForToken(|text|), returns kInfiniteErrors.
-ErrorsMade GetMinErrorsMade(std::vector<strings::UniString> const & tokens,
-                            strings::UniString const & text);
+ErrorsMade GetMinErrorsMade(QueryTokens const & tokens, strings::UniString const & text);
 }  // namespace impl
 
 // The order and numeric values are important here.  Please, check all
@@ -124,7 +123,9 @@ enum NameScore
 bool IsStopWord(strings::UniString const & s);
 
 // Normalizes, simplifies and splits string, removes stop-words.
-void PrepareStringForMatching(std::string const & name, std::vector<strings::UniString> & tokens);
+// |tokens| are kept in a QueryTokens to avoid a heap allocation per
+// name - this runs for every name of every ranked candidate.
+void PrepareStringForMatching(std::string const & name, QueryTokens & tokens);
 
 template <typename Slice>
 NameScore GetNameScore(std::string const & name, Slice const & slice)
@@ -132,13 +133,13 @@ NameScore GetNameScore(std::string const & name, Slice const & slice)
   if (slice.Empty())
     return NAME_SCORE_ZERO;
 
-  std::vector<strings::UniString> tokens;
+  QueryTokens tokens;
   SplitUniString(NormalizeAndSimplifyString(name), base::MakeBackInsertFunctor(tokens), Delimiters());
   return GetNameScore(tokens, slice);
 }
 
 template <typename Slice>
-NameScore GetNameScore(std::vector<strings::UniString> const & tokens, Slice const & slice)
+NameScore GetNameScore(QueryTokens const & tokens, Slice const & slice)
 {
   if (slice.Empty())
     return NAME_SCORE_ZERO;
@@ -179,7 +180,7 @@ string DebugPrint(NameScore score);
 // Returns total number of errors that were made during matching
 // feature |tokens| by a query - query tokens are in |slice|.
 template <typename Slice>
-ErrorsMade GetErrorsMade(std::vector<strings::UniString> const & tokens, Slice const & slice)
+ErrorsMade GetErrorsMade(QueryTokens const & tokens, Slice const & slice)
 {
   ErrorsMade totalErrorsMade;
 
@@ -199,6 +200,8 @@ ErrorsMade GetErrorsMade(std::vector<strings::UniString> const & tokens, Slice c
 template <typename Slice>
 ErrorsMade GetErrorsMade(std::string const & s, Slice const & slice)
 {
-  return GetErrorsMade({strings::MakeUniString(s)}, slice);
+  QueryTokens tokens;
+  tokens.push_back(strings::MakeUniString(s));
+  return GetErrorsMade(tokens, slice);
 }
 }  // namespace search
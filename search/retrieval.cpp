@@ -1,6 +1,7 @@
 #include "retrieval.hpp"
 
 #include "search/cancel_exception.hpp"
+#include "search/common.hpp"
 #include "search/feature_offset_match.hpp"
 #include "search/interval_set.hpp"
 #include "search/mwm_context.hpp"
@@ -112,7 +113,7 @@ unique_ptr<coding::CompressedBitVector> SortFeaturesAndBuildCBV(vector<uint64_t>
 }
 
 template <typename DFA>
-bool MatchesByName(vector<UniString> const & tokens, vector<DFA> const & dfas)
+bool MatchesByName(QueryTokens const & tokens, vector<DFA> const & dfas)
 {
   for (auto const & dfa : dfas)
   {
@@ -162,7 +163,9 @@ bool MatchFeatureByNameAndType(FeatureType & ft, SearchTrieRequest<DFA> const &
     if (name.empty() || !request.HasLang(lang))
       return base::ControlFlow::Continue;
 
-    vector<UniString> tokens;
+    // A stack-allocated buffer: this lambda runs for every name of every
+    // candidate feature, so the tokens should not hit the heap.
+    QueryTokens tokens;
     NormalizeAndTokenizeString(name, tokens, Delimiters());
     if (!MatchesByName(tokens, request.m_names) && !MatchesByType(th, request.m_categories))
       return base::ControlFlow::Continue;
@@ -177,7 +180,7 @@ bool MatchFeatureByNameAndType(FeatureType & ft, SearchTrieRequest<DFA> const &
 bool MatchFeatureByPostcode(FeatureType & ft, TokenSlice const & slice)
 {
   string const postcode = ft.GetMetadata().Get(feature::Metadata::FMD_POSTCODE);
-  vector<UniString> tokens;
+  QueryTokens tokens;
   NormalizeAndTokenizeString(postcode, tokens, Delimiters());
   if (slice.Size() > tokens.size())
     return false;
@@ -245,14 +248,11 @@ unique_ptr<coding::CompressedBitVector> RetrievePostcodeFeaturesImpl(
 }
 
 unique_ptr<coding::CompressedBitVector> RetrieveGeometryFeaturesImpl(
-    MwmContext const & context, base::Cancellable const & cancellable, m2::RectD const & rect,
-    int scale)
+    MwmContext const & context, base::Cancellable const & cancellable,
+    covering::Intervals const & coverage, m2::RectD const & rect, int scale)
 {
   EditedFeaturesHolder holder(context.GetId());
 
-  covering::Intervals coverage;
-  CoverRect(rect, scale, coverage);
-
   vector<uint64_t> features;
 
   FeaturesCollector collector(cancellable, features);
@@ -351,7 +351,15 @@ unique_ptr<coding::CompressedBitVector> Retrieval::RetrievePostcodeFeatures(
 unique_ptr<coding::CompressedBitVector> Retrieval::RetrieveGeometryFeatures(m2::RectD const & rect,
                                                                             int scale) const
 {
-  return RetrieveGeometryFeaturesImpl(m_context, m_cancellable, rect, scale);
+  covering::Intervals coverage;
+  CoverRect(rect, scale, coverage);
+  return RetrieveGeometryFeaturesImpl(m_context, m_cancellable, coverage, rect, scale);
+}
+
+unique_ptr<coding::CompressedBitVector> Retrieval::RetrieveGeometryFeatures(
+    covering::Intervals const & coverage, m2::RectD const & rect, int scale) const
+{
+  return RetrieveGeometryFeaturesImpl(m_context, m_cancellable, coverage, rect, scale);
 }
 
 template <template <typename> class R, typename... Args>
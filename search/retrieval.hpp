@@ -3,6 +3,8 @@
 #include "search/feature_offset_match.hpp"
 #include "search/query_params.hpp"
 
+#include "indexer/feature_covering.hpp"
+
 #include "platform/mwm_traits.hpp"
 
 #include "coding/reader.hpp"
@@ -57,6 +59,12 @@ public:
   unique_ptr<coding::CompressedBitVector> RetrieveGeometryFeatures(m2::RectD const & rect,
                                                                    int scale) const;
 
+  // The same as above, but with a precomputed covering of |rect|. The
+  // covering does not depend on the mwm, so a caller retrieving from
+  // several mwms can compute it once and reuse it.
+  unique_ptr<coding::CompressedBitVector> RetrieveGeometryFeatures(
+      covering::Intervals const & coverage, m2::RectD const & rect, int scale) const;
+
 private:
   template <template <typename> class R, typename... Args>
   unique_ptr<coding::CompressedBitVector> Retrieve(Args &&... args) const;
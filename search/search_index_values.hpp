@@ -184,10 +184,10 @@ public:
 
   void Init(std::vector<FeatureIndexValue> const & values)
   {
-    std::vector<uint64_t> ids(values.size());
-    for (size_t i = 0; i < ids.size(); ++i)
-      ids[i] = values[i].m_featureId;
-    m_cbv = coding::CompressedBitVectorBuilder::FromBitPositions(move(ids));
+    coding::StreamingCBVBuilder builder;
+    for (auto const & value : values)
+      builder.PushBitPosition(value.m_featureId);
+    m_cbv = builder.Build();
   }
 
   // This method returns number of values in the current instance of
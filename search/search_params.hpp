@@ -42,6 +42,13 @@ struct SearchParams
 
   size_t m_maxNumResults = kDefaultNumResultsEverywhere;
 
+  // Amount of time after which the query processing is stopped at the
+  // nearest cancellation checkpoint and everything found so far is
+  // returned. As mwms are processed in the order of their distance to
+  // the pivot, a timed out query degrades to a smaller search area
+  // instead of returning nothing. Non-positive values mean no limit.
+  double m_timeoutSec = 0.0;
+
   // Minimal distance between search results in mercators, needed for
   // pre-ranking of viewport search results.
   double m_minDistanceOnMapBetweenResults = 0.0;
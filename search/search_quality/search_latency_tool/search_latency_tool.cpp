@@ -0,0 +1,279 @@
+#include "search/result.hpp"
+#include "search/search_quality/helpers.hpp"
+#include "search/search_tests_support/test_search_engine.hpp"
+#include "search/search_tests_support/test_search_request.hpp"
+
+#include "storage/country_info_getter.hpp"
+#include "storage/index.hpp"
+#include "storage/storage.hpp"
+
+#include "indexer/classificator_loader.hpp"
+#include "indexer/data_source.hpp"
+
+#include "platform/country_file.hpp"
+#include "platform/local_country_file.hpp"
+#include "platform/local_country_file_utils.hpp"
+#include "platform/platform.hpp"
+
+#include "coding/file_name_utils.hpp"
+
+#include "geometry/mercator.hpp"
+#include "geometry/rect2d.hpp"
+
+#include "base/logging.hpp"
+#include "base/string_utils.hpp"
+
+#include "std/algorithm.hpp"
+#include "std/chrono.hpp"
+#include "std/cmath.hpp"
+#include "std/fstream.hpp"
+#include "std/iostream.hpp"
+#include "std/limits.hpp"
+#include "std/map.hpp"
+#include "std/string.hpp"
+#include "std/vector.hpp"
+
+#include "defines.hpp"
+
+#include "3party/gflags/src/gflags/gflags.h"
+
+using namespace search::tests_support;
+using namespace search;
+using namespace storage;
+
+DEFINE_string(data_path, "", "Path to data directory (resources dir)");
+DEFINE_string(locale, "en", "Locale of all the search queries");
+DEFINE_int32(num_threads, 1, "Number of search engine threads");
+DEFINE_string(mwm_list_path, "",
+              "Path to a file containing the names of available mwms, one per line");
+DEFINE_string(mwm_path, "", "Path to mwm files (writable dir)");
+DEFINE_string(queries_path, "", "Path to the file with recorded queries, one per line. "
+                                "Every query is replayed keystroke by keystroke.");
+DEFINE_string(viewport, "", "Viewport to use when searching (default, moscow, london, zurich)");
+DEFINE_bool(verbose, false, "Print timings of every keystroke");
+
+map<string, m2::RectD> const kViewports = {
+    {"default", m2::RectD(m2::PointD(0.0, 0.0), m2::PointD(1.0, 1.0))},
+    {"moscow", MercatorBounds::RectByCenterLatLonAndSizeInMeters(55.7, 37.7, 5000)},
+    {"london", MercatorBounds::RectByCenterLatLonAndSizeInMeters(51.5, 0.0, 5000)},
+    {"zurich", MercatorBounds::RectByCenterLatLonAndSizeInMeters(47.4, 8.5, 5000)}};
+
+void DidDownload(TCountryId const & /* countryId */,
+                 shared_ptr<platform::LocalCountryFile> const & /* localFile */)
+{
+}
+
+bool WillDelete(TCountryId const & /* countryId */,
+                shared_ptr<platform::LocalCountryFile> const & /* localFile */)
+{
+  return false;
+}
+
+void ReadStringsFromFile(string const & path, vector<string> & result)
+{
+  ifstream stream(path.c_str());
+  CHECK(stream.is_open(), ("Can't open", path));
+
+  string s;
+  while (getline(stream, s))
+  {
+    strings::Trim(s);
+    if (!s.empty())
+      result.emplace_back(s);
+  }
+}
+
+// A search request which additionally records the time of the first
+// non-empty results batch.
+class KeystrokeRequest : public TestSearchRequest
+{
+public:
+  KeystrokeRequest(TestSearchEngine & engine, string const & query, string const & locale,
+                   m2::RectD const & viewport)
+    : TestSearchRequest(engine, query, locale, Mode::Everywhere, viewport)
+  {
+    SetCustomOnResults([this](search::Results const & results) { OnTimedResults(results); });
+  }
+
+  // Returns the time from the search start to the first non-empty results
+  // batch or the total response time if the search emitted nothing.
+  steady_clock::duration TimeToFirstResult() const
+  {
+    {
+      lock_guard<mutex> lock(m_mu);
+      if (m_haveFirstResult)
+        return m_firstResultTime - m_startTime;
+    }
+    return ResponseTime();
+  }
+
+private:
+  void OnTimedResults(search::Results const & results)
+  {
+    {
+      lock_guard<mutex> lock(m_mu);
+      if (!m_haveFirstResult && !results.IsEndMarker() && results.GetCount() != 0)
+      {
+        m_haveFirstResult = true;
+        m_firstResultTime = m_timer.TimeElapsed();
+      }
+    }
+    OnResults(results);
+  }
+
+  bool m_haveFirstResult = false;
+  steady_clock::duration m_firstResultTime = {};
+};
+
+// Expands a recorded query into the sequence of queries the engine sees
+// while the user is typing it: all unicode prefixes and, at the end, the
+// whole query with a trailing space (the complete-token form).
+vector<string> MakeKeystrokes(string const & query)
+{
+  auto const uni = strings::MakeUniString(query);
+  vector<string> keystrokes;
+  keystrokes.reserve(uni.size() + 1);
+  for (size_t len = 1; len <= uni.size(); ++len)
+    keystrokes.push_back(strings::ToUtf8(strings::UniString(uni.begin(), uni.begin() + len)));
+  keystrokes.push_back(query + " ");
+  return keystrokes;
+}
+
+double ToMilliseconds(steady_clock::duration const & duration)
+{
+  return duration_cast<std::chrono::duration<double, std::milli>>(duration).count();
+}
+
+// Nearest-rank percentile of an ascending-sorted sample.
+double Percentile(vector<double> const & sorted, double p)
+{
+  CHECK(!sorted.empty(), ());
+  auto const rank = static_cast<size_t>(ceil(p * sorted.size()));
+  return sorted[min(sorted.size() - 1, rank == 0 ? 0 : rank - 1)];
+}
+
+void PrintStatistics(string const & name, vector<double> & times)
+{
+  if (times.empty())
+    return;
+
+  sort(times.begin(), times.end());
+  double sum = 0.0;
+  for (auto const time : times)
+    sum += time;
+
+  cout << name << ": count " << times.size() << ", mean " << sum / times.size() << " ms, p50 "
+       << Percentile(times, 0.5) << " ms, p95 " << Percentile(times, 0.95) << " ms, p99 "
+       << Percentile(times, 0.99) << " ms, max " << times.back() << " ms" << endl;
+}
+
+int main(int argc, char * argv[])
+{
+  ChangeMaxNumberOfOpenFiles(kMaxOpenFiles);
+
+  ios_base::sync_with_stdio(false);
+  Platform & platform = GetPlatform();
+
+  google::SetUsageMessage("Search latency benchmark. Replays recorded queries keystroke by "
+                          "keystroke and reports per-keystroke latency percentiles and "
+                          "time-to-first-result.");
+  google::ParseCommandLineFlags(&argc, &argv, true);
+
+  string countriesFile = COUNTRIES_FILE;
+  if (!FLAGS_data_path.empty())
+  {
+    platform.SetResourceDir(FLAGS_data_path);
+    countriesFile = base::JoinFoldersToPath(FLAGS_data_path, COUNTRIES_FILE);
+  }
+
+  if (!FLAGS_mwm_path.empty())
+    platform.SetWritableDirForTests(FLAGS_mwm_path);
+
+  CHECK(!FLAGS_queries_path.empty(), ("Path to the queries file is required."));
+
+  Storage storage(countriesFile);
+  storage.Init(&DidDownload, &WillDelete);
+  auto infoGetter = CountryInfoReader::CreateCountryInfoReader(platform);
+  infoGetter->InitAffiliationsInfo(&storage.GetAffiliations());
+
+  classificator::Load();
+
+  Engine::Params params;
+  params.m_locale = FLAGS_locale;
+  params.m_numThreads = FLAGS_num_threads;
+
+  FrozenDataSource dataSource;
+
+  vector<platform::LocalCountryFile> mwms;
+  if (!FLAGS_mwm_list_path.empty())
+  {
+    vector<string> availableMwms;
+    ReadStringsFromFile(FLAGS_mwm_list_path, availableMwms);
+    for (auto const & countryName : availableMwms)
+      mwms.emplace_back(platform.WritableDir(), platform::CountryFile(countryName), 0);
+  }
+  else
+  {
+    platform::FindAllLocalMapsAndCleanup(numeric_limits<int64_t>::max() /* the latest version */,
+                                         mwms);
+  }
+  cout << "Mwms used in all search invocations:" << endl;
+  for (auto & mwm : mwms)
+  {
+    mwm.SyncWithDisk();
+    cout << mwm.GetCountryName() << endl;
+    dataSource.RegisterMap(mwm);
+  }
+  cout << endl;
+
+  TestSearchEngine engine(dataSource, move(infoGetter), params);
+
+  m2::RectD viewport;
+  {
+    string name = FLAGS_viewport;
+    auto it = kViewports.find(name);
+    if (it == kViewports.end())
+    {
+      name = "default";
+      it = kViewports.find(name);
+    }
+    CHECK(it != kViewports.end(), ());
+    viewport = it->second;
+    cout << "Viewport used in all search invocations: " << name << " " << DebugPrint(viewport)
+         << endl
+         << endl;
+  }
+
+  vector<string> queries;
+  ReadStringsFromFile(FLAGS_queries_path, queries);
+
+  // Keystrokes are replayed sequentially: every request is completed before
+  // the next one starts. Real input cancels unfinished searches, but waiting
+  // keeps timings independent of the cancellation moment and reproducible.
+  vector<double> keystrokeTimes;
+  vector<double> firstResultTimes;
+  for (auto const & query : queries)
+  {
+    for (auto const & keystroke : MakeKeystrokes(query))
+    {
+      KeystrokeRequest request(engine, keystroke, FLAGS_locale, viewport);
+      request.Run();
+
+      auto const responseMs = ToMilliseconds(request.ResponseTime());
+      auto const firstResultMs = ToMilliseconds(request.TimeToFirstResult());
+      keystrokeTimes.push_back(responseMs);
+      firstResultTimes.push_back(firstResultMs);
+
+      if (FLAGS_verbose)
+      {
+        cout << "\"" << keystroke << "\": " << responseMs << " ms, first result after "
+             << firstResultMs << " ms, " << request.Results().size() << " result(s)" << endl;
+      }
+    }
+  }
+
+  cout << endl << "Replayed " << queries.size() << " queries." << endl;
+  PrintStatistics("Keystroke response time", keystrokeTimes);
+  PrintStatistics("Time to first result", firstResultTimes);
+  return 0;
+}
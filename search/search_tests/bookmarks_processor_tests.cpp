@@ -27,6 +27,8 @@ public:
 
   void Add(Id const & id, Doc const & doc) { m_processor.Add(id, doc); }
 
+  void Update(Id const & id, Doc const & doc) { m_processor.Update(id, doc); }
+
   void Erase(Id const & id) { m_processor.Erase(id); }
 
   Ids Search(string const & query)
@@ -77,4 +79,24 @@ UNIT_CLASS_TEST(BookmarksProcessorTest, Smoke)
   TEST_EQUAL(Search("double r cafe"), Ids({10}), ());
   TEST_EQUAL(Search("dine"), Ids({10}), ());
 }
+
+UNIT_CLASS_TEST(BookmarksProcessorTest, UpdateDocument)
+{
+  Add(10, {"Double R Diner" /* name */, "Best coffee in town" /* description */});
+
+  TEST_EQUAL(Search("diner"), Ids({10}), ());
+  TEST_EQUAL(Search("bakery"), Ids{}, ());
+
+  // An update that keeps the name and the description should not change
+  // the search results.
+  Update(10, {"Double R Diner", "Best coffee in town"});
+  TEST_EQUAL(Search("diner"), Ids({10}), ());
+
+  Update(10, {"Norma's Bakery", "Best coffee in town"});
+  TEST_EQUAL(Search("diner"), Ids{}, ());
+  TEST_EQUAL(Search("bakery"), Ids({10}), ());
+
+  Erase(10);
+  TEST_EQUAL(Search("bakery"), Ids{}, ());
+}
 }  // namespace
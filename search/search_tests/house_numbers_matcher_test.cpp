@@ -21,7 +21,7 @@ bool HouseNumbersMatch(string const & houseNumber, string const & query, bool qu
 bool CheckTokenizer(string const & utf8s, vector<string> const & expected)
 {
   UniString utf32s = MakeUniString(utf8s);
-  vector<Token> tokens;
+  Tokens tokens;
   Tokenize(utf32s, false /* isPrefix */, tokens);
 
   vector<string> actual;
@@ -37,7 +37,7 @@ bool CheckTokenizer(string const & utf8s, vector<string> const & expected)
 
 bool CheckParser(string const & utf8s, string const & expected)
 {
-  vector<vector<Token>> parses;
+  vector<Tokens> parses;
   ParseHouseNumber(MakeUniString(utf8s), parses);
 
   if (parses.size() != 1)
@@ -3,7 +3,6 @@
 #include "search/interval_set.hpp"
 
 #include <initializer_list>
-#include <set>
 #include <vector>
 
 using namespace base;
@@ -16,7 +15,7 @@ using Interval = typename search::IntervalSet<Elem>::Interval;
 template <typename Elem>
 void CheckSet(search::IntervalSet<Elem> const & actual, std::initializer_list<Interval<Elem>> intervals)
 {
-  std::set<Interval<Elem>> expected(intervals);
+  std::vector<Interval<Elem>> expected(intervals);
   TEST_EQUAL(actual.Elems(), expected, ());
 }
 }  // namespace
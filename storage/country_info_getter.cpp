@@ -16,8 +16,10 @@
 
 #include "3party/Alohalytics/src/alohalytics.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
+#include <numeric>
 
 namespace storage
 {
@@ -25,9 +27,23 @@ namespace
 {
 size_t const kInvalidId = std::numeric_limits<size_t>::max();
 
+// Lookup rect for a point query of the rect index. The index intersection
+// test is strict, so a degenerate rect could miss regions whose boundary
+// passes exactly through the point.
+m2::RectD PointLookupRect(m2::PointD const & pt)
+{
+  double const kEps = 1.0E-6;
+  m2::RectD rect(pt, pt);
+  rect.Inflate(kEps, kEps);
+  return rect;
+}
+
 struct DoFreeCacheMemory
 {
-  void operator()(std::vector<m2::RegionD> & v) const { std::vector<m2::RegionD>().swap(v); }
+  void operator()(std::vector<m2::IndexedRegionD> & v) const
+  {
+    std::vector<m2::IndexedRegionD>().swap(v);
+  }
 };
 
 class DoCalcUSA
@@ -57,6 +73,29 @@ TCountryId CountryInfoGetterBase::GetRegionCountryId(m2::PointD const & pt) cons
   return id != kInvalidId ? m_countries[id].m_countryId : kInvalidCountryId;
 }
 
+void CountryInfoGetterBase::GetRegionCountryIds(std::vector<m2::PointD> const & points,
+                                                TCountriesVec & countries) const
+{
+  countries.clear();
+  countries.reserve(points.size());
+
+  TRegionId lastId = kInvalidId;
+  for (auto const & pt : points)
+  {
+    // Consecutive points almost always hit the same region.
+    if (lastId != kInvalidId && m_countries[lastId].m_rect.IsPointInside(pt) &&
+        IsBelongToRegionImpl(lastId, pt))
+    {
+      countries.push_back(m_countries[lastId].m_countryId);
+      continue;
+    }
+
+    lastId = FindFirstCountry(pt);
+    countries.push_back(lastId != kInvalidId ? m_countries[lastId].m_countryId
+                                             : kInvalidCountryId);
+  }
+}
+
 bool CountryInfoGetterBase::IsBelongToRegions(m2::PointD const & pt,
                                               TRegionIdSet const & regions) const
 {
@@ -88,7 +127,9 @@ void CountryInfoGetterBase::RegionIdsToCountryIds(TRegionIdSet const & regions,
 
 CountryInfoGetterBase::TRegionId CountryInfoGetterBase::FindFirstCountry(m2::PointD const & pt) const
 {
-  for (size_t id = 0; id < m_countries.size(); ++id)
+  TRegionIdSet candidates;
+  GetCandidateRegions(PointLookupRect(pt), candidates);
+  for (auto const id : candidates)
   {
     if (m_countries[id].m_rect.IsPointInside(pt) && IsBelongToRegionImpl(id, pt))
       return id;
@@ -97,6 +138,33 @@ CountryInfoGetterBase::TRegionId CountryInfoGetterBase::FindFirstCountry(m2::Poi
   return kInvalidId;
 }
 
+void CountryInfoGetterBase::BuildRectIndex()
+{
+  m_rectIndex.Clear();
+  for (TRegionId id = 0; id < m_countries.size(); ++id)
+    m_rectIndex.Add(id, m_countries[id].m_rect);
+  m_rectIndex.Build();
+}
+
+void CountryInfoGetterBase::GetCandidateRegions(m2::RectD const & rect,
+                                                TRegionIdSet & regions) const
+{
+  regions.clear();
+  if (m_rectIndex.IsEmpty())
+  {
+    // The index is not built; enumerate all regions to keep the linear scan
+    // semantics.
+    regions.resize(m_countries.size());
+    std::iota(regions.begin(), regions.end(), 0);
+    return;
+  }
+
+  m_rectIndex.ForEachInRect(rect, [&regions](TRegionId id) { regions.push_back(id); });
+  // The tree enumerates values in its own order while the callers rely on
+  // the first matching region by index.
+  std::sort(regions.begin(), regions.end());
+}
+
 // CountryInfoGetter -------------------------------------------------------------------------------
 vector<TCountryId> CountryInfoGetter::GetRegionsCountryIdByRect(m2::RectD const & rect, bool rough) const
 {
@@ -104,7 +172,9 @@ vector<TCountryId> CountryInfoGetter::GetRegionsCountryIdByRect(m2::RectD const
 
   std::vector<TCountryId> result;
   result.reserve(kAverageSize);
-  for (size_t id = 0; id < m_countries.size(); ++id)
+  TRegionIdSet candidates;
+  GetCandidateRegions(rect, candidates);
+  for (auto const id : candidates)
   {
     if (rect.IsRectInside(m_countries[id].m_rect))
     {
@@ -127,7 +197,9 @@ void CountryInfoGetter::GetRegionsCountryId(m2::PointD const & pt, TCountriesVec
 
   m2::RectD const lookupRect = MercatorBounds::RectByCenterXYAndSizeInMeters(pt, kLookupRadiusM);
 
-  for (size_t id = 0; id < m_countries.size(); ++id)
+  TRegionIdSet candidates;
+  GetCandidateRegions(lookupRect, candidates);
+  for (auto const id : candidates)
   {
     if (m_countries[id].m_rect.IsIntersect(lookupRect) && IsCloseEnough(id, pt, kLookupRadiusM))
       closestCoutryIds.emplace_back(m_countries[id].m_countryId);
@@ -252,6 +324,8 @@ CountryInfoReader::CountryInfoReader(ModelReaderPtr polyR, ModelReaderPtr countr
   for (size_t i = 0; i < countrySz; ++i)
     m_countryIndex[m_countries[i].m_countryId] = i;
 
+  BuildRectIndex();
+
   string buffer;
   countryR.ReadAsString(buffer);
   LoadCountryFile2CountryInfo(buffer, m_id2info, m_isSingleMwm);
@@ -266,12 +340,12 @@ void CountryInfoReader::ClearCachesImpl() const
 }
 
 template <typename TFn>
-std::result_of_t<TFn(vector<m2::RegionD>)> CountryInfoReader::WithRegion(size_t id, TFn && fn) const
+std::result_of_t<TFn(vector<m2::IndexedRegionD>)> CountryInfoReader::WithRegion(size_t id, TFn && fn) const
 {
   std::lock_guard<std::mutex> lock(m_cacheMutex);
 
   bool isFound = false;
-  std::vector<m2::RegionD> & rgns = m_cache.Find(static_cast<uint32_t>(id), isFound);
+  std::vector<m2::IndexedRegionD> & rgns = m_cache.Find(static_cast<uint32_t>(id), isFound);
 
   if (!isFound)
   {
@@ -294,7 +368,7 @@ std::result_of_t<TFn(vector<m2::RegionD>)> CountryInfoReader::WithRegion(size_t
 
 bool CountryInfoReader::IsBelongToRegionImpl(size_t id, m2::PointD const & pt) const
 {
-  auto contains = [&pt](std::vector<m2::RegionD> const & regions) {
+  auto contains = [&pt](std::vector<m2::IndexedRegionD> const & regions) {
     for (auto const & region : regions)
     {
       if (region.Contains(pt))
@@ -312,7 +386,7 @@ bool CountryInfoReader::IsIntersectedByRegionImpl(size_t id, m2::RectD const & r
                                                      {rect.RightTop(), rect.RightBottom()},
                                                      {rect.RightBottom(), rect.LeftBottom()},
                                                      {rect.LeftBottom(), rect.LeftTop()}};
-  auto contains = [&edges](std::vector<m2::RegionD> const & regions) {
+  auto contains = [&edges](std::vector<m2::IndexedRegionD> const & regions) {
     for (auto const & region : regions)
     {
       for (auto const & edge : edges)
@@ -334,7 +408,7 @@ bool CountryInfoReader::IsIntersectedByRegionImpl(size_t id, m2::RectD const & r
 bool CountryInfoReader::IsCloseEnough(size_t id, m2::PointD const & pt, double distance)
 {
   m2::RectD const lookupRect = MercatorBounds::RectByCenterXYAndSizeInMeters(pt, distance);
-  auto isCloseEnough = [&](std::vector<m2::RegionD> const & regions) {
+  auto isCloseEnough = [&](std::vector<m2::IndexedRegionD> const & regions) {
     for (auto const & region : regions)
     {
       if (region.Contains(pt) || region.AtBorder(pt, lookupRect.SizeX() / 2))
@@ -356,6 +430,9 @@ CountryInfoGetterForTesting::CountryInfoGetterForTesting(std::vector<CountryDef>
 
 void CountryInfoGetterForTesting::AddCountry(CountryDef const & country)
 {
+  m_rectIndex.Add(m_countries.size(), country.m_rect);
+  // Test-only path with a handful of countries - rebuilding per Add is fine.
+  m_rectIndex.Build();
   m_countries.push_back(country);
   string const & name = country.m_countryId;
   m_id2info[name].m_name = name;
@@ -6,6 +6,7 @@
 #include "platform/platform.hpp"
 
 #include "geometry/region2d.hpp"
+#include "geometry/tree4d.hpp"
 
 #include "coding/file_container.hpp"
 
@@ -36,6 +37,12 @@ public:
   // string.
   TCountryId GetRegionCountryId(m2::PointD const & pt) const;
 
+  // Batch version of GetRegionCountryId. |countries| is aligned with
+  // |points|; a point outside of all regions gets kInvalidCountryId.
+  // Consecutive points almost always belong to the same region, so the
+  // previous match is probed before a full lookup.
+  void GetRegionCountryIds(std::vector<m2::PointD> const & points, TCountriesVec & countries) const;
+
   // Returns true when |pt| belongs to at least one of the specified
   // |regions|.
   bool IsBelongToRegions(m2::PointD const & pt, TRegionIdSet const & regions) const;
@@ -52,8 +59,21 @@ protected:
   // Returns true when |pt| belongs to a country identified by |id|.
   virtual bool IsBelongToRegionImpl(size_t id, m2::PointD const & pt) const = 0;
 
+  // Builds the rect index over m_countries. Should be called once the
+  // countries list is filled.
+  void BuildRectIndex();
+
+  // Fills |regions| with identifiers of regions whose bounding rects
+  // intersect |rect|, in ascending order. Enumerates all regions when the
+  // index is not built.
+  void GetCandidateRegions(m2::RectD const & rect, TRegionIdSet & regions) const;
+
   // List of all known countries.
   std::vector<CountryDef> m_countries;
+  // Index over bounding rects of m_countries, to avoid linear scans on
+  // every point or rect query. The set of countries is fixed after
+  // loading, so the bulk-loaded flat layout fits here.
+  m4::StaticTree<TRegionId> m_rectIndex;
   // m_isSingleMwm == true if the system is currently working with single (small) mwms
   // and false otherwise.
   // @TODO(bykoianko) Init m_isSingleMwm correctly.
@@ -154,10 +174,13 @@ protected:
   bool IsCloseEnough(size_t id, m2::PointD const & pt, double distance) override;
 
   template <typename TFn>
-  std::result_of_t<TFn(vector<m2::RegionD>)> WithRegion(size_t id, TFn && fn) const;
+  std::result_of_t<TFn(vector<m2::IndexedRegionD>)> WithRegion(size_t id, TFn && fn) const;
 
   FilesContainerR m_reader;
-  mutable base::Cache<uint32_t, std::vector<m2::RegionD>> m_cache;
+  // Regions are cached together with their strip indices: point-in-region
+  // checks are hot in both search and storage, and thousand-vertex border
+  // polygons are too slow to scan per query point.
+  mutable base::Cache<uint32_t, std::vector<m2::IndexedRegionD>> m_cache;
   mutable std::mutex m_cacheMutex;
 };
 
@@ -8,6 +8,7 @@
 #include "coding/internal/file_data.hpp"
 
 #include "base/assert.hpp"
+#include "base/logging.hpp"
 
 namespace storage
 {
@@ -73,8 +74,25 @@ void Manager::ApplyDiff(ApplyDiffParams && p, std::function<void(bool const resu
       string const oldMwmPath = p.m_oldMwmFile->GetPath(MapOptions::Map);
       string const newMwmPath = diffFile->GetPath(MapOptions::Map);
       string const diffApplyingInProgressPath = newMwmPath + DIFF_APPLYING_FILE_EXTENSION;
-      result = generator::mwm_diff::ApplyDiff(oldMwmPath, diffApplyingInProgressPath, diffPath) &&
-              base::RenameFileX(diffApplyingInProgressPath, newMwmPath);
+
+      auto const countryName = diffFile->GetCountryName();
+      int lastLoggedPercent = -1;
+      auto const progress = [&countryName, &lastLoggedPercent](uint64_t written, uint64_t total)
+      {
+        if (total == 0)
+          return;
+        int const percent = static_cast<int>(written * 100 / total);
+        if (percent / 10 != lastLoggedPercent / 10)
+        {
+          lastLoggedPercent = percent;
+          LOG(LINFO, ("Applying diff for", countryName, ":", percent, "%"));
+        }
+      };
+
+      result =
+          generator::mwm_diff::ApplyDiff(oldMwmPath, diffApplyingInProgressPath, diffPath,
+                                         progress) &&
+          base::RenameFileX(diffApplyingInProgressPath, newMwmPath);
     }
 
     diffFile->DeleteFromDisk(MapOptions::Diff);
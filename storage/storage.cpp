@@ -226,6 +226,7 @@ void Storage::Clear()
   m_downloader->Reset();
   m_queue.clear();
   m_justDownloaded.clear();
+  ResetProgressCache();
   m_failedCountries.clear();
   m_localFiles.clear();
   m_localFilesForFakeCountries.clear();
@@ -523,6 +524,7 @@ void Storage::DownloadCountry(TCountryId const & countryId, MapOptions opt)
 
   m_failedCountries.erase(countryId);
   m_queue.push_back(QueuedCountry(countryId, opt));
+  ResetProgressCache();
   if (m_queue.size() == 1)
   {
     if (m_startDownloadingCallback)
@@ -796,17 +798,33 @@ void Storage::ReportProgressForHierarchy(TCountryId const & countryId,
   ReportProgress(countryId, leafProgress);
 
   // Reporting progress for the parents of the leaf with |countryId|.
+  if (m_ancestorsProgressCacheKey != countryId)
+  {
+    m_ancestorsProgressCache.clear();
+    m_ancestorsProgressCacheKey = countryId;
+  }
+
   TCountriesSet setQueue;
   GetQueuedCountries(m_queue, setQueue);
 
   auto calcProgress = [&](TCountryId const & parentId, TCountryTreeNode const & parentNode) {
-    TCountriesVec descendants;
-    parentNode.ForEachDescendant([&descendants](TCountryTreeNode const & container) {
-      descendants.push_back(container.Value().Name());
-    });
+    auto it = m_ancestorsProgressCache.find(parentId);
+    if (it == m_ancestorsProgressCache.end())
+    {
+      TCountriesVec descendants;
+      parentNode.ForEachDescendant([&descendants](TCountryTreeNode const & container) {
+        descendants.push_back(container.Value().Name());
+      });
 
-    MapFilesDownloader::TProgress localAndRemoteBytes =
-        CalculateProgress(countryId, descendants, leafProgress, setQueue);
+      // Zero leaf progress is passed so that the cached sums account for the
+      // total size of the downloading mwm but not for its downloaded bytes.
+      auto const sums = CalculateProgress(countryId, descendants,
+                                          make_pair(0, 0) /* downloadingMwmProgress */, setQueue);
+      it = m_ancestorsProgressCache.emplace(parentId, sums).first;
+    }
+
+    MapFilesDownloader::TProgress localAndRemoteBytes = it->second;
+    localAndRemoteBytes.first += leafProgress.first;
     ReportProgress(parentId, localAndRemoteBytes);
   };
 
@@ -1183,6 +1201,7 @@ void Storage::RegisterCountryFiles(TLocalFilePtr localFile)
     else
       m_localFiles[countryId].push_front(localFile);
   }
+  ResetProgressCache();
 }
 
 void Storage::RegisterCountryFiles(TCountryId const & countryId, string const & directory,
@@ -1217,6 +1236,7 @@ void Storage::DeleteCountryFiles(TCountryId const & countryId, MapOptions opt, b
   if (deferredDelete)
   {
     m_localFiles.erase(countryId);
+    ResetProgressCache();
     return;
   }
 
@@ -1232,6 +1252,7 @@ void Storage::DeleteCountryFiles(TCountryId const & countryId, MapOptions opt, b
   localFiles.remove_if(isNull);
   if (localFiles.empty())
     m_localFiles.erase(countryId);
+  ResetProgressCache();
 }
 
 bool Storage::DeleteCountryFilesFromDownloader(TCountryId const & countryId)
@@ -1897,15 +1918,23 @@ bool Storage::GetUpdateInfo(TCountryId const & countryId, UpdateInfo & updateInf
   return true;
 }
 
+void Storage::ResetProgressCache()
+{
+  m_ancestorsProgressCache.clear();
+  m_ancestorsProgressCacheKey = kInvalidCountryId;
+}
+
 void Storage::PushToJustDownloaded(TQueue::iterator justDownloadedItem)
 {
   m_justDownloaded.insert(justDownloadedItem->GetCountryId());
+  ResetProgressCache();
 }
 
 void Storage::PopFromQueue(TQueue::iterator it)
 {
   CHECK(!m_queue.empty(), ());
   m_queue.erase(it);
+  ResetProgressCache();
   if (m_queue.empty())
     m_justDownloaded.clear();
 }
@@ -176,6 +176,16 @@ private:
   /// mwm group.
   TCountriesSet m_justDownloaded;
 
+  /// Progress ticks of a downloading mwm come often and recalculating
+  /// progress of every its ancestor requires a walk over the whole subtree
+  /// of each of them. Between two ticks the only value which changes is the
+  /// number of downloaded bytes of the leaf, so the sums over the rest of
+  /// the descendants are cached here (per ancestor, for the leaf
+  /// |m_ancestorsProgressCacheKey|) and dropped by ResetProgressCache()
+  /// whenever |m_queue|, |m_justDownloaded| or |m_localFiles| is changed.
+  map<TCountryId, MapFilesDownloader::TProgress> m_ancestorsProgressCache;
+  TCountryId m_ancestorsProgressCacheKey = kInvalidCountryId;
+
   /// stores countries whose download has failed recently
   TCountriesSet m_failedCountries;
 
@@ -661,6 +671,10 @@ private:
                                                   MapFilesDownloader::TProgress const & downloadingMwmProgress,
                                                   TCountriesSet const & mwmsInQueue) const;
 
+  /// Drops |m_ancestorsProgressCache|. Must be called on every change of
+  /// |m_queue|, |m_justDownloaded| or |m_localFiles|.
+  void ResetProgressCache();
+
   void PushToJustDownloaded(TQueue::iterator justDownloadedItem);
   void PopFromQueue(TQueue::iterator it);
   template <class ToDo>
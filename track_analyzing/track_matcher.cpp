@@ -86,8 +86,7 @@ void TrackMatcher::MatchTrack(vector<DataPoint> const & track, vector<MatchedTra
   {
     for (; trackBegin < steps.size(); ++trackBegin)
     {
-      steps[trackBegin].FillCandidatesWithNearbySegments(m_dataSource, *m_graph, *m_vehicleModel,
-                                                         m_mwmId);
+      steps[trackBegin].FillCandidatesWithNearbySegments(m_dataSource, *m_graph, m_mwmId);
       if (steps[trackBegin].HasCandidates())
         break;
 
@@ -132,39 +131,37 @@ TrackMatcher::Step::Step(DataPoint const & dataPoint)
 {
 }
 
-void TrackMatcher::Step::FillCandidatesWithNearbySegments(
-    DataSource const & dataSource, IndexGraph const & graph,
-    VehicleModelInterface const & vehicleModel, NumMwmId mwmId)
+void TrackMatcher::Step::FillCandidatesWithNearbySegments(DataSource const & dataSource,
+                                                          IndexGraph & graph, NumMwmId mwmId)
 {
-  dataSource.ForEachInRect(
-      [&](FeatureType & ft) {
-        if (!ft.GetID().IsValid())
+  dataSource.ForEachFeatureIDInRect(
+      [&](FeatureID const & fid) {
+        if (!fid.IsValid())
           return;
 
-        if (ft.GetID().m_mwmId.GetInfo()->GetType() != MwmInfo::COUNTRY)
+        if (fid.m_mwmId.GetInfo()->GetType() != MwmInfo::COUNTRY)
           return;
 
-        if (!vehicleModel.IsRoad(ft))
+        // The geometry cache of the graph parses a road once and serves the
+        // following queries from memory. Rects of consecutive track points
+        // mostly cover the same features, so taking roads from the cache
+        // instead of re-reading them from the mwm is what makes scanning
+        // a long track feasible.
+        auto const & road = graph.GetGeometry().GetRoad(fid.m_index);
+        if (!road.IsValid())
           return;
 
-        ft.ParseGeometry(FeatureType::BEST_GEOMETRY);
-
-        for (size_t segIdx = 0; segIdx + 1 < ft.GetPointsCount(); ++segIdx)
+        for (uint32_t segIdx = 0; segIdx + 1 < road.GetPointsCount(); ++segIdx)
         {
           double const distance =
-              DistanceToSegment(ft.GetPoint(segIdx), ft.GetPoint(segIdx + 1), m_point);
+              DistanceToSegment(road.GetPoint(segIdx), road.GetPoint(segIdx + 1), m_point);
           if (distance < kMatchingRange)
           {
-            AddCandidate(Segment(mwmId, ft.GetID().m_index, static_cast<uint32_t>(segIdx),
-                                 true /* forward */),
-                         distance, graph);
-
-            if (!vehicleModel.IsOneWay(ft))
-            {
-              AddCandidate(Segment(mwmId, ft.GetID().m_index, static_cast<uint32_t>(segIdx),
-                                   false /* forward */),
-                           distance, graph);
-            }
+            AddCandidate(Segment(mwmId, fid.m_index, segIdx, true /* forward */), distance, graph);
+
+            if (!road.IsOneWay())
+              AddCandidate(Segment(mwmId, fid.m_index, segIdx, false /* forward */), distance,
+                           graph);
           }
         }
       },
@@ -58,9 +58,7 @@ private:
     routing::Segment const & GetSegment() const { return m_segment; }
     bool HasCandidates() const { return !m_candidates.empty(); }
     void FillCandidatesWithNearbySegments(DataSource const & dataSource,
-                                          routing::IndexGraph const & graph,
-                                          routing::VehicleModelInterface const & vehicleModel,
-                                          routing::NumMwmId mwmId);
+                                          routing::IndexGraph & graph, routing::NumMwmId mwmId);
     void FillCandidates(Step const & previousStep, routing::IndexGraph & graph);
     void ChooseSegment(Step const & nextStep, routing::IndexGraph & indexGraph);
     void ChooseNearestSegment();
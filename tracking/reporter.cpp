@@ -4,6 +4,8 @@
 #include "platform/platform.hpp"
 #include "platform/socket.hpp"
 
+#include "geometry/distance_on_sphere.hpp"
+
 #include "3party/Alohalytics/src/alohalytics.h"
 
 #include "base/logging.hpp"
@@ -19,6 +21,11 @@ double constexpr kRequiredHorizontalAccuracy = 10.0;
 double constexpr kMinDelaySeconds = 1.0;
 double constexpr kReconnectDelaySeconds = 40.0;
 double constexpr kNotChargingEventPeriod = 5 * 60.0;
+// A batch which covers less than this distance is considered stationary
+// and may wait for the next push period instead of waking the radio up.
+double constexpr kMinBatchMovementMeters = 10.0;
+// Maximum number of push periods a stationary batch may be held back for.
+size_t constexpr kMaxDeferredPushes = 4;
 
 static_assert(kMinDelaySeconds != 0, "");
 } // namespace
@@ -36,7 +43,9 @@ Reporter::Reporter(unique_ptr<platform::Socket> socket, string const & host, uin
   : m_allowSendingPoints(true)
   , m_realtimeSender(move(socket), host, port, false)
   , m_pushDelay(pushDelay)
-  , m_points(ceil(duration_cast<seconds>(pushDelay).count() + kReconnectDelaySeconds) / kMinDelaySeconds)
+  , m_points(ceil((duration_cast<seconds>(pushDelay).count() * (1 + kMaxDeferredPushes) +
+                   kReconnectDelaySeconds) /
+                  kMinDelaySeconds))
   , m_thread([this] { Run(); })
 {
 }
@@ -99,8 +108,13 @@ void Reporter::Run()
     {
       m_idleFn();
     }
+    else if (ShouldDeferSending())
+    {
+      ++m_deferredPushes;
+    }
     else
     {
+      m_deferredPushes = 0;
       if (SendPoints())
         m_points.clear();
     }
@@ -114,6 +128,25 @@ void Reporter::Run()
   LOG(LINFO, ("Tracking Reporter finished"));
 }
 
+bool Reporter::ShouldDeferSending() const
+{
+  if (m_points.empty() || m_deferredPushes >= kMaxDeferredPushes)
+    return false;
+
+  // Deferring must never cost points: the batch is sent while the buffer
+  // still has room for everything the next push period can collect.
+  auto const pointsPerPeriod =
+      static_cast<size_t>(duration_cast<seconds>(m_pushDelay).count() / kMinDelaySeconds);
+  if (m_points.size() + pointsPerPeriod > m_points.capacity())
+    return false;
+
+  // The distance between the ends of the batch is a cheap stationarity test.
+  // It understates the movement of a vehicle driving in a loop, but such
+  // a batch is sent no later than kMaxDeferredPushes periods anyway.
+  return ms::DistanceOnEarth(m_points.front().m_latLon, m_points.back().m_latLon) <
+         kMinBatchMovementMeters;
+}
+
 bool Reporter::SendPoints()
 {
   if (!m_allowSendingPoints)
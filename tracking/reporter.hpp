@@ -48,6 +48,8 @@ public:
 private:
   void Run();
   bool SendPoints();
+  // Returns true if the collected points may wait for the next push period.
+  bool ShouldDeferSending() const;
 
   atomic<bool> m_allowSendingPoints;
   Connection m_realtimeSender;
@@ -62,6 +64,8 @@ private:
   vector<DataPoint> m_input;
   // Last collected points, sends periodically to server.
   boost::circular_buffer<DataPoint> m_points;
+  // Number of push periods the current batch has been held back for.
+  size_t m_deferredPushes = 0;
   double m_lastGpsTime = 0.0;
   bool m_isFinished = false;
   mutex m_mutex;
@@ -141,6 +141,14 @@ TrafficInfo::TrafficInfo(MwmSet::MwmId const & mwmId, int64_t currentDataVersion
   }
 }
 
+TrafficInfo::TrafficInfo(MwmSet::MwmId const & mwmId, int64_t currentDataVersion,
+                         vector<RoadSegmentId> && keys)
+  : m_keys(move(keys))
+  , m_mwmId(mwmId)
+  , m_currentDataVersion(currentDataVersion)
+{
+}
+
 // static
 TrafficInfo TrafficInfo::BuildForTesting(Coloring && coloring)
 {
@@ -80,6 +80,15 @@ public:
 
   TrafficInfo(MwmSet::MwmId const & mwmId, int64_t currentDataVersion);
 
+  // Takes the keys decoded earlier instead of re-reading them from the
+  // mwm section. The keys do not change during an mwm's lifetime, so a
+  // caller polling for updates may keep them between the requests.
+  TrafficInfo(MwmSet::MwmId const & mwmId, int64_t currentDataVersion,
+              vector<RoadSegmentId> && keys);
+
+  // Hands the keys back to the caller (see the constructor above).
+  vector<RoadSegmentId> TakeKeys() { return std::move(m_keys); }
+
   static TrafficInfo BuildForTesting(Coloring && coloring);
   void SetTrafficKeysForTesting(vector<RoadSegmentId> const & keys);
 
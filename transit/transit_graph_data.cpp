@@ -128,7 +128,12 @@ void ReadItems(uint32_t start, uint32_t end, string const & name, NonOwningReade
   CHECK_EQUAL(src.Pos(), start, ("Wrong", TRANSIT_FILE_TAG, "section format. Table name:", name));
   deserializer(items);
   CHECK_EQUAL(src.Pos(), end, ("Wrong", TRANSIT_FILE_TAG, "section format. Table name:", name));
+#ifdef DEBUG
+  // The tables are checked after sorting at generation stage, so in release
+  // there is no point in running three more passes over every table each time
+  // the transit section is loaded for routing.
   CheckValidSortedUnique(items, name);
+#endif
 }
 }  // namespace
 
@@ -93,6 +93,7 @@ template <typename UGCUpdate>
 ugc::Storage::SettingResult SetGenericUGCUpdate(UGCUpdate const & ugc,
                                                 FeatureType & featureType,
                                                 ugc::UpdateIndexes & indexes,
+                                                ugc::Storage::KeyToPosition & keyToPosition,
                                                 size_t & numberOfDeleted,
                                                 ugc::Version const version)
 {
@@ -106,14 +107,13 @@ ugc::Storage::SettingResult SetGenericUGCUpdate(UGCUpdate const & ugc,
   CHECK(optMatchingType, ());
   auto const & c = classif();
   auto const type = c.GetIndexForType(th.GetBestType());
-  for (auto & index : indexes)
+  ugc::Storage::UpdateKey const key(type, mercator);
+  auto const it = keyToPosition.find(key);
+  if (it != keyToPosition.end())
   {
-    if (type == index.m_type && mercator == index.m_mercator && !index.m_deleted)
-    {
-      index.m_deleted = true;
-      ++numberOfDeleted;
-      break;
-    }
+    indexes[it->second].m_deleted = true;
+    ++numberOfDeleted;
+    keyToPosition.erase(it);
   }
 
   ugc::UpdateIndex index;
@@ -144,6 +144,7 @@ ugc::Storage::SettingResult SetGenericUGCUpdate(UGCUpdate const & ugc,
   }
 
   indexes.emplace_back(move(index));
+  keyToPosition.emplace(key, indexes.size() - 1);
   return ugc::Storage::SettingResult::Success;
 }
 }  // namespace
@@ -162,16 +163,12 @@ UGCUpdate Storage::GetUGCUpdate(FeatureID const & id) const
   auto const & c = classif();
   auto const type = c.GetIndexForType(th.GetBestType());
 
-  auto const index = find_if(
-      m_indexes.begin(), m_indexes.end(), [type, &mercator](UpdateIndex const & index) -> bool {
-        return type == index.m_type && mercator == index.m_mercator && !index.m_deleted;
-      });
-
-  if (index == m_indexes.end())
+  auto const it = m_keyToPosition.find(UpdateKey(type, mercator));
+  if (it == m_keyToPosition.end())
     return {};
 
-  auto const offset = index->m_offset;
-  auto const size = static_cast<size_t>(UGCSizeAtIndex(distance(m_indexes.begin(), index)));
+  auto const offset = m_indexes[it->second].m_offset;
+  auto const size = static_cast<size_t>(UGCSizeAtIndex(it->second));
   vector<uint8_t> buf;
   buf.resize(size);
   auto const ugcFilePath = GetUGCFilePath();
@@ -196,7 +193,8 @@ UGCUpdate Storage::GetUGCUpdate(FeatureID const & id) const
 Storage::SettingResult Storage::SetUGCUpdate(FeatureID const & id, UGCUpdate const & ugc)
 {
   auto const feature = GetFeature(id);
-  return SetGenericUGCUpdate(ugc, *feature, m_indexes, m_numberOfDeleted, Version::V1);
+  return SetGenericUGCUpdate(ugc, *feature, m_indexes, m_keyToPosition, m_numberOfDeleted,
+                             Version::V1);
 }
 
 void Storage::Load()
@@ -243,6 +241,8 @@ void Storage::Load()
 
   if (version && *version != IndexVersion::Latest)
     Migrate(indexFilePath);
+
+  BuildKeyToPosition();
 }
 
 void Storage::Migrate(string const & indexFilePath)
@@ -364,6 +364,7 @@ void Storage::DefragmentationImpl(bool force)
   CHECK(base::RenameFileX(tmpUGCFilePath, ugcFilePath), ());
 
   m_numberOfDeleted = 0;
+  BuildKeyToPosition();
 }
 
 string Storage::GetUGCToSend() const
@@ -465,6 +466,19 @@ void Storage::MarkAllAsSynchronized()
   SaveIndex();
 }
 
+void Storage::BuildKeyToPosition()
+{
+  m_keyToPosition.clear();
+  for (size_t i = 0; i < m_indexes.size(); ++i)
+  {
+    auto const & index = m_indexes[i];
+    // In case of duplicates the first not deleted update wins,
+    // the same way as the linear lookup did.
+    if (!index.m_deleted)
+      m_keyToPosition.emplace(UpdateKey(index.m_type, index.m_mercator), i);
+  }
+}
+
 uint64_t Storage::UGCSizeAtIndex(size_t const indexPosition) const
 {
   CHECK(!m_indexes.empty(), ());
@@ -498,7 +512,8 @@ Storage::SettingResult Storage::SetUGCUpdateForTesting(FeatureID const & id,
                                                        v0::UGCUpdate const & ugc)
 {
   auto const feature = GetFeature(id);
-  return SetGenericUGCUpdate(ugc, *feature, m_indexes, m_numberOfDeleted, Version::V0);
+  return SetGenericUGCUpdate(ugc, *feature, m_indexes, m_keyToPosition, m_numberOfDeleted,
+                             Version::V0);
 }
 
 void Storage::LoadForTesting(std::string const & testIndexFilePath)
@@ -520,6 +535,8 @@ void Storage::LoadForTesting(std::string const & testIndexFilePath)
 
   if (m_indexes.front().m_version != IndexVersion::Latest)
     Migrate(testIndexFilePath);
+
+  BuildKeyToPosition();
 }
 }  // namespace ugc
 
@@ -2,10 +2,15 @@
 
 #include "ugc/types.hpp"
 
+#include "geometry/point2d.hpp"
+
 #include "base/thread_checker.hpp"
 
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
 class DataSource;
 class FeatureType;
@@ -41,14 +46,20 @@ public:
   SettingResult SetUGCUpdateForTesting(FeatureID const & id, v0::UGCUpdate const & ugc);
   void LoadForTesting(std::string const & testIndexFilePath);
 
+  // Maps (type, mercator) of a not deleted update to its position in m_indexes.
+  using UpdateKey = std::pair<uint32_t, m2::PointD>;
+  using KeyToPosition = std::map<UpdateKey, size_t>;
+
 private:
   void DefragmentationImpl(bool force);
   uint64_t UGCSizeAtIndex(size_t const indexPosition) const;
   std::unique_ptr<FeatureType> GetFeature(FeatureID const & id) const;
   void Migrate(std::string const & indexFilePath);
+  void BuildKeyToPosition();
 
   DataSource const & m_dataSource;
   UpdateIndexes m_indexes;
+  KeyToPosition m_keyToPosition;
   size_t m_numberOfDeleted = 0;
 };
 